@@ -33,18 +33,27 @@ public:
   {
     // NOTHING TO DO
   }
+  CircleExpContract(luci::Module *module, const std::string &filename,
+                    const std::string &weights_filename)
+      : _module(module), _filepath(filename), _weights_filepath(weights_filename)
+  {
+    // NOTHING TO DO
+  }
   virtual ~CircleExpContract() = default;
 
 public:
   loco::Graph *graph(void) const final { return nullptr; }
   luci::Module *module(void) const final { return _module; };
+  bool external_weights(void) const final { return !_weights_filepath.empty(); }
 
 public:
   bool store(const char *ptr, const size_t size) const final;
+  bool store_weights(const char *ptr, const size_t size) const final;
 
 private:
   luci::Module *_module;
   const std::string _filepath;
+  const std::string _weights_filepath;
 };
 
 #endif // __CIRCLE2CIRCLE_CIRCLEXPCONTRACT_H__
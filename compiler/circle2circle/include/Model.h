@@ -38,6 +38,21 @@ struct Model
  */
 std::unique_ptr<Model> load_model(const std::string &path);
 
+struct Weights
+{
+  virtual ~Weights() = default;
+
+  virtual const uint8_t *data(void) const = 0;
+  virtual size_t size(void) const = 0;
+};
+
+/**
+ * @brief Map external weights file from a given path
+ *
+ * @note May return a nullptr
+ */
+std::unique_ptr<Weights> load_weights(const std::string &path);
+
 } // namespace luci
 
 #endif // __CIRCLE2CIRCLE_MODEL_H__
@@ -28,6 +28,7 @@
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string>
 
 using OptionHook = std::function<int(const char **)>;
@@ -38,15 +39,28 @@ using AlgorithmParameters = luci::CircleOptimizer::Options::AlgorithmParameters;
 void print_help(const char *progname)
 {
   std::cerr << "USAGE: " << progname << " [options] input output" << std::endl;
+  std::cerr << "   --fold_constants : Enable FoldConstants Pass" << std::endl;
   std::cerr << "   --fuse_bcq : Enable FuseBCQ Pass" << std::endl;
   std::cerr << "   --fuse_instnorm : Enable FuseInstanceNormalization Pass" << std::endl;
+  std::cerr << "   --fuse_batchnorm_with_conv : Enable FuseBatchNormWithConv Pass" << std::endl;
+  std::cerr << "   --fuse_activation_function : Enable FuseActivationFunction Pass" << std::endl;
+  std::cerr << "   --fuse_pad_with_conv : Enable FusePadWithConv Pass" << std::endl;
   std::cerr << "   --resolve_customop_batchmatmul : Enable ResolveCustomOpBatchMatMulPass Pass"
             << std::endl;
   std::cerr << "   --quantize_with_minmax : Enable QuantizeWithMinMax Pass" << std::endl;
   std::cerr << "                            ";
   std::cerr << "Require two following parameters (input_dtype, output_dtype)" << std::endl;
   std::cerr << "                            ";
-  std::cerr << "Ex: --quantize_with_minmax float32 uint8" << std::endl;
+  std::cerr << "and optional granularity of weights (layer or channel)" << std::endl;
+  std::cerr << "                            ";
+  std::cerr << "uint8 output supports layer, and int8 output supports channel" << std::endl;
+  std::cerr << "                            ";
+  std::cerr << "Ex: --quantize_with_minmax float32 uint8 layer" << std::endl;
+  std::cerr << "                            ";
+  std::cerr << "Ex: --quantize_with_minmax float32 int8 channel" << std::endl;
+  std::cerr << "   --input_weights path : Read external weights of input from path" << std::endl;
+  std::cerr << "   --output_weights path : Write constants of output to external weights path"
+            << std::endl;
   std::cerr << std::endl;
 }
 
@@ -67,6 +81,10 @@ int entry(int argc, char **argv)
   auto options = optimizer.options();
 
   // TODO merge this with help message
+  argparse["--fold_constants"] = [&options](const char **) {
+    options->enable(Algorithms::FoldConstants);
+    return 0;
+  };
   argparse["--fuse_bcq"] = [&options](const char **) {
     options->enable(Algorithms::FuseBCQ);
     return 0;
@@ -75,6 +93,18 @@ int entry(int argc, char **argv)
     options->enable(Algorithms::FuseInstanceNorm);
     return 0;
   };
+  argparse["--fuse_batchnorm_with_conv"] = [&options](const char **) {
+    options->enable(Algorithms::FuseBatchNormWithConv);
+    return 0;
+  };
+  argparse["--fuse_activation_function"] = [&options](const char **) {
+    options->enable(Algorithms::FuseActivationFunction);
+    return 0;
+  };
+  argparse["--fuse_pad_with_conv"] = [&options](const char **) {
+    options->enable(Algorithms::FusePadWithConv);
+    return 0;
+  };
   argparse["--resolve_customop_batchmatmul"] = [&options](const char **) {
     options->enable(Algorithms::ResolveCustomOpBatchMatMul);
     return 0;
@@ -96,9 +126,45 @@ int entry(int argc, char **argv)
 
     options->param(AlgorithmParameters::QuantizeWithMinMax_input_dtype, input_dtype);
     options->param(AlgorithmParameters::QuantizeWithMinMax_output_dtype, output_dtype);
+
+    // Optional granularity of weights quantization
+    if (argv[2] != nullptr)
+    {
+      std::string granularity = argv[2];
+      if (granularity == "layer" || granularity == "channel")
+      {
+        // uint8 weights of per-channel zero points are not supported by the runtime
+        if (granularity == "channel" && output_dtype == "uint8")
+          throw std::runtime_error("--quantize_with_minmax: channel granularity is not supported "
+                                   "with uint8 output.");
+        // int8 weights are quantized symmetrically per channel
+        if (granularity == "layer" && output_dtype == "int8")
+          throw std::runtime_error("--quantize_with_minmax: layer granularity is not supported "
+                                   "with int8 output.");
+
+        options->param(AlgorithmParameters::QuantizeWithMinMax_granularity, granularity);
+        return 3;
+      }
+    }
     return 2;
   };
 
+  std::string input_weights_path;
+  std::string output_weights_path;
+
+  argparse["--input_weights"] = [&input_weights_path](const char **argv) {
+    if (argv[0] == nullptr)
+      throw std::runtime_error("--input_weights must have a following path.");
+    input_weights_path = argv[0];
+    return 1;
+  };
+  argparse["--output_weights"] = [&output_weights_path](const char **argv) {
+    if (argv[0] == nullptr)
+      throw std::runtime_error("--output_weights must have a following path.");
+    output_weights_path = argv[0];
+    return 1;
+  };
+
   for (int n = 1; n < argc - 2; ++n)
   {
     const std::string tag{argv[n]};
@@ -118,7 +184,7 @@ int entry(int argc, char **argv)
   std::string output_path = argv[argc - 1];
 
   // Load model from the file
-  std::unique_ptr<luci::Model> model = luci::load_model(input_path);
+  std::shared_ptr<luci::Model> model = luci::load_model(input_path);
   if (model == nullptr)
   {
     std::cerr << "ERROR: Failed to load '" << input_path << "'" << std::endl;
@@ -132,17 +198,43 @@ int entry(int argc, char **argv)
     return 255;
   }
 
+  std::shared_ptr<luci::Weights> input_weights;
+  if (!input_weights_path.empty())
+  {
+    input_weights = luci::load_weights(input_weights_path);
+    if (input_weights == nullptr)
+    {
+      std::cerr << "ERROR: Failed to load '" << input_weights_path << "'" << std::endl;
+      return 255;
+    }
+  }
+
+  // Constants of the module refer to the model and weights files, which are kept alive by storage
+  using Storage = std::pair<std::shared_ptr<luci::Model>, std::shared_ptr<luci::Weights>>;
+  auto storage = std::make_shared<Storage>(model, input_weights);
+
   // Import from input Circle file
   luci::Importer importer;
-  auto module = importer.importModule(input_model);
+  auto module = input_weights ? importer.importModule(input_model, storage, input_weights->data(),
+                                                      input_weights->size())
+                              : importer.importModule(input_model, storage);
 
   for (size_t idx = 0; idx < module->size(); ++idx)
   {
     auto graph = module->graph(idx);
 
+    const auto nodes_before = loco::active_nodes(loco::output_nodes(graph)).size();
+
     // call luci optimizations
     optimizer.optimize(graph);
 
+    if (options->query(Algorithms::FoldConstants))
+    {
+      const auto nodes_after = loco::active_nodes(loco::output_nodes(graph)).size();
+      std::cout << "Graph " << idx << ": " << nodes_before << " nodes -> " << nodes_after
+                << " nodes" << std::endl;
+    }
+
     if (!luci::validate(graph))
     {
       std::cerr << "ERROR: Optimized graph is invalid" << std::endl;
@@ -153,7 +245,7 @@ int entry(int argc, char **argv)
   // Export to output Circle file
   luci::CircleExporter exporter;
 
-  CircleExpContract contract(module.get(), output_path);
+  CircleExpContract contract(module.get(), output_path, output_weights_path);
 
   if (!exporter.invoke(&contract))
   {
@@ -31,3 +31,12 @@ bool CircleExpContract::store(const char *ptr, const size_t size) const
 
   return fs.good();
 }
+
+bool CircleExpContract::store_weights(const char *ptr, const size_t size) const
+{
+  std::ofstream fs(_weights_filepath.c_str(), std::ofstream::binary);
+  if (size > 0)
+    fs.write(ptr, size);
+
+  return fs.good();
+}
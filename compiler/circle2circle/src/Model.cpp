@@ -16,11 +16,10 @@
 
 #include "Model.h"
 
-#include <fstream>
-#include <vector>
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 namespace
@@ -30,6 +29,11 @@ class FileModel final : public luci::Model
 {
 public:
   explicit FileModel(const std::string &filename) : _filename(filename) {}
+  ~FileModel()
+  {
+    if (_size > 0)
+      munmap(_base, _size);
+  }
 
 public:
   FileModel(const FileModel &) = delete;
@@ -38,31 +42,60 @@ public:
 public:
   const ::circle::Model *model(void) override
   {
-    std::ifstream file(_filename, std::ios::binary | std::ios::in);
-    if (!file.good())
-      return nullptr;
-
-    file.unsetf(std::ios::skipws);
+    if (_base == nullptr)
+    {
+      // NOTE The file is mapped read-only so that constants can refer to it without copying
+      int fd = open(_filename.c_str(), O_RDONLY);
+      if (fd < 0)
+        return nullptr;
+
+      struct stat st;
+      if (fstat(fd, &st) != 0 || st.st_size == 0)
+      {
+        close(fd);
+        return nullptr;
+      }
+
+      const auto size = static_cast<size_t>(st.st_size);
+      void *base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (base == MAP_FAILED)
+        return nullptr;
+
+      _base = base;
+      _size = size;
+    }
+
+    return ::circle::GetModel(_base);
+  }
 
-    std::streampos fileSize;
-    file.seekg(0, std::ios::end);
-    fileSize = file.tellg();
-    file.seekg(0, std::ios::beg);
+private:
+  const std::string _filename;
+  void *_base = nullptr;
+  size_t _size = 0;
+};
 
-    // reserve capacity
-    _data.reserve(fileSize);
+class MappedWeights final : public luci::Weights
+{
+public:
+  MappedWeights(void *base, size_t size) : _base(base), _size(size) {}
+  ~MappedWeights()
+  {
+    if (_size > 0)
+      munmap(_base, _size);
+  }
 
-    // read the data
-    file.read(_data.data(), fileSize);
-    if (file.fail())
-      return nullptr;
+public:
+  MappedWeights(const MappedWeights &) = delete;
+  MappedWeights(MappedWeights &&) = delete;
 
-    return ::circle::GetModel(_data.data());
-  }
+public:
+  const uint8_t *data(void) const override { return reinterpret_cast<const uint8_t *>(_base); }
+  size_t size(void) const override { return _size; }
 
 private:
-  const std::string _filename;
-  std::vector<char> _data;
+  void *_base;
+  size_t _size;
 };
 
 } // namespace
@@ -75,4 +108,33 @@ std::unique_ptr<Model> load_model(const std::string &path)
   return std::unique_ptr<Model>{new FileModel(path)};
 }
 
+std::unique_ptr<Weights> load_weights(const std::string &path)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  const auto size = static_cast<size_t>(st.st_size);
+  void *base = nullptr;
+  if (size > 0)
+  {
+    base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (base == MAP_FAILED)
+    {
+      close(fd);
+      return nullptr;
+    }
+  }
+  close(fd);
+
+  return std::unique_ptr<Weights>{new MappedWeights(base, size)};
+}
+
 } // namespace luci
@@ -31,6 +31,16 @@ namespace luci_interpreter
 class TensorMap;
 class Kernel;
 
+class ExecutionObserver
+{
+public:
+  virtual ~ExecutionObserver();
+
+  // Called when the value of a tensor has been updated during execution.
+  // 'data' holds 'data_size' bytes of elements of type 'node->dtype()'.
+  virtual void postTensorWrite(const luci::CircleNode *node, const void *data, size_t data_size);
+};
+
 class Interpreter
 {
 public:
@@ -44,12 +54,17 @@ public:
 
   void interpret();
 
+  void attachObserver(ExecutionObserver *observer);
+
 private:
   void createTensors(const loco::Graph *graph);
   void createExecutionSequence(const loco::Graph *main_graph);
 
   std::unique_ptr<TensorMap> _tensor_map;
   std::vector<std::unique_ptr<Kernel>> _execution_sequence;
+  // Nodes whose outputs are computed by the kernels of '_execution_sequence', in the same order.
+  std::vector<const luci::CircleNode *> _execution_nodes;
+  std::vector<ExecutionObserver *> _observers;
 };
 
 } // namespace luci_interpreter
@@ -21,6 +21,7 @@
 
 #include <loco/IR/Algorithm.h>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace luci_interpreter
@@ -124,6 +125,7 @@ void Interpreter::createExecutionSequence(const loco::Graph *main_graph)
     }
 
     _execution_sequence.push_back(node->accept(&kernel_builder));
+    _execution_nodes.push_back(node);
   }
 }
 
@@ -158,6 +160,11 @@ void Interpreter::writeInputTensor(const luci::CircleInput *input_node, const vo
     throw std::runtime_error("Cannot find tensor for input node named \"" + name + "\".");
   }
   tensor->writeData(data, data_size);
+
+  for (ExecutionObserver *observer : _observers)
+  {
+    observer->postTensorWrite(input_node, data, data_size);
+  }
 }
 
 void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *data,
@@ -174,10 +181,37 @@ void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *
 
 void Interpreter::interpret()
 {
-  for (const auto &kernel : _execution_sequence)
+  assert(_execution_sequence.size() == _execution_nodes.size());
+  for (size_t i = 0; i < _execution_sequence.size(); ++i)
   {
-    kernel->execute();
+    _execution_sequence[i]->execute();
+
+    if (_observers.empty())
+      continue;
+
+    const luci::CircleNode *node = _execution_nodes[i];
+    const Tensor *tensor = _tensor_map->getTensor(node);
+    if (tensor == nullptr)
+      continue;
+
+    const size_t data_size =
+        tensor->shape().num_elements() * getDataTypeSize(tensor->element_type());
+    for (ExecutionObserver *observer : _observers)
+    {
+      observer->postTensorWrite(node, tensor->data<void>(), data_size);
+    }
   }
 }
 
+void Interpreter::attachObserver(ExecutionObserver *observer)
+{
+  if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
+    throw std::runtime_error("Observer is already attached.");
+  _observers.push_back(observer);
+}
+
+ExecutionObserver::~ExecutionObserver() = default;
+
+void ExecutionObserver::postTensorWrite(const luci::CircleNode *, const void *, size_t) {}
+
 } // namespace luci_interpreter
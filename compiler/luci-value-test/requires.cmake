@@ -2,4 +2,5 @@ require("luci")
 require("luci-interpreter")
 require("tflchef")
 require("tflite2circle")
+require("circle2circle")
 require("safemain")
@@ -22,6 +22,7 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <memory>
 #include <string>
 #include <random>
 
@@ -55,9 +56,10 @@ std::unique_ptr<luci::Module> importModel(const std::string &filename)
   {
     throw std::runtime_error("Cannot open model file \"" + filename + "\".\n");
   }
-  std::vector<char> model_data((std::istreambuf_iterator<char>(fs)),
-                               std::istreambuf_iterator<char>());
-  return luci::Importer().importModule(circle::GetModel(model_data.data()));
+  // NOTE model_data is kept alive by constants of the module that refer to it
+  auto model_data = std::make_shared<std::vector<char>>((std::istreambuf_iterator<char>(fs)),
+                                                        std::istreambuf_iterator<char>());
+  return luci::Importer().importModule(circle::GetModel(model_data->data()), model_data);
 }
 
 template <typename NodeT> size_t getTensorSize(const NodeT *node)
@@ -45,10 +45,18 @@ public:
     // TODO make this pure virtual
     virtual luci::Module *module(void) const;
 
+    // Store constant data in external weights file instead of the model
+    // Exporter calls store_weights with the contents of the file when this returns true
+    virtual bool external_weights(void) const { return false; }
+
   public: // Exporter -> Client
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+    // Exporter calls store_weights for external weights data
+    // Notice: Please DO NOT STORE ptr and size when implementing this in Client
+    virtual bool store_weights(const char *, const size_t) const { return false; }
   };
 
 public:
@@ -39,26 +39,38 @@ bool CircleExporter::invoke(Contract *contract) const
   auto module = contract->module();
   if (module != nullptr)
   {
-    CircleExporterImpl impl(module);
+    CircleExporterImpl impl(module, contract->external_weights());
 
     const char *ptr = impl.getBufferPointer();
     const size_t size = impl.getBufferSize();
 
     // we just send one time
-    return contract->store(ptr, size);
+    if (!contract->store(ptr, size))
+      return false;
+
+    if (contract->external_weights())
+      return contract->store_weights(impl.getWeightsPointer(), impl.getWeightsSize());
+
+    return true;
   }
 
   auto graph = contract->graph();
   if (graph == nullptr)
     return false;
 
-  CircleExporterImpl impl(graph);
+  CircleExporterImpl impl(graph, contract->external_weights());
 
   const char *ptr = impl.getBufferPointer();
   const size_t size = impl.getBufferSize();
 
   // we just send one time
-  return contract->store(ptr, size);
+  if (!contract->store(ptr, size))
+    return false;
+
+  if (contract->external_weights())
+    return contract->store_weights(impl.getWeightsPointer(), impl.getWeightsSize());
+
+  return true;
 }
 
 } // namespace luci
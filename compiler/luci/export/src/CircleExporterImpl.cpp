@@ -134,8 +134,17 @@ namespace luci
 using namespace circle;
 using namespace flatbuffers;
 
-CircleExporterImpl::CircleExporterImpl(loco::Graph *graph) { exportGraph(graph); }
-CircleExporterImpl::CircleExporterImpl(Module *module) { exportModule(module); }
+CircleExporterImpl::CircleExporterImpl(loco::Graph *graph, bool external_weights)
+    : _external_weights{external_weights}
+{
+  exportGraph(graph);
+}
+
+CircleExporterImpl::CircleExporterImpl(Module *module, bool external_weights)
+    : _external_weights{external_weights}
+{
+  exportModule(module);
+}
 
 ::flatbuffers::Offset<::circle::SubGraph>
 CircleExporterImpl::exportSubgraph(SerializedGraphData &gd)
@@ -163,6 +172,8 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   SerializedModelData md;
   SerializedGraphData gd;
 
+  md._external_weights = _external_weights;
+
   // This version is taken from comment in fbs
   constexpr uint32_t version = 0;
 
@@ -207,6 +218,8 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, metadata_buffer);
   FinishModelBuffer(_builder, model_offset);
+
+  _weights = std::move(md._weights);
 }
 
 void CircleExporterImpl::exportModule(Module *module)
@@ -216,6 +229,8 @@ void CircleExporterImpl::exportModule(Module *module)
 
   SerializedModelData md;
 
+  md._external_weights = _external_weights;
+
   _builder.Clear();
 
   // prepare model data
@@ -278,6 +293,8 @@ void CircleExporterImpl::exportModule(Module *module)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, metadata_buffer);
   FinishModelBuffer(_builder, model_offset);
+
+  _weights = std::move(md._weights);
 }
 
 const char *CircleExporterImpl::getBufferPointer() const
@@ -287,4 +304,11 @@ const char *CircleExporterImpl::getBufferPointer() const
 
 size_t CircleExporterImpl::getBufferSize() const { return _builder.GetSize(); }
 
+const char *CircleExporterImpl::getWeightsPointer() const
+{
+  return reinterpret_cast<const char *>(_weights.data());
+}
+
+size_t CircleExporterImpl::getWeightsSize() const { return _weights.size(); }
+
 } // namespace luci
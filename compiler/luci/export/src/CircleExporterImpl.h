@@ -40,8 +40,8 @@ public:
   CircleExporterImpl() = delete;
   ~CircleExporterImpl() = default;
 
-  explicit CircleExporterImpl(loco::Graph *graph);
-  explicit CircleExporterImpl(Module *module);
+  explicit CircleExporterImpl(loco::Graph *graph, bool external_weights = false);
+  explicit CircleExporterImpl(Module *module, bool external_weights = false);
 
   /**
    * @return pointer to buffer with serialized graph
@@ -53,6 +53,16 @@ public:
    */
   size_t getBufferSize() const;
 
+  /**
+   * @return pointer to external weights referenced by serialized graph
+   */
+  const char *getWeightsPointer() const;
+
+  /**
+   * @return size of external weights, 0 if constants are stored in the graph buffer
+   */
+  size_t getWeightsSize() const;
+
 private:
   /**
    * @brief create Subgraph using data stored in SerializedGraphData
@@ -75,6 +85,8 @@ private:
 
 private:
   flatbuffers::FlatBufferBuilder _builder;
+  bool _external_weights;
+  std::vector<uint8_t> _weights;
 };
 
 } // namespace luci
@@ -156,14 +156,33 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder)
 }
 
 template <typename NodeT>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, NodeT *)
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
+                                                   SerializedModelData &, NodeT *)
 {
   return CreateBuffer(builder);
 }
 
+// Each buffer in external weights file starts at this alignment
+constexpr size_t kWeightsAlignment = 64;
+
+flatbuffers::Offset<circle::Buffer> encodeExternalBuffer(FlatBufferBuilder &builder,
+                                                         SerializedModelData &md,
+                                                         const uint8_t *data, size_t size)
+{
+  auto &weights = md._weights;
+
+  const size_t offset =
+      (weights.size() + kWeightsAlignment - 1) / kWeightsAlignment * kWeightsAlignment;
+  weights.resize(offset, 0);
+  weights.insert(weights.end(), data, data + size);
+
+  return CreateBuffer(builder, 0, offset, size);
+}
+
 template <loco::DataType DT>
-flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
-                                                          luci::CircleConst *c)
+flatbuffers::Offset<circle::Buffer>
+encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md,
+                      const luci::CircleConst *c)
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
@@ -175,25 +194,31 @@ flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &bui
     raw_data.push_back(c->at<DT>(i));
   }
   const size_t raw_size = size * sizeof(NativeType);
+  if (md._external_weights && raw_size > 0)
+    return encodeExternalBuffer(builder, md, reinterpret_cast<uint8_t *>(raw_data.data()),
+                                raw_size);
   auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
   return CreateBuffer(builder, array_offset);
 }
 
 template <>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, luci::CircleConst *c)
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
+                                                   SerializedModelData &md, luci::CircleConst *c)
 {
   switch (c->dtype())
   {
     case loco::DataType::FLOAT32:
-      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, md, c);
     case loco::DataType::S32:
-      return encodeOpBufferByDType<loco::DataType::S32>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::S32>(builder, md, c);
     case loco::DataType::S64:
-      return encodeOpBufferByDType<loco::DataType::S64>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::S64>(builder, md, c);
     case loco::DataType::U8:
-      return encodeOpBufferByDType<loco::DataType::U8>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::U8>(builder, md, c);
+    case loco::DataType::S8:
+      return encodeOpBufferByDType<loco::DataType::S8>(builder, md, c);
     case loco::DataType::BOOL:
-      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, md, c);
     default:
       break;
   }
@@ -221,7 +246,9 @@ encodeQuantizationParameters(FlatBufferBuilder &builder, luci::CircleQuantParam
     scale = builder.CreateVector(quantparam->scale);
     zero_point = builder.CreateVector(quantparam->zerop);
   }
-  return circle::CreateQuantizationParameters(builder, min, max, scale, zero_point);
+  return circle::CreateQuantizationParameters(builder, min, max, scale, zero_point,
+                                             circle::QuantizationDetails_NONE, 0,
+                                             quantparam->quantized_dimension);
 }
 
 void exportOpDefinedTensor(const CircleTensoInfo &info, FlatBufferBuilder &builder,
@@ -233,8 +260,8 @@ void exportOpDefinedTensor(const CircleTensoInfo &info, FlatBufferBuilder &build
     shape_offset = encodeShape(builder, info.shape());
 
   // encode and register output tensor buffer
-  auto buffer =
-      info.content() == nullptr ? encodeOpBuffer(builder) : encodeOpBuffer(builder, info.content());
+  auto buffer = info.content() == nullptr ? encodeOpBuffer(builder)
+                                          : encodeOpBuffer(builder, md, info.content());
 
   auto quantparam = encodeQuantizationParameters(builder, info.quantparam());
 
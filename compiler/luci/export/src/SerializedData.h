@@ -73,6 +73,11 @@ struct SerializedModelData final
   std::unordered_map<OpCode, std::string> _custom_operator_codes;
   std::vector<flatbuffers::Offset<circle::Buffer>> _buffers;
 
+  /// @brief Store constant data to _weights instead of circle::Buffer when true
+  bool _external_weights = false;
+  /// @brief Contents of external weights file
+  std::vector<uint8_t> _weights;
+
   /**
    * @brief if opcode is not registered in table of opcodes add it
    * @param builtin_code
@@ -56,7 +56,6 @@ void copy_tensor_attributes(const circle::TensorT &tensor, CircleNode *node);
 class CircleReader
 {
 private:
-  using CircleBuffers_t = std::vector<std::unique_ptr<circle::BufferT>>;
   using CircleTensors_t = std::vector<std::unique_ptr<circle::TensorT>>;
   using CircleOperators_t = std::vector<std::unique_ptr<circle::OperatorT>>;
   using CircleOperatorCodes_t = std::vector<std::unique_ptr<circle::OperatorCodeT>>;
@@ -64,12 +63,21 @@ private:
   using CircleSubGraphsPtr_t = flatbuffers::Vector<flatbuffers::Offset<circle::SubGraph>>;
   using CircleTensorsPtr_t = flatbuffers::Vector<flatbuffers::Offset<circle::Tensor>>;
 
+public:
+  /**
+   * @brief Raw contents of a buffer
+   */
+  struct BufferData
+  {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+  };
+
 public:
   CircleReader() = default;
 
 public:
   const CircleOperatorCodes_t &opcodes() const { return _model->operator_codes; }
-  const CircleBuffers_t &buffers() const { return _model->buffers; }
   const CircleTensors_t &tensors() const { return _current_subgraph->tensors; }
   const CircleOperators_t &operators() const { return _current_subgraph->operators; }
   const std::vector<int32_t> &inputs() const { return _current_subgraph->inputs; }
@@ -83,8 +91,15 @@ public:
   circle::BuiltinOperator builtin_code(const circle::OperatorT &op) const;
   std::string opcode_name(const circle::OperatorT &op) const;
 
+  // Returns contents of a buffer, which may be stored in external weights
+  BufferData buffer_data(uint32_t index) const;
+
+  // Returns owner of the memory of model and weights, or nullptr if they are not owned
+  const std::shared_ptr<const void> &storage() const { return _storage; }
+
 public:
-  bool parse(const circle::Model *model);
+  bool parse(const circle::Model *model, const uint8_t *weights = nullptr,
+             size_t weights_size = 0, std::shared_ptr<const void> storage = nullptr);
   bool select_subgraph(uint32_t subgraph);
 
 private:
@@ -93,6 +108,11 @@ private:
 
   const circle::Model *_model_ptr{nullptr};
   const CircleTensorsPtr_t *_tensors_ptr{nullptr};
+
+  const uint8_t *_weights{nullptr};
+  size_t _weights_size{0};
+
+  std::shared_ptr<const void> _storage;
 };
 
 } // namespace luci
@@ -43,7 +43,25 @@ public:
 
 public:
   std::unique_ptr<loco::Graph> import(const circle::Model *model) const;
+  /**
+   * @brief Import 'model' whose memory may be freed while the module is in use
+   *
+   * @note  Constants are copied, as nothing tells how long the memory lives. Use the overload
+   *        with 'storage' not to copy them.
+   */
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
+  // 'weights' is the contents of external weights file that 'model' refers to
+  std::unique_ptr<Module> importModule(const circle::Model *model, const uint8_t *weights,
+                                       size_t weights_size) const;
+  /**
+   * @brief Import 'model' whose memory, and that of 'weights', is kept alive by 'storage'
+   *
+   * @note  Constants refer to the memory instead of copying it
+   */
+  std::unique_ptr<Module> importModule(const circle::Model *model,
+                                       std::shared_ptr<const void> storage,
+                                       const uint8_t *weights = nullptr,
+                                       size_t weights_size = 0) const;
 
 private:
   const GraphBuilderSource *_source = nullptr;
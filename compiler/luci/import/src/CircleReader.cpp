@@ -16,6 +16,8 @@
 
 #include "luci/Import/CircleReader.h"
 
+#include <oops/UserExn.h>
+
 #include <memory>
 #include <sstream>
 #include <string>
@@ -165,6 +167,7 @@ luci_quantparam(const circle::QuantizationParametersT *quantization)
     quantparam->max = max;
     quantparam->scale = scale;
     quantparam->zerop = zero_point;
+    quantparam->quantized_dimension = quantization->quantized_dimension;
 
     return quantparam;
   }
@@ -220,15 +223,61 @@ std::string CircleReader::opcode_name(const circle::OperatorT &op) const
   return ::luci::opcode_name(opcode);
 }
 
-bool CircleReader::parse(const circle::Model *model)
+CircleReader::BufferData CircleReader::buffer_data(uint32_t index) const
+{
+  const auto buffers = _model_ptr->buffers();
+  if (buffers == nullptr || index >= buffers->size())
+    throw oops::UserExn("Invalid buffer index", index);
+  const circle::Buffer *buffer = buffers->Get(index);
+
+  BufferData result;
+  if (buffer->data() != nullptr && buffer->data()->size() != 0)
+  {
+    result.data = buffer->data()->data();
+    result.size = buffer->data()->size();
+  }
+  else if (buffer->size() != 0)
+  {
+    if (_weights == nullptr)
+      throw oops::UserExn("Model refers to external weights, but weights are not given");
+    // NOTE Compare without adding offset and size not to wrap around
+    if (buffer->offset() > _weights_size || buffer->size() > _weights_size - buffer->offset())
+      throw oops::UserExn("Buffer is out of range of external weights", index);
+
+    result.data = _weights + buffer->offset();
+    result.size = buffer->size();
+  }
+  return result;
+}
+
+bool CircleReader::parse(const circle::Model *model, const uint8_t *weights, size_t weights_size,
+                         std::shared_ptr<const void> storage)
 {
   assert(model != nullptr);
 
-  _model.reset(model->UnPack());
+  // NOTE Buffers are not unpacked not to copy contents of constants.
+  //      They are read from 'model' directly with buffer_data().
+  auto model_t = std::make_unique<circle::ModelT>();
+  model_t->version = model->version();
+  if (model->operator_codes() != nullptr)
+  {
+    for (const auto opcode : *model->operator_codes())
+      model_t->operator_codes.emplace_back(opcode->UnPack());
+  }
+  if (model->subgraphs() != nullptr)
+  {
+    for (const auto subgraph : *model->subgraphs())
+      model_t->subgraphs.emplace_back(subgraph->UnPack());
+  }
+  _model = std::move(model_t);
 
   // for direct pointer access
   _model_ptr = model;
 
+  _weights = weights;
+  _weights_size = weights_size;
+  _storage = std::move(storage);
+
   return true;
 }
 
@@ -87,12 +87,10 @@ void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &r
   }
 
   // Create CircleConst nodes for constant tensors.
-  const auto &buffers = reader.buffers();
   for (uint32_t i = 0; i < tensors.size(); ++i)
   {
     const circle::TensorT &tensor = *tensors[i];
-    const std::vector<uint8_t> &buffer = buffers[tensor.buffer]->data;
-    if (!buffer.empty())
+    if (reader.buffer_data(tensor.buffer).size != 0)
     {
       luci::CircleConst *const_node = luci::create_circleconst(&gb_context, i);
       nodefinder->enroll(i, const_node);
@@ -230,6 +228,19 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
 }
 
 std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
+{
+  return importModule(model, nullptr, 0);
+}
+
+std::unique_ptr<Module> Importer::importModule(const circle::Model *model, const uint8_t *weights,
+                                               size_t weights_size) const
+{
+  return importModule(model, nullptr, weights, weights_size);
+}
+
+std::unique_ptr<Module> Importer::importModule(const circle::Model *model,
+                                               std::shared_ptr<const void> storage,
+                                               const uint8_t *weights, size_t weights_size) const
 {
   auto module = make_module();
 
@@ -242,7 +253,7 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
   }
 
   CircleReader reader;
-  if (!reader.parse(model))
+  if (!reader.parse(model, weights, weights_size, std::move(storage)))
     return nullptr;
 
   for (uint32_t g = 0; g < reader.num_subgraph(); ++g)
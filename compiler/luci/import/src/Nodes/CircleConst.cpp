@@ -23,18 +23,28 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
 
 namespace luci
 {
 
 template <loco::DataType DT>
-static void copy_data(const std::vector<uint8_t> &raw_data, uint32_t num_elements,
+static void copy_data(const CircleReader::BufferData &raw_data,
+                      const std::shared_ptr<const void> &storage, uint32_t num_elements,
                       CircleConst *const_node)
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
 
-  assert(raw_data.size() == num_elements * sizeof(T));
-  const auto *data = reinterpret_cast<const T *>(raw_data.data());
+  assert(raw_data.size == num_elements * sizeof(T));
+  const auto *data = reinterpret_cast<const T *>(raw_data.data);
+
+  // Refer to the memory of model when it outlives the node and is properly aligned
+  if (storage != nullptr && reinterpret_cast<uintptr_t>(data) % alignof(T) == 0)
+  {
+    const_node->reference(storage, raw_data.data, raw_data.size);
+    return;
+  }
 
   const_node->size<DT>(num_elements);
   for (uint32_t i = 0; i < num_elements; ++i)
@@ -70,30 +80,34 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
   }
 
   // (3) constant values from circle buffer
-  const std::vector<uint8_t> &buffer = reader->buffers()[const_tensor.buffer]->data;
-  if (buffer.empty())
+  const auto buffer = reader->buffer_data(const_tensor.buffer);
+  if (buffer.size == 0)
     throw oops::UserExn("Empty buffer");
 
   switch (luci_datatype(const_tensor.type))
   {
     case loco::DataType::FLOAT32:
-      copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::FLOAT32>(buffer, reader->storage(), num_elements, const_node);
       break;
 
     case loco::DataType::U8:
-      copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::U8>(buffer, reader->storage(), num_elements, const_node);
+      break;
+
+    case loco::DataType::S8:
+      copy_data<loco::DataType::S8>(buffer, reader->storage(), num_elements, const_node);
       break;
 
     case loco::DataType::S32:
-      copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::S32>(buffer, reader->storage(), num_elements, const_node);
       break;
 
     case loco::DataType::S64:
-      copy_data<loco::DataType::S64>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::S64>(buffer, reader->storage(), num_elements, const_node);
       break;
 
     case loco::DataType::BOOL:
-      copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node);
+      copy_data<loco::DataType::BOOL>(buffer, reader->storage(), num_elements, const_node);
       break;
 
     default:
@@ -25,6 +25,9 @@
 
 #include <loco/IR/DataTypeTraits.h>
 
+#include <memory>
+#include <vector>
+
 namespace luci
 {
 
@@ -46,8 +49,29 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Read 'size' bytes at 'data' instead of owning a copy of them
+   *
+   * @note  'owner' keeps 'data' alive while this node refers to it.
+   *        'data' is copied on the first non-const access, so it is never written.
+   */
+  void reference(std::shared_ptr<const void> owner, const uint8_t *data, size_t size);
+  bool referenced(void) const { return _ref_data != nullptr; }
+
+private:
+  const uint8_t *bytes(void) const { return referenced() ? _ref_data : _data.data(); }
+  size_t num_bytes(void) const { return referenced() ? _ref_size : _data.size(); }
+
+  // Copy referenced data to '_data' before it is modified
+  void materialize(void);
+
 private:
   std::vector<uint8_t> _data;
+
+  std::shared_ptr<const void> _ref_owner;
+  const uint8_t *_ref_data = nullptr;
+  size_t _ref_size = 0;
 };
 
 } // namespace luci
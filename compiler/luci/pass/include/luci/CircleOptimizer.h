@@ -36,12 +36,17 @@ public:
       FuseInstanceNorm,
       ResolveCustomOpBatchMatMul,
       QuantizeWithMinMax,
+      FuseBatchNormWithConv,
+      FuseActivationFunction,
+      FusePadWithConv,
+      FoldConstants,
     };
 
     enum AlgorithmParameters
     {
       QuantizeWithMinMax_input_dtype,
-      QuantizeWithMinMax_output_dtype
+      QuantizeWithMinMax_output_dtype,
+      QuantizeWithMinMax_granularity
     };
 
     virtual ~Options() = default;
@@ -59,6 +64,9 @@ public:
 public:
   void optimize(loco::Graph *) const;
 
+private:
+  void quantize(loco::Graph *) const;
+
 private:
   std::unique_ptr<Options> _options;
 };
@@ -16,8 +16,13 @@
 
 #include "luci/CircleOptimizer.h"
 
+#include "luci/Pass/FoldConstantsPass.h"
+#include "luci/Pass/FuseActivationFunctionPass.h"
+#include "luci/Pass/FuseBatchNormWithConvPass.h"
 #include "luci/Pass/FuseBCQPass.h"
 #include "luci/Pass/FuseInstanceNormPass.h"
+#include "luci/Pass/FusePadWithConvPass.h"
+#include "luci/Pass/QuantizeWithMinMaxPass.h"
 #include "luci/Pass/ResolveCustomOpBatchMatMulPass.h"
 // TODO add more passes
 
@@ -31,6 +36,8 @@
 
 #include <logo/Phase.h>
 
+#include <oops/UserExn.h>
+
 #include <memory>
 
 namespace
@@ -80,6 +87,28 @@ bool OptimizeOptionsImpl::query(Algorithm algo)
   return true;
 }
 
+loco::DataType str_to_dtype(const std::string &str)
+{
+  if (str == "float32")
+    return loco::DataType::FLOAT32;
+  if (str == "uint8")
+    return loco::DataType::U8;
+  if (str == "int8")
+    return loco::DataType::S8;
+
+  throw oops::UserExn("Unsupported data type for quantization", str);
+}
+
+QuantizationGranularity str_to_granularity(const std::string &str)
+{
+  if (str.empty() || str == "layer")
+    return QuantizationGranularity::LayerWise;
+  if (str == "channel")
+    return QuantizationGranularity::ChannelWise;
+
+  throw oops::UserExn("Unsupported granularity for quantization", str);
+}
+
 } // namespace
 
 namespace luci
@@ -104,18 +133,30 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<luci::ResolveCustomOpBatchMatMulPass>());
   }
-  if (_options->query(Options::Algorithm::FuseInstanceNorm))
+  if (_options->query(Options::Algorithm::FoldConstants))
   {
-    phase.emplace_back(std::make_unique<FuseInstanceNormPass>());
+    phase.emplace_back(std::make_unique<FoldConstantsPass>());
   }
-  if (_options->query(Options::Algorithm::QuantizeWithMinMax))
+  if (_options->query(Options::Algorithm::FuseInstanceNorm))
   {
-    // TODO: Add QuantizeWithMinMaxPass phase with parameters
+    phase.emplace_back(std::make_unique<FuseInstanceNormPass>());
   }
   if (_options->query(Options::Algorithm::FuseBCQ))
   {
     phase.emplace_back(std::make_unique<FuseBCQPass>());
   }
+  if (_options->query(Options::Algorithm::FusePadWithConv))
+  {
+    phase.emplace_back(std::make_unique<FusePadWithConvPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseBatchNormWithConv))
+  {
+    phase.emplace_back(std::make_unique<FuseBatchNormWithConvPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseActivationFunction))
+  {
+    phase.emplace_back(std::make_unique<FuseActivationFunctionPass>());
+  }
 
   // Shape inference is needed for added nodes doing above transformations
   phase.emplace_back(std::make_unique<luci::ShapeInferencePass>());
@@ -127,6 +168,35 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
+
+  // Quantization runs after all other transformations as it changes type of nodes
+  if (_options->query(Options::Algorithm::QuantizeWithMinMax))
+  {
+    quantize(g);
+  }
+}
+
+void CircleOptimizer::quantize(loco::Graph *g) const
+{
+  logo::Phase phase;
+
+  using AlgorithmParameters = Options::AlgorithmParameters;
+
+  auto input_dtype = _options->param(AlgorithmParameters::QuantizeWithMinMax_input_dtype);
+  auto output_dtype = _options->param(AlgorithmParameters::QuantizeWithMinMax_output_dtype);
+  auto granularity = _options->param(AlgorithmParameters::QuantizeWithMinMax_granularity);
+
+  phase.emplace_back(std::make_unique<QuantizeWithMinMaxPass>(
+      str_to_dtype(input_dtype), str_to_dtype(output_dtype), str_to_granularity(granularity)));
+
+  phase.emplace_back(std::make_unique<luci::ShapeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::TypeInferencePass>());
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+
+  ProgressReporter prog(g, logo::PhaseStrategy::Saturate);
+  logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
+  phase_runner.attach(&prog);
+  phase_runner.run(phase);
 }
 
 } // namespace luci
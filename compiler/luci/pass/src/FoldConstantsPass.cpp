@@ -0,0 +1,517 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FoldConstantsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/Service/ShapeInference.h>
+#include <loco/Service/TypeInference.h>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using Dims = std::vector<uint32_t>;
+
+/// @brief (index of input, offset of element in the input) for each output element
+using IndexMap = std::vector<std::pair<uint32_t, uint32_t>>;
+
+Dims dims_of(const luci::CircleConst *node)
+{
+  Dims dims(node->rank());
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+    dims[axis] = node->dim(axis).value();
+  return dims;
+}
+
+uint32_t num_elements(const Dims &dims)
+{
+  uint32_t count = 1;
+  for (auto dim : dims)
+    count *= dim;
+  return count;
+}
+
+/// @return distance between elements of each axis in row-major order
+Dims strides_of(const Dims &dims)
+{
+  Dims strides(dims.size(), 1);
+  for (int32_t axis = static_cast<int32_t>(dims.size()) - 2; axis >= 0; --axis)
+    strides[axis] = strides[axis + 1] * dims[axis + 1];
+  return strides;
+}
+
+/// @return true if every dimension of 'node' is statically known
+bool static_shape(loco::Node *node, Dims &dims)
+{
+  if (not loco::shape_known(node))
+    return false;
+
+  auto shape = loco::shape_get(node).as<loco::TensorShape>();
+  dims.resize(shape.rank());
+  for (uint32_t axis = 0; axis < shape.rank(); ++axis)
+  {
+    if (not shape.dim(axis).known())
+      return false;
+    dims[axis] = shape.dim(axis).value();
+  }
+  return true;
+}
+
+/// @return values of S32 CircleConst 'node', or false if 'node' is not such one
+bool s32_values(loco::Node *node, std::vector<int32_t> &values)
+{
+  auto const_node = dynamic_cast<luci::CircleConst *>(node);
+  if (const_node == nullptr || const_node->dtype() != loco::DataType::S32)
+    return false;
+
+  values.resize(const_node->size<loco::DataType::S32>());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    values[i] = const_node->at<loco::DataType::S32>(i);
+  return true;
+}
+
+/**
+ * @brief Create CircleConst for the result of 'node' with the inferred shape and type
+ */
+luci::CircleConst *create_result(luci::CircleNode *node, const Dims &dims)
+{
+  auto result = node->graph()->nodes()->create<luci::CircleConst>();
+  result->dtype(loco::dtype_known(node) ? loco::dtype_get(node) : node->dtype());
+  result->rank(dims.size());
+  for (uint32_t axis = 0; axis < dims.size(); ++axis)
+    result->dim(axis) = dims[axis];
+  result->name(node->name());
+  // Values of quantized type are meaningful only with their quantization parameters
+  if (auto qparam = node->quantparam())
+    result->quantparam(std::make_unique<luci::CircleQuantParam>(*qparam));
+  return result;
+}
+
+bool quantized(const luci::CircleNode *node)
+{
+  auto qparam = node->quantparam();
+  return qparam != nullptr && !qparam->scale.empty();
+}
+
+/// @return true if values of 'lhs' and 'rhs' are quantized with the same parameters, or not at all
+bool same_quantization(const luci::CircleNode *lhs, const luci::CircleNode *rhs)
+{
+  if (not quantized(lhs) || not quantized(rhs))
+    return quantized(lhs) == quantized(rhs);
+
+  auto lhs_qparam = lhs->quantparam();
+  auto rhs_qparam = rhs->quantparam();
+  return lhs_qparam->scale == rhs_qparam->scale && lhs_qparam->zerop == rhs_qparam->zerop &&
+         lhs_qparam->quantized_dimension == rhs_qparam->quantized_dimension;
+}
+
+template <loco::DataType DT>
+void gather(const std::vector<luci::CircleConst *> &inputs, const IndexMap &map,
+            luci::CircleConst *output)
+{
+  output->size<DT>(map.size());
+  for (uint32_t i = 0; i < map.size(); ++i)
+    output->at<DT>(i) = inputs.at(map[i].first)->at<DT>(map[i].second);
+}
+
+/**
+ * @brief Fill 'output' with elements of 'inputs' picked by 'map'
+ *
+ * @return false if type is not supported
+ */
+bool gather(const std::vector<luci::CircleConst *> &inputs, const IndexMap &map,
+            luci::CircleConst *output)
+{
+  for (auto input : inputs)
+  {
+    if (input->dtype() != output->dtype())
+      return false;
+  }
+
+  switch (output->dtype())
+  {
+    case loco::DataType::FLOAT32:
+      gather<loco::DataType::FLOAT32>(inputs, map, output);
+      return true;
+    case loco::DataType::S32:
+      gather<loco::DataType::S32>(inputs, map, output);
+      return true;
+    case loco::DataType::S64:
+      gather<loco::DataType::S64>(inputs, map, output);
+      return true;
+    case loco::DataType::U8:
+      gather<loco::DataType::U8>(inputs, map, output);
+      return true;
+    case loco::DataType::BOOL:
+      gather<loco::DataType::BOOL>(inputs, map, output);
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Replace 'node' with CircleConst of elements of 'inputs' picked by 'map'
+ */
+bool fold_with(luci::CircleNode *node, const Dims &dims,
+               const std::vector<luci::CircleConst *> &inputs, const IndexMap &map)
+{
+  if (num_elements(dims) != map.size())
+    return false;
+
+  // Elements are copied as they are, which keeps their values only with the same quantization
+  for (auto input : inputs)
+  {
+    if (not same_quantization(input, node))
+      return false;
+  }
+
+  auto result = create_result(node, dims);
+  if (not gather(inputs, map, result))
+    return false;
+
+  replace(node).with(result);
+  return true;
+}
+
+bool fold_reshape(luci::CircleReshape *node)
+{
+  auto input = dynamic_cast<luci::CircleConst *>(node->tensor());
+  if (input == nullptr)
+    return false;
+
+  Dims dims;
+  if (not static_shape(node, dims))
+    return false;
+
+  IndexMap map(num_elements(dims_of(input)));
+  for (uint32_t i = 0; i < map.size(); ++i)
+    map[i] = {0, i};
+
+  return fold_with(node, dims, {input}, map);
+}
+
+bool fold_transpose(luci::CircleTranspose *node)
+{
+  auto input = dynamic_cast<luci::CircleConst *>(node->a());
+  std::vector<int32_t> perm;
+  if (input == nullptr || not s32_values(node->perm(), perm))
+    return false;
+
+  const auto in_dims = dims_of(input);
+  if (perm.size() != in_dims.size())
+    return false;
+
+  Dims out_dims(in_dims.size());
+  for (uint32_t axis = 0; axis < perm.size(); ++axis)
+  {
+    if (perm[axis] < 0 || perm[axis] >= static_cast<int32_t>(in_dims.size()))
+      return false;
+    out_dims[axis] = in_dims[perm[axis]];
+  }
+
+  const auto in_strides = strides_of(in_dims);
+  const auto out_strides = strides_of(out_dims);
+
+  IndexMap map(num_elements(out_dims));
+  for (uint32_t i = 0; i < map.size(); ++i)
+  {
+    uint32_t offset = 0;
+    for (uint32_t axis = 0; axis < out_dims.size(); ++axis)
+    {
+      const uint32_t coord = (i / out_strides[axis]) % out_dims[axis];
+      offset += coord * in_strides[perm[axis]];
+    }
+    map[i] = {0, offset};
+  }
+
+  return fold_with(node, out_dims, {input}, map);
+}
+
+bool fold_strided_slice(luci::CircleStridedSlice *node)
+{
+  // TODO support ellipsis_mask and new_axis_mask
+  if (node->ellipsis_mask() != 0 || node->new_axis_mask() != 0)
+    return false;
+
+  auto input = dynamic_cast<luci::CircleConst *>(node->input());
+  std::vector<int32_t> begin, end, strides;
+  if (input == nullptr || not s32_values(node->begin(), begin) ||
+      not s32_values(node->end(), end) || not s32_values(node->strides(), strides))
+    return false;
+
+  Dims out_dims;
+  if (not static_shape(node, out_dims))
+    return false;
+
+  const auto in_dims = dims_of(input);
+  const auto rank = in_dims.size();
+  if (begin.size() != rank || end.size() != rank || strides.size() != rank)
+    return false;
+
+  // Start and number of elements of each axis
+  std::vector<int32_t> starts(rank), counts(rank);
+  for (uint32_t axis = 0; axis < rank; ++axis)
+  {
+    const int32_t dim = in_dims[axis];
+    const int32_t stride = strides[axis];
+    if (stride == 0)
+      return false;
+
+    auto clamp_index = [&](int32_t index) {
+      if (index < 0)
+        index += dim;
+      if (stride > 0)
+        return std::min(std::max(index, 0), dim);
+      return std::min(std::max(index, -1), dim - 1);
+    };
+
+    int32_t start = (node->begin_mask() & (1 << axis)) ? (stride > 0 ? 0 : dim - 1)
+                                                      : clamp_index(begin[axis]);
+    int32_t stop =
+        (node->end_mask() & (1 << axis)) ? (stride > 0 ? dim : -1) : clamp_index(end[axis]);
+
+    if (node->shrink_axis_mask() & (1 << axis))
+    {
+      start = begin[axis] < 0 ? begin[axis] + dim : begin[axis];
+      if (start < 0 || start >= dim)
+        return false;
+      stop = start + 1;
+      strides[axis] = 1;
+    }
+
+    const int32_t step = strides[axis];
+    const int32_t length = step > 0 ? stop - start : start - stop;
+    const int32_t abs_step = step > 0 ? step : -step;
+
+    starts[axis] = start;
+    counts[axis] = length > 0 ? (length + abs_step - 1) / abs_step : 0;
+  }
+
+  Dims sliced_dims(counts.begin(), counts.end());
+  const auto in_strides = strides_of(in_dims);
+  const auto sliced_strides = strides_of(sliced_dims);
+
+  IndexMap map(num_elements(sliced_dims));
+  for (uint32_t i = 0; i < map.size(); ++i)
+  {
+    uint32_t offset = 0;
+    for (uint32_t axis = 0; axis < rank; ++axis)
+    {
+      const int32_t coord = (i / sliced_strides[axis]) % sliced_dims[axis];
+      offset += (starts[axis] + coord * strides[axis]) * in_strides[axis];
+    }
+    map[i] = {0, offset};
+  }
+
+  // NOTE Axes of shrink_axis_mask are removed from the inferred shape, with the same elements
+  return fold_with(node, out_dims, {input}, map);
+}
+
+bool fold_pack(luci::CirclePack *node)
+{
+  std::vector<luci::CircleConst *> inputs;
+  for (uint32_t n = 0; n < node->values_count(); ++n)
+  {
+    auto input = dynamic_cast<luci::CircleConst *>(node->values(n));
+    if (input == nullptr)
+      return false;
+    if (n > 0 && dims_of(input) != dims_of(inputs.front()))
+      return false;
+    inputs.push_back(input);
+  }
+  if (inputs.empty())
+    return false;
+
+  const auto in_dims = dims_of(inputs.front());
+  int32_t axis = node->axis();
+  if (axis < 0)
+    axis += in_dims.size() + 1;
+  if (axis < 0 || axis > static_cast<int32_t>(in_dims.size()))
+    return false;
+
+  Dims out_dims = in_dims;
+  out_dims.insert(out_dims.begin() + axis, inputs.size());
+
+  // Number of elements of an input to be copied at once
+  uint32_t inner = 1;
+  for (uint32_t d = axis; d < in_dims.size(); ++d)
+    inner *= in_dims[d];
+
+  IndexMap map(num_elements(out_dims));
+  for (uint32_t i = 0; i < map.size(); ++i)
+  {
+    const uint32_t outer = i / (inputs.size() * inner);
+    const uint32_t rem = i % (inputs.size() * inner);
+    map[i] = {rem / inner, outer * inner + rem % inner};
+  }
+
+  return fold_with(node, out_dims, inputs, map);
+}
+
+template <loco::DataType IN, loco::DataType OUT>
+void cast(const luci::CircleConst *input, luci::CircleConst *output)
+{
+  using OutType = typename loco::DataTypeImpl<OUT>::Type;
+
+  const auto size = input->size<IN>();
+  output->size<OUT>(size);
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    if (OUT == loco::DataType::BOOL)
+      output->at<OUT>(i) = input->at<IN>(i) != 0;
+    else
+      output->at<OUT>(i) = static_cast<OutType>(input->at<IN>(i));
+  }
+}
+
+template <loco::DataType IN>
+bool cast_from(const luci::CircleConst *input, luci::CircleConst *output)
+{
+  switch (output->dtype())
+  {
+    case loco::DataType::FLOAT32:
+      cast<IN, loco::DataType::FLOAT32>(input, output);
+      return true;
+    case loco::DataType::S32:
+      cast<IN, loco::DataType::S32>(input, output);
+      return true;
+    case loco::DataType::S64:
+      cast<IN, loco::DataType::S64>(input, output);
+      return true;
+    case loco::DataType::U8:
+      cast<IN, loco::DataType::U8>(input, output);
+      return true;
+    case loco::DataType::BOOL:
+      cast<IN, loco::DataType::BOOL>(input, output);
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool fold_cast(luci::CircleCast *node)
+{
+  auto input = dynamic_cast<luci::CircleConst *>(node->x());
+  if (input == nullptr)
+    return false;
+
+  // Casting quantized values would need to requantize them
+  if (quantized(input) || quantized(node))
+    return false;
+
+  auto result = create_result(node, dims_of(input));
+  result->dtype(node->out_data_type());
+
+  bool casted = false;
+  switch (input->dtype())
+  {
+    case loco::DataType::FLOAT32:
+      casted = cast_from<loco::DataType::FLOAT32>(input, result);
+      break;
+    case loco::DataType::S32:
+      casted = cast_from<loco::DataType::S32>(input, result);
+      break;
+    case loco::DataType::S64:
+      casted = cast_from<loco::DataType::S64>(input, result);
+      break;
+    case loco::DataType::U8:
+      casted = cast_from<loco::DataType::U8>(input, result);
+      break;
+    case loco::DataType::BOOL:
+      casted = cast_from<loco::DataType::BOOL>(input, result);
+      break;
+    default:
+      break;
+  }
+  if (not casted)
+    return false;
+
+  replace(node).with(result);
+  return true;
+}
+
+bool fold_shape(luci::CircleShape *node)
+{
+  // Input of Shape does not need to be constant, but its shape should be static
+  Dims in_dims;
+  if (not static_shape(node->input(), in_dims))
+    return false;
+
+  auto result = create_result(node, {static_cast<uint32_t>(in_dims.size())});
+  result->dtype(node->out_type());
+
+  if (node->out_type() == loco::DataType::S32)
+  {
+    result->size<loco::DataType::S32>(in_dims.size());
+    for (uint32_t axis = 0; axis < in_dims.size(); ++axis)
+      result->at<loco::DataType::S32>(axis) = in_dims[axis];
+  }
+  else if (node->out_type() == loco::DataType::S64)
+  {
+    result->size<loco::DataType::S64>(in_dims.size());
+    for (uint32_t axis = 0; axis < in_dims.size(); ++axis)
+      result->at<loco::DataType::S64>(axis) = in_dims[axis];
+  }
+  else
+  {
+    return false;
+  }
+
+  replace(node).with(result);
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FoldConstantsPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    bool folded = false;
+
+    if (auto reshape = dynamic_cast<luci::CircleReshape *>(node))
+      folded = fold_reshape(reshape);
+    else if (auto transpose = dynamic_cast<luci::CircleTranspose *>(node))
+      folded = fold_transpose(transpose);
+    else if (auto strided_slice = dynamic_cast<luci::CircleStridedSlice *>(node))
+      folded = fold_strided_slice(strided_slice);
+    else if (auto pack = dynamic_cast<luci::CirclePack *>(node))
+      folded = fold_pack(pack);
+    else if (auto cast = dynamic_cast<luci::CircleCast *>(node))
+      folded = fold_cast(cast);
+    else if (auto shape = dynamic_cast<luci::CircleShape *>(node))
+      folded = fold_shape(shape);
+
+    if (folded)
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseActivationFunctionPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+namespace
+{
+
+/**
+ *  BEFORE
+ *
+ *    [Node(act: NONE)] --- [Relu] ---
+ *
+ *  AFTER
+ *
+ *    [Node(act: RELU)] ---
+ */
+bool fuse_activation_function(luci::CircleNode *activation, loco::Node *features,
+                              luci::FusedActFunc act)
+{
+  auto pred = dynamic_cast<luci::CircleNode *>(features);
+  if (pred == nullptr)
+    return false;
+
+  auto pred_act = dynamic_cast<luci::LuciNodeMixin<luci::LuciNodeTrait::FusedActFunc> *>(pred);
+  if (pred_act == nullptr)
+    return false;
+
+  if (pred_act->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+
+  // Result before activation should not be used by others
+  if (loco::succs(pred).size() != 1)
+    return false;
+
+  // Quantized nodes keep separate activation, as its output range may differ
+  if (pred->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  pred_act->fusedActivationFunction(act);
+  replace(activation).with(pred);
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseActivationFunctionPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    if (auto relu = dynamic_cast<luci::CircleRelu *>(node))
+    {
+      if (fuse_activation_function(relu, relu->features(), luci::FusedActFunc::RELU))
+        changed = true;
+    }
+    else if (auto relu6 = dynamic_cast<luci::CircleRelu6 *>(node))
+    {
+      if (fuse_activation_function(relu6, relu6->features(), luci::FusedActFunc::RELU6))
+        changed = true;
+    }
+    else if (auto relu_n1_to_1 = dynamic_cast<luci::CircleReluN1To1 *>(node))
+    {
+      if (fuse_activation_function(relu_n1_to_1, relu_n1_to_1->features(),
+                                   luci::FusedActFunc::RELU_N1_TO_1))
+        changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseBatchNormWithConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/Service/ShapeInference.h>
+
+#include <cassert>
+
+namespace
+{
+
+/// @return weights (filter) of 'layer'
+loco::Node *weights_of(luci::CircleNode *layer)
+{
+  switch (layer->opcode())
+  {
+    case luci::CircleOpcode::CONV_2D:
+      return loco::must_cast<luci::CircleConv2D *>(layer)->filter();
+    case luci::CircleOpcode::DEPTHWISE_CONV_2D:
+      return loco::must_cast<luci::CircleDepthwiseConv2D *>(layer)->filter();
+    case luci::CircleOpcode::FULLY_CONNECTED:
+      return loco::must_cast<luci::CircleFullyConnected *>(layer)->weights();
+    default:
+      return nullptr;
+  }
+}
+
+void set_weights(luci::CircleNode *layer, loco::Node *weights)
+{
+  switch (layer->opcode())
+  {
+    case luci::CircleOpcode::CONV_2D:
+      loco::must_cast<luci::CircleConv2D *>(layer)->filter(weights);
+      break;
+    case luci::CircleOpcode::DEPTHWISE_CONV_2D:
+      loco::must_cast<luci::CircleDepthwiseConv2D *>(layer)->filter(weights);
+      break;
+    case luci::CircleOpcode::FULLY_CONNECTED:
+      loco::must_cast<luci::CircleFullyConnected *>(layer)->weights(weights);
+      break;
+    default:
+      assert(false);
+  }
+}
+
+/**
+ * @return number of output channels of 'layer'
+ *
+ * Layout of weights
+ *   Conv2D          : [O, H, W, I]
+ *   DepthwiseConv2D : [1, H, W, O]
+ *   FullyConnected  : [O, I]
+ */
+uint32_t num_output_channels(luci::CircleNode *layer, const luci::CircleConst *weights)
+{
+  switch (layer->opcode())
+  {
+    case luci::CircleOpcode::CONV_2D:
+      return weights->rank() == 4 ? weights->dim(0).value() : 0;
+    case luci::CircleOpcode::DEPTHWISE_CONV_2D:
+      return weights->rank() == 4 ? weights->dim(3).value() : 0;
+    case luci::CircleOpcode::FULLY_CONNECTED:
+      return weights->rank() == 2 ? weights->dim(0).value() : 0;
+    default:
+      return 0;
+  }
+}
+
+/// @return output channel of n-th element of 'weights'
+uint32_t output_channel_of(luci::CircleNode *layer, const luci::CircleConst *weights, uint32_t n)
+{
+  if (layer->opcode() == luci::CircleOpcode::DEPTHWISE_CONV_2D)
+    return n % weights->dim(3).value();
+
+  // Conv2D and FullyConnected have output channel at the outermost dimension
+  return n / (weights->size<loco::DataType::FLOAT32>() / weights->dim(0).value());
+}
+
+/// @return true when 'node' is FLOAT32 CircleConst of shape [C] or [1, ..., 1, C]
+bool is_per_channel_const(luci::CircleConst *node, uint32_t channels)
+{
+  if (node->dtype() != loco::DataType::FLOAT32)
+    return false;
+  if (node->rank() == 0)
+    return false;
+
+  for (uint32_t axis = 0; axis + 1 < node->rank(); ++axis)
+  {
+    if (node->dim(axis).value() != 1)
+      return false;
+  }
+  return node->dim(node->rank() - 1).value() == channels;
+}
+
+luci::CircleConst *clone_const_shape(luci::CircleConst *node)
+{
+  auto cloned = node->graph()->nodes()->create<luci::CircleConst>();
+  cloned->dtype(node->dtype());
+  cloned->rank(node->rank());
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+    cloned->dim(axis) = node->dim(axis);
+  cloned->name(node->name());
+  return cloned;
+}
+
+/**
+ * @brief Find the layer that 'node' (Mul or Add) can be fused into, and per-channel constant
+ *
+ * @return nullptr if 'node' does not match the pattern
+ */
+template <class BINARY>
+luci::CircleNode *match_layer(BINARY *node, luci::CircleConst **param, luci::CircleConst **weights,
+                              luci::CircleConst **bias)
+{
+  luci::CircleNode *layer = nullptr;
+  luci::CircleConst *constant = nullptr;
+
+  if ((layer = dynamic_cast<luci::CircleNode *>(node->x())) &&
+      (constant = dynamic_cast<luci::CircleConst *>(node->y())))
+  {
+    // DO NOTHING
+  }
+  else if ((layer = dynamic_cast<luci::CircleNode *>(node->y())) &&
+           (constant = dynamic_cast<luci::CircleConst *>(node->x())))
+  {
+    // DO NOTHING
+  }
+  else
+  {
+    return nullptr;
+  }
+
+  if (node->dtype() != loco::DataType::FLOAT32)
+    return nullptr;
+
+  // Mul/Add should not broadcast result of layer to higher rank
+  if (not loco::shape_known(layer) || not loco::shape_known(node))
+    return nullptr;
+  if (loco::shape_get(layer).as<loco::TensorShape>().rank() !=
+      loco::shape_get(node).as<loco::TensorShape>().rank())
+    return nullptr;
+
+  auto weights_const = dynamic_cast<luci::CircleConst *>(weights_of(layer));
+  if (weights_const == nullptr || weights_const->dtype() != loco::DataType::FLOAT32)
+    return nullptr;
+
+  auto layer_bias = dynamic_cast<luci::LuciNodeMixin<luci::LuciNodeTrait::Bias> *>(layer);
+  auto layer_act = dynamic_cast<luci::LuciNodeMixin<luci::LuciNodeTrait::FusedActFunc> *>(layer);
+  assert(layer_bias != nullptr && layer_act != nullptr);
+
+  auto bias_const = dynamic_cast<luci::CircleConst *>(layer_bias->bias());
+  if (bias_const == nullptr || bias_const->dtype() != loco::DataType::FLOAT32)
+    return nullptr;
+
+  // Activation of layer should be applied after Mul/Add
+  if (layer_act->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return nullptr;
+
+  // Result of layer should not be used by others
+  if (loco::succs(layer).size() != 1)
+    return nullptr;
+
+  const auto channels = num_output_channels(layer, weights_const);
+  if (channels == 0 || bias_const->size<loco::DataType::FLOAT32>() != channels)
+    return nullptr;
+
+  if (!is_per_channel_const(constant, channels))
+    return nullptr;
+
+  *param = constant;
+  *weights = weights_const;
+  *bias = bias_const;
+  return layer;
+}
+
+void set_activation(luci::CircleNode *layer, luci::FusedActFunc act)
+{
+  auto layer_act = dynamic_cast<luci::LuciNodeMixin<luci::LuciNodeTrait::FusedActFunc> *>(layer);
+  assert(layer_act != nullptr);
+  layer_act->fusedActivationFunction(act);
+}
+
+/**
+ *  BEFORE
+ *
+ *    [Layer] --- [Mul(scale)] ---
+ *
+ *  AFTER
+ *
+ *    [Layer(weights * scale, bias * scale)] ---
+ */
+bool fuse_mul(luci::CircleMul *mul)
+{
+  luci::CircleConst *scale = nullptr;
+  luci::CircleConst *weights = nullptr;
+  luci::CircleConst *bias = nullptr;
+
+  auto layer = match_layer(mul, &scale, &weights, &bias);
+  if (layer == nullptr)
+    return false;
+
+  // NOTE weights and bias may be shared with other layers, so new constants are created
+  auto fused_weights = clone_const_shape(weights);
+  const auto weights_size = weights->size<loco::DataType::FLOAT32>();
+  fused_weights->size<loco::DataType::FLOAT32>(weights_size);
+  for (uint32_t n = 0; n < weights_size; ++n)
+  {
+    const auto c = output_channel_of(layer, weights, n);
+    fused_weights->at<loco::DataType::FLOAT32>(n) =
+        weights->at<loco::DataType::FLOAT32>(n) * scale->at<loco::DataType::FLOAT32>(c);
+  }
+
+  auto fused_bias = clone_const_shape(bias);
+  const auto bias_size = bias->size<loco::DataType::FLOAT32>();
+  fused_bias->size<loco::DataType::FLOAT32>(bias_size);
+  for (uint32_t c = 0; c < bias_size; ++c)
+  {
+    fused_bias->at<loco::DataType::FLOAT32>(c) =
+        bias->at<loco::DataType::FLOAT32>(c) * scale->at<loco::DataType::FLOAT32>(c);
+  }
+
+  set_weights(layer, fused_weights);
+  dynamic_cast<luci::LuciNodeMixin<luci::LuciNodeTrait::Bias> *>(layer)->bias(fused_bias);
+  set_activation(layer, mul->fusedActivationFunction());
+
+  replace(mul).with(layer);
+  return true;
+}
+
+/**
+ *  BEFORE
+ *
+ *    [Layer] --- [Add(shift)] ---
+ *
+ *  AFTER
+ *
+ *    [Layer(bias + shift)] ---
+ */
+bool fuse_add(luci::CircleAdd *add)
+{
+  luci::CircleConst *shift = nullptr;
+  luci::CircleConst *weights = nullptr;
+  luci::CircleConst *bias = nullptr;
+
+  auto layer = match_layer(add, &shift, &weights, &bias);
+  if (layer == nullptr)
+    return false;
+
+  auto fused_bias = clone_const_shape(bias);
+  const auto bias_size = bias->size<loco::DataType::FLOAT32>();
+  fused_bias->size<loco::DataType::FLOAT32>(bias_size);
+  for (uint32_t c = 0; c < bias_size; ++c)
+  {
+    fused_bias->at<loco::DataType::FLOAT32>(c) =
+        bias->at<loco::DataType::FLOAT32>(c) + shift->at<loco::DataType::FLOAT32>(c);
+  }
+
+  dynamic_cast<luci::LuciNodeMixin<luci::LuciNodeTrait::Bias> *>(layer)->bias(fused_bias);
+  set_activation(layer, add->fusedActivationFunction());
+
+  replace(add).with(layer);
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseBatchNormWithConvPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    if (auto mul = dynamic_cast<luci::CircleMul *>(node))
+    {
+      if (fuse_mul(mul))
+        changed = true;
+    }
+    else if (auto add = dynamic_cast<luci::CircleAdd *>(node))
+    {
+      if (fuse_add(add))
+        changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
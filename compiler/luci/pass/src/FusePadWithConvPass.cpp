@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FusePadWithConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/Service/ShapeInference.h>
+
+#include <algorithm>
+
+namespace
+{
+
+int64_t padding_at(luci::CircleConst *paddings, uint32_t n)
+{
+  if (paddings->dtype() == loco::DataType::S32)
+    return paddings->at<loco::DataType::S32>(n);
+  return paddings->at<loco::DataType::S64>(n);
+}
+
+/// @return true when 'before' and 'after' are the same as SAME padding of convolution
+bool is_same_padding(uint32_t in, uint32_t kernel, uint32_t stride, int64_t before, int64_t after)
+{
+  const int64_t out = (in + stride - 1) / stride;
+  const int64_t total = std::max<int64_t>((out - 1) * stride + kernel - in, 0);
+  return before == total / 2 && after == total - total / 2;
+}
+
+/**
+ *  BEFORE
+ *
+ *    [In] --- [Pad] --- [Conv(VALID)] ---
+ *
+ *  AFTER
+ *
+ *    [In] --- [Conv(SAME)] ---
+ *
+ *  NOTE Pad remains if it has other successors
+ */
+template <class CONV> bool fuse_pad(CONV *conv)
+{
+  if (conv->padding() != luci::Padding::VALID)
+    return false;
+
+  auto pad = dynamic_cast<luci::CirclePad *>(conv->input());
+  if (pad == nullptr)
+    return false;
+
+  auto paddings = dynamic_cast<luci::CircleConst *>(pad->paddings());
+  if (paddings == nullptr)
+    return false;
+  if (paddings->dtype() != loco::DataType::S32 && paddings->dtype() != loco::DataType::S64)
+    return false;
+  if (paddings->rank() != 2 || paddings->dim(0).value() != 4 || paddings->dim(1).value() != 2)
+    return false;
+
+  auto filter = dynamic_cast<luci::CircleConst *>(conv->filter());
+  if (filter == nullptr || filter->rank() != 4)
+    return false;
+
+  if (not loco::shape_known(pad->input()))
+    return false;
+  auto input_shape = loco::shape_get(pad->input()).template as<loco::TensorShape>();
+  if (input_shape.rank() != 4)
+    return false;
+
+  // Batch and channel should not be padded (NHWC)
+  if (padding_at(paddings, 0) != 0 || padding_at(paddings, 1) != 0 ||
+      padding_at(paddings, 6) != 0 || padding_at(paddings, 7) != 0)
+    return false;
+
+  // Filter is [O, H, W, I] for Conv2D and [1, H, W, O] for DepthwiseConv2D
+  const auto kernel_h = filter->dim(1).value();
+  const auto kernel_w = filter->dim(2).value();
+
+  if (!is_same_padding(input_shape.dim(1).value(), kernel_h, conv->stride()->h(),
+                       padding_at(paddings, 2), padding_at(paddings, 3)))
+    return false;
+  if (!is_same_padding(input_shape.dim(2).value(), kernel_w, conv->stride()->w(),
+                       padding_at(paddings, 4), padding_at(paddings, 5)))
+    return false;
+
+  conv->input(pad->input());
+  conv->padding(luci::Padding::SAME);
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FusePadWithConvPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    if (auto conv = dynamic_cast<luci::CircleConv2D *>(node))
+    {
+      if (fuse_pad(conv))
+        changed = true;
+    }
+    else if (auto dw_conv = dynamic_cast<luci::CircleDepthwiseConv2D *>(node))
+    {
+      if (fuse_pad(dw_conv))
+        changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
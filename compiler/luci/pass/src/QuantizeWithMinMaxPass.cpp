@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeWithMinMaxPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <loco/IR/Graph.h>
+#include <loco/Service/TypeInference.h>
+
+#include <oops/UserExn.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+constexpr int32_t kMinU8 = 0;
+constexpr int32_t kMaxU8 = 255;
+constexpr int32_t kMinS8 = -128;
+constexpr int32_t kMaxS8 = 127;
+
+bool has_min_max(const luci::CircleNode *node)
+{
+  auto qparam = node->quantparam();
+  return qparam != nullptr && !qparam->min.empty() && !qparam->max.empty();
+}
+
+bool has_scale(const luci::CircleNode *node)
+{
+  auto qparam = node->quantparam();
+  return qparam != nullptr && !qparam->scale.empty();
+}
+
+/// @brief Range of quantized values of 'dtype', which is U8 or S8
+void quantized_range(loco::DataType dtype, int32_t &qmin, int32_t &qmax)
+{
+  assert(dtype == loco::DataType::U8 || dtype == loco::DataType::S8);
+  qmin = dtype == loco::DataType::U8 ? kMinU8 : kMinS8;
+  qmax = dtype == loco::DataType::U8 ? kMaxU8 : kMaxS8;
+}
+
+/**
+ * @brief Compute asymmetric scale and zero point of 'dtype' for [min, max]
+ *
+ * @note  The range is extended to include 0 so that 0 is exactly representable
+ */
+void compute_asym_scale_zp(float min, float max, loco::DataType dtype, float &scale, int64_t &zp)
+{
+  int32_t qmin, qmax;
+  quantized_range(dtype, qmin, qmax);
+
+  const double rmin = std::min(0.0f, min);
+  const double rmax = std::max(0.0f, max);
+
+  double dscale = (rmax - rmin) / (qmax - qmin);
+  if (dscale == 0.0)
+  {
+    // All values are zero. Any positive scale works.
+    dscale = 1.0;
+  }
+
+  const double zp_from_min = qmin - rmin / dscale;
+  const double nudged_zp = std::round(zp_from_min);
+
+  scale = static_cast<float>(dscale);
+  zp = static_cast<int64_t>(std::min<double>(qmax, std::max<double>(qmin, nudged_zp)));
+}
+
+int32_t quantize(float value, float scale, int64_t zp, int32_t qmin, int32_t qmax)
+{
+  const int64_t q = static_cast<int64_t>(std::round(value / scale)) + zp;
+  return static_cast<int32_t>(std::min<int64_t>(qmax, std::max<int64_t>(qmin, q)));
+}
+
+std::vector<float> float_values(const luci::CircleConst *node)
+{
+  assert(node->dtype() == loco::DataType::FLOAT32);
+
+  const auto size = node->size<loco::DataType::FLOAT32>();
+  std::vector<float> values(size);
+  for (uint32_t i = 0; i < size; ++i)
+    values[i] = node->at<loco::DataType::FLOAT32>(i);
+  return values;
+}
+
+/// @brief Set dtype of 'node' and let type inference re-visit it
+void set_dtype(luci::CircleNode *node, loco::DataType dtype)
+{
+  node->dtype(dtype);
+  loco::dtype_erase(node);
+}
+
+/// @brief Quantize float 'node' to 'dtype' (U8 or S8) with a single scale/zero point
+void asym_quant_per_layer(luci::CircleConst *node, loco::DataType dtype)
+{
+  const auto values = float_values(node);
+  assert(!values.empty());
+
+  const auto minmax = std::minmax_element(values.begin(), values.end());
+  float scale;
+  int64_t zp;
+  compute_asym_scale_zp(*minmax.first, *minmax.second, dtype, scale, zp);
+
+  int32_t qmin, qmax;
+  quantized_range(dtype, qmin, qmax);
+  set_dtype(node, dtype);
+  if (dtype == loco::DataType::U8)
+  {
+    node->size<loco::DataType::U8>(values.size());
+    for (uint32_t i = 0; i < values.size(); ++i)
+      node->at<loco::DataType::U8>(i) = quantize(values[i], scale, zp, qmin, qmax);
+  }
+  else
+  {
+    node->size<loco::DataType::S8>(values.size());
+    for (uint32_t i = 0; i < values.size(); ++i)
+      node->at<loco::DataType::S8>(i) = quantize(values[i], scale, zp, qmin, qmax);
+  }
+
+  auto qparam = std::make_unique<luci::CircleQuantParam>();
+  qparam->min.push_back(*minmax.first);
+  qparam->max.push_back(*minmax.second);
+  qparam->scale.push_back(scale);
+  qparam->zerop.push_back(zp);
+  node->quantparam(std::move(qparam));
+}
+
+/**
+ * @brief Quantize float 'node' to int8 symmetrically with a scale for each index of 'channel_dim'
+ *
+ * @note  Values are in [-127, 127] so that zero points of all channels are 0
+ */
+void sym_quant_per_channel(luci::CircleConst *node, uint32_t channel_dim)
+{
+  assert(channel_dim < node->rank());
+
+  const auto values = float_values(node);
+  const uint32_t channels = node->dim(channel_dim).value();
+  uint32_t stride = 1;
+  for (uint32_t axis = channel_dim + 1; axis < node->rank(); ++axis)
+    stride *= node->dim(axis).value();
+
+  auto channel_of = [&](uint32_t n) { return (n / stride) % channels; };
+
+  std::vector<float> min(channels, 0.0f);
+  std::vector<float> max(channels, 0.0f);
+  for (uint32_t i = 0; i < values.size(); ++i)
+  {
+    const auto c = channel_of(i);
+    min[c] = std::min(min[c], values[i]);
+    max[c] = std::max(max[c], values[i]);
+  }
+
+  std::vector<float> scale(channels);
+  for (uint32_t c = 0; c < channels; ++c)
+  {
+    const float range = std::max(std::abs(min[c]), std::abs(max[c]));
+    // All values of the channel are zero. Any positive scale works.
+    scale[c] = range == 0.0f ? 1.0f : range / kMaxS8;
+  }
+
+  set_dtype(node, loco::DataType::S8);
+  node->size<loco::DataType::S8>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::S8>(i) = quantize(values[i], scale[channel_of(i)], 0, -kMaxS8, kMaxS8);
+
+  auto qparam = std::make_unique<luci::CircleQuantParam>();
+  qparam->min = std::move(min);
+  qparam->max = std::move(max);
+  qparam->scale = std::move(scale);
+  qparam->zerop.assign(channels, 0);
+  qparam->quantized_dimension = channel_dim;
+  node->quantparam(std::move(qparam));
+}
+
+/**
+ * @brief Create int32 bias from float 'bias' with scale of input * scale of weights
+ *
+ * @note  A new constant is created as 'bias' may be shared by layers of different input scale
+ */
+luci::CircleConst *quantize_bias(luci::CircleConst *bias, float input_scale,
+                                 const std::vector<float> &weights_scale)
+{
+  const auto values = float_values(bias);
+  const bool per_channel = weights_scale.size() > 1;
+  assert(!per_channel || weights_scale.size() == values.size());
+
+  auto qbias = bias->graph()->nodes()->create<luci::CircleConst>();
+  qbias->dtype(loco::DataType::S32);
+  qbias->rank(bias->rank());
+  for (uint32_t axis = 0; axis < bias->rank(); ++axis)
+    qbias->dim(axis) = bias->dim(axis);
+  qbias->name(bias->name());
+  qbias->size<loco::DataType::S32>(values.size());
+
+  auto qparam = std::make_unique<luci::CircleQuantParam>();
+  for (uint32_t c = 0; c < values.size(); ++c)
+  {
+    const float scale = input_scale * weights_scale.at(per_channel ? c : 0);
+    qbias->at<loco::DataType::S32>(c) = static_cast<int32_t>(std::round(values[c] / scale));
+    if (per_channel || c == 0)
+    {
+      qparam->scale.push_back(scale);
+      qparam->zerop.push_back(0);
+    }
+  }
+  qbias->quantparam(std::move(qparam));
+
+  return qbias;
+}
+
+/**
+ * @brief Quantize weights and bias of Conv2D, DepthwiseConv2D and FullyConnected
+ *
+ * Weights of uint8 are quantized per layer, as uint8 kernels take a single zero point of
+ * weights. Weights of int8 are quantized symmetrically per output channel.
+ *
+ * Layout of weights and the dimension of output channel
+ *   Conv2D          : [O, H, W, I], 0
+ *   DepthwiseConv2D : [1, H, W, O], 3
+ *   FullyConnected  : [O, I], 0
+ */
+template <class LAYER>
+bool quantize_layer(LAYER *layer, loco::Node *input, loco::Node *weights, uint32_t channel_dim,
+                    loco::DataType dtype)
+{
+  auto input_node = loco::must_cast<luci::CircleNode *>(input);
+  if (input_node->dtype() != dtype || !has_scale(input_node))
+    return false;
+
+  auto weights_const = dynamic_cast<luci::CircleConst *>(weights);
+  auto bias_const = dynamic_cast<luci::CircleConst *>(layer->bias());
+  if (weights_const == nullptr || bias_const == nullptr)
+    return false;
+
+  // Already quantized
+  if (bias_const->dtype() == loco::DataType::S32)
+    return false;
+  if (bias_const->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  if (weights_const->dtype() == loco::DataType::FLOAT32)
+  {
+    if (dtype == loco::DataType::S8)
+      sym_quant_per_channel(weights_const, channel_dim);
+    else
+      asym_quant_per_layer(weights_const, dtype);
+  }
+  if (weights_const->dtype() != dtype || !has_scale(weights_const))
+    return false;
+
+  const float input_scale = input_node->quantparam()->scale.at(0);
+  layer->bias(quantize_bias(bias_const, input_scale, weights_const->quantparam()->scale));
+  return true;
+}
+
+/**
+ * @brief Let operators that only move values have the same range as their input
+ *
+ * @note  uint8 kernels of these operators require the same scale for input and output
+ */
+bool propagate_input_range(luci::CircleNode *node)
+{
+  luci::CircleNode *input = nullptr;
+  if (auto reshape = dynamic_cast<luci::CircleReshape *>(node))
+    input = loco::must_cast<luci::CircleNode *>(reshape->tensor());
+  else if (auto maxpool = dynamic_cast<luci::CircleMaxPool2D *>(node))
+    input = loco::must_cast<luci::CircleNode *>(maxpool->value());
+  else
+    return false;
+
+  if (!has_min_max(node) || !has_min_max(input) || has_scale(node))
+    return false;
+
+  auto qparam = node->quantparam();
+  auto input_qparam = input->quantparam();
+  if (qparam->min == input_qparam->min && qparam->max == input_qparam->max)
+    return false;
+
+  qparam->min = input_qparam->min;
+  qparam->max = input_qparam->max;
+  return true;
+}
+
+/**
+ * @brief Get the fixed output range of operators whose quantized kernels assume it
+ *
+ *   Softmax, Logistic : [0, 1), scale of 1/256 and zero point of 0 (uint8) or -128 (int8)
+ *   Tanh              : [-1, 1), scale of 1/128 and zero point of 128 (uint8) or 0 (int8)
+ */
+bool fixed_output_range(const luci::CircleNode *node, loco::DataType dtype, float &scale,
+                        int64_t &zp)
+{
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::SOFTMAX:
+    case luci::CircleOpcode::LOGISTIC:
+      scale = 1.0f / 256;
+      zp = dtype == loco::DataType::U8 ? 0 : -128;
+      return true;
+    case luci::CircleOpcode::TANH:
+      scale = 1.0f / 128;
+      zp = dtype == loco::DataType::U8 ? 128 : 0;
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool is_virtual(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CONST:
+    case luci::CircleOpcode::CIRCLEOUTPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUTDUMMY:
+    case luci::CircleOpcode::CIRCLEOUTPUTEXCLUDE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool QuantizeWithMinMaxPass::run(loco::Graph *g)
+{
+  LOGGER(l);
+  INFO(l) << "QuantizeWithMinMaxPass Start" << std::endl;
+
+  if (_input_dtype != loco::DataType::FLOAT32)
+    throw oops::UserExn("Unsupported input type for quantization. Only float32 is supported");
+  if (_output_dtype != loco::DataType::U8 && _output_dtype != loco::DataType::S8)
+    throw oops::UserExn(
+        "Unsupported output type for quantization. Only uint8 and int8 are supported");
+  // Per-channel weights need int8 with zero points of 0, which are not supported with uint8
+  if (_output_dtype == loco::DataType::U8 &&
+      _granularity == QuantizationGranularity::ChannelWise)
+    throw oops::UserExn("Unsupported granularity for uint8 quantization. Only layer is supported");
+  // int8 kernels of the runtime take weights quantized per channel
+  if (_output_dtype == loco::DataType::S8 && _granularity == QuantizationGranularity::LayerWise)
+    throw oops::UserExn("Unsupported granularity for int8 quantization. Only channel is supported");
+
+  bool changed = false;
+  auto nodes = loco::active_nodes(loco::output_nodes(g));
+
+  // Pass 1: share the range of input for operators that only move values
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (propagate_input_range(circle_node))
+      changed = true;
+  }
+
+  // Pass 2: quantize activations with recorded min/max
+  for (auto node : nodes)
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (is_virtual(circle_node) || circle_node->dtype() != loco::DataType::FLOAT32)
+      continue;
+
+    float scale;
+    int64_t zp;
+    if (fixed_output_range(circle_node, _output_dtype, scale, zp))
+    {
+      if (circle_node->quantparam() == nullptr)
+        circle_node->quantparam(std::make_unique<luci::CircleQuantParam>());
+    }
+    else
+    {
+      if (!has_min_max(circle_node))
+        throw oops::UserExn("Activation has no min/max. Record min/max before quantization",
+                            circle_node->name());
+
+      auto qparam = circle_node->quantparam();
+      compute_asym_scale_zp(qparam->min.at(0), qparam->max.at(0), _output_dtype, scale, zp);
+    }
+
+    auto qparam = circle_node->quantparam();
+    qparam->scale = {scale};
+    qparam->zerop = {zp};
+    set_dtype(circle_node, _output_dtype);
+
+    if (auto input = dynamic_cast<luci::CircleInput *>(circle_node))
+      g->inputs()->at(input->index())->dtype(_output_dtype);
+
+    changed = true;
+  }
+
+  // Graph outputs follow the type of their values
+  for (auto node : loco::output_nodes(g))
+  {
+    auto output = loco::must_cast<luci::CircleOutput *>(node);
+    auto from = loco::must_cast<luci::CircleNode *>(output->from());
+    if (output->dtype() == from->dtype())
+      continue;
+
+    set_dtype(output, from->dtype());
+    g->outputs()->at(output->index())->dtype(from->dtype());
+    changed = true;
+  }
+
+  // Pass 3: quantize weights and bias of layers
+  for (auto node : nodes)
+  {
+    if (auto conv = dynamic_cast<luci::CircleConv2D *>(node))
+    {
+      if (quantize_layer(conv, conv->input(), conv->filter(), 0, _output_dtype))
+        changed = true;
+    }
+    else if (auto dwconv = dynamic_cast<luci::CircleDepthwiseConv2D *>(node))
+    {
+      if (quantize_layer(dwconv, dwconv->input(), dwconv->filter(), 3, _output_dtype))
+        changed = true;
+    }
+    else if (auto fc = dynamic_cast<luci::CircleFullyConnected *>(node))
+    {
+      if (quantize_layer(fc, fc->input(), fc->weights(), 0, _output_dtype))
+        changed = true;
+    }
+  }
+
+  // Pass 4: quantize remaining float constants used only by quantized operators
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto const_node = dynamic_cast<luci::CircleConst *>(node);
+    if (const_node == nullptr || const_node->dtype() != loco::DataType::FLOAT32)
+      continue;
+    if (const_node->size<loco::DataType::FLOAT32>() == 0)
+      continue;
+
+    auto succs = loco::succs(const_node);
+    bool all_quantized = !succs.empty();
+    for (auto succ : succs)
+    {
+      auto succ_node = loco::must_cast<luci::CircleNode *>(succ);
+      if (succ_node->dtype() != _output_dtype)
+        all_quantized = false;
+    }
+    if (!all_quantized)
+      continue;
+
+    asym_quant_per_layer(const_node, _output_dtype);
+    changed = true;
+  }
+
+  INFO(l) << "QuantizeWithMinMaxPass End" << std::endl;
+  return changed;
+}
+
+} // namespace luci
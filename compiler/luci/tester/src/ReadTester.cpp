@@ -66,7 +66,7 @@ int entry(int argc, char **argv)
   std::cout << "[INFO] Circle is '" << input_path << "'" << std::endl;
 
   // Load model from the file
-  std::unique_ptr<luci::Model> model = luci::load_model(input_path);
+  std::shared_ptr<luci::Model> model = luci::load_model(input_path);
   if (model == nullptr)
   {
     std::cerr << "ERROR: Failed to load '" << input_path << "'" << std::endl;
@@ -81,7 +81,8 @@ int entry(int argc, char **argv)
   }
 
   luci::Importer importer;
-  auto module = importer.importModule(input_model);
+  // Constants refer to the memory of 'model', which outlives 'module'
+  auto module = importer.importModule(input_model, model);
   assert(module->size() > 0);
 
   for (size_t g = 0; g < module->size(); ++g)
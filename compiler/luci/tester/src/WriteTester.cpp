@@ -109,7 +109,7 @@ int entry(int argc, char **argv)
   std::cout << "[INFO] Circle from '" << input_path << "' to '" << output_path << "'" << std::endl;
 
   // Load model from the file
-  std::unique_ptr<luci::Model> model = luci::load_model(input_path);
+  std::shared_ptr<luci::Model> model = luci::load_model(input_path);
   if (model == nullptr)
   {
     std::cerr << "ERROR: Failed to load '" << input_path << "'" << std::endl;
@@ -125,7 +125,8 @@ int entry(int argc, char **argv)
 
   // Import from input Circle file
   luci::Importer importer;
-  auto module = importer.importModule(input_model);
+  // Constants refer to the memory of 'model', which outlives 'module'
+  auto module = importer.importModule(input_model, model);
   assert(module->size() > 0);
 
   for (size_t g = 0; g < module->size(); ++g)
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecordMinMax.h"
+
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+
+using OptionHook = std::function<void(const char *)>;
+
+void print_help(const char *progname)
+{
+  std::cerr << "USAGE: " << progname << " [options]" << std::endl;
+  std::cerr << "   --input_model path : Float circle model to profile (required)" << std::endl;
+  std::cerr << "   --input_data path : List of input data (required)" << std::endl;
+  std::cerr << "                       ";
+  std::cerr << "Each line has raw binary files, one for each input of the model" << std::endl;
+  std::cerr << "   --output_model path : Circle model with recorded min/max (required)"
+            << std::endl;
+  std::cerr << "   --mode mode : 'percentile' (default) or 'minmax'" << std::endl;
+  std::cerr << "   --min_percentile value : Percentile of min for 'percentile' (default: 1.0)"
+            << std::endl;
+  std::cerr << "   --max_percentile value : Percentile of max for 'percentile' (default: 99.0)"
+            << std::endl;
+  std::cerr << std::endl;
+}
+
+int entry(int argc, char **argv)
+{
+  std::string input_model_path;
+  std::string input_data_path;
+  std::string output_model_path;
+  std::string mode("percentile");
+  float min_percentile = 1.0f;
+  float max_percentile = 99.0f;
+
+  // Simple argument parser (based on map)
+  std::map<std::string, OptionHook> argparse;
+
+  argparse["--input_model"] = [&](const char *arg) { input_model_path = arg; };
+  argparse["--input_data"] = [&](const char *arg) { input_data_path = arg; };
+  argparse["--output_model"] = [&](const char *arg) { output_model_path = arg; };
+  argparse["--mode"] = [&](const char *arg) { mode = arg; };
+  argparse["--min_percentile"] = [&](const char *arg) { min_percentile = std::stof(arg); };
+  argparse["--max_percentile"] = [&](const char *arg) { max_percentile = std::stof(arg); };
+
+  for (int n = 1; n < argc; n += 2)
+  {
+    const std::string tag{argv[n]};
+    auto it = argparse.find(tag);
+    if (it == argparse.end() || n + 1 >= argc)
+    {
+      std::cerr << "Option '" << tag << "' is not supported or has no value" << std::endl;
+      std::cerr << std::endl;
+      print_help(argv[0]);
+      return 255;
+    }
+
+    it->second(argv[n + 1]);
+  }
+
+  if (input_model_path.empty() || input_data_path.empty() || output_model_path.empty())
+  {
+    std::cerr << "ERROR: Failed to parse arguments" << std::endl;
+    std::cerr << std::endl;
+    print_help(argv[0]);
+    return 255;
+  }
+
+  record_minmax::RecordMinMax rmm;
+
+  // Initialize interpreter and observer
+  rmm.initialize(input_model_path);
+
+  // Profile min/max while executing the given input data
+  rmm.profileData(input_data_path);
+
+  // Write min/max to quantparam of the model
+  rmm.updateQuantParams(mode, min_percentile, max_percentile);
+
+  // Save profiled values to the model
+  rmm.saveModel(output_model_path);
+
+  return 0;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MINMAXOBSERVER_H__
+#define __RECORD_MINMAX_MINMAXOBSERVER_H__
+
+#include <luci_interpreter/Interpreter.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace record_minmax
+{
+
+struct MinMaxVectors
+{
+  // min/max of each inference
+  std::vector<float> min_vector;
+  std::vector<float> max_vector;
+};
+
+/**
+ * @brief Observer to record min/max of float tensors written during inference
+ */
+class MinMaxObserver : public luci_interpreter::ExecutionObserver
+{
+public:
+  void postTensorWrite(const luci::CircleNode *node, const void *data, size_t data_size) override;
+
+  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> &minmax(void) const
+  {
+    return _minmax;
+  }
+
+private:
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MINMAXOBSERVER_H__
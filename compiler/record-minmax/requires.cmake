@@ -0,0 +1,5 @@
+require("mio-circle")
+require("luci")
+require("luci-interpreter")
+require("safemain")
+require("oops")
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxObserver.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace record_minmax
+{
+
+void MinMaxObserver::postTensorWrite(const luci::CircleNode *node, const void *data,
+                                     size_t data_size)
+{
+  // Only float tensors are quantized with recorded min/max
+  if (node->dtype() != loco::DataType::FLOAT32)
+    return;
+
+  assert(data_size % sizeof(float) == 0);
+  const size_t num_elements = data_size / sizeof(float);
+  if (num_elements == 0)
+    return;
+
+  const auto *values = reinterpret_cast<const float *>(data);
+  const auto minmax = std::minmax_element(values, values + num_elements);
+
+  auto &vectors = _minmax[node];
+  vectors.min_vector.push_back(*minmax.first);
+  vectors.max_vector.push_back(*minmax.second);
+}
+
+} // namespace record_minmax
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecordMinMax.h"
+
+#include <luci/Importer.h>
+#include <luci/CircleExporter.h>
+#include <luci/IR/CircleQuantParam.h>
+
+#include <oops/UserExn.h>
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+class CircleExpContract : public luci::CircleExporter::Contract
+{
+public:
+  CircleExpContract(luci::Module *module, const std::string &filename)
+      : _module(module), _filepath(filename)
+  {
+    // NOTHING TO DO
+  }
+
+public:
+  loco::Graph *graph(void) const final { return nullptr; }
+  luci::Module *module(void) const final { return _module; };
+
+public:
+  bool store(const char *ptr, const size_t size) const final
+  {
+    std::ofstream fs(_filepath.c_str(), std::ofstream::binary);
+    fs.write(ptr, size);
+
+    return fs.good();
+  }
+
+private:
+  luci::Module *_module;
+  const std::string _filepath;
+};
+
+void readDataFromFile(const std::string &filename, char *data, size_t data_size)
+{
+  std::ifstream fs(filename, std::ifstream::binary);
+  if (fs.fail())
+    throw std::runtime_error("Cannot open file \"" + filename + "\".\n");
+  if (fs.read(data, data_size).fail())
+    throw std::runtime_error("Failed to read data from file \"" + filename + "\".\n");
+}
+
+template <typename NodeT> size_t getTensorSize(const NodeT *node)
+{
+  uint32_t tensor_size = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    tensor_size *= node->dim(i).value();
+  return tensor_size;
+}
+
+/**
+ * @brief Return 'percentile' (0 ~ 100) of 'values' with linear interpolation
+ */
+float getNthPercentile(std::vector<float> values, float percentile)
+{
+  assert(!values.empty());
+  if (percentile < 0 || percentile > 100)
+    throw oops::UserExn("Percentile must be in [0, 100]", percentile);
+
+  std::sort(values.begin(), values.end());
+
+  const float index = percentile / 100.0f * (values.size() - 1);
+  const size_t lower = static_cast<size_t>(index);
+  const size_t upper = std::min(lower + 1, values.size() - 1);
+  const float fraction = index - lower;
+
+  return values[lower] + (values[upper] - values[lower]) * fraction;
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+void RecordMinMax::initialize(const std::string &input_model_path)
+{
+  std::ifstream fs(input_model_path, std::ifstream::binary);
+  if (fs.fail())
+  {
+    throw std::runtime_error("Cannot open model file \"" + input_model_path + "\".\n");
+  }
+  // NOTE model_data is kept alive by constants of the module that refer to it
+  auto model_data = std::make_shared<std::vector<char>>((std::istreambuf_iterator<char>(fs)),
+                                                        std::istreambuf_iterator<char>());
+  _module = luci::Importer().importModule(circle::GetModel(model_data->data()), model_data);
+
+  if (_module == nullptr)
+  {
+    throw std::runtime_error("Failed to load '" + input_model_path + "'");
+  }
+
+  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+  _observer = std::make_unique<MinMaxObserver>();
+  _interpreter->attachObserver(_observer.get());
+}
+
+void RecordMinMax::profileData(const std::string &input_data_path)
+{
+  std::ifstream list(input_data_path);
+  if (list.fail())
+    throw std::runtime_error("Cannot open input data list \"" + input_data_path + "\".\n");
+
+  const auto input_nodes = loco::input_nodes(_module->graph());
+
+  uint32_t num_records = 0;
+  std::string line;
+  while (std::getline(list, line))
+  {
+    std::istringstream paths(line);
+    std::vector<std::string> input_files;
+    std::string path;
+    while (paths >> path)
+      input_files.push_back(path);
+
+    // Skip empty lines
+    if (input_files.empty())
+      continue;
+
+    if (input_files.size() != input_nodes.size())
+      throw oops::UserExn("Number of input files mismatches with inputs of the model", line);
+
+    for (uint32_t i = 0; i < input_nodes.size(); ++i)
+    {
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[i]);
+      std::vector<char> input_data(getTensorSize(input_node));
+      readDataFromFile(input_files[i], input_data.data(), input_data.size());
+      _interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
+    }
+
+    _interpreter->interpret();
+    num_records++;
+  }
+
+  if (num_records == 0)
+    throw std::runtime_error("No input data in \"" + input_data_path + "\".\n");
+
+  std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
+}
+
+void RecordMinMax::updateQuantParams(const std::string &mode, float min_percentile,
+                                     float max_percentile)
+{
+  if (mode != "minmax" && mode != "percentile")
+    throw oops::UserExn("Unsupported mode", mode);
+
+  for (const auto &item : _observer->minmax())
+  {
+    // NOTE quantparam of node is updated while the observer only reads it
+    auto node = const_cast<luci::CircleNode *>(item.first);
+    const auto &vectors = item.second;
+
+    float min, max;
+    if (mode == "minmax")
+    {
+      min = *std::min_element(vectors.min_vector.begin(), vectors.min_vector.end());
+      max = *std::max_element(vectors.max_vector.begin(), vectors.max_vector.end());
+    }
+    else
+    {
+      min = getNthPercentile(vectors.min_vector, min_percentile);
+      max = getNthPercentile(vectors.max_vector, max_percentile);
+    }
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min.push_back(min);
+    quantparam->max.push_back(max);
+    node->quantparam(std::move(quantparam));
+  }
+}
+
+void RecordMinMax::saveModel(const std::string &output_model_path)
+{
+  luci::CircleExporter exporter;
+
+  CircleExpContract contract(_module.get(), output_model_path);
+
+  if (!exporter.invoke(&contract))
+  {
+    throw std::runtime_error("Failed to export '" + output_model_path + "'");
+  }
+}
+
+} // namespace record_minmax
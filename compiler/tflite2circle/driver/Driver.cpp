@@ -22,13 +22,14 @@
 
 int entry(int argc, char **argv)
 {
-  if (argc != 3)
+  if (argc != 3 && argc != 4)
   {
     std::cerr << "ERROR: Failed to parse arguments" << std::endl;
     std::cerr << std::endl;
-    std::cerr << "USAGE: " << argv[0] << " [tflite] [circle]" << std::endl;
+    std::cerr << "USAGE: " << argv[0] << " [tflite] [circle] [weights (optional)]" << std::endl;
     return 255;
   }
+  const bool external_weights = (argc == 4);
 
   // read tflite file
   tflite2circle::TFLModel tfl_model(argv[1]);
@@ -42,7 +43,7 @@ int entry(int argc, char **argv)
   auto flatbuffer_builder = stdex::make_unique<flatbuffers::FlatBufferBuilder>(1024);
 
   // convert tflite to circle
-  tflite2circle::CircleModel circle_model{flatbuffer_builder, tfl_model};
+  tflite2circle::CircleModel circle_model{flatbuffer_builder, tfl_model, external_weights};
 
   std::ofstream outfile{argv[2], std::ios::binary};
 
@@ -55,5 +56,18 @@ int entry(int argc, char **argv)
     return 255;
   }
 
+  if (external_weights)
+  {
+    const auto &weights = circle_model.weights();
+    std::ofstream weightsfile{argv[3], std::ios::binary};
+    weightsfile.write(reinterpret_cast<const char *>(weights.data()), weights.size());
+    weightsfile.close();
+    if (weightsfile.fail())
+    {
+      std::cerr << "ERROR: Failed to write weights '" << argv[3] << "'" << std::endl;
+      return 255;
+    }
+  }
+
   return 0;
 }
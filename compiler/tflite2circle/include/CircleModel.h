@@ -65,6 +65,9 @@ private:
 public:
   Offset(void) = delete;
   Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec);
+  // Stores contents to 'weights' instead of 'fb' (only for BufferLink)
+  Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec,
+         std::vector<uint8_t> &weights);
 
 public:
   CIRFlatBufVecOffset offset(void) const { return _circle_flatbuffer_vec_offset; }
@@ -80,12 +83,14 @@ private:
 
 public:
   CircleModel(void) = delete;
-  CircleModel(FlatBufBuilder &fb, TFLModel &tfl_model);
+  CircleModel(FlatBufBuilder &fb, TFLModel &tfl_model, bool external_weights = false);
 
 public:
   void model_build(void) const;
   const char *base(void) const;
   size_t size(void) const;
+  // Contents of external weights file, empty if weights are stored in the model
+  const std::vector<uint8_t> &weights(void) const { return _weights; }
 
 private:
   uint32_t _version;
@@ -95,6 +100,7 @@ private:
   std::unique_ptr<Offset<SubGraphLink>> _subGraphs_offset;
   std::unique_ptr<Offset<BufferLink>> _buffers_offset;
   std::unique_ptr<Offset<MetaDataBufferLink>> _metadata_buffer_offset;
+  std::vector<uint8_t> _weights;
 };
 
 } // namespace tflite2circle
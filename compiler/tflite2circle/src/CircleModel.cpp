@@ -53,6 +53,33 @@ Offset<BufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatb
   _circle_flatbuffer_vec_offset = fb->CreateVector(buffers_vec);
 }
 
+template <>
+Offset<BufferLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec,
+                           std::vector<uint8_t> &weights)
+{
+  // Each buffer in external weights file starts at this alignment
+  const size_t alignment = 64;
+
+  std::vector<flatbuffers::Offset<circle::Buffer>> buffers_vec;
+
+  for (auto it : *tflite_flatbuffer_vec)
+  {
+    circle::BufferBuilder circle_buffer_builder{*fb};
+    if (it->data() && it->data()->size() > 0)
+    {
+      const size_t offset = (weights.size() + alignment - 1) / alignment * alignment;
+      weights.resize(offset, 0);
+      weights.insert(weights.end(), it->data()->begin(), it->data()->end());
+
+      circle_buffer_builder.add_offset(offset);
+      circle_buffer_builder.add_size(it->data()->size());
+    }
+    auto circle_buffers = circle_buffer_builder.Finish();
+    buffers_vec.emplace_back(circle_buffers);
+  }
+  _circle_flatbuffer_vec_offset = fb->CreateVector(buffers_vec);
+}
+
 template <>
 Offset<SubGraphLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite_flatbuffer_vec)
 {
@@ -218,14 +245,17 @@ Offset<OperatorCodeLink>::Offset(FlatBufBuilder &fb, const TFLFlatBufVec *tflite
   _circle_flatbuffer_vec_offset = fb->CreateVector(operator_code_vec);
 }
 
-CircleModel::CircleModel(FlatBufBuilder &fb, TFLModel &model)
+CircleModel::CircleModel(FlatBufBuilder &fb, TFLModel &model, bool external_weights)
     : _version{0}, _description{fb->CreateString("nnpackage")}, _fb{fb}
 {
   const tflite::Model *tfl_model = model.load_model();
   _operator_codes_offset =
       stdex::make_unique<Offset<OperatorCodeLink>>(fb, tfl_model->operator_codes());
   _subGraphs_offset = stdex::make_unique<Offset<SubGraphLink>>(fb, tfl_model->subgraphs());
-  _buffers_offset = stdex::make_unique<Offset<BufferLink>>(fb, tfl_model->buffers());
+  if (external_weights)
+    _buffers_offset = stdex::make_unique<Offset<BufferLink>>(fb, tfl_model->buffers(), _weights);
+  else
+    _buffers_offset = stdex::make_unique<Offset<BufferLink>>(fb, tfl_model->buffers());
   _metadata_buffer_offset =
       stdex::make_unique<Offset<MetaDataBufferLink>>(fb, tfl_model->metadata_buffer());
   model_build();
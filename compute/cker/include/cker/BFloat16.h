@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BFLOAT16_H__
+#define __NNFW_CKER_BFLOAT16_H__
+
+#include <cstdint>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief bfloat16 value, the upper 16 bits of IEEE 754 binary32
+ *
+ * It has the same exponent range as float, so weights never overflow when they are narrowed.
+ * Widening to float is just a shift.
+ */
+struct BFloat16
+{
+  uint16_t bits;
+
+  BFloat16() = default;
+
+  // Round to nearest even
+  explicit BFloat16(float value)
+  {
+    uint32_t u;
+    std::memcpy(&u, &value, sizeof(u));
+    if ((u & 0x7fffffffu) > 0x7f800000u)
+    {
+      // Keep NaN as quiet NaN (rounding could turn it into infinity)
+      bits = static_cast<uint16_t>((u >> 16) | 0x0040u);
+      return;
+    }
+    u += 0x7fffu + ((u >> 16) & 1u);
+    bits = static_cast<uint16_t>(u >> 16);
+  }
+
+  operator float() const
+  {
+    const uint32_t u = static_cast<uint32_t>(bits) << 16;
+    float value;
+    std::memcpy(&value, &u, sizeof(value));
+    return value;
+  }
+};
+
+static_assert(sizeof(BFloat16) == 2, "BFloat16 must be 2 bytes");
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BFLOAT16_H__
@@ -18,6 +18,8 @@
 #ifndef __NNFW_CKER_TYPES_H__
 #define __NNFW_CKER_TYPES_H__
 
+#include "cker/Shape.h"
+
 #include <cstdint>
 #include <type_traits>
 #include <limits>
@@ -33,6 +35,8 @@ enum class FusedActivationFunctionType
   kRelu6 = 1,
   kRelu1 = 2,
   kRelu = 3,
+  kTanh = 4,
+  kSigmoid = 5,
 };
 enum class PaddingType
 {
@@ -251,6 +255,43 @@ struct FullyConnectedParams
   // FullyConnectedWeightsFormat weights_format;
 };
 
+struct BatchMatMulParams
+{
+  // Use the transpose of the last two dimensions of lhs/rhs
+  bool adj_x;
+  bool adj_y;
+};
+
+struct LSTMParams
+{
+  // Activation of the cell input and the cell output
+  FusedActivationFunctionType activation;
+  // Cell state is clipped to [-cell_clip, cell_clip] if it is larger than 0
+  float cell_clip;
+  // Output is clipped to [-projection_clip, projection_clip] if it is larger than 0
+  float projection_clip;
+};
+
+struct RNNParams
+{
+  FusedActivationFunctionType activation;
+  // Scales of int8 weights in hybrid RNN
+  float weights_scale;
+  float recurrent_weights_scale;
+};
+
+struct ResizeBilinearParams
+{
+  bool align_corners;
+  bool half_pixel_centers;
+};
+
+struct SpaceToBatchParams
+{
+  // "Zero" padding for uint8 means padding with the output offset.
+  int32_t output_offset;
+};
+
 struct GatherParams
 {
   int32_t axis;
@@ -0,0 +1,717 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_TENSOR_UTILS_H__
+#define __NNFW_CKER_X86_TENSOR_UTILS_H__
+
+#include "cker/PortableTensorUtils.h"
+#include "cker/x86/x86_check.h"
+
+#ifdef USE_X86_SIMD
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#define CKER_TARGET_SSE4 __attribute__((target("sse4.1")))
+#define CKER_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define CKER_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace x86_detail
+{
+
+// Quantize 'value' to [-127, 127] as PortableSymmetricQuantizeFloats does
+inline int8_t QuantizeScalar(float value, float scaling_factor_inv)
+{
+  const int kScale = 127;
+  const int32_t quantized_value = static_cast<int32_t>(std::round(value * scaling_factor_inv));
+  return static_cast<int8_t>(std::min(kScale, std::max(-kScale, quantized_value)));
+}
+
+// Quantize 4 floats to int32 in [-127, 127]
+// Rounds half away from zero like NeonSymmetricQuantizeFloats: (int)(x + sign(x) * 0.5)
+CKER_TARGET_SSE4 inline __m128i Quantize(const float *src, __m128 q_factor)
+{
+  const __m128 mul = _mm_mul_ps(_mm_loadu_ps(src), q_factor);
+  const __m128 half = _mm_or_ps(_mm_and_ps(mul, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+  const __m128i q = _mm_cvttps_epi32(_mm_add_ps(mul, half));
+  return _mm_min_epi32(_mm_max_epi32(q, _mm_set1_epi32(-127)), _mm_set1_epi32(127));
+}
+
+CKER_TARGET_SSE4 inline float HorizontalSum(__m128 v)
+{
+  __m128 shuf = _mm_movehdup_ps(v);
+  __m128 sums = _mm_add_ps(v, shuf);
+  shuf = _mm_movehl_ps(shuf, sums);
+  sums = _mm_add_ss(sums, shuf);
+  return _mm_cvtss_f32(sums);
+}
+
+CKER_TARGET_SSE4 inline int32_t HorizontalSum(__m128i v)
+{
+  __m128i hi = _mm_unpackhi_epi64(v, v);
+  __m128i sum = _mm_add_epi32(v, hi);
+  hi = _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1));
+  sum = _mm_add_epi32(sum, hi);
+  return _mm_cvtsi128_si32(sum);
+}
+
+CKER_TARGET_AVX2 inline float HorizontalSum(__m256 v)
+{
+  const __m128 lo = _mm256_castps256_ps128(v);
+  const __m128 hi = _mm256_extractf128_ps(v, 1);
+  return HorizontalSum(_mm_add_ps(lo, hi));
+}
+
+CKER_TARGET_AVX2 inline int32_t HorizontalSum(__m256i v)
+{
+  const __m128i lo = _mm256_castsi256_si128(v);
+  const __m128i hi = _mm256_extracti128_si256(v, 1);
+  return HorizontalSum(_mm_add_epi32(lo, hi));
+}
+
+} // namespace x86_detail
+
+//
+// SSE4.1
+//
+CKER_TARGET_SSE4 inline bool Sse4IsZeroVector(const float *vector, int v_size)
+{
+  const __m128 zero = _mm_setzero_ps();
+  int i = 0;
+  for (; i + 4 <= v_size; i += 4)
+  {
+    const __m128 v = _mm_loadu_ps(vector + i);
+    if (_mm_movemask_ps(_mm_cmpneq_ps(v, zero)) != 0)
+      return false;
+  }
+  for (; i < v_size; ++i)
+  {
+    if (vector[i] != 0.0f)
+      return false;
+  }
+  return true;
+}
+
+CKER_TARGET_SSE4 inline void Sse4SymmetricQuantizeFloats(const float *values, const int size,
+                                                         int8_t *quantized_values, float *min_value,
+                                                         float *max_value, float *scaling_factor)
+{
+  if (size <= 0)
+  {
+    PortableSymmetricQuantizeFloats(values, size, quantized_values, min_value, max_value,
+                                    scaling_factor);
+    return;
+  }
+
+  int i = 0;
+  float min_v = values[0];
+  float max_v = values[0];
+  if (size >= 4)
+  {
+    __m128 min_f32x4 = _mm_loadu_ps(values);
+    __m128 max_f32x4 = min_f32x4;
+    for (i = 4; i + 4 <= size; i += 4)
+    {
+      const __m128 v = _mm_loadu_ps(values + i);
+      min_f32x4 = _mm_min_ps(min_f32x4, v);
+      max_f32x4 = _mm_max_ps(max_f32x4, v);
+    }
+    float mins[4], maxs[4];
+    _mm_storeu_ps(mins, min_f32x4);
+    _mm_storeu_ps(maxs, max_f32x4);
+    min_v = *std::min_element(mins, mins + 4);
+    max_v = *std::max_element(maxs, maxs + 4);
+  }
+  for (; i < size; ++i)
+  {
+    min_v = std::min(min_v, values[i]);
+    max_v = std::max(max_v, values[i]);
+  }
+  *min_value = min_v;
+  *max_value = max_v;
+
+  const int kScale = 127;
+  const float range = std::max(std::abs(min_v), std::abs(max_v));
+  if (range == 0)
+  {
+    memset(quantized_values, 0, size * sizeof(int8_t));
+    *scaling_factor = 1;
+    return;
+  }
+  *scaling_factor = range / kScale;
+  const float scaling_factor_inv = kScale / range;
+
+  const __m128 q_factor = _mm_set1_ps(scaling_factor_inv);
+
+  i = 0;
+  for (; i + 16 <= size; i += 16)
+  {
+    const __m128i q0 = x86_detail::Quantize(values + i, q_factor);
+    const __m128i q1 = x86_detail::Quantize(values + i + 4, q_factor);
+    const __m128i q2 = x86_detail::Quantize(values + i + 8, q_factor);
+    const __m128i q3 = x86_detail::Quantize(values + i + 12, q_factor);
+    const __m128i q01 = _mm_packs_epi32(q0, q1);
+    const __m128i q23 = _mm_packs_epi32(q2, q3);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(quantized_values + i), _mm_packs_epi16(q01, q23));
+  }
+  for (; i < size; ++i)
+  {
+    quantized_values[i] = x86_detail::QuantizeScalar(values[i], scaling_factor_inv);
+  }
+}
+
+CKER_TARGET_SSE4 inline void Sse4MatrixBatchVectorMultiplyAccumulate(
+    const int8_t *__restrict__ matrix, const int m_rows, const int m_cols,
+    const int8_t *__restrict__ vectors, const float *scaling_factors, int n_batch,
+    float *__restrict__ result, int result_stride)
+{
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols)
+  {
+    const float batch_scaling_factor = scaling_factors[batch];
+    const int8_t *row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, result += result_stride)
+    {
+      // Products of two int8 in [-127, 127] are summed in pairs by madd, which never overflows
+      __m128i dotprod_32x4 = _mm_setzero_si128();
+      int col = 0;
+      for (; col + 16 <= m_cols; col += 16)
+      {
+        const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row_ptr + col));
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(vectors + col));
+        const __m128i r_lo = _mm_cvtepi8_epi16(r);
+        const __m128i r_hi = _mm_cvtepi8_epi16(_mm_unpackhi_epi64(r, r));
+        const __m128i v_lo = _mm_cvtepi8_epi16(v);
+        const __m128i v_hi = _mm_cvtepi8_epi16(_mm_unpackhi_epi64(v, v));
+        dotprod_32x4 = _mm_add_epi32(dotprod_32x4, _mm_madd_epi16(r_lo, v_lo));
+        dotprod_32x4 = _mm_add_epi32(dotprod_32x4, _mm_madd_epi16(r_hi, v_hi));
+      }
+      int32_t dotprod = x86_detail::HorizontalSum(dotprod_32x4);
+      for (; col < m_cols; ++col)
+      {
+        dotprod += row_ptr[col] * vectors[col];
+      }
+      *result += dotprod * batch_scaling_factor;
+    }
+  }
+}
+
+CKER_TARGET_SSE4 inline void Sse4MatrixBatchVectorMultiplyAccumulate(const float *matrix,
+                                                                     int m_rows, int m_cols,
+                                                                     const float *vector,
+                                                                     int n_batch, float *result,
+                                                                     int result_stride)
+{
+  for (int b = 0; b < n_batch; b++)
+  {
+    float *result_in_batch = result + b * m_rows * result_stride;
+    const float *vector_in_batch = vector + b * m_cols;
+    const float *matrix_row = matrix;
+    for (int r = 0; r < m_rows; r++, matrix_row += m_cols, result_in_batch += result_stride)
+    {
+      __m128 acc_f32x4 = _mm_setzero_ps();
+      int c = 0;
+      for (; c + 4 <= m_cols; c += 4)
+      {
+        const __m128 m = _mm_loadu_ps(matrix_row + c);
+        const __m128 v = _mm_loadu_ps(vector_in_batch + c);
+        acc_f32x4 = _mm_add_ps(acc_f32x4, _mm_mul_ps(m, v));
+      }
+      float dot_prod = x86_detail::HorizontalSum(acc_f32x4);
+      for (; c < m_cols; c++)
+      {
+        dot_prod += matrix_row[c] * vector_in_batch[c];
+      }
+      *result_in_batch += dot_prod;
+    }
+  }
+}
+
+//
+// AVX2 (with FMA)
+//
+CKER_TARGET_AVX2 inline bool Avx2IsZeroVector(const float *vector, int v_size)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  int i = 0;
+  for (; i + 8 <= v_size; i += 8)
+  {
+    const __m256 v = _mm256_loadu_ps(vector + i);
+    if (_mm256_movemask_ps(_mm256_cmp_ps(v, zero, _CMP_NEQ_UQ)) != 0)
+      return false;
+  }
+  for (; i < v_size; ++i)
+  {
+    if (vector[i] != 0.0f)
+      return false;
+  }
+  return true;
+}
+
+CKER_TARGET_AVX2 inline void Avx2SymmetricQuantizeFloats(const float *values, const int size,
+                                                         int8_t *quantized_values, float *min_value,
+                                                         float *max_value, float *scaling_factor)
+{
+  if (size < 8)
+  {
+    PortableSymmetricQuantizeFloats(values, size, quantized_values, min_value, max_value,
+                                    scaling_factor);
+    return;
+  }
+
+  int i = 8;
+  __m256 min_f32x8 = _mm256_loadu_ps(values);
+  __m256 max_f32x8 = min_f32x8;
+  for (; i + 8 <= size; i += 8)
+  {
+    const __m256 v = _mm256_loadu_ps(values + i);
+    min_f32x8 = _mm256_min_ps(min_f32x8, v);
+    max_f32x8 = _mm256_max_ps(max_f32x8, v);
+  }
+  float mins[8], maxs[8];
+  _mm256_storeu_ps(mins, min_f32x8);
+  _mm256_storeu_ps(maxs, max_f32x8);
+  float min_v = *std::min_element(mins, mins + 8);
+  float max_v = *std::max_element(maxs, maxs + 8);
+  for (; i < size; ++i)
+  {
+    min_v = std::min(min_v, values[i]);
+    max_v = std::max(max_v, values[i]);
+  }
+  *min_value = min_v;
+  *max_value = max_v;
+
+  const int kScale = 127;
+  const float range = std::max(std::abs(min_v), std::abs(max_v));
+  if (range == 0)
+  {
+    memset(quantized_values, 0, size * sizeof(int8_t));
+    *scaling_factor = 1;
+    return;
+  }
+  *scaling_factor = range / kScale;
+  const float scaling_factor_inv = kScale / range;
+
+  const __m256 q_factor = _mm256_set1_ps(scaling_factor_inv);
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  const __m256 point5 = _mm256_set1_ps(0.5f);
+  const __m256i scale = _mm256_set1_epi32(kScale);
+  const __m256i neg_scale = _mm256_set1_epi32(-kScale);
+
+  i = 0;
+  for (; i + 8 <= size; i += 8)
+  {
+    const __m256 mul = _mm256_mul_ps(_mm256_loadu_ps(values + i), q_factor);
+    const __m256 half = _mm256_or_ps(_mm256_and_ps(mul, sign_mask), point5);
+    __m256i q = _mm256_cvttps_epi32(_mm256_add_ps(mul, half));
+    q = _mm256_min_epi32(_mm256_max_epi32(q, neg_scale), scale);
+    // Pack 8 x int32 to 8 x int8. Packs of AVX2 work per 128-bit lane, so use halves instead.
+    const __m128i q16 =
+        _mm_packs_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(quantized_values + i), _mm_packs_epi16(q16, q16));
+  }
+  for (; i < size; ++i)
+  {
+    quantized_values[i] = x86_detail::QuantizeScalar(values[i], scaling_factor_inv);
+  }
+}
+
+CKER_TARGET_AVX2 inline void Avx2MatrixBatchVectorMultiplyAccumulate(
+    const int8_t *__restrict__ matrix, const int m_rows, const int m_cols,
+    const int8_t *__restrict__ vectors, const float *scaling_factors, int n_batch,
+    float *__restrict__ result, int result_stride)
+{
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols)
+  {
+    const float batch_scaling_factor = scaling_factors[batch];
+    const int8_t *row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, result += result_stride)
+    {
+      __m256i dotprod_32x8 = _mm256_setzero_si256();
+      int col = 0;
+      for (; col + 16 <= m_cols; col += 16)
+      {
+        const __m256i r = _mm256_cvtepi8_epi16(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(row_ptr + col)));
+        const __m256i v = _mm256_cvtepi8_epi16(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(vectors + col)));
+        dotprod_32x8 = _mm256_add_epi32(dotprod_32x8, _mm256_madd_epi16(r, v));
+      }
+      int32_t dotprod = x86_detail::HorizontalSum(dotprod_32x8);
+      for (; col < m_cols; ++col)
+      {
+        dotprod += row_ptr[col] * vectors[col];
+      }
+      *result += dotprod * batch_scaling_factor;
+    }
+  }
+}
+
+CKER_TARGET_AVX2 inline void Avx2MatrixBatchVectorMultiplyAccumulate(const float *matrix,
+                                                                     int m_rows, int m_cols,
+                                                                     const float *vector,
+                                                                     int n_batch, float *result,
+                                                                     int result_stride)
+{
+  for (int b = 0; b < n_batch; b++)
+  {
+    float *result_in_batch = result + b * m_rows * result_stride;
+    const float *vector_in_batch = vector + b * m_cols;
+    const float *matrix_row = matrix;
+    for (int r = 0; r < m_rows; r++, matrix_row += m_cols, result_in_batch += result_stride)
+    {
+      // Two accumulators hide the latency of FMA
+      __m256 acc0_f32x8 = _mm256_setzero_ps();
+      __m256 acc1_f32x8 = _mm256_setzero_ps();
+      int c = 0;
+      for (; c + 16 <= m_cols; c += 16)
+      {
+        acc0_f32x8 = _mm256_fmadd_ps(_mm256_loadu_ps(matrix_row + c),
+                                     _mm256_loadu_ps(vector_in_batch + c), acc0_f32x8);
+        acc1_f32x8 = _mm256_fmadd_ps(_mm256_loadu_ps(matrix_row + c + 8),
+                                     _mm256_loadu_ps(vector_in_batch + c + 8), acc1_f32x8);
+      }
+      for (; c + 8 <= m_cols; c += 8)
+      {
+        acc0_f32x8 = _mm256_fmadd_ps(_mm256_loadu_ps(matrix_row + c),
+                                     _mm256_loadu_ps(vector_in_batch + c), acc0_f32x8);
+      }
+      float dot_prod = x86_detail::HorizontalSum(_mm256_add_ps(acc0_f32x8, acc1_f32x8));
+      for (; c < m_cols; c++)
+      {
+        dot_prod += matrix_row[c] * vector_in_batch[c];
+      }
+      *result_in_batch += dot_prod;
+    }
+  }
+}
+
+//
+// AVX-512 (F and BW)
+//
+// NOTE GCC 12 reports -Wmaybe-uninitialized on _mm512_undefined_* used by many AVX-512
+//      intrinsics (GCC PR105593), which breaks -Werror builds
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace x86_detail
+{
+
+// Reductions are done by 256-bit halves instead of _mm512_reduce_*, which GCC 12 also warns on
+// NOTE _mm512_extractf32x8_ps needs AVX512DQ, so the upper half is extracted as 4 doubles
+CKER_TARGET_AVX512 inline __m256 UpperHalf(__m512 v)
+{
+  return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1));
+}
+
+CKER_TARGET_AVX512 inline float HorizontalSum(__m512 v)
+{
+  return HorizontalSum(_mm256_add_ps(_mm512_castps512_ps256(v), UpperHalf(v)));
+}
+
+CKER_TARGET_AVX512 inline int32_t HorizontalSum(__m512i v)
+{
+  return HorizontalSum(
+      _mm256_add_epi32(_mm512_castsi512_si256(v), _mm512_extracti64x4_epi64(v, 1)));
+}
+
+CKER_TARGET_AVX512 inline float HorizontalMin(__m512 v)
+{
+  const __m256 v8 = _mm256_min_ps(_mm512_castps512_ps256(v), UpperHalf(v));
+  __m128 v4 = _mm_min_ps(_mm256_castps256_ps128(v8), _mm256_extractf128_ps(v8, 1));
+  v4 = _mm_min_ps(v4, _mm_movehl_ps(v4, v4));
+  v4 = _mm_min_ss(v4, _mm_movehdup_ps(v4));
+  return _mm_cvtss_f32(v4);
+}
+
+CKER_TARGET_AVX512 inline float HorizontalMax(__m512 v)
+{
+  const __m256 v8 = _mm256_max_ps(_mm512_castps512_ps256(v), UpperHalf(v));
+  __m128 v4 = _mm_max_ps(_mm256_castps256_ps128(v8), _mm256_extractf128_ps(v8, 1));
+  v4 = _mm_max_ps(v4, _mm_movehl_ps(v4, v4));
+  v4 = _mm_max_ss(v4, _mm_movehdup_ps(v4));
+  return _mm_cvtss_f32(v4);
+}
+
+} // namespace x86_detail
+
+CKER_TARGET_AVX512 inline bool Avx512IsZeroVector(const float *vector, int v_size)
+{
+  const __m512 zero = _mm512_setzero_ps();
+  int i = 0;
+  for (; i + 16 <= v_size; i += 16)
+  {
+    const __m512 v = _mm512_loadu_ps(vector + i);
+    if (_mm512_cmp_ps_mask(v, zero, _CMP_NEQ_UQ) != 0)
+      return false;
+  }
+  for (; i < v_size; ++i)
+  {
+    if (vector[i] != 0.0f)
+      return false;
+  }
+  return true;
+}
+
+CKER_TARGET_AVX512 inline void Avx512SymmetricQuantizeFloats(const float *values, const int size,
+                                                             int8_t *quantized_values,
+                                                             float *min_value, float *max_value,
+                                                             float *scaling_factor)
+{
+  if (size < 16)
+  {
+    PortableSymmetricQuantizeFloats(values, size, quantized_values, min_value, max_value,
+                                    scaling_factor);
+    return;
+  }
+
+  int i = 16;
+  __m512 min_f32x16 = _mm512_loadu_ps(values);
+  __m512 max_f32x16 = min_f32x16;
+  for (; i + 16 <= size; i += 16)
+  {
+    const __m512 v = _mm512_loadu_ps(values + i);
+    min_f32x16 = _mm512_min_ps(min_f32x16, v);
+    max_f32x16 = _mm512_max_ps(max_f32x16, v);
+  }
+  float min_v = x86_detail::HorizontalMin(min_f32x16);
+  float max_v = x86_detail::HorizontalMax(max_f32x16);
+  for (; i < size; ++i)
+  {
+    min_v = std::min(min_v, values[i]);
+    max_v = std::max(max_v, values[i]);
+  }
+  *min_value = min_v;
+  *max_value = max_v;
+
+  const int kScale = 127;
+  const float range = std::max(std::abs(min_v), std::abs(max_v));
+  if (range == 0)
+  {
+    memset(quantized_values, 0, size * sizeof(int8_t));
+    *scaling_factor = 1;
+    return;
+  }
+  *scaling_factor = range / kScale;
+  const float scaling_factor_inv = kScale / range;
+
+  const __m512 q_factor = _mm512_set1_ps(scaling_factor_inv);
+  const __m512i sign_mask = _mm512_set1_epi32(static_cast<int32_t>(0x80000000u));
+  const __m512i point5 = _mm512_castps_si512(_mm512_set1_ps(0.5f));
+  const __m512i scale = _mm512_set1_epi32(kScale);
+  const __m512i neg_scale = _mm512_set1_epi32(-kScale);
+
+  i = 0;
+  for (; i + 16 <= size; i += 16)
+  {
+    const __m512 mul = _mm512_mul_ps(_mm512_loadu_ps(values + i), q_factor);
+    // NOTE Bitwise ops on float vectors need AVX512DQ, so do them on integer vectors
+    const __m512 half = _mm512_castsi512_ps(
+        _mm512_or_si512(_mm512_and_si512(_mm512_castps_si512(mul), sign_mask), point5));
+    __m512i q = _mm512_cvttps_epi32(_mm512_add_ps(mul, half));
+    q = _mm512_min_epi32(_mm512_max_epi32(q, neg_scale), scale);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(quantized_values + i), _mm512_cvtsepi32_epi8(q));
+  }
+  for (; i < size; ++i)
+  {
+    quantized_values[i] = x86_detail::QuantizeScalar(values[i], scaling_factor_inv);
+  }
+}
+
+CKER_TARGET_AVX512 inline void Avx512MatrixBatchVectorMultiplyAccumulate(
+    const int8_t *__restrict__ matrix, const int m_rows, const int m_cols,
+    const int8_t *__restrict__ vectors, const float *scaling_factors, int n_batch,
+    float *__restrict__ result, int result_stride)
+{
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols)
+  {
+    const float batch_scaling_factor = scaling_factors[batch];
+    const int8_t *row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, result += result_stride)
+    {
+      __m512i dotprod_32x16 = _mm512_setzero_si512();
+      int col = 0;
+      for (; col + 32 <= m_cols; col += 32)
+      {
+        const __m512i r = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row_ptr + col)));
+        const __m512i v = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(vectors + col)));
+        dotprod_32x16 = _mm512_add_epi32(dotprod_32x16, _mm512_madd_epi16(r, v));
+      }
+      int32_t dotprod = x86_detail::HorizontalSum(dotprod_32x16);
+      for (; col < m_cols; ++col)
+      {
+        dotprod += row_ptr[col] * vectors[col];
+      }
+      *result += dotprod * batch_scaling_factor;
+    }
+  }
+}
+
+CKER_TARGET_AVX512 inline void Avx512MatrixBatchVectorMultiplyAccumulate(const float *matrix,
+                                                                         int m_rows, int m_cols,
+                                                                         const float *vector,
+                                                                         int n_batch, float *result,
+                                                                         int result_stride)
+{
+  for (int b = 0; b < n_batch; b++)
+  {
+    float *result_in_batch = result + b * m_rows * result_stride;
+    const float *vector_in_batch = vector + b * m_cols;
+    const float *matrix_row = matrix;
+    for (int r = 0; r < m_rows; r++, matrix_row += m_cols, result_in_batch += result_stride)
+    {
+      __m512 acc_f32x16 = _mm512_setzero_ps();
+      int c = 0;
+      for (; c + 16 <= m_cols; c += 16)
+      {
+        acc_f32x16 = _mm512_fmadd_ps(_mm512_loadu_ps(matrix_row + c),
+                                     _mm512_loadu_ps(vector_in_batch + c), acc_f32x16);
+      }
+      // Remaining columns are handled with a masked load instead of a scalar loop
+      if (c < m_cols)
+      {
+        const __mmask16 mask = static_cast<__mmask16>((1u << (m_cols - c)) - 1);
+        acc_f32x16 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, matrix_row + c),
+                                     _mm512_maskz_loadu_ps(mask, vector_in_batch + c), acc_f32x16);
+      }
+      *result_in_batch += x86_detail::HorizontalSum(acc_f32x16);
+    }
+  }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+//
+// Runtime dispatchers (used by NEON_OR_PORTABLE on x86)
+//
+inline bool X86IsZeroVector(const float *vector, int v_size)
+{
+  switch (GetX86Isa())
+  {
+    case X86Isa::kAvx512:
+      return Avx512IsZeroVector(vector, v_size);
+    case X86Isa::kAvx2:
+      return Avx2IsZeroVector(vector, v_size);
+    case X86Isa::kSse4:
+      return Sse4IsZeroVector(vector, v_size);
+    default:
+      return PortableIsZeroVector(vector, v_size);
+  }
+}
+
+inline void X86SymmetricQuantizeFloats(const float *values, const int size,
+                                       int8_t *quantized_values, float *min, float *max,
+                                       float *scaling_factor)
+{
+  switch (GetX86Isa())
+  {
+    case X86Isa::kAvx512:
+      Avx512SymmetricQuantizeFloats(values, size, quantized_values, min, max, scaling_factor);
+      break;
+    case X86Isa::kAvx2:
+      Avx2SymmetricQuantizeFloats(values, size, quantized_values, min, max, scaling_factor);
+      break;
+    case X86Isa::kSse4:
+      Sse4SymmetricQuantizeFloats(values, size, quantized_values, min, max, scaling_factor);
+      break;
+    default:
+      PortableSymmetricQuantizeFloats(values, size, quantized_values, min, max, scaling_factor);
+      break;
+  }
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                   const int m_rows, const int m_cols,
+                                                   const int8_t *__restrict__ vectors,
+                                                   const float *scaling_factors, int n_batch,
+                                                   float *__restrict__ result, int result_stride)
+{
+  switch (GetX86Isa())
+  {
+    case X86Isa::kAvx512:
+      Avx512MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors, scaling_factors,
+                                                n_batch, result, result_stride);
+      break;
+    case X86Isa::kAvx2:
+      Avx2MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors, scaling_factors,
+                                              n_batch, result, result_stride);
+      break;
+    case X86Isa::kSse4:
+      Sse4MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors, scaling_factors,
+                                              n_batch, result, result_stride);
+      break;
+    default:
+      PortableMatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors,
+                                                  scaling_factors, n_batch, result, result_stride);
+      break;
+  }
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                   const int m_rows, const int m_cols,
+                                                   const int8_t *__restrict__ vectors,
+                                                   const float *scaling_factors, int n_batch,
+                                                   int32_t *, float *__restrict__ result,
+                                                   int result_stride)
+{
+  X86MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors, scaling_factors,
+                                         n_batch, result, result_stride);
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
+                                                   const float *vector, int n_batch, float *result,
+                                                   int result_stride)
+{
+  switch (GetX86Isa())
+  {
+    case X86Isa::kAvx512:
+      Avx512MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vector, n_batch, result,
+                                                result_stride);
+      break;
+    case X86Isa::kAvx2:
+      Avx2MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vector, n_batch, result,
+                                              result_stride);
+      break;
+    case X86Isa::kSse4:
+      Sse4MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vector, n_batch, result,
+                                              result_stride);
+      break;
+    default:
+      PortableMatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vector, n_batch, result,
+                                                  result_stride);
+      break;
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_TENSOR_UTILS_H__
@@ -113,6 +113,24 @@ inline const Eigen::ThreadPoolDevice *GetThreadPoolDevice()
   return ctx.device.get();
 }
 
+// Run fn(start, end) over [0, total) on the global threadpool. Eigen decides the number of shards
+// from cost_per_unit, so small work runs on the calling thread without any synchronization.
+template <typename Fn>
+inline void ParallelFor(int64_t total, const Eigen::TensorOpCost &cost_per_unit, Fn &&fn)
+{
+  GetThreadPoolDevice()->parallelFor(
+      total, cost_per_unit,
+      [&fn](Eigen::Index start, Eigen::Index end) {
+        fn(static_cast<int64_t>(start), static_cast<int64_t>(end));
+      });
+}
+
+// Cost of a unit of work which only moves bytes
+inline Eigen::TensorOpCost DataMovementCost(int64_t bytes_per_unit)
+{
+  return Eigen::TensorOpCost(bytes_per_unit, bytes_per_unit, 0);
+}
+
 } // namespace eigen_support
 } // namespace cker
 } // namespace nnfw
@@ -33,12 +33,18 @@ limitations under the License.
 #pragma GCC diagnostic pop
 #endif
 
+#include "cker/x86/x86_check.h"
+
 // NEON_OR_PORTABLE(SomeFunc, args) calls NeonSomeFunc(args) if USE_NEON is
-// defined, PortableSomeFunc(args) otherwise.
+// defined, X86SomeFunc(args) if USE_X86_SIMD is defined, PortableSomeFunc(args) otherwise.
 #ifdef USE_NEON
 // Always use Neon code
 #define NEON_OR_PORTABLE(funcname, ...) Neon##funcname(__VA_ARGS__)
 
+#elif defined(USE_X86_SIMD)
+// x86: X86 code selects SSE4/AVX2/AVX-512 or Portable code at runtime
+#define NEON_OR_PORTABLE(funcname, ...) X86##funcname(__VA_ARGS__)
+
 #else
 // No NEON available: Use Portable code
 #define NEON_OR_PORTABLE(funcname, ...) Portable##funcname(__VA_ARGS__)
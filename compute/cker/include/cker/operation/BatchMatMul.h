@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BATCH_MATMUL_H__
+#define __NNFW_CKER_BATCH_MATMUL_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#ifdef USE_RUY_GEMV
+#include <ruy/path.h>
+#include <ruy/ruy.h>
+#include "cker/ruy/RuySupport.h"
+#endif
+
+#include <Eigen/Core>
+
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace batch_matmul_internal
+{
+
+// Multiply-adds of a single product above which the product itself is split over threads rather
+// than running products of different batches in parallel
+constexpr int64_t kMinMultiThreadedGemmCost = 64 * 64 * 64;
+// Rank of shapes extended with batch dimensions of 1
+constexpr int kMaxRank = 5;
+
+template <bool Transposed>
+using MatrixMap = Eigen::Map<const Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic,
+                                                 Transposed ? Eigen::ColMajor : Eigen::RowMajor>>;
+using OutputMatrixMap =
+    Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+
+// Single-threaded output(MxN) = lhs(MxK) * rhs(KxN). A transposed operand is read as a column
+// major matrix, so it is never copied.
+template <bool AdjX, bool AdjY>
+inline void Gemm(const float *lhs_data, const float *rhs_data, int m, int k, int n,
+                 float *output_data)
+{
+  const MatrixMap<AdjX> lhs(lhs_data, m, k);
+  const MatrixMap<AdjY> rhs(rhs_data, k, n);
+  OutputMatrixMap output(output_data, m, n);
+  output.noalias() = lhs * rhs;
+}
+
+inline void Gemm(const BatchMatMulParams &params, const float *lhs_data, const float *rhs_data,
+                 int m, int k, int n, float *output_data)
+{
+  if (params.adj_x)
+  {
+    if (params.adj_y)
+      Gemm<true, true>(lhs_data, rhs_data, m, k, n, output_data);
+    else
+      Gemm<true, false>(lhs_data, rhs_data, m, k, n, output_data);
+  }
+  else
+  {
+    if (params.adj_y)
+      Gemm<false, true>(lhs_data, rhs_data, m, k, n, output_data);
+    else
+      Gemm<false, false>(lhs_data, rhs_data, m, k, n, output_data);
+  }
+}
+
+// Same as Gemm() but the product runs on multiple threads
+inline void MultiThreadedGemm(const BatchMatMulParams &params, const float *lhs_data,
+                              const float *rhs_data, int m, int k, int n, float *output_data)
+{
+#ifdef USE_RUY_GEMV
+  MatrixParams<float> lhs_params;
+  lhs_params.order = params.adj_x ? Order::kColMajor : Order::kRowMajor;
+  lhs_params.rows = m;
+  lhs_params.cols = k;
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = params.adj_y ? Order::kColMajor : Order::kRowMajor;
+  rhs_params.rows = k;
+  rhs_params.cols = n;
+
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kRowMajor;
+  dst_params.rows = m;
+  dst_params.cols = n;
+
+  GemmParams<float, float> gemm_params;
+
+  ruy::Context *ruy_context = ruy_support::GetRuyContext();
+
+  ruy::Matrix<float> ruy_lhs;
+  ruy::Matrix<float> ruy_rhs;
+  ruy::Matrix<float> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, lhs_data, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, rhs_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ruy::BasicSpec<float, float> ruy_spec;
+  ruy_support::MakeRuySpec(gemm_params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst);
+#else
+  // Contract the stored dimension of K, which is the first one of a transposed lhs and the last
+  // one of a transposed rhs
+  using ConstTensorMap = Eigen::TensorMap<Eigen::Tensor<const float, 2, Eigen::RowMajor>>;
+  const ConstTensorMap lhs(lhs_data, params.adj_x ? k : m, params.adj_x ? m : k);
+  const ConstTensorMap rhs(rhs_data, params.adj_y ? n : k, params.adj_y ? k : n);
+  Eigen::TensorMap<Eigen::Tensor<float, 2, Eigen::RowMajor>> output(output_data, m, n);
+  const Eigen::array<Eigen::IndexPair<Eigen::Index>, 1> dim_pair{
+      {Eigen::IndexPair<Eigen::Index>(params.adj_x ? 0 : 1, params.adj_y ? 1 : 0)}};
+  output.device(*eigen_support::GetThreadPoolDevice()) = lhs.contract(rhs, dim_pair);
+#endif
+}
+
+} // namespace batch_matmul_internal
+
+/**
+ * @brief output[..., M, N] = lhs[..., M, K] * rhs[..., K, N]
+ *
+ * Batch dimensions (up to 3) are broadcasted, and adj_x/adj_y use the transpose of the last two
+ * dimensions of lhs/rhs. Large products are split over threads one after another, and small
+ * ones (e.g. attention heads) run in parallel across batches instead.
+ */
+inline void BatchMatMul(const BatchMatMulParams &params, const Shape &lhs_shape,
+                        const float *lhs_data, const Shape &rhs_shape, const float *rhs_data,
+                        const Shape &output_shape, float *output_data)
+{
+  using namespace batch_matmul_internal;
+
+  // Dimensions of shapes extended to 5D, where the first 3 are batch dimensions
+  auto dim = [](const Shape &shape, int i) {
+    const int num_padded = kMaxRank - shape.DimensionsCount();
+    return i < num_padded ? 1 : shape.Dims(i - num_padded);
+  };
+
+  const int m = dim(lhs_shape, params.adj_x ? 4 : 3);
+  const int k = dim(lhs_shape, params.adj_x ? 3 : 4);
+  const int n = dim(rhs_shape, params.adj_y ? 3 : 4);
+  assert(k == dim(rhs_shape, params.adj_y ? 4 : 3));
+  assert(m == dim(output_shape, 3));
+  assert(n == dim(output_shape, 4));
+
+  // Offsets of matrices for each output batch, where broadcasted dimensions have zero stride
+  int64_t lhs_strides[3];
+  int64_t rhs_strides[3];
+  int64_t lhs_stride = static_cast<int64_t>(m) * k;
+  int64_t rhs_stride = static_cast<int64_t>(k) * n;
+  for (int i = 2; i >= 0; --i)
+  {
+    const int lhs_dim = dim(lhs_shape, i);
+    const int rhs_dim = dim(rhs_shape, i);
+    assert(dim(output_shape, i) == std::max(lhs_dim, rhs_dim));
+    lhs_strides[i] = lhs_dim == 1 ? 0 : lhs_stride;
+    rhs_strides[i] = rhs_dim == 1 ? 0 : rhs_stride;
+    lhs_stride *= lhs_dim;
+    rhs_stride *= rhs_dim;
+  }
+
+  const int num_batches = dim(output_shape, 0) * dim(output_shape, 1) * dim(output_shape, 2);
+  std::vector<int64_t> lhs_offsets(num_batches);
+  std::vector<int64_t> rhs_offsets(num_batches);
+  int batch = 0;
+  for (int b0 = 0; b0 < dim(output_shape, 0); ++b0)
+  {
+    for (int b1 = 0; b1 < dim(output_shape, 1); ++b1)
+    {
+      for (int b2 = 0; b2 < dim(output_shape, 2); ++b2, ++batch)
+      {
+        lhs_offsets[batch] = b0 * lhs_strides[0] + b1 * lhs_strides[1] + b2 * lhs_strides[2];
+        rhs_offsets[batch] = b0 * rhs_strides[0] + b1 * rhs_strides[1] + b2 * rhs_strides[2];
+      }
+    }
+  }
+
+  const int64_t output_stride = static_cast<int64_t>(m) * n;
+  const int64_t gemm_cost = static_cast<int64_t>(m) * n * k;
+  const int num_threads = eigen_support::GetThreadPoolDevice()->numThreads();
+  if (gemm_cost >= kMinMultiThreadedGemmCost && num_batches < num_threads)
+  {
+    for (int b = 0; b < num_batches; ++b)
+    {
+      MultiThreadedGemm(params, lhs_data + lhs_offsets[b], rhs_data + rhs_offsets[b], m, k, n,
+                        output_data + b * output_stride);
+    }
+    return;
+  }
+
+  const Eigen::TensorOpCost cost((static_cast<int64_t>(m) * k + static_cast<int64_t>(k) * n) *
+                                     sizeof(float),
+                                 output_stride * sizeof(float), gemm_cost);
+  eigen_support::ParallelFor(num_batches, cost, [&](int64_t start, int64_t end) {
+    for (int64_t b = start; b < end; ++b)
+    {
+      Gemm(params, lhs_data + lhs_offsets[b], rhs_data + rhs_offsets[b], m, k, n,
+           output_data + b * output_stride);
+    }
+  });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BATCH_MATMUL_H__
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BATCH_TO_SPACE_ND_H__
+#define __NNFW_CKER_BATCH_TO_SPACE_ND_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief BatchToSpaceND of NHWC tensor
+ *
+ * Input batch (offset_h * block_width + offset_w) * output batches + b is scattered to output
+ * pixels of the same spatial offset in batch b. Pixels are copied as runs of channels.
+ *
+ * @param crops_data  [[top, bottom], [left, right]], nullptr for no crop
+ */
+template <typename T>
+inline void BatchToSpaceND(const Shape &input_shape, const T *input_data,
+                           const int32_t *block_shape_data, const int32_t *crops_data,
+                           const Shape &output_shape, T *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int block_height = block_shape_data[0];
+  const int block_width = block_shape_data[1];
+  const int crop_top = crops_data ? crops_data[0] : 0;
+  const int crop_left = crops_data ? crops_data[2] : 0;
+
+  const int input_batches = input_shape.Dims(0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int output_batches = output_shape.Dims(0);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(input_batches == output_batches * block_height * block_width);
+
+  const auto copy_rows = [&](int64_t start, int64_t end) {
+    for (int64_t in_row = start; in_row < end; ++in_row)
+    {
+      const int in_batch = in_row / input_height;
+      const int in_h = in_row % input_height;
+      const int out_batch = in_batch % output_batches;
+      const int spatial_offset = in_batch / output_batches;
+      const int out_h = in_h * block_height + spatial_offset / block_width - crop_top;
+      if (out_h < 0 || out_h >= output_height)
+        continue;
+
+      const int offset_w = spatial_offset % block_width - crop_left;
+      // Range of in_w whose out_w = in_w * block_width + offset_w is not cropped
+      const int first_w = std::max(0, (-offset_w + block_width - 1) / block_width);
+      const int last_w =
+          std::min(input_width, (output_width - offset_w + block_width - 1) / block_width);
+
+      const T *in = input_data + in_row * input_width * depth;
+      T *out = output_data + (out_batch * output_height + out_h) * output_width * depth;
+      for (int in_w = first_w; in_w < last_w; ++in_w)
+      {
+        memcpy(out + (in_w * block_width + offset_w) * depth, in + in_w * depth,
+               depth * sizeof(T));
+      }
+    }
+  };
+
+  eigen_support::ParallelFor(
+      static_cast<int64_t>(input_batches) * input_height,
+      eigen_support::DataMovementCost(input_width * depth * sizeof(T)), copy_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BATCH_TO_SPACE_ND_H__
@@ -20,15 +20,38 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/eigen/EigenSupport.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cmath>
+#include <cstring>
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 
+namespace concatenation_internal
+{
+
+// Copy a large contiguous buffer by chunks distributed over the threadpool
+inline void ParallelMemcpy(void *dst, const void *src, size_t size)
+{
+  constexpr size_t kChunk = 64 * 1024;
+  const int64_t num_chunks = (size + kChunk - 1) / kChunk;
+  auto copy_chunks = [&](int64_t start, int64_t end) {
+    const size_t begin = start * kChunk;
+    const size_t finish = std::min(size, static_cast<size_t>(end) * kChunk);
+    std::memcpy(static_cast<uint8_t *>(dst) + begin, static_cast<const uint8_t *>(src) + begin,
+                finish - begin);
+  };
+  eigen_support::ParallelFor(num_chunks, eigen_support::DataMovementCost(kChunk), copy_chunks);
+}
+
+} // namespace concatenation_internal
+
 template <typename Scalar>
 inline void Concatenation(const ConcatenationParams &params, const Shape *const *input_shapes,
                           const Scalar *const *input_data, const Shape &output_shape,
@@ -67,16 +90,42 @@ inline void Concatenation(const ConcatenationParams &params, const Shape *const
     base_inner_size *= output_shape.Dims(i);
   }
 
-  Scalar *output_ptr = output_data;
-  for (int k = 0; k < outer_size; k++)
+  // Each row of output is made of one slice from every input
+  std::vector<int64_t> copy_sizes(inputs_count);
+  int64_t output_row_size = 0;
+  for (int i = 0; i < inputs_count; ++i)
   {
+    copy_sizes[i] = input_shapes[i]->Dims(axis) * base_inner_size;
+    output_row_size += copy_sizes[i];
+  }
+
+  if (outer_size == 1)
+  {
+    // Inputs are placed one after another, so copy each input as a whole
+    Scalar *output_ptr = output_data;
     for (int i = 0; i < inputs_count; ++i)
     {
-      const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
-      memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
-      output_ptr += copy_size;
+      concatenation_internal::ParallelMemcpy(output_ptr, input_data[i],
+                                             copy_sizes[i] * sizeof(Scalar));
+      output_ptr += copy_sizes[i];
     }
+    return;
   }
+
+  auto concat_rows = [&](int64_t start, int64_t end) {
+    for (int64_t k = start; k < end; ++k)
+    {
+      Scalar *output_ptr = output_data + k * output_row_size;
+      for (int i = 0; i < inputs_count; ++i)
+      {
+        memcpy(output_ptr, input_data[i] + k * copy_sizes[i], copy_sizes[i] * sizeof(Scalar));
+        output_ptr += copy_sizes[i];
+      }
+    }
+  };
+  eigen_support::ParallelFor(outer_size,
+                             eigen_support::DataMovementCost(output_row_size * sizeof(Scalar)),
+                             concat_rows);
 }
 
 // quantized as it takes scale as a floating point value. This should be fixed
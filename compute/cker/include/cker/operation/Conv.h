@@ -23,6 +23,9 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/PointwiseConv.h"
+#include "cker/operation/optimized/WinogradConv.h"
+#include "cker/operation/optimized/integer_ops/Conv.h"
 #include <vector>
 
 namespace nnfw
@@ -51,34 +54,66 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 }
 } // namespace
 
+// Kernels for float convolution, which are selected per layer at prepare()
+enum class ConvAlgorithm
+{
+  kReference,
+  // im2col and GEMM of Eigen with HWCN filter
+  kMultithreaded,
+  // GEMM without im2col for 1x1 filter with unit stride and no padding
+  kPointwise,
+  // Winograd F(2x2, 3x3) and F(4x4, 3x3) for 3x3 filter with unit stride
+  kWinograd2x2,
+  kWinograd4x4,
+};
+
 class Conv
 {
 public:
   Conv()
       : _modified_filter_data(), _im2col_data(), _im2col_shape(4), _need_im2col(false),
-        _prepared(false)
+        _prepared(false), _algorithm(ConvAlgorithm::kReference)
   {
   }
 
-  void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
-               bool &is_replaced_weights)
+  /**
+   * @brief Select the float kernel of this layer and prepare its filter
+   * @note  Filter is replaced by a copy in another layout unless the kernel uses it as is
+   */
+  void prepare(const ConvParams &params, const Shape &input_shape, const Shape &filter_shape,
+               const float *filter_data, bool &is_replaced_weights)
   {
-    (void)filter_shape;
-    (void)filter_data;
-    (void)padding_type;
-    (void)is_replaced_weights;
-    if (!_prepared)
+    if (_prepared)
+      return;
+
+    _algorithm = selectAlgorithm(params, input_shape, filter_shape);
+    switch (_algorithm)
     {
-      if (padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1)
+      case ConvAlgorithm::kMultithreaded:
       {
         const auto output_depth = filter_shape.Dims(0);
         const Shape hwcn_filter_shape{filter_shape.FlatSize() / output_depth, output_depth};
         _modified_filter_data.resize(hwcn_filter_shape.FlatSize());
         TransposeFloatTensor(filter_data, hwcn_filter_shape, &_modified_filter_data[0]);
         is_replaced_weights = true;
+        break;
       }
-      _prepared = true;
+      case ConvAlgorithm::kWinograd2x2:
+        _modified_filter_data.resize(optimized::winograd::TransformedFilterSize<2>(filter_shape));
+        optimized::winograd::TransformFilter<2>(filter_shape, filter_data,
+                                                &_modified_filter_data[0]);
+        is_replaced_weights = true;
+        break;
+      case ConvAlgorithm::kWinograd4x4:
+        _modified_filter_data.resize(optimized::winograd::TransformedFilterSize<4>(filter_shape));
+        optimized::winograd::TransformFilter<4>(filter_shape, filter_data,
+                                                &_modified_filter_data[0]);
+        is_replaced_weights = true;
+        break;
+      default:
+        break;
     }
+    _prepared = true;
   }
 
   void prepareQuant(const Shape &input_shape, const Shape &kernel_shape, const Shape &output_shape,
@@ -101,22 +136,45 @@ public:
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
                   const float *bias_data, const Shape &output_shape, float *output_data)
   {
-    if (params.padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1)
+    if (!_prepared)
     {
-      if (!_prepared)
-      {
-        bool not_used_condition = false;
-        prepare(filter_shape, filter_data, params.padding_type, not_used_condition);
-        _prepared = true;
-      }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
-                          bias_shape, bias_data, output_shape, output_data);
+      bool not_used_condition = false;
+      prepare(params, input_shape, filter_shape, filter_data, not_used_condition);
     }
-    else
+
+    switch (_algorithm)
     {
-      // TODO Support optimized kernel
-      reference::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
-                      bias_data, output_shape, output_data);
+      case ConvAlgorithm::kMultithreaded:
+        multithreaded::Conv(params, input_shape, input_data, filter_shape,
+                            &_modified_filter_data[0], bias_shape, bias_data, output_shape,
+                            output_data);
+        break;
+      case ConvAlgorithm::kWinograd2x2:
+        optimized::winograd::Conv<2>(params, input_shape, input_data, filter_shape,
+                                     &_modified_filter_data[0], bias_shape, bias_data,
+                                     output_shape, output_data);
+        break;
+      case ConvAlgorithm::kWinograd4x4:
+        optimized::winograd::Conv<4>(params, input_shape, input_data, filter_shape,
+                                     &_modified_filter_data[0], bias_shape, bias_data,
+                                     output_shape, output_data);
+        break;
+      case ConvAlgorithm::kPointwise:
+        // Explicit padding may still change spatial size of 1x1 convolution
+        if (input_shape.Dims(1) == output_shape.Dims(1) &&
+            input_shape.Dims(2) == output_shape.Dims(2))
+        {
+          optimized::PointwiseConv(params, input_shape, input_data, filter_shape, filter_data,
+                                   bias_shape, bias_data, output_shape, output_data);
+          break;
+        }
+        reference::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                        bias_data, output_shape, output_data);
+        break;
+      default:
+        reference::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                        bias_data, output_shape, output_data);
+        break;
     }
   }
 
@@ -137,14 +195,75 @@ public:
     }
   }
 
+  /**
+   * @brief Convolution of int8 with per-channel quantized filter
+   * @note  prepareQuant() must be called before
+   */
+  void operator()(const ConvParams &params, const int32_t *output_multiplier,
+                  const int32_t *output_shift, const Shape &input_shape, const int8_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, int8_t *output_data)
+  {
+    assert(_prepared);
+    // im2col buffer holds bytes of either quantized type
+    int8_t *im2col_raw_data = reinterpret_cast<int8_t *>(_im2col_data.data());
+    optimized_integer_ops::ConvPerChannel(params, output_multiplier, output_shift, input_shape,
+                                          input_data, filter_shape, filter_data, bias_shape,
+                                          bias_data, output_shape, output_data, _im2col_shape,
+                                          im2col_raw_data);
+  }
+
+  ConvAlgorithm algorithm() const { return _algorithm; }
+
+private:
+  static ConvAlgorithm selectAlgorithm(const ConvParams &params, const Shape &input_shape,
+                                       const Shape &filter_shape)
+  {
+    const int output_depth = filter_shape.Dims(0);
+    const int filter_height = filter_shape.Dims(1);
+    const int filter_width = filter_shape.Dims(2);
+    const int input_depth = filter_shape.Dims(3);
+    const bool is_unit_stride = params.stride_width == 1 && params.stride_height == 1 &&
+                                params.dilation_width_factor == 1 &&
+                                params.dilation_height_factor == 1;
+
+    if (is_unit_stride && filter_height == 1 && filter_width == 1 &&
+        params.padding_values.width == 0 && params.padding_values.height == 0)
+    {
+      return ConvAlgorithm::kPointwise;
+    }
+
+    // Transforms of Winograd do not pay off when GEMMs over channels are too small
+    constexpr int kWinogradMinDepth = 8;
+    if (is_unit_stride && filter_height == 3 && filter_width == 3 &&
+        input_depth >= kWinogradMinDepth && output_depth >= kWinogradMinDepth)
+    {
+      // F(4x4, 3x3) needs 4 times less multiplications than direct convolution while
+      // F(2x2, 3x3) needs 2.25 times less, but it loses more precision and wastes more work on
+      // partial tiles. Input shape may change later, which costs only performance.
+      constexpr int kWinograd4x4MinSize = 16;
+      const bool is_large = input_shape.DimensionsCount() == 4 &&
+                            input_shape.Dims(1) >= kWinograd4x4MinSize &&
+                            input_shape.Dims(2) >= kWinograd4x4MinSize;
+      return is_large ? ConvAlgorithm::kWinograd4x4 : ConvAlgorithm::kWinograd2x2;
+    }
+
+    if (params.padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1)
+    {
+      return ConvAlgorithm::kMultithreaded;
+    }
+    return ConvAlgorithm::kReference;
+  }
+
 private:
   std::vector<float> _modified_filter_data;
   std::vector<uint8_t> _im2col_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
+  ConvAlgorithm _algorithm;
 };
 } // namespace cker
 } // namespace nnfw
 
-#endif // __NNFW_CKER_CONCATENATION_H_
+#endif // __NNFW_CKER_CONV_H__
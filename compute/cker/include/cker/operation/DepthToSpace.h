@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_DEPTH_TO_SPACE_H__
+#define __NNFW_CKER_DEPTH_TO_SPACE_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief DepthToSpace of NHWC tensor
+ *
+ * Channels of an input pixel are block_size rows of output pixels, each of which is copied at
+ * once.
+ */
+template <typename T>
+inline void DepthToSpace(const Shape &unextended_input_shape, const T *input_data,
+                         const Shape &unextended_output_shape, T *output_data, int32_t block_size)
+{
+  assert(unextended_input_shape.DimensionsCount() <= 4);
+  assert(unextended_output_shape.DimensionsCount() <= 4);
+  const Shape input_shape = Shape::ExtendedShape(4, unextended_input_shape);
+  const Shape output_shape = Shape::ExtendedShape(4, unextended_output_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  assert(input_height * block_size == output_shape.Dims(1));
+  assert(input_width * block_size == output_width);
+  assert(input_depth == output_depth * block_size * block_size);
+
+  // Each input row makes block_size output rows
+  const int run_size = block_size * output_depth;
+  const int output_row_size = output_width * output_depth;
+  const auto copy_rows = [&](int64_t start, int64_t end) {
+    for (int64_t in_row = start; in_row < end; ++in_row)
+    {
+      const T *in = input_data + in_row * input_width * input_depth;
+      T *out = output_data + in_row * block_size * output_row_size;
+      for (int offset_h = 0; offset_h < block_size; ++offset_h)
+      {
+        for (int in_w = 0; in_w < input_width; ++in_w)
+        {
+          memcpy(out + offset_h * output_row_size + in_w * run_size,
+                 in + in_w * input_depth + offset_h * run_size, run_size * sizeof(T));
+        }
+      }
+    }
+  };
+
+  eigen_support::ParallelFor(
+      static_cast<int64_t>(batches) * input_height,
+      eigen_support::DataMovementCost(input_width * input_depth * sizeof(T)), copy_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_DEPTH_TO_SPACE_H__
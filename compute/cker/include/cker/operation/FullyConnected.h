@@ -31,7 +31,8 @@ namespace cker
 class FCTempArena
 {
 public:
-  FCTempArena(void) : prepared(false), input_quantized(), scaling_factors(), accum_scratch()
+  FCTempArena(void)
+      : prepared(false), input_quantized(), scaling_factors(), accum_scratch(), widened_weights()
   {
     // DO NOTHING
   }
@@ -52,6 +53,7 @@ public:
   std::vector<int8_t> input_quantized;
   std::vector<float> scaling_factors;
   std::vector<int32_t> accum_scratch;
+  std::vector<float> widened_weights;
 };
 
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
@@ -192,6 +194,60 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
   return;
 }
 
+/**
+ * @brief FullyConnected with weights stored in a narrower floating point type (e.g. fp16, bf16)
+ *
+ * Weights are widened to float a block of rows at a time right before they are used, so only
+ * a small float scratch is needed and the block stays in cache while every batch uses it.
+ */
+template <typename WeightT>
+inline void FullyConnectedWidenWeights(const FullyConnectedParams &params,
+                                       const Shape &input_shape, const float *input_data,
+                                       const Shape &weights_shape, const WeightT *weights_data,
+                                       const Shape &, const float *bias_data, const Shape &,
+                                       float *output_data, FCTempArena &temp_arena)
+{
+  int total_input_size = input_shape.FlatSize();
+  const int input_size = weights_shape.Dims(1);
+  const int batch_size = total_input_size / input_size;
+  const int num_units = weights_shape.Dims(0);
+
+  // Output = bias if bias tensor exists.
+  if (bias_data)
+  {
+    VectorBatchVectorAssign(bias_data, num_units, batch_size, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, batch_size * num_units);
+  }
+
+  constexpr int kBlockRows = 16;
+  temp_arena.widened_weights.resize(kBlockRows * input_size);
+  float *block = temp_arena.widened_weights.data();
+
+  // Compute output += weight * input, block by block
+  for (int row = 0; row < num_units; row += kBlockRows)
+  {
+    const int rows = std::min(kBlockRows, num_units - row);
+    const WeightT *block_weights = weights_data + row * input_size;
+    for (int i = 0; i < rows * input_size; ++i)
+    {
+      block[i] = static_cast<float>(block_weights[i]);
+    }
+
+    for (int b = 0; b < batch_size; ++b)
+    {
+      MatrixBatchVectorMultiplyAccumulate(block, rows, input_size, input_data + b * input_size,
+                                          /*n_batch=*/1, output_data + b * num_units + row,
+                                          /*result_stride=*/1);
+    }
+  }
+
+  // Apply activation function
+  ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FUSED_ELEMENTWISE_H__
+#define __NNFW_CKER_FUSED_ELEMENTWISE_H__
+
+#include "cker/eigen/EigenSupport.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+enum class ElementwiseOpType
+{
+  // Unary
+  kAbs,
+  kClamp,
+  kCos,
+  kExp,
+  kLog,
+  kLogistic,
+  kNeg,
+  kSin,
+  kTanh,
+  // Binary
+  kAdd,
+  kSub,
+  kMul,
+  kDiv,
+};
+
+// How the other operand of a binary step is read for an element of the chain
+enum class ElementwiseBroadcast
+{
+  kFull,   //< Same shape as the chain
+  kScalar, //< One value
+  kInner,  //< Trailing dimensions of the chain, i.e. element i % operand_size
+};
+
+/**
+ * @brief A step of a fused elementwise chain, which is applied to the value of the chain
+ */
+struct ElementwiseStep
+{
+  ElementwiseOpType type;
+
+  // Binary
+  const float *operand = nullptr;
+  int64_t operand_size = 0;
+  ElementwiseBroadcast broadcast = ElementwiseBroadcast::kFull;
+  bool reversed = false; //< operand (op) value instead of value (op) operand
+
+  // kClamp
+  float min = 0.0f;
+  float max = 0.0f;
+};
+
+namespace fused_elementwise
+{
+
+// Elements of a tile, which stay in cache while all steps are applied
+constexpr int64_t kTileSize = 2048;
+
+using VectorMap = Eigen::Map<Eigen::ArrayXf>;
+using ConstVectorMap = Eigen::Map<const Eigen::ArrayXf>;
+
+// Functors make Eigen expressions, so that each step is a vectorized loop over a tile
+struct AbsFunctor
+{
+  template <typename X> auto operator()(const X &x) const { return x.abs(); }
+};
+struct CosFunctor
+{
+  template <typename X> auto operator()(const X &x) const { return x.cos(); }
+};
+struct ExpFunctor
+{
+  template <typename X> auto operator()(const X &x) const { return x.exp(); }
+};
+struct LogFunctor
+{
+  template <typename X> auto operator()(const X &x) const { return x.log(); }
+};
+struct LogisticFunctor
+{
+  template <typename X> auto operator()(const X &x) const
+  {
+    return x.unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+  }
+};
+struct NegFunctor
+{
+  template <typename X> auto operator()(const X &x) const { return -x; }
+};
+struct SinFunctor
+{
+  template <typename X> auto operator()(const X &x) const { return x.sin(); }
+};
+struct TanhFunctor
+{
+  template <typename X> auto operator()(const X &x) const { return x.tanh(); }
+};
+
+struct AddFunctor
+{
+  template <typename X, typename Y> auto operator()(const X &x, const Y &y) const { return x + y; }
+};
+struct SubFunctor
+{
+  template <typename X, typename Y> auto operator()(const X &x, const Y &y) const { return x - y; }
+};
+struct MulFunctor
+{
+  template <typename X, typename Y> auto operator()(const X &x, const Y &y) const { return x * y; }
+};
+struct DivFunctor
+{
+  template <typename X, typename Y> auto operator()(const X &x, const Y &y) const { return x / y; }
+};
+
+template <typename Functor> inline void ApplyUnary(float *value, int64_t size)
+{
+  VectorMap x(value, size);
+  x = Functor()(x);
+}
+
+template <typename Functor, typename Y>
+inline void ApplyBinary(float *value, int64_t size, const Y &y, bool reversed)
+{
+  VectorMap x(value, size);
+  if (reversed)
+    x = Functor()(y, x);
+  else
+    x = Functor()(x, y);
+}
+
+// Apply a binary step to elements [start, start + size) of the chain
+template <typename Functor>
+inline void ApplyBinary(const ElementwiseStep &step, float *value, int64_t start, int64_t size)
+{
+  switch (step.broadcast)
+  {
+    case ElementwiseBroadcast::kFull:
+      ApplyBinary<Functor>(value, size, ConstVectorMap(step.operand + start, size), step.reversed);
+      break;
+    case ElementwiseBroadcast::kScalar:
+      ApplyBinary<Functor>(value, size, step.operand[0], step.reversed);
+      break;
+    case ElementwiseBroadcast::kInner:
+      // Split the tile where the operand wraps around
+      for (int64_t pos = 0; pos < size;)
+      {
+        const int64_t offset = (start + pos) % step.operand_size;
+        const int64_t run = std::min(size - pos, step.operand_size - offset);
+        ApplyBinary<Functor>(value + pos, run, ConstVectorMap(step.operand + offset, run),
+                             step.reversed);
+        pos += run;
+      }
+      break;
+  }
+}
+
+inline void ApplyStep(const ElementwiseStep &step, float *value, int64_t start, int64_t size)
+{
+  switch (step.type)
+  {
+    case ElementwiseOpType::kAbs:
+      ApplyUnary<AbsFunctor>(value, size);
+      break;
+    case ElementwiseOpType::kClamp:
+    {
+      VectorMap x(value, size);
+      x = x.max(step.min).min(step.max);
+      break;
+    }
+    case ElementwiseOpType::kCos:
+      ApplyUnary<CosFunctor>(value, size);
+      break;
+    case ElementwiseOpType::kExp:
+      ApplyUnary<ExpFunctor>(value, size);
+      break;
+    case ElementwiseOpType::kLog:
+      ApplyUnary<LogFunctor>(value, size);
+      break;
+    case ElementwiseOpType::kLogistic:
+      ApplyUnary<LogisticFunctor>(value, size);
+      break;
+    case ElementwiseOpType::kNeg:
+      ApplyUnary<NegFunctor>(value, size);
+      break;
+    case ElementwiseOpType::kSin:
+      ApplyUnary<SinFunctor>(value, size);
+      break;
+    case ElementwiseOpType::kTanh:
+      ApplyUnary<TanhFunctor>(value, size);
+      break;
+    case ElementwiseOpType::kAdd:
+      ApplyBinary<AddFunctor>(step, value, start, size);
+      break;
+    case ElementwiseOpType::kSub:
+      ApplyBinary<SubFunctor>(step, value, start, size);
+      break;
+    case ElementwiseOpType::kMul:
+      ApplyBinary<MulFunctor>(step, value, start, size);
+      break;
+    case ElementwiseOpType::kDiv:
+      ApplyBinary<DivFunctor>(step, value, start, size);
+      break;
+    default:
+      throw std::runtime_error{"FusedElementwise: unsupported op type"};
+  }
+}
+
+} // namespace fused_elementwise
+
+/**
+ * @brief Run a chain of elementwise steps by one pass over memory
+ *
+ * The chain is applied tile by tile in the output, so that intermediate values are not written
+ * to memory. Input and output may be the same buffer.
+ */
+inline void FusedElementwise(const std::vector<ElementwiseStep> &steps, const float *input_data,
+                             int64_t size, float *output_data)
+{
+  using namespace fused_elementwise;
+
+  const auto run_tiles = [&](int64_t start_tile, int64_t end_tile) {
+    for (int64_t tile = start_tile; tile < end_tile; ++tile)
+    {
+      const int64_t start = tile * kTileSize;
+      const int64_t tile_size = std::min(kTileSize, size - start);
+      float *value = output_data + start;
+      if (value != input_data + start)
+        std::copy_n(input_data + start, tile_size, value);
+      for (const auto &step : steps)
+        ApplyStep(step, value, start, tile_size);
+    }
+  };
+
+  const int64_t num_tiles = (size + kTileSize - 1) / kTileSize;
+  eigen_support::ParallelFor(num_tiles,
+                             Eigen::TensorOpCost(kTileSize * sizeof(float) * (steps.size() + 1),
+                                                 kTileSize * sizeof(float),
+                                                 kTileSize * steps.size() * 8),
+                             run_tiles);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FUSED_ELEMENTWISE_H__
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LSTM_H__
+#define __NNFW_CKER_LSTM_H__
+
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/operation/RecurrentUtils.h"
+
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Weights of LSTM, with gates stacked in order of input, forget, cell and output
+ *
+ * Stacked gates are multiplied by one GEMM. The input gate is left out with coupled input and
+ * forget gates (CIFG). WeightT is float, or int8_t for hybrid LSTM with symmetric weights.
+ */
+template <typename WeightT> struct LSTMWeights
+{
+  int n_gates = 4;                        //< 3 with CIFG
+  std::vector<WeightT> input_weights;     //< [n_gates * n_cell, n_input]
+  std::vector<WeightT> recurrent_weights; //< [n_gates * n_cell, n_output]
+  std::vector<float> input_scales;        //< Scale of each gate for int8 weights
+  std::vector<float> recurrent_scales;    //< Scale of each gate for int8 weights
+  std::vector<float> bias;                //< [n_gates * n_cell]
+
+  // Peephole weights of [n_cell], empty if peephole is not used. cell_to_input is empty in CIFG.
+  std::vector<float> cell_to_input;
+  std::vector<float> cell_to_forget;
+  std::vector<float> cell_to_output;
+
+  // Projection of [n_output, n_cell], nullptr if it is not used
+  const WeightT *projection_weights = nullptr;
+  float projection_scale = 1.0f;
+  const float *projection_bias = nullptr; //< May be nullptr with projection weights
+};
+
+/**
+ * @brief Stack matrices of the same shape vertically
+ */
+template <typename T>
+inline void StackGates(const std::vector<const T *> &gates, int rows, int cols,
+                       std::vector<T> &stacked)
+{
+  const int gate_size = rows * cols;
+  stacked.resize(gates.size() * gate_size);
+  for (size_t g = 0; g < gates.size(); ++g)
+  {
+    std::memcpy(stacked.data() + g * gate_size, gates[g], gate_size * sizeof(T));
+  }
+}
+
+/**
+ * @brief LSTM over n_time steps
+ *
+ * Input is [n_time, n_batch, n_input] and output is [n_time, n_batch, n_output]. Output state
+ * [n_batch, n_output] and cell state [n_batch, n_cell] are updated in place to the ones of the
+ * last step. Input of all steps is multiplied by the stacked input weights at once, and only
+ * recurrent weights are multiplied step by step.
+ */
+template <typename WeightT>
+inline void LSTM(const LSTMParams &params, const LSTMWeights<WeightT> &weights, int n_time,
+                 int n_batch, int n_input, int n_cell, int n_output, const float *input_data,
+                 float *output_state, float *cell_state, float *output_data,
+                 RecurrentTempArena &arena)
+{
+  using namespace recurrent_internal;
+
+  const bool use_cifg = (weights.n_gates == 3);
+  const bool use_peephole = !weights.cell_to_forget.empty();
+  const int gates_size = weights.n_gates * n_cell;
+  // Offsets of gates in a row of gates
+  const int forget_offset = use_cifg ? 0 : n_cell;
+  const int cell_offset = forget_offset + n_cell;
+  const int output_offset = cell_offset + n_cell;
+
+  // Gates = bias + input weights * input, for all steps
+  arena.gates.resize(n_time * n_batch * gates_size);
+  VectorBatchVectorAssign(weights.bias.data(), gates_size, n_time * n_batch, arena.gates.data());
+  MatMulAccumulate(weights.input_weights.data(), weights.input_scales.data(), weights.n_gates,
+                   n_cell, n_input, input_data, n_time * n_batch, arena.gates.data(), arena);
+
+  arena.cell_output.resize(n_batch * n_cell);
+  float *cell_output = arena.cell_output.data();
+  for (int t = 0; t < n_time; ++t)
+  {
+    float *step_gates = arena.gates.data() + t * n_batch * gates_size;
+    MatMulAccumulate(weights.recurrent_weights.data(), weights.recurrent_scales.data(),
+                     weights.n_gates, n_cell, n_output, output_state, n_batch, step_gates, arena);
+
+    for (int b = 0; b < n_batch; ++b)
+    {
+      float *gates = step_gates + b * gates_size;
+      VectorMap input_gate(gates, n_cell);
+      VectorMap forget_gate(gates + forget_offset, n_cell);
+      VectorMap cell_gate(gates + cell_offset, n_cell);
+      VectorMap output_gate(gates + output_offset, n_cell);
+      VectorMap cell(cell_state + b * n_cell, n_cell);
+
+      if (use_peephole)
+      {
+        if (!use_cifg)
+          input_gate += ConstVectorMap(weights.cell_to_input.data(), n_cell) * cell;
+        forget_gate += ConstVectorMap(weights.cell_to_forget.data(), n_cell) * cell;
+      }
+      Sigmoid(forget_gate.data(), n_cell);
+      ApplyActivation(params.activation, cell_gate.data(), n_cell);
+
+      // Cell state is updated in place
+      if (use_cifg)
+      {
+        cell = forget_gate * cell + (1.0f - forget_gate) * cell_gate;
+      }
+      else
+      {
+        Sigmoid(input_gate.data(), n_cell);
+        cell = forget_gate * cell + input_gate * cell_gate;
+      }
+      Clip(cell.data(), n_cell, params.cell_clip);
+
+      if (use_peephole)
+        output_gate += ConstVectorMap(weights.cell_to_output.data(), n_cell) * cell;
+      Sigmoid(output_gate.data(), n_cell);
+
+      VectorMap cell_out(cell_output + b * n_cell, n_cell);
+      cell_out = cell;
+      ApplyActivation(params.activation, cell_out.data(), n_cell);
+      cell_out *= output_gate;
+    }
+
+    if (weights.projection_weights)
+    {
+      if (weights.projection_bias)
+        VectorBatchVectorAssign(weights.projection_bias, n_output, n_batch, output_state);
+      else
+        ZeroVector(output_state, n_batch * n_output);
+      MatMulAccumulate(weights.projection_weights, &weights.projection_scale, 1, n_output, n_cell,
+                       cell_output, n_batch, output_state, arena);
+      Clip(output_state, n_batch * n_output, params.projection_clip);
+    }
+    else
+    {
+      std::memcpy(output_state, cell_output, n_batch * n_cell * sizeof(float));
+    }
+    std::memcpy(output_data + t * n_batch * n_output, output_state,
+                n_batch * n_output * sizeof(float));
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LSTM_H__
@@ -20,8 +20,13 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
-#include <iostream>
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -52,172 +57,87 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
     assert(output_shape.Dims(i) ==
            input_shape.Dims(i) + padding_list[i].first + padding_list[i].second);
   }
-  /* Use pad_rank since given input/output shapes are expanded to 4d before calling all cker
-     functions:
-     1. to prevent access violation in padding_list;
-     2. handling as 4d is slower than as 2d/3d.
-  */
-  switch (pad_rank)
+
+  if (pad_rank > 4)
+  {
+    throw std::runtime_error("Padding for rank > 4 NYI");
+  }
+
+  // Extend to 4D by prepending dimensions of size 1 without padding. Use pad_rank since given
+  // input/output shapes may not be extended.
+  int32_t in_dims[4];
+  int32_t out_dims[4];
+  PaddingInfo pads[4];
+  const int32_t ext = 4 - pad_rank;
+  for (int32_t i = 0; i < 4; ++i)
   {
-    case 0:
-    case 1:
+    if (i < ext)
     {
-      const int32_t in_row_len = input_shape.Dims(0);
-      std::fill_n(output_data, padding_list[0].first, constant_value);
-      std::memcpy(output_data + padding_list[0].first, input_data, in_row_len * sizeof(float));
-      std::fill_n(output_data + padding_list[0].first + in_row_len, padding_list[0].second,
-                  constant_value);
-      break;
+      in_dims[i] = 1;
+      out_dims[i] = 1;
+      pads[i] = {0, 0};
     }
-    case 2: // HW
+    else
     {
-      const int32_t in_row_len = input_shape.Dims(1);
-      const int32_t out_row_size = output_shape.Dims(1);
+      in_dims[i] = input_shape.Dims(i - ext);
+      out_dims[i] = output_shape.Dims(i - ext);
+      pads[i] = padding_list[i - ext];
+    }
+  }
 
-      // prepend padding rows
-      std::fill_n(output_data, padding_list[0].first * out_row_size, constant_value);
+  // Output is filled by (N, H) planes of [W, C] in parallel
+  const int64_t out_row_size = out_dims[3];
+  const int64_t out_plane_size = out_dims[2] * out_row_size;
+  const int64_t in_plane_size = static_cast<int64_t>(in_dims[2]) * in_dims[3];
+  const bool has_channel_padding = pads[3].first != 0 || pads[3].second != 0;
 
-      const auto r_h_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, j = 0; i < r_h_inp_lim; ++i, ++j)
+  auto pad_planes = [&](int64_t start, int64_t end) {
+    for (int64_t plane = start; plane < end; ++plane)
+    {
+      float *out = output_data + plane * out_plane_size;
+      const int32_t in_n = static_cast<int32_t>(plane / out_dims[1]) - pads[0].first;
+      const int32_t in_h = static_cast<int32_t>(plane % out_dims[1]) - pads[1].first;
+      if (in_n < 0 || in_n >= in_dims[0] || in_h < 0 || in_h >= in_dims[1])
       {
-        auto out_offset = i * out_row_size;
-        const auto in_offset = j * in_row_len;
-
-        // prepend padding values
-        std::fill_n(output_data + out_offset, padding_list[1].first, constant_value);
-
-        out_offset += padding_list[1].first;
-
-        // copy a row of input data
-        memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(float));
-
-        out_offset += in_row_len;
-
-        // append padding values
-        std::fill_n(output_data + out_offset, padding_list[1].second, constant_value);
+        // The whole plane is padding
+        std::fill_n(out, out_plane_size, constant_value);
+        continue;
       }
 
-      // append padding rows
-      std::fill_n(output_data + r_h_inp_lim * out_row_size, padding_list[0].second * out_row_size,
-                  constant_value);
-      break;
-    }
-    case 3: // HWC
-    {
-      const int32_t in_row_len = input_shape.Dims(2);
-      const int32_t out_row_size = output_shape.Dims(2);
-      const auto plain_size = out_row_size * output_shape.Dims(1);
+      const int64_t in_plane = static_cast<int64_t>(in_n) * in_dims[1] + in_h;
+      const float *in = input_data + in_plane * in_plane_size;
 
-      // prepend padding plains
-      std::fill_n(output_data, padding_list[0].first * plain_size, constant_value);
+      // prepend padding rows
+      std::fill_n(out, pads[2].first * out_row_size, constant_value);
+      out += pads[2].first * out_row_size;
 
-      const auto r_h_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, i_inp = 0; i < r_h_inp_lim; ++i, ++i_inp)
+      if (!has_channel_padding)
       {
-        const auto out_w_offset = (i * output_shape.Dims(1) + 0) * output_shape.Dims(2);
-
-        // prepend padding rows
-        std::fill_n(output_data + out_w_offset, padding_list[1].first * out_row_size,
-                    constant_value);
-
-        const auto r_w_inp_lim = input_shape.Dims(1) + padding_list[1].first;
-        for (auto j = padding_list[1].first, j_inp = 0; j < r_w_inp_lim; ++j, ++j_inp)
-        {
-          auto out_offset = (i * output_shape.Dims(1) + j) * output_shape.Dims(2);
-          const auto in_offset = (i_inp * input_shape.Dims(1) + j_inp) * input_shape.Dims(2);
-
-          // prepend padding values
-          std::fill_n(output_data + out_offset, padding_list[2].first, constant_value);
-
-          out_offset += padding_list[2].first;
-
-          // copy a row of input data
-          memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(float));
-
-          out_offset += in_row_len;
-
-          // append padding values
-          std::fill_n(output_data + out_offset, padding_list[2].second, constant_value);
-        }
-
-        // append padding rows
-        std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
-                    padding_list[1].second * out_row_size, constant_value);
+        // Rows are contiguous in both input and output
+        memcpy(out, in, in_plane_size * sizeof(float));
+        out += in_plane_size;
       }
-
-      // append padding plains
-      std::fill_n(output_data + r_h_inp_lim * plain_size, padding_list[0].second * plain_size,
-                  constant_value);
-      break;
-    }
-    case 4:
-    {
-      auto get_offset = [](const Shape &shape, int32_t n, int32_t h, int32_t w) -> int32_t {
-        return ((n * shape.Dims(1) + h) * shape.Dims(2) + w) * shape.Dims(3);
-      };
-      const int32_t in_row_len = input_shape.Dims(3);
-      const int32_t out_row_size = output_shape.Dims(3);
-      const auto plain_size = out_row_size * output_shape.Dims(2);
-      const auto parallelepiped_size = plain_size * output_shape.Dims(1);
-
-      // prepend padding parallelepipeds
-      std::fill_n(output_data, padding_list[0].first * parallelepiped_size, constant_value);
-
-      const auto r_b_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, i_inp = 0; i < r_b_inp_lim; ++i, ++i_inp)
+      else
       {
-        const auto out_h_offset = get_offset(output_shape, i, 0, 0);
-        // prepend padding plains
-        std::fill_n(output_data + out_h_offset, padding_list[1].first * plain_size, constant_value);
-
-        const auto r_h_inp_lim = input_shape.Dims(1) + padding_list[1].first;
-        for (auto j = padding_list[1].first, j_inp = 0; j < r_h_inp_lim; ++j, ++j_inp)
+        for (int32_t w = 0; w < in_dims[2]; ++w)
         {
-          const auto out_w_offset = get_offset(output_shape, i, j, 0);
-
-          // prepend padding rows
-          std::fill_n(output_data + out_w_offset, padding_list[2].first * out_row_size,
-                      constant_value);
-
-          const auto r_w_inp_lim = input_shape.Dims(2) + padding_list[2].first;
-          for (auto k = padding_list[2].first, k_inp = 0; k < r_w_inp_lim; ++k, ++k_inp)
-          {
-            auto out_c_offset = get_offset(output_shape, i, j, k);
-            const auto in_offset = get_offset(input_shape, i_inp, j_inp, k_inp);
-
-            // prepend padding values
-            std::fill_n(output_data + out_c_offset, padding_list[3].first, constant_value);
-
-            out_c_offset += padding_list[3].first;
-
-            // copy a row of input data
-            memcpy(output_data + out_c_offset, input_data + in_offset, in_row_len * sizeof(float));
-
-            out_c_offset += in_row_len;
-
-            // append padding values
-            std::fill_n(output_data + out_c_offset, padding_list[3].second, constant_value);
-          }
-
-          // append padding rows
-          std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
-                      padding_list[2].second * out_row_size, constant_value);
+          std::fill_n(out, pads[3].first, constant_value);
+          memcpy(out + pads[3].first, in + w * in_dims[3], in_dims[3] * sizeof(float));
+          std::fill_n(out + pads[3].first + in_dims[3], pads[3].second, constant_value);
+          out += out_row_size;
         }
-
-        // append padding plains
-        std::fill_n(output_data + out_h_offset + r_h_inp_lim * plain_size,
-                    padding_list[1].second * plain_size, constant_value);
       }
-      // append padding parallelepipeds
-      std::fill_n(output_data + r_b_inp_lim * parallelepiped_size,
-                  padding_list[0].second * parallelepiped_size, constant_value);
-      break;
+
+      // append padding rows
+      std::fill_n(out, pads[2].second * out_row_size, constant_value);
     }
-    default:
-      throw std::runtime_error("Padding for rank > 4 NYI");
-      break;
-  }
+  };
+
+  eigen_support::ParallelFor(static_cast<int64_t>(out_dims[0]) * out_dims[1],
+                             eigen_support::DataMovementCost(out_plane_size * sizeof(float)),
+                             pad_planes);
 }
+
 } // namespace cker
 } // namespace nnfw
 
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RNN_H__
+#define __NNFW_CKER_RNN_H__
+
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/operation/RecurrentUtils.h"
+
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Basic RNN over n_time steps, hidden = activation(W * input + R * hidden + bias)
+ *
+ * Input is [n_time, n_batch, n_input] and output is [n_time, n_batch, n_units]. Hidden state is
+ * [n_batch, n_units], updated in place to the one of the last step. Input of all steps is
+ * multiplied by W at once, and only R is multiplied step by step.
+ * WeightT is float, or int8_t for hybrid RNN with symmetric weights of params scales.
+ */
+template <typename WeightT>
+inline void RNN(const RNNParams &params, int n_time, int n_batch, int n_input, int n_units,
+                const float *input_data, const WeightT *weights_data,
+                const WeightT *recurrent_weights_data, const float *bias_data, float *hidden_state,
+                float *output_data, RecurrentTempArena &arena)
+{
+  using namespace recurrent_internal;
+
+  // Output = bias + W * input, for all steps
+  VectorBatchVectorAssign(bias_data, n_units, n_time * n_batch, output_data);
+  MatMulAccumulate(weights_data, &params.weights_scale, 1, n_units, n_input, input_data,
+                   n_time * n_batch, output_data, arena);
+
+  const int step_size = n_batch * n_units;
+  for (int t = 0; t < n_time; ++t)
+  {
+    float *step_output = output_data + t * step_size;
+    MatMulAccumulate(recurrent_weights_data, &params.recurrent_weights_scale, 1, n_units, n_units,
+                     hidden_state, n_batch, step_output, arena);
+    ApplyActivation(params.activation, step_output, step_size);
+    std::memcpy(hidden_state, step_output, step_size * sizeof(float));
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RNN_H__
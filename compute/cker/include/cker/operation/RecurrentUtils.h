@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RECURRENT_UTILS_H__
+#define __NNFW_CKER_RECURRENT_UTILS_H__
+
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Buffers reused over runs of a recurrent kernel, so that a run does not allocate
+ */
+class RecurrentTempArena
+{
+public:
+  std::vector<float> gates;
+  std::vector<float> cell_output;
+  // For int8 weights
+  std::vector<int8_t> quantized;
+  std::vector<float> scaling_factors;
+  std::vector<float> products;
+  std::vector<int32_t> accum_scratch;
+};
+
+namespace recurrent_internal
+{
+
+using VectorMap = Eigen::Map<Eigen::ArrayXf>;
+using ConstVectorMap = Eigen::Map<const Eigen::ArrayXf>;
+
+inline void Sigmoid(float *data, int size)
+{
+  VectorMap vector(data, size);
+  vector = vector.unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+}
+
+inline void ApplyActivation(FusedActivationFunctionType activation, float *data, int size)
+{
+  switch (activation)
+  {
+    case FusedActivationFunctionType::kTanh:
+      VectorMap(data, size) = ConstVectorMap(data, size).tanh();
+      break;
+    case FusedActivationFunctionType::kSigmoid:
+      Sigmoid(data, size);
+      break;
+    default:
+      ApplyActivationToVector(data, size, activation, data);
+      break;
+  }
+}
+
+inline void Clip(float *data, int size, float clip)
+{
+  if (clip > 0.0f)
+  {
+    VectorMap vector(data, size);
+    vector = vector.max(-clip).min(clip);
+  }
+}
+
+/**
+ * @brief result[b] += matrix * vectors[b] for each batch b
+ *
+ * The matrix is [num_blocks * block_rows, cols], blocks of rows stacked (e.g. gates of LSTM).
+ */
+inline void MatMulAccumulate(const float *matrix, const float *, int num_blocks, int block_rows,
+                             int cols, const float *vectors, int n_batch, float *result,
+                             RecurrentTempArena &)
+{
+  MatrixBatchVectorMultiplyAccumulate(matrix, num_blocks * block_rows, cols, vectors, n_batch,
+                                      result, /*result_stride=*/1);
+}
+
+/**
+ * @brief Same as above with int8 symmetric weights, where each block has its own scale
+ *
+ * Vectors are quantized by batch, and all blocks are multiplied at once. Scales of blocks are
+ * applied to the products afterwards.
+ */
+inline void MatMulAccumulate(const int8_t *matrix, const float *block_scales, int num_blocks,
+                             int block_rows, int cols, const float *vectors, int n_batch,
+                             float *result, RecurrentTempArena &arena)
+{
+  // Save matrix multiplication computation for all zero input.
+  if (IsZeroVector(vectors, n_batch * cols))
+    return;
+
+  arena.quantized.resize(n_batch * cols);
+  arena.scaling_factors.resize(n_batch);
+  float unused_min, unused_max;
+  for (int b = 0; b < n_batch; ++b)
+  {
+    SymmetricQuantizeFloats(vectors + b * cols, cols, arena.quantized.data() + b * cols,
+                            &unused_min, &unused_max, &arena.scaling_factors[b]);
+  }
+
+  const int rows = num_blocks * block_rows;
+  arena.products.assign(n_batch * rows, 0.0f);
+#ifdef USE_RUY_GEMV
+  arena.accum_scratch.resize(n_batch * rows);
+  MatrixBatchVectorMultiplyAccumulate(matrix, rows, cols, arena.quantized.data(),
+                                      arena.scaling_factors.data(), n_batch,
+                                      arena.accum_scratch.data(), arena.products.data(),
+                                      /*result_stride=*/1);
+#else
+  MatrixBatchVectorMultiplyAccumulate(matrix, rows, cols, arena.quantized.data(),
+                                      arena.scaling_factors.data(), n_batch, arena.products.data(),
+                                      /*result_stride=*/1);
+#endif
+
+  for (int b = 0; b < n_batch; ++b)
+  {
+    for (int block = 0; block < num_blocks; ++block)
+    {
+      const int offset = b * rows + block * block_rows;
+      VectorMap(result + offset, block_rows) +=
+          ConstVectorMap(arena.products.data() + offset, block_rows) * block_scales[block];
+    }
+  }
+}
+
+} // namespace recurrent_internal
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RECURRENT_UTILS_H__
@@ -21,6 +21,11 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 namespace nnfw
 {
@@ -30,10 +35,10 @@ namespace cker
 // A generic reduce method that can be used for reduce_sum, reduce_mean, etc.
 // This method iterates through input data and reduce elements along the
 // dimensions given in axis.
-template <typename In, typename Out>
+template <typename In, typename Out, typename Reducer>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
-                       const int *axis, const int num_axis, int *input_iter,
-                       Out reducer(const Out current, const In in), Out *output_data)
+                       const int *axis, const int num_axis, int *input_iter, Reducer reducer,
+                       Out *output_data)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -54,6 +59,199 @@ inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Sha
   return true;
 }
 
+namespace reduce_internal
+{
+
+// Number of independent accumulators of a row reduction. They break the dependency chain between
+// iterations so that the compiler can vectorize the loop even for floating point reducers.
+constexpr int kLanes = 8;
+// Number of elements each task works on when a single row or column is split over threads
+constexpr int kBlockSize = 4096;
+
+template <typename In, typename Out, typename Reducer, typename Combiner>
+inline Out ReduceRow(const In *input_data, int size, Out init_value, Reducer reducer,
+                     Combiner combiner)
+{
+  Out acc[kLanes];
+  for (int l = 0; l < kLanes; ++l)
+  {
+    acc[l] = init_value;
+  }
+  int i = 0;
+  for (; i + kLanes <= size; i += kLanes)
+  {
+    for (int l = 0; l < kLanes; ++l)
+    {
+      acc[l] = reducer(acc[l], input_data[i + l]);
+    }
+  }
+  for (; i < size; ++i)
+  {
+    acc[0] = reducer(acc[0], input_data[i]);
+  }
+  Out result = acc[0];
+  for (int l = 1; l < kLanes; ++l)
+  {
+    result = combiner(result, acc[l]);
+  }
+  return result;
+}
+
+template <typename In, typename Out, typename Reducer>
+inline void AccumulateRow(const In *__restrict__ input_data, int size, Reducer reducer,
+                          Out *__restrict__ output_data)
+{
+  // Unrolled by kLanes so that the body is vectorized without a runtime trip count check
+  int i = 0;
+  for (; i + kLanes <= size; i += kLanes)
+  {
+    for (int l = 0; l < kLanes; ++l)
+    {
+      output_data[i + l] = reducer(output_data[i + l], input_data[i + l]);
+    }
+  }
+  for (; i < size; ++i)
+  {
+    output_data[i] = reducer(output_data[i], input_data[i]);
+  }
+}
+
+template <typename In>
+inline Eigen::TensorOpCost ReduceCost(int64_t num_reduced, int64_t num_outputs, size_t out_size)
+{
+  return Eigen::TensorOpCost(num_reduced * sizeof(In), num_outputs * out_size, num_reduced);
+}
+
+} // namespace reduce_internal
+
+// Collapses the input shape into [outer, reduce, inner] by skipping dimensions of size 1 and
+// merging neighbouring dimensions. Returns false if the reduced axes are not contiguous.
+inline bool CollapseReduceDims(const Shape &input_shape, const int *axis, const int num_axis,
+                               int *outer_size, int *reduce_size, int *inner_size)
+{
+  enum class Part
+  {
+    kOuter,
+    kReduce,
+    kInner
+  };
+
+  Part part = Part::kOuter;
+  *outer_size = 1;
+  *reduce_size = 1;
+  *inner_size = 1;
+  for (int d = 0; d < input_shape.DimensionsCount(); ++d)
+  {
+    const int size = input_shape.Dims(d);
+    if (size == 0)
+      return false;
+    if (size == 1)
+      continue;
+
+    if (std::find(axis, axis + num_axis, d) != axis + num_axis)
+    {
+      if (part == Part::kInner)
+        return false;
+      part = Part::kReduce;
+      *reduce_size *= size;
+    }
+    else if (part == Part::kOuter)
+    {
+      *outer_size *= size;
+    }
+    else
+    {
+      part = Part::kInner;
+      *inner_size *= size;
+    }
+  }
+  return true;
+}
+
+// Fast path of ReduceImpl for reduced axes which are contiguous in memory after collapsing the
+// shape. Rows are reduced with independent accumulators and split over the shared threadpool.
+// 'reducer' folds an input element into an output value, and 'combiner' merges two partial
+// results, so that both must be associative. Returns false without touching the output if the
+// axes are not supported.
+template <typename In, typename Out, typename Reducer, typename Combiner>
+inline bool ReduceContiguous(const In *input_data, const Shape &input_shape, const int *axis,
+                             const int num_axis, Out init_value, Reducer reducer,
+                             Combiner combiner, Out *output_data)
+{
+  int outer_size, reduce_size, inner_size;
+  if (!CollapseReduceDims(input_shape, axis, num_axis, &outer_size, &reduce_size, &inner_size))
+  {
+    return false;
+  }
+
+  using reduce_internal::AccumulateRow;
+  using reduce_internal::kBlockSize;
+  using reduce_internal::ReduceCost;
+  using reduce_internal::ReduceRow;
+
+  if (inner_size == 1 && outer_size == 1)
+  {
+    // Reduce everything into one value. Partial results of blocks are merged in fixed order, so
+    // the result does not depend on the number of threads.
+    const int num_blocks = (reduce_size + kBlockSize - 1) / kBlockSize;
+    std::vector<Out> partials(num_blocks);
+    eigen_support::ParallelFor(
+        num_blocks, ReduceCost<In>(kBlockSize, 1, sizeof(Out)), [&](int64_t start, int64_t end) {
+          for (int64_t b = start; b < end; ++b)
+          {
+            const int offset = b * kBlockSize;
+            const int size = std::min(kBlockSize, reduce_size - offset);
+            partials[b] = ReduceRow(input_data + offset, size, init_value, reducer, combiner);
+          }
+        });
+    Out result = partials[0];
+    for (int b = 1; b < num_blocks; ++b)
+    {
+      result = combiner(result, partials[b]);
+    }
+    output_data[0] = result;
+  }
+  else if (inner_size == 1)
+  {
+    // Reduce the innermost axis, one output for each row
+    eigen_support::ParallelFor(outer_size, ReduceCost<In>(reduce_size, 1, sizeof(Out)),
+                               [&](int64_t start, int64_t end) {
+                                 for (int64_t o = start; o < end; ++o)
+                                 {
+                                   output_data[o] = ReduceRow(input_data + o * reduce_size,
+                                                              reduce_size, init_value, reducer,
+                                                              combiner);
+                                 }
+                               });
+  }
+  else
+  {
+    // Reduce an outer axis. Each output row accumulates input rows element-wise, and the inner
+    // loop is vectorized. Rows are split into blocks so that a single row also runs in parallel.
+    const int block_size = std::min(kBlockSize, inner_size);
+    const int num_blocks = (inner_size + block_size - 1) / block_size;
+    eigen_support::ParallelFor(
+        static_cast<int64_t>(outer_size) * num_blocks,
+        ReduceCost<In>(static_cast<int64_t>(reduce_size) * block_size, block_size, sizeof(Out)),
+        [&](int64_t start, int64_t end) {
+          for (int64_t unit = start; unit < end; ++unit)
+          {
+            const int o = unit / num_blocks;
+            const int offset = (unit % num_blocks) * block_size;
+            const int size = std::min(block_size, inner_size - offset);
+            Out *out = output_data + static_cast<int64_t>(o) * inner_size + offset;
+            const In *in = input_data + static_cast<int64_t>(o) * reduce_size * inner_size + offset;
+            std::fill(out, out + size, init_value);
+            for (int r = 0; r < reduce_size; ++r, in += inner_size)
+            {
+              AccumulateRow(in, size, reducer, out);
+            }
+          }
+        });
+  }
+  return true;
+}
+
 // This method parses the input 'axis' to remove duplicates and handle negative
 // values, and returns a valid 'out_axis'
 inline bool ResolveAxis(const int num_dims, const std::vector<int> &axes, int *out_axis,
@@ -135,10 +333,11 @@ public:
 
   // Computes the generic value (i.e., sum/max/min/prod) of elements across
   // dimensions given in axis. It needs to pass in init_value and reducer.
-  template <typename T>
+  // 'reducer' must be associative and commutative, since elements may be reduced in any order.
+  template <typename T, typename Reducer>
   inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
                             const Shape &output_shape, T *output_data, const std::vector<int> &axes,
-                            bool, T init_value, T reducer(const T current, const T in))
+                            bool, T init_value, Reducer reducer)
   {
     // Reset output data.
     if (!InitTensorDataForReduce(output_shape, init_value, output_data))
@@ -154,6 +353,12 @@ public:
       return false;
     }
 
+    if (ReduceContiguous<T, T>(input_data, input_shape, _resolved_axis.data(), num_resolved_axis,
+                               init_value, reducer, reducer, output_data))
+    {
+      return true;
+    }
+
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, _resolved_axis.data(),
                             num_resolved_axis, _temp_index.data(), reducer, output_data);
   }
@@ -159,6 +159,21 @@ public:
     {
       return false;
     }
+
+    // Sum first and divide once, which is what 'reducer' computes element by element
+    auto sum = [](const Out current, const Out in) -> Out { return current + in; };
+    if (ReduceContiguous<In, Out>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
+                                  init_value, sum, sum, output_data))
+    {
+      const Out normalizer = static_cast<Out>(input_shape.FlatSize() / output_shape.FlatSize());
+      const int num_outputs = output_shape.FlatSize();
+      for (int idx = 0; idx < num_outputs; ++idx)
+      {
+        output_data[idx] /= normalizer;
+      }
+      return true;
+    }
+
     return ReduceMeanImpl<In, Out>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
                                    temp_index_data(), reducer, output_data);
   }
@@ -184,9 +199,19 @@ public:
       return false;
     }
 
-    size_t normalizer =
-        ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
-                               temp_index_data(), reducer, _temp_sum.data());
+    size_t normalizer;
+    auto combiner = [](const int current, const int in) -> int { return current + in; };
+    if (ReduceContiguous<In, int>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
+                                  0, reducer, combiner, _temp_sum.data()))
+    {
+      normalizer = input_shape.FlatSize() / num_outputs;
+    }
+    else
+    {
+      normalizer =
+          ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
+                                 temp_index_data(), reducer, _temp_sum.data());
+    }
     if (num_outputs > 0)
     {
       float scale = input_scale / output_scale;
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RESIZE_BILINEAR_H__
+#define __NNFW_CKER_RESIZE_BILINEAR_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace resize_bilinear_internal
+{
+
+// Source positions of an output coordinate, which are computed once per axis
+struct Interpolation
+{
+  int lower;  //< Offset of the lower source position
+  int upper;  //< Offset of the upper source position
+  float lerp; //< Weight of the upper one
+};
+
+inline std::vector<Interpolation> ComputeInterpolation(const ResizeBilinearParams &params,
+                                                       int in_size, int out_size, int stride)
+{
+  const float scale = (params.align_corners && out_size > 1)
+                          ? static_cast<float>(in_size - 1) / (out_size - 1)
+                          : static_cast<float>(in_size) / out_size;
+
+  std::vector<Interpolation> interpolation(out_size);
+  for (int i = 0; i < out_size; ++i)
+  {
+    const float in = params.half_pixel_centers ? (i + 0.5f) * scale - 0.5f : i * scale;
+    const float in_floor = std::floor(in);
+    interpolation[i].lower = std::max(static_cast<int>(in_floor), 0) * stride;
+    interpolation[i].upper = std::min(static_cast<int>(std::ceil(in)), in_size - 1) * stride;
+    interpolation[i].lerp = in - in_floor;
+  }
+  return interpolation;
+}
+
+template <typename Derived>
+inline void StoreInterpolated(const Eigen::ArrayBase<Derived> &value, float *output, int depth)
+{
+  Eigen::Map<Eigen::ArrayXf>(output, depth) = value;
+}
+
+template <typename Derived>
+inline void StoreInterpolated(const Eigen::ArrayBase<Derived> &value, uint8_t *output, int depth)
+{
+  // Round to nearest, as interpolation of non-negative values is non-negative
+  Eigen::Map<Eigen::Array<uint8_t, Eigen::Dynamic, 1>>(output, depth) =
+      (value + 0.5f).template cast<uint8_t>();
+}
+
+} // namespace resize_bilinear_internal
+
+/**
+ * @brief Bilinear resize of NHWC tensor
+ *
+ * Source positions and weights of rows and columns are computed before the loop, and channels
+ * of a pixel are interpolated as a vector.
+ */
+template <typename T>
+inline void ResizeBilinear(const ResizeBilinearParams &params, const Shape &input_shape,
+                           const T *input_data, const Shape &output_shape, T *output_data)
+{
+  using namespace resize_bilinear_internal;
+  using ConstVectorMap = Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>>;
+
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int input_row_size = input_width * depth;
+  const int output_row_size = output_width * depth;
+
+  const auto ys = ComputeInterpolation(params, input_height, output_height, input_row_size);
+  const auto xs = ComputeInterpolation(params, input_width, output_width, depth);
+
+  const auto resize_rows = [&](int64_t start, int64_t end) {
+    for (int64_t row = start; row < end; ++row)
+    {
+      const int batch = row / output_height;
+      const auto &y = ys[row % output_height];
+      const T *input_batch = input_data + batch * input_height * input_row_size;
+      const T *top = input_batch + y.lower;
+      const T *bottom = input_batch + y.upper;
+      T *output_row = output_data + row * output_row_size;
+
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const auto &x = xs[out_x];
+        const auto top_left = ConstVectorMap(top + x.lower, depth).template cast<float>();
+        const auto top_right = ConstVectorMap(top + x.upper, depth).template cast<float>();
+        const auto bottom_left = ConstVectorMap(bottom + x.lower, depth).template cast<float>();
+        const auto bottom_right = ConstVectorMap(bottom + x.upper, depth).template cast<float>();
+        const auto top_lerp = top_left + (top_right - top_left) * x.lerp;
+        const auto bottom_lerp = bottom_left + (bottom_right - bottom_left) * x.lerp;
+        StoreInterpolated(top_lerp + (bottom_lerp - top_lerp) * y.lerp, output_row + out_x * depth,
+                          depth);
+      }
+    }
+  };
+
+  eigen_support::ParallelFor(
+      static_cast<int64_t>(batches) * output_height,
+      Eigen::TensorOpCost(4 * input_row_size * sizeof(T), output_row_size * sizeof(T),
+                          8 * output_row_size),
+      resize_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RESIZE_BILINEAR_H__
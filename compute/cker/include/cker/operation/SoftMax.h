@@ -21,6 +21,7 @@
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
+#include "cker/eigen/EigenSupport.h"
 #include "cker/eigen/Utils.h"
 
 #include <Eigen/Core>
@@ -38,16 +39,27 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
   // Validate whether if shapes of input and output are the same
   MatchingFlatSize(input_shape, output_shape);
 
-  const auto in_mat = MapAsMatrixWithLastDimAsRows(input_data, input_shape);
-  auto out_mat = MapAsMatrixWithLastDimAsRows(output_data, output_shape);
-  // Compute the exponential first, removing the max coefficient for numerical
-  // stability.
-  out_mat = (in_mat.rowwise() - in_mat.colwise().maxCoeff()).array() * params.beta;
-  // We are separating out the exp function so that exp can be vectorized.
-  out_mat = out_mat.array().exp();
-  // Normalize to get the activations.
-  Eigen::Array<float, 1, Eigen::Dynamic> scale = out_mat.array().colwise().sum().inverse();
-  out_mat.array().rowwise() *= scale;
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+
+  // Rows are independent, so they are split over the shared threadpool. Eigen vectorizes max, exp
+  // and sum of each row.
+  const Eigen::TensorOpCost cost(depth * sizeof(float), depth * sizeof(float),
+                                 depth * Eigen::internal::functor_traits<
+                                             Eigen::internal::scalar_exp_op<float>>::Cost);
+  eigen_support::ParallelFor(outer_size, cost, [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i)
+    {
+      const Eigen::Map<const Eigen::ArrayXf> in_row(input_data + i * depth, depth);
+      Eigen::Map<Eigen::ArrayXf> out_row(output_data + i * depth, depth);
+      // Compute the exponential first, removing the max coefficient for numerical
+      // stability.
+      out_row = ((in_row - in_row.maxCoeff()) * params.beta).exp();
+      // Normalize to get the activations.
+      out_row *= 1.0f / out_row.sum();
+    }
+  });
 }
 
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
@@ -71,65 +83,70 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
   const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
   const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
 
-  for (int i = 0; i < outer_size; ++i)
-  {
-    uint8_t max_in_row = 0;
-    for (int c = 0; c < depth; ++c)
-    {
-      max_in_row = std::max(max_in_row, input_data[i * depth + c]);
-    }
-
-    FixedPointAccum sum_of_exps = FixedPointAccum::Zero();
-    for (int c = 0; c < depth; ++c)
+  // Rows are independent, so they are split over the shared threadpool. exp_on_negative_values()
+  // takes a few dozen integer operations and runs twice for each element.
+  const Eigen::TensorOpCost cost(depth, depth, depth * 64);
+  eigen_support::ParallelFor(outer_size, cost, [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i)
     {
-      int32_t input_diff = static_cast<int32_t>(input_data[i * depth + c]) - max_in_row;
-      if (input_diff >= diff_min)
+      uint8_t max_in_row = 0;
+      for (int c = 0; c < depth; ++c)
       {
-        const int32_t input_diff_rescaled = MultiplyByQuantizedMultiplierGreaterThanOne(
-            input_diff, input_beta_multiplier, input_beta_left_shift);
-        const FixedPointScaledDiff scaled_diff_f8 =
-            FixedPointScaledDiff::FromRaw(input_diff_rescaled);
-        sum_of_exps = sum_of_exps + gemmlowp::Rescale<kAccumulationIntegerBits>(
-                                        exp_on_negative_values(scaled_diff_f8));
+        max_in_row = std::max(max_in_row, input_data[i * depth + c]);
       }
-    }
-
-    int32_t fixed_sum_of_exps = sum_of_exps.raw();
-    int headroom_plus_one = CountLeadingZeros(static_cast<uint32_t>(fixed_sum_of_exps));
-    // This is the number of bits to the left of the binary point above 1.0.
-    // Consider fixed_sum_of_exps=1.25.  In that case shifted_scale=0.8 and
-    // no later adjustment will be needed.
-    int num_bits_over_unit = kAccumulationIntegerBits - headroom_plus_one;
-    int32_t shifted_sum_minus_one =
-        static_cast<int32_t>((static_cast<uint32_t>(fixed_sum_of_exps) << headroom_plus_one) -
-                             (static_cast<uint32_t>(1) << 31));
-
-    FixedPoint0 shifted_scale =
-        one_over_one_plus_x_for_x_in_0_1(FixedPoint0::FromRaw(shifted_sum_minus_one));
 
-    for (int c = 0; c < depth; ++c)
-    {
-      int32_t input_diff = static_cast<int32_t>(input_data[i * depth + c]) - max_in_row;
-      if (input_diff >= diff_min)
+      FixedPointAccum sum_of_exps = FixedPointAccum::Zero();
+      for (int c = 0; c < depth; ++c)
       {
-        const int32_t input_diff_rescaled = MultiplyByQuantizedMultiplierGreaterThanOne(
-            input_diff, input_beta_multiplier, input_beta_left_shift);
-        const FixedPointScaledDiff scaled_diff_f8 =
-            FixedPointScaledDiff::FromRaw(input_diff_rescaled);
+        int32_t input_diff = static_cast<int32_t>(input_data[i * depth + c]) - max_in_row;
+        if (input_diff >= diff_min)
+        {
+          const int32_t input_diff_rescaled = MultiplyByQuantizedMultiplierGreaterThanOne(
+              input_diff, input_beta_multiplier, input_beta_left_shift);
+          const FixedPointScaledDiff scaled_diff_f8 =
+              FixedPointScaledDiff::FromRaw(input_diff_rescaled);
+          sum_of_exps = sum_of_exps + gemmlowp::Rescale<kAccumulationIntegerBits>(
+                                          exp_on_negative_values(scaled_diff_f8));
+        }
+      }
 
-        FixedPoint0 exp_in_0 = exp_on_negative_values(scaled_diff_f8);
-        int32_t unsat_output = gemmlowp::RoundingDivideByPOT((shifted_scale * exp_in_0).raw(),
-                                                             num_bits_over_unit + 31 - 8);
+      int32_t fixed_sum_of_exps = sum_of_exps.raw();
+      int headroom_plus_one = CountLeadingZeros(static_cast<uint32_t>(fixed_sum_of_exps));
+      // This is the number of bits to the left of the binary point above 1.0.
+      // Consider fixed_sum_of_exps=1.25.  In that case shifted_scale=0.8 and
+      // no later adjustment will be needed.
+      int num_bits_over_unit = kAccumulationIntegerBits - headroom_plus_one;
+      int32_t shifted_sum_minus_one =
+          static_cast<int32_t>((static_cast<uint32_t>(fixed_sum_of_exps) << headroom_plus_one) -
+                               (static_cast<uint32_t>(1) << 31));
 
-        output_data[i * depth + c] = static_cast<uint8_t>(
-            std::max(std::min(unsat_output, static_cast<int32_t>(255)), static_cast<int32_t>(0)));
-      }
-      else
+      FixedPoint0 shifted_scale =
+          one_over_one_plus_x_for_x_in_0_1(FixedPoint0::FromRaw(shifted_sum_minus_one));
+
+      for (int c = 0; c < depth; ++c)
       {
-        output_data[i * depth + c] = 0;
+        int32_t input_diff = static_cast<int32_t>(input_data[i * depth + c]) - max_in_row;
+        if (input_diff >= diff_min)
+        {
+          const int32_t input_diff_rescaled = MultiplyByQuantizedMultiplierGreaterThanOne(
+              input_diff, input_beta_multiplier, input_beta_left_shift);
+          const FixedPointScaledDiff scaled_diff_f8 =
+              FixedPointScaledDiff::FromRaw(input_diff_rescaled);
+
+          FixedPoint0 exp_in_0 = exp_on_negative_values(scaled_diff_f8);
+          int32_t unsat_output = gemmlowp::RoundingDivideByPOT((shifted_scale * exp_in_0).raw(),
+                                                               num_bits_over_unit + 31 - 8);
+
+          output_data[i * depth + c] = static_cast<uint8_t>(
+              std::max(std::min(unsat_output, static_cast<int32_t>(255)), static_cast<int32_t>(0)));
+        }
+        else
+        {
+          output_data[i * depth + c] = 0;
+        }
       }
     }
-  }
+  });
 }
 
 } // namespace cker
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_SPACE_TO_BATCH_ND_H__
+#define __NNFW_CKER_SPACE_TO_BATCH_ND_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief SpaceToBatchND of NHWC tensor
+ *
+ * Output batch (offset_h * block_width + offset_w) * input batches + b gathers input pixels of
+ * the same spatial offset in batch b. Pixels are copied as runs of channels, and pixels of
+ * padding are filled with params.output_offset.
+ *
+ * @param paddings_data  [[top, bottom], [left, right]]
+ */
+template <typename T>
+inline void SpaceToBatchND(const SpaceToBatchParams &params, const Shape &input_shape,
+                           const T *input_data, const int32_t *block_shape_data,
+                           const int32_t *paddings_data, const Shape &output_shape,
+                           T *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int block_height = block_shape_data[0];
+  const int block_width = block_shape_data[1];
+  const int padding_top = paddings_data[0];
+  const int padding_left = paddings_data[2];
+
+  const int input_batches = input_shape.Dims(0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int output_batches = output_shape.Dims(0);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_batches == input_batches * block_height * block_width);
+
+  const T pad_value = static_cast<T>(params.output_offset);
+  const auto copy_rows = [&](int64_t start, int64_t end) {
+    for (int64_t out_row = start; out_row < end; ++out_row)
+    {
+      const int out_batch = out_row / output_height;
+      const int out_h = out_row % output_height;
+      const int in_batch = out_batch % input_batches;
+      const int spatial_offset = out_batch / input_batches;
+      const int in_h = out_h * block_height + spatial_offset / block_width - padding_top;
+
+      T *out = output_data + out_row * output_width * depth;
+      if (in_h < 0 || in_h >= input_height)
+      {
+        std::fill_n(out, output_width * depth, pad_value);
+        continue;
+      }
+
+      const int offset_w = spatial_offset % block_width - padding_left;
+      // Range of out_w whose in_w = out_w * block_width + offset_w is not padding
+      const int first_w =
+          std::min(output_width, std::max(0, (-offset_w + block_width - 1) / block_width));
+      const int last_w =
+          std::max(first_w, std::min(output_width,
+                                     (input_width - offset_w + block_width - 1) / block_width));
+
+      const T *in = input_data + (in_batch * input_height + in_h) * input_width * depth;
+      std::fill_n(out, first_w * depth, pad_value);
+      for (int out_w = first_w; out_w < last_w; ++out_w)
+      {
+        memcpy(out + out_w * depth, in + (out_w * block_width + offset_w) * depth,
+               depth * sizeof(T));
+      }
+      std::fill(out + last_w * depth, out + output_width * depth, pad_value);
+    }
+  };
+
+  eigen_support::ParallelFor(
+      static_cast<int64_t>(output_batches) * output_height,
+      eigen_support::DataMovementCost(output_width * depth * sizeof(T)), copy_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_SPACE_TO_BATCH_ND_H__
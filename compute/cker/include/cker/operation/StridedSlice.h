@@ -21,8 +21,10 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
 
 #include <cmath>
+#include <cstring>
 
 namespace nnfw
 {
@@ -190,6 +192,15 @@ inline bool LoopCondition(int index, int stop, int stride)
   return stride > 0 ? index >= stop : index <= stop;
 }
 
+// Return the number of iterations along an axis. It is the same as the number of iterations
+// until LoopCondition() becomes true.
+inline int LoopCount(int start, int stop, int stride)
+{
+  const int count =
+      stride > 0 ? (stop - start + stride - 1) / stride : (start - stop - stride - 1) / (-stride);
+  return count > 0 ? count : 0;
+}
+
 template <typename T>
 inline StridedSliceParams
 buildStridedSliceParams(const T *begin, const T *end, const T *strides, const uint32_t begin_mask,
@@ -282,24 +293,51 @@ inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unext
   const int start_d = StartForAxis(params_copy, input_shape, 3);
   const int stop_d = StopForAxis(params_copy, input_shape, 3, start_d);
 
-  T *out_ptr = output_data;
-  for (int in_b = start_b; !LoopCondition(in_b, stop_b, params_copy.strides[0]);
-       in_b += params_copy.strides[0])
-  {
-    for (int in_h = start_h; !LoopCondition(in_h, stop_h, params_copy.strides[1]);
-         in_h += params_copy.strides[1])
+  const int stride_b = params_copy.strides[0];
+  const int stride_h = params_copy.strides[1];
+  const int stride_w = params_copy.strides[2];
+  const int stride_d = params_copy.strides[3];
+
+  const int count_b = LoopCount(start_b, stop_b, stride_b);
+  const int count_h = LoopCount(start_h, stop_h, stride_h);
+  const int count_w = LoopCount(start_w, stop_w, stride_w);
+  const int count_d = LoopCount(start_d, stop_d, stride_d);
+  const int64_t out_plane_size = static_cast<int64_t>(count_w) * count_d;
+
+  // Output is filled by (B, H) planes of [W, D] in parallel
+  auto slice_planes = [&](int64_t start, int64_t end) {
+    // Nothing is copied from an empty innermost slice, whose start need not be addressed
+    if (count_d == 0)
+      return;
+    for (int64_t plane = start; plane < end; ++plane)
     {
-      for (int in_w = start_w; !LoopCondition(in_w, stop_w, params_copy.strides[2]);
-           in_w += params_copy.strides[2])
+      const int in_b = start_b + static_cast<int>(plane / count_h) * stride_b;
+      const int in_h = start_h + static_cast<int>(plane % count_h) * stride_h;
+      T *out_ptr = output_data + plane * out_plane_size;
+      for (int w = 0; w < count_w; ++w)
       {
-        for (int in_d = start_d; !LoopCondition(in_d, stop_d, params_copy.strides[3]);
-             in_d += params_copy.strides[3])
+        const int in_w = start_w + w * stride_w;
+        const T *in_ptr = input_data + Offset(input_shape, in_b, in_h, in_w, start_d);
+        if (stride_d == 1)
         {
-          *out_ptr++ = input_data[Offset(input_shape, in_b, in_h, in_w, in_d)];
+          // Innermost elements are contiguous
+          memcpy(out_ptr, in_ptr, count_d * sizeof(T));
         }
+        else
+        {
+          for (int d = 0; d < count_d; ++d)
+          {
+            out_ptr[d] = in_ptr[d * stride_d];
+          }
+        }
+        out_ptr += count_d;
       }
     }
-  }
+  };
+
+  eigen_support::ParallelFor(static_cast<int64_t>(count_b) * count_h,
+                             eigen_support::DataMovementCost(out_plane_size * sizeof(T)),
+                             slice_planes);
 }
 
 } // namespace cker
@@ -21,6 +21,13 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+#include "cker/neon/neon_check.h"
+
+#include <algorithm>
+#if !defined(USE_NEON) && defined(__SSE2__)
+#include <xmmintrin.h>
+#endif
 
 namespace nnfw
 {
@@ -290,116 +297,148 @@ size_t Flatten(const Shape &input_shape, const Shape &output_shape, const Transp
 
 } // namespace anonymous (util)
 
-// Transpose2D only deals with typical 2D matrix transpose ops.
-// Perform transpose by transposing 4x4 blocks of the input, proceeding from
-// left to right (down the rows) of the input, and then from top to bottom.
-template <typename T>
-inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
-                        T *output_data)
+namespace transpose_internal
 {
-  assert(input_shape.DimensionsCount() == 2);
-  assert(output_shape.DimensionsCount() == 2);
-  UNUSED_RELEASE(output_shape);
 
-  const int d0 = input_shape.DimsData()[0];
-  const int d1 = input_shape.DimsData()[1];
-  const int kLines = 4;
-  const int kSkipSize = (kLines - 1) * d1;
+// Transpose a 4x4 block. in_stride and out_stride are distances between rows in elements.
+template <typename T>
+inline void Transpose4x4(const T *in, int in_stride, T *out, int out_stride)
+{
+  for (int r = 0; r < 4; ++r)
+  {
+    for (int c = 0; c < 4; ++c)
+    {
+      out[c * out_stride + r] = in[r * in_stride + c];
+    }
+  }
+}
 
-  const T *input = input_data;
+#if defined(USE_NEON) || defined(__SSE2__)
+// 32-bit elements are moved as float lanes. Lane moves do not change bits, so it also works for
+// int32 and uint32.
+inline void Transpose4x4Simd32(const void *in_ptr, int in_stride, void *out_ptr, int out_stride)
+{
+  const float *in = reinterpret_cast<const float *>(in_ptr);
+  float *out = reinterpret_cast<float *>(out_ptr);
+#ifdef USE_NEON
+  const float32x4x2_t p01 = vtrnq_f32(vld1q_f32(in), vld1q_f32(in + in_stride));
+  const float32x4x2_t p23 = vtrnq_f32(vld1q_f32(in + 2 * in_stride), vld1q_f32(in + 3 * in_stride));
+  vst1q_f32(out, vcombine_f32(vget_low_f32(p01.val[0]), vget_low_f32(p23.val[0])));
+  vst1q_f32(out + out_stride, vcombine_f32(vget_low_f32(p01.val[1]), vget_low_f32(p23.val[1])));
+  vst1q_f32(out + 2 * out_stride,
+            vcombine_f32(vget_high_f32(p01.val[0]), vget_high_f32(p23.val[0])));
+  vst1q_f32(out + 3 * out_stride,
+            vcombine_f32(vget_high_f32(p01.val[1]), vget_high_f32(p23.val[1])));
+#else
+  __m128 r0 = _mm_loadu_ps(in);
+  __m128 r1 = _mm_loadu_ps(in + in_stride);
+  __m128 r2 = _mm_loadu_ps(in + 2 * in_stride);
+  __m128 r3 = _mm_loadu_ps(in + 3 * in_stride);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  _mm_storeu_ps(out, r0);
+  _mm_storeu_ps(out + out_stride, r1);
+  _mm_storeu_ps(out + 2 * out_stride, r2);
+  _mm_storeu_ps(out + 3 * out_stride, r3);
+#endif
+}
 
-  int i = 0;
-  for (; i <= d0 - kLines; i += kLines)
-  {
-    T *output = output_data + i;
+template <>
+inline void Transpose4x4<float>(const float *in, int in_stride, float *out, int out_stride)
+{
+  Transpose4x4Simd32(in, in_stride, out, out_stride);
+}
 
-    const T *input_ptr = input;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
+template <>
+inline void Transpose4x4<int32_t>(const int32_t *in, int in_stride, int32_t *out, int out_stride)
+{
+  Transpose4x4Simd32(in, in_stride, out, out_stride);
+}
+#endif // defined(USE_NEON) || defined(__SSE2__)
 
-    int j = 0;
-    for (; j <= d1 - kLines; j += kLines)
-    {
-      input_ptr = input;
-      const T a00 = input_ptr[0];
-      const T a01 = input_ptr[1];
-      const T a02 = input_ptr[2];
-      const T a03 = input_ptr[3];
-      input_ptr += d1;
-      const T a10 = input_ptr[0];
-      const T a11 = input_ptr[1];
-      const T a12 = input_ptr[2];
-      const T a13 = input_ptr[3];
-      input_ptr += d1;
-      const T a20 = input_ptr[0];
-      const T a21 = input_ptr[1];
-      const T a22 = input_ptr[2];
-      const T a23 = input_ptr[3];
-      input_ptr += d1;
-      const T a30 = input_ptr[0];
-      const T a31 = input_ptr[1];
-      const T a32 = input_ptr[2];
-      const T a33 = input_ptr[3];
-
-      output[0] = a00;
-      output[1] = a10;
-      output[2] = a20;
-      output[3] = a30;
-      output += d0;
-
-      output[0] = a01;
-      output[1] = a11;
-      output[2] = a21;
-      output[3] = a31;
-      output += d0;
-
-      output[0] = a02;
-      output[1] = a12;
-      output[2] = a22;
-      output[3] = a32;
-      output += d0;
-
-      output[0] = a03;
-      output[1] = a13;
-      output[2] = a23;
-      output[3] = a33;
-      output += d0;
-
-      input += kLines;
-    }
-    if (j == d1)
+// Transpose a rows x cols block of a matrix whose row length is in_stride into a matrix whose
+// row length is out_stride
+template <typename T>
+inline void TransposeBlock(const T *in, int in_stride, T *out, int out_stride, int rows, int cols)
+{
+  int r = 0;
+  for (; r + 4 <= rows; r += 4)
+  {
+    int c = 0;
+    for (; c + 4 <= cols; c += 4)
     {
-      input += kSkipSize;
+      Transpose4x4(in + r * in_stride + c, in_stride, out + c * out_stride + r, out_stride);
     }
-    else
+    for (; c < cols; ++c)
     {
-      for (int p = 0; p < kLines; ++p)
+      for (int rr = r; rr < r + 4; ++rr)
       {
-        for (int q = 0; q < d1 - j; ++q)
-        {
-          *(output + q * d0 + p) = *(input + p * d1 + q);
-        }
+        out[c * out_stride + rr] = in[rr * in_stride + c];
       }
-      input += (d1 - j) + kSkipSize;
     }
   }
-  for (; i < d0; ++i)
+  for (; r < rows; ++r)
   {
-    T *output = output_data + i;
-    for (int j = 0; j < d1; ++j)
+    for (int c = 0; c < cols; ++c)
     {
-      *output = *input;
-      output += d0;
-      ++input;
+      out[c * out_stride + r] = in[r * in_stride + c];
     }
   }
 }
 
+} // namespace transpose_internal
+
+// Transpose `batch` matrices of d0 x d1 into d1 x d0.
+//
+// Each matrix is split into bands of kBlock rows, and each band is transposed by kBlock x kBlock
+// tiles so that both source rows and destination rows of a tile stay in L1 cache. Bands of all
+// the matrices are distributed over the threadpool.
+//
+// NHWC <-> NCHW transposes fall into this after flattening the batch dimension, since
+// [N, HW, C] -> [N, C, HW] is a batch of 2D transposes.
+template <typename T>
+inline void TransposeBatched2D(int batch, int d0, int d1, const T *input_data, T *output_data)
+{
+  // 32 x 32 tiles of 4-byte elements are 4KB for each of source and destination
+  constexpr int kBlock = 32;
+  const int bands_per_matrix = (d0 + kBlock - 1) / kBlock;
+  const int64_t matrix_size = static_cast<int64_t>(d0) * d1;
+
+  auto transpose_bands = [&](int64_t start, int64_t end) {
+    for (int64_t band = start; band < end; ++band)
+    {
+      const int64_t b = band / bands_per_matrix;
+      const int r = static_cast<int>(band % bands_per_matrix) * kBlock;
+      const int rows = std::min(kBlock, d0 - r);
+      const T *in = input_data + b * matrix_size;
+      T *out = output_data + b * matrix_size;
+      for (int c = 0; c < d1; c += kBlock)
+      {
+        const int cols = std::min(kBlock, d1 - c);
+        transpose_internal::TransposeBlock(in + r * d1 + c, d1, out + c * d0 + r, d0, rows, cols);
+      }
+    }
+  };
+
+  const int64_t num_bands = static_cast<int64_t>(batch) * bands_per_matrix;
+  eigen_support::ParallelFor(num_bands,
+                             eigen_support::DataMovementCost(kBlock * d1 * sizeof(T)),
+                             transpose_bands);
+}
+
+// Transpose2D only deals with typical 2D matrix transpose ops.
+template <typename T>
+inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                        T *output_data)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  assert(output_shape.DimensionsCount() == 2);
+  UNUSED_RELEASE(output_shape);
+
+  const int d0 = input_shape.DimsData()[0];
+  const int d1 = input_shape.DimsData()[1];
+  TransposeBatched2D(1, d0, d1, input_data, output_data);
+}
+
 // TODO(alanchiao): see if we can reduce the number
 // of lines of code in branching without affecting latency.
 template <typename T>
@@ -458,18 +497,24 @@ inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
   o_s[1] = input_shape.Dims(params.perm[1]);
   o_s[2] = input_shape.Dims(params.perm[2]);
 
-  for (int i1 = 0; i1 < o_s[0]; ++i1)
-  {
-    for (int i2 = 0; i2 < o_s[1]; ++i2)
+  auto transpose_planes = [&](int64_t start, int64_t end) {
+    for (int i1 = static_cast<int>(start); i1 < end; ++i1)
     {
-      for (int i3 = 0; i3 < o_s[2]; ++i3)
+      for (int i2 = 0; i2 < o_s[1]; ++i2)
       {
-        const int i = i1 * p1 + i2 * p2 + i3 * p3;
-        const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
-        output_data[o] = input_data[i];
+        for (int i3 = 0; i3 < o_s[2]; ++i3)
+        {
+          const int i = i1 * p1 + i2 * p2 + i3 * p3;
+          const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
+          output_data[o] = input_data[i];
+        }
       }
     }
-  }
+  };
+
+  eigen_support::ParallelFor(o_s[0],
+                             eigen_support::DataMovementCost(o_s[1] * o_s[2] * sizeof(T)),
+                             transpose_planes);
 }
 
 template <typename T>
@@ -560,6 +605,14 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
                 &non_flatten_input_shape, &non_flatten_output_shape, &non_flatten_params);
     assert(non_flatten_params.perm[0] != 0);
 
+    // Transpose all the batches at once so that they are distributed over the threadpool
+    int dim0, dim1;
+    if (IsTranspose2DApplicable(non_flatten_params, non_flatten_input_shape, &dim0, &dim1))
+    {
+      TransposeBatched2D(total_size / non_flatten_size, dim0, dim1, input_data, output_data);
+      return;
+    }
+
     for (int i = 0; i < total_size; i += non_flatten_size)
     {
       TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_POINTWISE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_POINTWISE_CONV_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/operation/Common.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Convolution of 1x1 filter with unit stride and no padding, which is a GEMM of
+// (batches * height * width x input_depth) * (input_depth x output_depth).
+// OHWI filter is used as is since it is the column-major (input_depth x output_depth) matrix.
+// Rows are split into blocks so that bias and activation are applied while the block is hot.
+inline void PointwiseConv(const ConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *filter_data, const Shape &bias_shape,
+                          const float *bias_data, const Shape &output_shape, float *output_data)
+{
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using ColMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(filter_shape.Dims(1) == 1 && filter_shape.Dims(2) == 1);
+  assert(params.stride_width == 1 && params.stride_height == 1);
+  assert(params.padding_values.width == 0 && params.padding_values.height == 0);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int height = MatchingDim(input_shape, 1, output_shape, 1);
+  const int width = MatchingDim(input_shape, 2, output_shape, 2);
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+
+  const int rows = batches * height * width;
+  constexpr int kRowBlock = 64;
+  const int num_blocks = (rows + kRowBlock - 1) / kRowBlock;
+
+  const Eigen::TensorOpCost cost(static_cast<double>(kRowBlock) * input_depth * sizeof(float),
+                                 static_cast<double>(kRowBlock) * output_depth * sizeof(float),
+                                 static_cast<double>(kRowBlock) * input_depth * output_depth);
+
+  Eigen::Map<const ColMajorMatrix> filter(filter_data, input_depth, output_depth);
+  eigen_support::ParallelFor(num_blocks, cost, [&](int64_t start, int64_t end) {
+    const int first_row = static_cast<int>(start) * kRowBlock;
+    const int num_rows = std::min(static_cast<int>(end) * kRowBlock, rows) - first_row;
+    Eigen::Map<const RowMajorMatrix> input(input_data + first_row * input_depth, num_rows,
+                                           input_depth);
+    Eigen::Map<RowMajorMatrix> output(output_data + first_row * output_depth, num_rows,
+                                      output_depth);
+    output.noalias() = input * filter;
+    if (bias_data)
+    {
+      BiasAndClamp(output_activation_min, output_activation_max, output_depth, bias_data,
+                   num_rows * output_depth, output.data());
+    }
+    else
+    {
+      output = output.cwiseMax(output_activation_min).cwiseMin(output_activation_max);
+    }
+  });
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_POINTWISE_CONV_H__
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * @brief Reorder OHWI filter of TransposeConv to HWOI for TransposeConv() below
+ */
+inline void TransposeConvPrepareFilter(const Shape &filter_shape, const float *filter_data,
+                                       std::vector<float> &prepared_filter)
+{
+  assert(filter_shape.DimensionsCount() == 4);
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_spatial = filter_shape.Dims(1) * filter_shape.Dims(2);
+  const int input_depth = filter_shape.Dims(3);
+
+  prepared_filter.resize(filter_shape.FlatSize());
+  for (int oc = 0; oc < output_depth; ++oc)
+  {
+    for (int s = 0; s < filter_spatial; ++s)
+    {
+      std::copy_n(filter_data + (oc * filter_spatial + s) * input_depth, input_depth,
+                  prepared_filter.data() + (s * output_depth + oc) * input_depth);
+    }
+  }
+}
+
+/**
+ * @brief TransposeConv by GEMM and col2im
+ *
+ * Products of each input pixel and all filter taps are computed by one GEMM of
+ * [H * W, Cin] x [Cin, kh * kw * Cout], then they are accumulated to the output pixels they
+ * influence. Filter must be prepared by TransposeConvPrepareFilter(). col_buffer is resized to
+ * hold products of a batch.
+ */
+inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *prepared_filter_data, const Shape &output_shape,
+                          float *output_data, std::vector<float> &col_buffer)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  const int input_pixels = input_height * input_width;
+  const int col_size = filter_height * filter_width * output_depth;
+  col_buffer.resize(static_cast<size_t>(input_pixels) * col_size);
+
+  using ConstTensorMap = Eigen::TensorMap<Eigen::Tensor<const float, 2, Eigen::RowMajor>>;
+  using TensorMap = Eigen::TensorMap<Eigen::Tensor<float, 2, Eigen::RowMajor>>;
+  using VectorMap = Eigen::Map<Eigen::ArrayXf>;
+  using ConstVectorMap = Eigen::Map<const Eigen::ArrayXf>;
+  const Eigen::array<Eigen::IndexPair<Eigen::Index>, 1> dim_pair{
+      {Eigen::IndexPair<Eigen::Index>(1, 1)}};
+  const ConstTensorMap filter(prepared_filter_data, col_size, input_depth);
+
+  std::fill_n(output_data, output_shape.FlatSize(), 0.0f);
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    const ConstTensorMap input(input_data + batch * input_pixels * input_depth, input_pixels,
+                               input_depth);
+    TensorMap col(col_buffer.data(), input_pixels, col_size);
+    col.device(*eigen_support::GetThreadPoolDevice()) = input.contract(filter, dim_pair);
+
+    // col2im, where a row of products is accumulated to the output channels of each tap
+    float *output_batch = output_data + batch * output_height * output_width * output_depth;
+    for (int in_y = 0; in_y < input_height; ++in_y)
+    {
+      for (int in_x = 0; in_x < input_width; ++in_x)
+      {
+        const float *products = col_buffer.data() + (in_y * input_width + in_x) * col_size;
+        const int out_y_origin = (in_y * stride_height) - pad_height;
+        const int out_x_origin = (in_x * stride_width) - pad_width;
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int out_y = out_y_origin + filter_y;
+          if (out_y < 0 || out_y >= output_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int out_x = out_x_origin + filter_x;
+            if (out_x < 0 || out_x >= output_width)
+              continue;
+            VectorMap(output_batch + (out_y * output_width + out_x) * output_depth,
+                      output_depth) +=
+                ConstVectorMap(products + (filter_y * filter_width + filter_x) * output_depth,
+                               output_depth);
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/operation/Common.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+namespace winograd
+{
+
+// Transform matrices of F(m x m, 3 x 3) from Lavin and Gray, "Fast Algorithms for Convolutional
+// Neural Networks". Output is computed in m x m tiles from (m + 2) x (m + 2) input tiles as
+//   Y = AT * [(G * g * GT) . (BT * d * B)] * A
+template <int M> struct Transform;
+
+template <> struct Transform<2>
+{
+  static constexpr int kOutputTile = 2;
+  static constexpr int kInputTile = 4;
+
+  static const float *BT()
+  {
+    static const float bt[4 * 4] = {
+        1, 0, -1, 0, // row 0
+        0, 1, 1,  0, // row 1
+        0, -1, 1, 0, // row 2
+        0, 1, 0,  -1 // row 3
+    };
+    return bt;
+  }
+
+  static const float *G()
+  {
+    static const float g[4 * 3] = {
+        1.0f, 0.0f,  0.0f, // row 0
+        0.5f, 0.5f,  0.5f, // row 1
+        0.5f, -0.5f, 0.5f, // row 2
+        0.0f, 0.0f,  1.0f  // row 3
+    };
+    return g;
+  }
+
+  static const float *AT()
+  {
+    static const float at[2 * 4] = {
+        1, 1, 1,  0, // row 0
+        0, 1, -1, -1 // row 1
+    };
+    return at;
+  }
+};
+
+template <> struct Transform<4>
+{
+  static constexpr int kOutputTile = 4;
+  static constexpr int kInputTile = 6;
+
+  static const float *BT()
+  {
+    static const float bt[6 * 6] = {
+        4, 0,  -5, 0,  1, 0, // row 0
+        0, -4, -4, 1,  1, 0, // row 1
+        0, 4,  -4, -1, 1, 0, // row 2
+        0, -2, -1, 2,  1, 0, // row 3
+        0, 2,  -1, -2, 1, 0, // row 4
+        0, 4,  0,  -5, 0, 1  // row 5
+    };
+    return bt;
+  }
+
+  static const float *G()
+  {
+    static const float g[6 * 3] = {
+        1.0f / 4,   0.0f,       0.0f,      // row 0
+        -1.0f / 6,  -1.0f / 6,  -1.0f / 6, // row 1
+        -1.0f / 6,  1.0f / 6,   -1.0f / 6, // row 2
+        1.0f / 24,  1.0f / 12,  1.0f / 6,  // row 3
+        1.0f / 24,  -1.0f / 12, 1.0f / 6,  // row 4
+        0.0f,       0.0f,       1.0f       // row 5
+    };
+    return g;
+  }
+
+  static const float *AT()
+  {
+    static const float at[4 * 6] = {
+        1, 1, 1,  1, 1,  0, // row 0
+        0, 1, -1, 2, -2, 0, // row 1
+        0, 1, 1,  4, 4,  0, // row 2
+        0, 1, -1, 8, -8, 1  // row 3
+    };
+    return at;
+  }
+};
+
+// Elements of the matrices below are vectors of `depth` floats, so that every transform runs
+// over channels in the innermost loop. Element (i, j) of a matrix with `cols` columns is at
+// (i * cols + j) * stride.
+
+// dst = a * src where a is (rows x inner) and src is (inner x cols)
+inline void MultiplyLeft(const float *a, int rows, int inner, int cols, const float *src,
+                         int src_stride, float *dst, int dst_stride, int depth)
+{
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      float *__restrict__ out = dst + (i * cols + j) * dst_stride;
+      std::fill(out, out + depth, 0.0f);
+      for (int k = 0; k < inner; ++k)
+      {
+        const float coef = a[i * inner + k];
+        if (coef == 0.0f)
+          continue;
+        const float *__restrict__ in = src + (k * cols + j) * src_stride;
+        for (int c = 0; c < depth; ++c)
+          out[c] += coef * in[c];
+      }
+    }
+  }
+}
+
+// dst = src * transpose(a) where src is (rows x inner) and a is (cols x inner)
+inline void MultiplyRightTransposed(const float *a, int rows, int inner, int cols,
+                                    const float *src, int src_stride, float *dst, int dst_stride,
+                                    int depth)
+{
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      float *__restrict__ out = dst + (i * cols + j) * dst_stride;
+      std::fill(out, out + depth, 0.0f);
+      for (int k = 0; k < inner; ++k)
+      {
+        const float coef = a[j * inner + k];
+        if (coef == 0.0f)
+          continue;
+        const float *__restrict__ in = src + (i * inner + k) * src_stride;
+        for (int c = 0; c < depth; ++c)
+          out[c] += coef * in[c];
+      }
+    }
+  }
+}
+
+// Transformed filter is [alpha * alpha, input_depth, output_depth] where alpha is the input tile
+// size, so it is (alpha / 3)^2 times larger than the original filter
+template <int M> inline int TransformedFilterSize(const Shape &filter_shape)
+{
+  constexpr int alpha = Transform<M>::kInputTile;
+  return alpha * alpha * filter_shape.Dims(3) * filter_shape.Dims(0);
+}
+
+// Computes G * g * GT for every pair of output and input channels of OHWI filter
+template <int M>
+inline void TransformFilter(const Shape &filter_shape, const float *filter_data,
+                            float *transformed_filter_data)
+{
+  using T = Transform<M>;
+  constexpr int alpha = T::kInputTile;
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(filter_shape.Dims(1) == 3 && filter_shape.Dims(2) == 3);
+  const int output_depth = filter_shape.Dims(0);
+  const int input_depth = filter_shape.Dims(3);
+
+  std::vector<float> gg(alpha * 3 * input_depth);
+  std::vector<float> ggg(alpha * alpha * input_depth);
+  for (int out_c = 0; out_c < output_depth; ++out_c)
+  {
+    const float *g = filter_data + out_c * 3 * 3 * input_depth;
+    MultiplyLeft(T::G(), alpha, 3, 3, g, input_depth, gg.data(), input_depth, input_depth);
+    MultiplyRightTransposed(T::G(), alpha, 3, alpha, gg.data(), input_depth, ggg.data(),
+                            input_depth, input_depth);
+    for (int k = 0; k < alpha * alpha; ++k)
+    {
+      for (int in_c = 0; in_c < input_depth; ++in_c)
+      {
+        transformed_filter_data[(k * input_depth + in_c) * output_depth + out_c] =
+            ggg[k * input_depth + in_c];
+      }
+    }
+  }
+}
+
+// Convolution of 3x3 filter with unit stride and dilation. Tiles are processed in blocks: input
+// tiles of a block are transformed, multiplied with the transformed filter by alpha * alpha
+// GEMMs of (tiles x input_depth) * (input_depth x output_depth), and transformed back.
+template <int M>
+inline void Conv(const ConvParams &params, const Shape &input_shape, const float *input_data,
+                 const Shape &filter_shape, const float *transformed_filter_data,
+                 const Shape &bias_shape, const float *bias_data, const Shape &output_shape,
+                 float *output_data)
+{
+  using T = Transform<M>;
+  constexpr int alpha = T::kInputTile;
+  constexpr int num_positions = alpha * alpha;
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(filter_shape.Dims(1) == 3 && filter_shape.Dims(2) == 3);
+  assert(params.stride_width == 1 && params.stride_height == 1);
+  UNUSED_RELEASE(bias_shape);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int pad_height = params.padding_values.height;
+  const int pad_width = params.padding_values.width;
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+
+  const int tiles_height = (output_height + M - 1) / M;
+  const int tiles_width = (output_width + M - 1) / M;
+  const int total_tiles = batches * tiles_height * tiles_width;
+
+  // Keep transformed input and output of a block within L2 cache
+  constexpr int kBlockFloats = 64 * 1024;
+  constexpr int kMaxTileBlock = 64;
+  const int max_depth = std::max(input_depth, output_depth);
+  const int tile_block =
+      std::max(1, std::min(kMaxTileBlock, kBlockFloats / (num_positions * max_depth)));
+  const int num_blocks = (total_tiles + tile_block - 1) / tile_block;
+
+  const Eigen::TensorOpCost cost(
+      static_cast<double>(tile_block) * num_positions * input_depth * sizeof(float),
+      static_cast<double>(tile_block) * M * M * output_depth * sizeof(float),
+      static_cast<double>(tile_block) * num_positions * input_depth * output_depth);
+
+  eigen_support::ParallelFor(num_blocks, cost, [&](int64_t start, int64_t end) {
+    std::vector<float> transformed_input(num_positions * tile_block * input_depth);
+    std::vector<float> transformed_output(num_positions * tile_block * output_depth);
+    std::vector<float> tile(num_positions * max_depth);
+    std::vector<float> temp(num_positions * max_depth);
+
+    for (int64_t block = start; block < end; ++block)
+    {
+      const int first_tile = static_cast<int>(block) * tile_block;
+      const int num_tiles = std::min(tile_block, total_tiles - first_tile);
+
+      // BT * d * B
+      for (int t = 0; t < num_tiles; ++t)
+      {
+        const int tile_index = first_tile + t;
+        const int batch = tile_index / (tiles_height * tiles_width);
+        const int in_y_origin = (tile_index / tiles_width) % tiles_height * M - pad_height;
+        const int in_x_origin = tile_index % tiles_width * M - pad_width;
+        for (int i = 0; i < alpha; ++i)
+        {
+          const int in_y = in_y_origin + i;
+          for (int j = 0; j < alpha; ++j)
+          {
+            const int in_x = in_x_origin + j;
+            float *dst = tile.data() + (i * alpha + j) * input_depth;
+            if (in_y < 0 || in_y >= input_height || in_x < 0 || in_x >= input_width)
+            {
+              std::fill(dst, dst + input_depth, 0.0f);
+            }
+            else
+            {
+              std::memcpy(dst, input_data + Offset(input_shape, batch, in_y, in_x, 0),
+                          input_depth * sizeof(float));
+            }
+          }
+        }
+        MultiplyLeft(T::BT(), alpha, alpha, alpha, tile.data(), input_depth, temp.data(),
+                     input_depth, input_depth);
+        MultiplyRightTransposed(T::BT(), alpha, alpha, alpha, temp.data(), input_depth,
+                                transformed_input.data() + t * input_depth,
+                                tile_block * input_depth, input_depth);
+      }
+
+      // Element-wise multiplication over tiles, reduced over input channels
+      for (int k = 0; k < num_positions; ++k)
+      {
+        Eigen::Map<const RowMajorMatrix> lhs(transformed_input.data() +
+                                                 k * tile_block * input_depth,
+                                             num_tiles, input_depth);
+        Eigen::Map<const RowMajorMatrix> rhs(transformed_filter_data +
+                                                 k * input_depth * output_depth,
+                                             input_depth, output_depth);
+        Eigen::Map<RowMajorMatrix> out(transformed_output.data() + k * tile_block * output_depth,
+                                       num_tiles, output_depth);
+        out.noalias() = lhs * rhs;
+      }
+
+      // AT * m * A
+      for (int t = 0; t < num_tiles; ++t)
+      {
+        const int tile_index = first_tile + t;
+        const int batch = tile_index / (tiles_height * tiles_width);
+        const int out_y_origin = (tile_index / tiles_width) % tiles_height * M;
+        const int out_x_origin = tile_index % tiles_width * M;
+        MultiplyLeft(T::AT(), M, alpha, alpha, transformed_output.data() + t * output_depth,
+                     tile_block * output_depth, temp.data(), output_depth, output_depth);
+        MultiplyRightTransposed(T::AT(), M, alpha, M, temp.data(), output_depth, tile.data(),
+                                output_depth, output_depth);
+        for (int p = 0; p < M && out_y_origin + p < output_height; ++p)
+        {
+          for (int q = 0; q < M && out_x_origin + q < output_width; ++q)
+          {
+            float *dst =
+                output_data + Offset(output_shape, batch, out_y_origin + p, out_x_origin + q, 0);
+            std::memcpy(dst, tile.data() + (p * M + q) * output_depth,
+                        output_depth * sizeof(float));
+            if (bias_data)
+            {
+              BiasAndClamp(output_activation_min, output_activation_max, output_depth,
+                           bias_data, output_depth, dst);
+            }
+            else
+            {
+              for (int c = 0; c < output_depth; ++c)
+              {
+                dst[c] = ActivationFunctionWithMinMax(dst[c], output_activation_min,
+                                                      output_activation_max);
+              }
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
+} // namespace winograd
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_OPTIMIZED_INTEGER_OPS_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_INTEGER_OPS_CONV_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/operation/optimized/OptimizedUtils.h"
+#include "cker/operation/optimized/integer_ops/Gemm.h"
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+
+/**
+ * @brief Convolution of int8 input and output with per-channel symmetric int8 filter
+ *
+ * The filter of [output_depth, H * W * input_depth] is multiplied with im2col of the input by
+ * one GEMM, which requantizes accumulators of each output channel with its own multiplier.
+ * im2col_data is unused for 1x1 filter with unit stride.
+ */
+inline void ConvPerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                           const int32_t *output_shift, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &filter_shape,
+                           const int8_t *filter_data, const Shape &bias_shape,
+                           const int32_t *bias_data, const Shape &output_shape, int8_t *output_data,
+                           const Shape &im2col_shape, int8_t *im2col_data)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.dilation_width_factor == 1 && params.dilation_height_factor == 1);
+
+  const int8_t *gemm_input_data = nullptr;
+  const Shape *gemm_input_shape = nullptr;
+  const int filter_width = filter_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const bool need_im2col =
+      stride_width != 1 || stride_height != 1 || filter_width != 1 || filter_height != 1;
+  if (need_im2col)
+  {
+    assert(im2col_data);
+    // Padding is filled with the zero point, which contributes nothing to accumulators
+    const int input_zero_point = -input_offset;
+    assert(input_zero_point >= std::numeric_limits<int8_t>::min());
+    assert(input_zero_point <= std::numeric_limits<int8_t>::max());
+    optimized::Im2col(params, filter_height, filter_width,
+                      static_cast<uint8_t>(static_cast<int8_t>(input_zero_point)), input_shape,
+                      input_data, im2col_shape, im2col_data);
+    gemm_input_data = im2col_data;
+    gemm_input_shape = &im2col_shape;
+  }
+  else
+  {
+    gemm_input_data = input_data;
+    gemm_input_shape = &input_shape;
+  }
+
+  const int gemm_input_rows = gemm_input_shape->Dims(3);
+  const int gemm_input_cols = FlatSizeSkipDim(*gemm_input_shape, 3);
+  const int filter_rows = filter_shape.Dims(0);
+  const int filter_cols = FlatSizeSkipDim(filter_shape, 0);
+  const int output_rows = output_shape.Dims(3);
+  const int output_cols = FlatSizeSkipDim(output_shape, 3);
+  assert(output_rows == filter_rows);
+  assert(filter_cols == gemm_input_rows);
+  assert(bias_shape.FlatSize() == output_rows);
+  UNUSED_RELEASE(bias_shape);
+  UNUSED_RELEASE(filter_cols);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = filter_rows;
+  lhs_params.cols = filter_cols;
+  lhs_params.zero_point = 0; // Symmetric filter
+  lhs_params.cacheable = true;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = gemm_input_rows;
+  rhs_params.cols = gemm_input_cols;
+  rhs_params.zero_point = -input_offset;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_rows;
+  dst_params.cols = output_cols;
+  dst_params.zero_point = output_offset;
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = params.quantized_activation_min;
+  gemm_params.clamp_max = params.quantized_activation_max;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+
+  GemmPerChannel(lhs_params, filter_data, rhs_params, gemm_input_data, dst_params, output_data,
+                 gemm_params);
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_INTEGER_OPS_CONV_H__
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+
+/**
+ * @brief DepthwiseConv of int8 input and output with per-channel symmetric int8 filter
+ *
+ * Each output row is accumulated in int32 tap by tap, where a tap is a loop over channels, and
+ * then requantized with the multiplier of each output channel. Rows are run in parallel.
+ */
+inline void DepthwiseConvPerChannel(const DepthwiseConvParams &params,
+                                    const int32_t *output_multiplier, const int32_t *output_shift,
+                                    const Shape &input_shape, const int8_t *input_data,
+                                    const Shape &filter_shape, const int8_t *filter_data,
+                                    const Shape &bias_shape, const int32_t *bias_data,
+                                    const Shape &output_shape, int8_t *output_data)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_depth * depth_multiplier);
+  assert(bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(bias_shape);
+
+  const auto convolve_rows = [&](int64_t start, int64_t end) {
+    std::vector<int32_t> acc(output_depth);
+    for (int64_t row = start; row < end; ++row)
+    {
+      const int batch = row / output_height;
+      const int out_y = row % output_height;
+      const int in_y_origin = out_y * stride_height - pad_height;
+      int8_t *output_row = output_data + row * output_width * output_depth;
+
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = out_x * stride_width - pad_width;
+        if (bias_data)
+          std::copy_n(bias_data, output_depth, acc.data());
+        else
+          std::fill(acc.begin(), acc.end(), 0);
+
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = in_y_origin + dilation_height_factor * filter_y;
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = in_x_origin + dilation_width_factor * filter_x;
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            const int8_t *input = input_data + Offset(input_shape, batch, in_y, in_x, 0);
+            const int8_t *filter =
+                filter_data + (filter_y * filter_width + filter_x) * output_depth;
+            if (depth_multiplier == 1)
+            {
+              for (int c = 0; c < output_depth; ++c)
+                acc[c] += (input[c] + input_offset) * filter[c];
+            }
+            else
+            {
+              for (int ic = 0; ic < input_depth; ++ic)
+              {
+                const int32_t input_value = input[ic] + input_offset;
+                for (int m = 0; m < depth_multiplier; ++m)
+                {
+                  const int oc = ic * depth_multiplier + m;
+                  acc[oc] += input_value * filter[oc];
+                }
+              }
+            }
+          }
+        }
+
+        int8_t *output = output_row + out_x * output_depth;
+        for (int c = 0; c < output_depth; ++c)
+        {
+          int32_t value = MultiplyByQuantizedMultiplier(acc[c], output_multiplier[c],
+                                                        output_shift[c]);
+          value += output_offset;
+          value = std::max(value, output_activation_min);
+          value = std::min(value, output_activation_max);
+          output[c] = static_cast<int8_t>(value);
+        }
+      }
+    }
+  };
+
+  const int64_t row_size = static_cast<int64_t>(output_width) * output_depth;
+  eigen_support::ParallelFor(
+      static_cast<int64_t>(batches) * output_height,
+      Eigen::TensorOpCost(filter_height * input_width * input_depth, row_size,
+                          2 * row_size * filter_height * filter_width),
+      convolve_rows);
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H__
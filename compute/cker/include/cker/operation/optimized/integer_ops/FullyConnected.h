@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H__
+#define __NNFW_CKER_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/operation/optimized/integer_ops/Gemm.h"
+
+#include <cassert>
+#include <cstdint>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+
+/**
+ * @brief FullyConnected of int8 input and output with per-channel symmetric int8 weights
+ *
+ * Accumulators of each output unit are requantized with their own multiplier.
+ */
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier, const int32_t *output_shift,
+                                     const Shape &input_shape, const int8_t *input_data,
+                                     const Shape &weights_shape, const int8_t *weights_data,
+                                     const Shape &bias_shape, const int32_t *bias_data,
+                                     const Shape &output_shape, int8_t *output_data)
+{
+  assert(weights_shape.DimensionsCount() == 2);
+  const int accum_depth = weights_shape.Dims(1);
+  const int output_depth = weights_shape.Dims(0);
+  const int batches = input_shape.FlatSize() / accum_depth;
+  assert(output_shape.FlatSize() == batches * output_depth);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(bias_shape);
+  UNUSED_RELEASE(output_shape);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = accum_depth;
+  lhs_params.zero_point = 0; // Symmetric weights
+  lhs_params.cacheable = true;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = accum_depth;
+  rhs_params.cols = batches;
+  rhs_params.zero_point = -params.input_offset;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = batches;
+  dst_params.zero_point = params.output_offset;
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = params.quantized_activation_min;
+  gemm_params.clamp_max = params.quantized_activation_max;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+
+  GemmPerChannel(lhs_params, weights_data, rhs_params, input_data, dst_params, output_data,
+                 gemm_params);
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H__
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_OPTIMIZED_INTEGER_OPS_GEMM_H__
+#define __NNFW_CKER_OPTIMIZED_INTEGER_OPS_GEMM_H__
+
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#ifdef USE_RUY_GEMV
+#include <ruy/path.h>
+#include <ruy/ruy.h>
+#include "cker/ruy/RuySupport.h"
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+
+/**
+ * @brief int8 GEMM of row-major weights and column-major input to column-major output, which
+ *        requantizes accumulators of each output row with its own multiplier
+ */
+inline void GemmPerChannel(
+    const MatrixParams<int8_t> &lhs_params, const int8_t *lhs_data,
+    const MatrixParams<int8_t> &rhs_params, const int8_t *rhs_data,
+    const MatrixParams<int8_t> &dst_params, int8_t *dst_data,
+    const GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> &params)
+{
+  assert(lhs_params.order == Order::kRowMajor);
+  assert(rhs_params.order == Order::kColMajor);
+  assert(dst_params.order == Order::kColMajor);
+  assert(lhs_params.cols == rhs_params.rows);
+  assert(lhs_params.rows == dst_params.rows);
+  assert(rhs_params.cols == dst_params.cols);
+  ValidateGemmParams(params);
+
+#ifdef USE_RUY_GEMV
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, lhs_data, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, rhs_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, dst_data, &ruy_dst);
+
+  ruy::BasicSpec<int32_t, int8_t> ruy_spec;
+  ruy_support::MakeRuySpec(params, &ruy_spec);
+
+  constexpr ruy::Path kRuyPath = ruy::kAllPaths;
+  ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_support::GetRuyContext(), &ruy_dst);
+#else
+  const int depth = lhs_params.cols;
+  for (int col = 0; col < dst_params.cols; ++col)
+  {
+    const int8_t *rhs = rhs_data + col * depth;
+    int8_t *dst = dst_data + col * dst_params.rows;
+    for (int row = 0; row < dst_params.rows; ++row)
+    {
+      const int8_t *lhs = lhs_data + row * depth;
+      int32_t acc = params.bias ? params.bias[row] : 0;
+      for (int k = 0; k < depth; ++k)
+        acc += (lhs[k] - lhs_params.zero_point) * (rhs[k] - rhs_params.zero_point);
+      acc = MultiplyByQuantizedMultiplier(acc, params.multiplier_fixedpoint_perchannel[row],
+                                          params.multiplier_exponent_perchannel[row]);
+      acc += dst_params.zero_point;
+      acc = std::max<int32_t>(acc, params.clamp_min);
+      acc = std::min<int32_t>(acc, params.clamp_max);
+      dst[row] = static_cast<int8_t>(acc);
+    }
+  }
+#endif
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_INTEGER_OPS_GEMM_H__
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_CHECK_H__
+#define __NNFW_CKER_X86_CHECK_H__
+
+// x86 SIMD kernels are compiled with per-function target attributes, so they do not need any
+// global -m flags. Which one runs is decided at runtime by CPUID (see GetX86Isa).
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+    !defined(CKER_DISABLE_X86_SIMD)
+#define USE_X86_SIMD
+#endif
+
+#ifdef USE_X86_SIMD
+
+#include <cstdlib>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// NOTE Order matters. A larger value means a wider instruction set.
+enum class X86Isa
+{
+  kPortable = 0,
+  kSse4 = 1,
+  kAvx2 = 2,
+  kAvx512 = 3,
+};
+
+inline X86Isa DetectX86Isa()
+{
+  __builtin_cpu_init();
+
+  X86Isa isa = X86Isa::kPortable;
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    isa = X86Isa::kAvx512;
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    isa = X86Isa::kAvx2;
+  else if (__builtin_cpu_supports("sse4.1"))
+    isa = X86Isa::kSse4;
+
+  // CKER_X86_ISA caps the detected instruction set. It is useful to compare implementations
+  // on the same machine, or to avoid AVX-512 frequency throttling.
+  const char *limit = std::getenv("CKER_X86_ISA");
+  if (limit != nullptr)
+  {
+    X86Isa limit_isa = isa;
+    if (std::strcmp(limit, "portable") == 0)
+      limit_isa = X86Isa::kPortable;
+    else if (std::strcmp(limit, "sse4") == 0)
+      limit_isa = X86Isa::kSse4;
+    else if (std::strcmp(limit, "avx2") == 0)
+      limit_isa = X86Isa::kAvx2;
+    else if (std::strcmp(limit, "avx512") == 0)
+      limit_isa = X86Isa::kAvx512;
+
+    if (limit_isa < isa)
+      isa = limit_isa;
+  }
+
+  return isa;
+}
+
+inline X86Isa GetX86Isa()
+{
+  static const X86Isa isa = DetectX86Isa();
+  return isa;
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_CHECK_H__
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/BFloat16.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using nnfw::cker::BFloat16;
+
+namespace
+{
+
+float fromBits(uint32_t bits)
+{
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+} // namespace
+
+TEST(CKer_BFloat16, exact_values)
+{
+  for (const float value : {0.0f, -0.0f, 1.0f, -2.5f, 0.15625f, 65536.0f, 1.0f / 1024})
+  {
+    EXPECT_EQ(static_cast<float>(BFloat16(value)), value);
+  }
+  EXPECT_TRUE(std::signbit(static_cast<float>(BFloat16(-0.0f))));
+}
+
+TEST(CKer_BFloat16, round_to_nearest)
+{
+  // bfloat16 keeps 7 fraction bits, so values around 1 are apart by 2^-7
+  const float ulp = std::ldexp(1.0f, -7);
+  EXPECT_EQ(static_cast<float>(BFloat16(1.0f + ulp * 0.25f)), 1.0f);
+  EXPECT_EQ(static_cast<float>(BFloat16(1.0f + ulp * 0.75f)), 1.0f + ulp);
+  EXPECT_EQ(static_cast<float>(BFloat16(-1.0f - ulp * 0.75f)), -1.0f - ulp);
+}
+
+TEST(CKer_BFloat16, round_ties_to_even)
+{
+  const float ulp = std::ldexp(1.0f, -7);
+  // Halfway between 1 (even) and 1 + ulp (odd)
+  EXPECT_EQ(static_cast<float>(BFloat16(1.0f + ulp * 0.5f)), 1.0f);
+  // Halfway between 1 + ulp (odd) and 1 + 2 * ulp (even)
+  EXPECT_EQ(static_cast<float>(BFloat16(1.0f + ulp * 1.5f)), 1.0f + 2 * ulp);
+  EXPECT_EQ(static_cast<float>(BFloat16(-1.0f - ulp * 1.5f)), -1.0f - 2 * ulp);
+  // Just above a tie rounds up
+  EXPECT_EQ(static_cast<float>(BFloat16(fromBits(0x3f808001u))), 1.0f + ulp);
+}
+
+TEST(CKer_BFloat16, infinity)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  EXPECT_EQ(static_cast<float>(BFloat16(inf)), inf);
+  EXPECT_EQ(static_cast<float>(BFloat16(-inf)), -inf);
+  // Finite values past the largest bfloat16 round to infinity
+  EXPECT_EQ(static_cast<float>(BFloat16(std::numeric_limits<float>::max())), inf);
+  EXPECT_EQ(static_cast<float>(BFloat16(-std::numeric_limits<float>::max())), -inf);
+}
+
+TEST(CKer_BFloat16, nan)
+{
+  EXPECT_TRUE(std::isnan(static_cast<float>(BFloat16(std::numeric_limits<float>::quiet_NaN()))));
+  // NaN whose payload is only in the dropped bits must not turn into infinity
+  EXPECT_TRUE(std::isnan(static_cast<float>(BFloat16(fromBits(0x7f800001u)))));
+  EXPECT_TRUE(std::isnan(static_cast<float>(BFloat16(fromBits(0xffffffffu)))));
+  EXPECT_TRUE(std::signbit(static_cast<float>(BFloat16(fromBits(0xff800001u)))));
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Conv.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+std::vector<float> makeValues(size_t size, float range, int seed)
+{
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; ++i)
+    values[i] = range * (static_cast<float>((i * 37 + seed * 11) % 97) / 48.0f - 1.0f);
+  return values;
+}
+
+struct ConvCase
+{
+  int input_size;
+  int input_depth;
+  int output_depth;
+  int filter_size;
+  int stride;
+  int padding;
+  ConvAlgorithm algorithm;
+};
+
+class CKer_Conv : public ::testing::TestWithParam<ConvCase>
+{
+};
+
+} // namespace
+
+// Optimized float kernels must compute what reference::Conv does
+TEST_P(CKer_Conv, matches_reference)
+{
+  const auto &param = GetParam();
+  const int output_size =
+      (param.input_size + 2 * param.padding - param.filter_size) / param.stride + 1;
+
+  const Shape input_shape{1, param.input_size, param.input_size, param.input_depth};
+  const Shape filter_shape{param.output_depth, param.filter_size, param.filter_size,
+                           param.input_depth};
+  const Shape bias_shape{param.output_depth};
+  const Shape output_shape{1, output_size, output_size, param.output_depth};
+
+  const auto input = makeValues(input_shape.FlatSize(), 1.0f, 1);
+  const auto filter = makeValues(filter_shape.FlatSize(), 0.5f, 2);
+  const auto bias = makeValues(bias_shape.FlatSize(), 0.2f, 3);
+
+  ConvParams params;
+  params.padding_type = param.padding == 0 ? PaddingType::kValid : PaddingType::kSame;
+  params.padding_values.width = param.padding;
+  params.padding_values.height = param.padding;
+  params.stride_width = param.stride;
+  params.stride_height = param.stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> expected(output_shape.FlatSize());
+  reference::Conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+                  bias.data(), output_shape, expected.data());
+
+  Conv conv;
+  bool is_replaced_weights = false;
+  conv.prepare(params, input_shape, filter_shape, filter.data(), is_replaced_weights);
+  ASSERT_EQ(conv.algorithm(), param.algorithm);
+
+  // Run twice, as kernels keep buffers between runs
+  for (int run = 0; run < 2; ++run)
+  {
+    std::vector<float> output(output_shape.FlatSize(), 0.0f);
+    conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape, bias.data(),
+         output_shape, output.data());
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_NEAR(output[i], expected[i], 1e-4f + std::abs(expected[i]) * 1e-4f) << "at " << i;
+  }
+}
+
+// Multithreaded kernel is selected for the other cases if there are more than one thread
+const auto kOther = std::thread::hardware_concurrency() > 1 ? ConvAlgorithm::kMultithreaded
+                                                            : ConvAlgorithm::kReference;
+
+INSTANTIATE_TEST_CASE_P(
+    CKer_Conv, CKer_Conv,
+    ::testing::Values(
+        // 1x1
+        ConvCase{5, 8, 8, 1, 1, 0, ConvAlgorithm::kPointwise},
+        ConvCase{7, 3, 5, 1, 1, 0, ConvAlgorithm::kPointwise},
+        ConvCase{7, 8, 8, 1, 2, 0, ConvAlgorithm::kReference},
+        ConvCase{5, 8, 8, 1, 1, 1, kOther},
+        // 3x3 with enough channels for Winograd
+        ConvCase{5, 8, 8, 3, 1, 0, ConvAlgorithm::kWinograd2x2},
+        ConvCase{7, 8, 16, 3, 1, 1, ConvAlgorithm::kWinograd2x2},
+        ConvCase{16, 8, 8, 3, 1, 1, ConvAlgorithm::kWinograd4x4},
+        ConvCase{19, 16, 8, 3, 1, 0, ConvAlgorithm::kWinograd4x4},
+        // 3x3 without Winograd
+        ConvCase{7, 8, 8, 3, 2, 1, kOther},
+        ConvCase{7, 3, 8, 3, 1, 1, kOther},
+        ConvCase{9, 8, 4, 3, 2, 0, ConvAlgorithm::kReference}));
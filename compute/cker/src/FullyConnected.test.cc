@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/BFloat16.h>
+#include <cker/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+// Number of units is not a multiple of the block of rows widened at a time
+constexpr int batch_size = 3;
+constexpr int input_size = 19;
+constexpr int num_units = 37;
+
+std::vector<float> makeValues(size_t size, float range, int seed)
+{
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; ++i)
+    values[i] = range * (static_cast<float>((i * 37 + seed * 11) % 97) / 48.0f - 1.0f);
+  return values;
+}
+
+struct FullyConnectedTest
+{
+  FullyConnectedTest()
+      : input(makeValues(batch_size * input_size, 1.0f, 1)),
+        weights(makeValues(num_units * input_size, 0.5f, 2)), bias(makeValues(num_units, 0.2f, 3))
+  {
+    params.activation = FusedActivationFunctionType::kNone;
+  }
+
+  std::vector<float> runFloat(const std::vector<float> &weights_data)
+  {
+    std::vector<float> output(batch_size * num_units);
+    FullyConnected(params, input_shape, input.data(), weights_shape, weights_data.data(),
+                   bias_shape, bias.data(), output_shape, output.data());
+    return output;
+  }
+
+  template <typename WeightT> std::vector<float> runWiden(const std::vector<WeightT> &weights_data)
+  {
+    std::vector<float> output(batch_size * num_units);
+    FCTempArena temp_arena;
+    FullyConnectedWidenWeights(params, input_shape, input.data(), weights_shape,
+                               weights_data.data(), bias_shape, bias.data(), output_shape,
+                               output.data(), temp_arena);
+    return output;
+  }
+
+  FullyConnectedParams params;
+  const Shape input_shape{batch_size, input_size};
+  const Shape weights_shape{num_units, input_size};
+  const Shape bias_shape{num_units};
+  const Shape output_shape{batch_size, num_units};
+  std::vector<float> input;
+  std::vector<float> weights;
+  std::vector<float> bias;
+};
+
+} // namespace
+
+TEST(CKer_FullyConnected, widen_weights_matches_float_path)
+{
+  FullyConnectedTest test;
+
+  std::vector<BFloat16> narrowed;
+  std::vector<float> widened;
+  for (const auto value : test.weights)
+  {
+    narrowed.emplace_back(value);
+    widened.push_back(static_cast<float>(narrowed.back()));
+  }
+
+  // Same weight values in float give the same output
+  const auto expected = test.runFloat(widened);
+  const auto output = test.runWiden(narrowed);
+  ASSERT_EQ(output.size(), expected.size());
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-5f) << "at " << i;
+}
+
+TEST(CKer_FullyConnected, widen_weights_accuracy)
+{
+  FullyConnectedTest test;
+
+  std::vector<BFloat16> narrowed;
+  for (const auto value : test.weights)
+    narrowed.emplace_back(value);
+
+  const auto expected = test.runFloat(test.weights);
+  const auto output = test.runWiden(narrowed);
+
+  // Rounding to 7 fraction bits changes each weight by at most 2^-8 of its magnitude
+  const float relative_error = std::ldexp(1.0f, -8);
+  for (int b = 0; b < batch_size; ++b)
+  {
+    for (int u = 0; u < num_units; ++u)
+    {
+      float bound = 1e-6f;
+      for (int i = 0; i < input_size; ++i)
+        bound += std::abs(test.weights[u * input_size + i] * test.input[b * input_size + i]) *
+                 relative_error;
+      EXPECT_NEAR(output[b * num_units + u], expected[b * num_units + u], bound)
+          << "at batch " << b << ", unit " << u;
+    }
+  }
+}
+
+TEST(CKer_FullyConnected, widen_weights_activation)
+{
+  FullyConnectedTest test;
+  test.params.activation = FusedActivationFunctionType::kRelu;
+
+  std::vector<BFloat16> narrowed;
+  for (const auto value : test.weights)
+    narrowed.emplace_back(value);
+
+  const auto output = test.runWiden(narrowed);
+  for (const auto value : output)
+    EXPECT_GE(value, 0.0f);
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FusedElementwise.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+std::vector<float> makeValues(size_t size, float range, int seed)
+{
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; ++i)
+    values[i] = range * (static_cast<float>((i * 37 + seed * 11) % 97) / 48.0f - 1.0f);
+  return values;
+}
+
+// Operand of a binary step for the i-th element of the chain, as broadcast by the operation
+float operandAt(const ElementwiseStep &step, int64_t i)
+{
+  switch (step.broadcast)
+  {
+    case ElementwiseBroadcast::kScalar:
+      return step.operand[0];
+    case ElementwiseBroadcast::kInner:
+      return step.operand[i % step.operand_size];
+    default:
+      return step.operand[i];
+  }
+}
+
+// Apply steps one by one to the whole chain, like unfused operations
+std::vector<float> referenceElementwise(const std::vector<ElementwiseStep> &steps,
+                                        const std::vector<float> &input)
+{
+  std::vector<float> value = input;
+  for (const auto &step : steps)
+  {
+    for (int64_t i = 0; i < static_cast<int64_t>(value.size()); ++i)
+    {
+      float &x = value[i];
+      switch (step.type)
+      {
+        case ElementwiseOpType::kAbs:
+          x = std::abs(x);
+          break;
+        case ElementwiseOpType::kClamp:
+          x = std::min(std::max(x, step.min), step.max);
+          break;
+        case ElementwiseOpType::kExp:
+          x = std::exp(x);
+          break;
+        case ElementwiseOpType::kLogistic:
+          x = 1.0f / (1.0f + std::exp(-x));
+          break;
+        case ElementwiseOpType::kNeg:
+          x = -x;
+          break;
+        case ElementwiseOpType::kTanh:
+          x = std::tanh(x);
+          break;
+        case ElementwiseOpType::kAdd:
+          x = x + operandAt(step, i);
+          break;
+        case ElementwiseOpType::kSub:
+          x = step.reversed ? operandAt(step, i) - x : x - operandAt(step, i);
+          break;
+        case ElementwiseOpType::kMul:
+          x = x * operandAt(step, i);
+          break;
+        case ElementwiseOpType::kDiv:
+          x = step.reversed ? operandAt(step, i) / x : x / operandAt(step, i);
+          break;
+        default:
+          throw std::runtime_error{"referenceElementwise: unsupported op type"};
+      }
+    }
+  }
+  return value;
+}
+
+ElementwiseStep unaryStep(ElementwiseOpType type)
+{
+  ElementwiseStep step;
+  step.type = type;
+  return step;
+}
+
+ElementwiseStep binaryStep(ElementwiseOpType type, const std::vector<float> &operand,
+                           ElementwiseBroadcast broadcast, bool reversed = false)
+{
+  ElementwiseStep step;
+  step.type = type;
+  step.operand = operand.data();
+  step.operand_size = operand.size();
+  step.broadcast = broadcast;
+  step.reversed = reversed;
+  return step;
+}
+
+void expectNear(const std::vector<float> &actual, const std::vector<float> &expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i)
+    EXPECT_NEAR(actual[i], expected[i], 1e-5f * std::max(1.0f, std::abs(expected[i])))
+        << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_FusedElementwise, matches_op_by_op)
+{
+  // Crosses a tile boundary, and the inner operand wraps around within tiles
+  const int64_t size = fused_elementwise::kTileSize * 2 + 29;
+  const auto input = makeValues(size, 2.0f, 0);
+  const auto full = makeValues(size, 1.0f, 1);
+  const auto inner = makeValues(7, 1.0f, 2);
+  const std::vector<float> scalar{1.5f};
+  // Divisors away from zero
+  auto divisors = makeValues(size, 1.0f, 3);
+  for (auto &divisor : divisors)
+    divisor += divisor < 0.0f ? -1.0f : 1.0f;
+
+  ElementwiseStep clamp = unaryStep(ElementwiseOpType::kClamp);
+  clamp.min = -1.0f;
+  clamp.max = 1.5f;
+
+  const std::vector<ElementwiseStep> steps{
+      binaryStep(ElementwiseOpType::kAdd, full, ElementwiseBroadcast::kFull),
+      binaryStep(ElementwiseOpType::kMul, inner, ElementwiseBroadcast::kInner),
+      binaryStep(ElementwiseOpType::kSub, scalar, ElementwiseBroadcast::kScalar, true),
+      unaryStep(ElementwiseOpType::kTanh),
+      binaryStep(ElementwiseOpType::kSub, inner, ElementwiseBroadcast::kInner, true),
+      binaryStep(ElementwiseOpType::kDiv, divisors, ElementwiseBroadcast::kFull),
+      unaryStep(ElementwiseOpType::kAbs),
+      binaryStep(ElementwiseOpType::kAdd, scalar, ElementwiseBroadcast::kScalar),
+      binaryStep(ElementwiseOpType::kDiv, full, ElementwiseBroadcast::kFull, true),
+      clamp,
+      unaryStep(ElementwiseOpType::kNeg),
+      unaryStep(ElementwiseOpType::kLogistic),
+  };
+
+  std::vector<float> output(size);
+  FusedElementwise(steps, input.data(), size, output.data());
+  expectNear(output, referenceElementwise(steps, input));
+}
+
+TEST(CKer_FusedElementwise, in_place)
+{
+  const int64_t size = fused_elementwise::kTileSize + 1;
+  const auto input = makeValues(size, 1.0f, 4);
+  const auto inner = makeValues(fused_elementwise::kTileSize - 3, 1.0f, 5);
+
+  const std::vector<ElementwiseStep> steps{
+      binaryStep(ElementwiseOpType::kAdd, inner, ElementwiseBroadcast::kInner),
+      unaryStep(ElementwiseOpType::kExp),
+      binaryStep(ElementwiseOpType::kDiv, inner, ElementwiseBroadcast::kInner, true),
+  };
+
+  auto value = input;
+  FusedElementwise(steps, value.data(), size, value.data());
+  expectNear(value, referenceElementwise(steps, input));
+}
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/optimized/integer_ops/Conv.h>
+#include <cker/operation/optimized/integer_ops/DepthwiseConv.h>
+#include <cker/operation/optimized/integer_ops/FullyConnected.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// These tests are built with ruy GEMM (test_cker) and without it (test_cker_no_ruy), so that
+// both paths of GemmPerChannel are compared with the naive loops below
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+constexpr int32_t input_offset = 3;   // input zero point is -3
+constexpr int32_t output_offset = -5; // output zero point is -5
+
+std::vector<int8_t> makeValues(size_t size, int range, int seed)
+{
+  std::vector<int8_t> values(size);
+  for (size_t i = 0; i < size; ++i)
+    values[i] = static_cast<int8_t>(static_cast<int>((i * 37 + seed * 11) % 97) * range / 48 -
+                                    range);
+  return values;
+}
+
+std::vector<int32_t> makeBias(size_t size)
+{
+  std::vector<int32_t> bias(size);
+  for (size_t i = 0; i < size; ++i)
+    bias[i] = static_cast<int32_t>(i * 53 % 301) - 150;
+  return bias;
+}
+
+/**
+ * @brief Per-channel multipliers of different scales, which keep outputs mostly in range
+ */
+void makeMultipliers(int channels, std::vector<int32_t> &multipliers, std::vector<int32_t> &shifts)
+{
+  multipliers.resize(channels);
+  shifts.resize(channels);
+  for (int c = 0; c < channels; ++c)
+  {
+    const double multiplier = 0.0005 * (c % 5 + 1) * (c % 2 ? 1.5 : 0.7);
+    int shift = 0;
+    const double q = std::frexp(multiplier, &shift);
+    multipliers[c] = static_cast<int32_t>(std::round(q * (1ll << 31)));
+    shifts[c] = shift;
+  }
+}
+
+int8_t requantize(int32_t acc, int32_t multiplier, int32_t shift, int32_t act_min,
+                  int32_t act_max)
+{
+  int32_t value = MultiplyByQuantizedMultiplier(acc, multiplier, shift) + output_offset;
+  value = std::max(value, act_min);
+  value = std::min(value, act_max);
+  return static_cast<int8_t>(value);
+}
+
+struct ConvCase
+{
+  int input_size;
+  int input_depth;
+  int output_depth;
+  int filter_size;
+  int stride;
+  int padding;
+  int32_t act_min;
+};
+
+/**
+ * @brief Naive convolution of NHWC input and [output_depth, H, W, input_depth] filter, where the
+ *        filter is [1, H, W, output_depth] for depthwise
+ */
+std::vector<int8_t> naiveConv(const ConvCase &param, bool depthwise, const std::vector<int8_t> &input,
+                              const std::vector<int8_t> &filter, const std::vector<int32_t> &bias,
+                              const std::vector<int32_t> &multipliers,
+                              const std::vector<int32_t> &shifts, int output_size)
+{
+  const int fs = param.filter_size;
+  const int in_depth = param.input_depth;
+  const int out_depth = param.output_depth;
+  const int depth_multiplier = out_depth / in_depth;
+  std::vector<int8_t> output(output_size * output_size * out_depth);
+  for (int oy = 0; oy < output_size; ++oy)
+  {
+    for (int ox = 0; ox < output_size; ++ox)
+    {
+      for (int oc = 0; oc < out_depth; ++oc)
+      {
+        int32_t acc = bias[oc];
+        for (int fy = 0; fy < fs; ++fy)
+        {
+          const int iy = oy * param.stride - param.padding + fy;
+          for (int fx = 0; fx < fs; ++fx)
+          {
+            const int ix = ox * param.stride - param.padding + fx;
+            if (iy < 0 || iy >= param.input_size || ix < 0 || ix >= param.input_size)
+              continue;
+            const int8_t *in = input.data() + (iy * param.input_size + ix) * in_depth;
+            if (depthwise)
+            {
+              acc += (in[oc / depth_multiplier] + input_offset) *
+                     filter[(fy * fs + fx) * out_depth + oc];
+            }
+            else
+            {
+              for (int ic = 0; ic < in_depth; ++ic)
+                acc += (in[ic] + input_offset) * filter[((oc * fs + fy) * fs + fx) * in_depth + ic];
+            }
+          }
+        }
+        output[(oy * output_size + ox) * out_depth + oc] =
+            requantize(acc, multipliers[oc], shifts[oc], param.act_min, 127);
+      }
+    }
+  }
+  return output;
+}
+
+class CKer_ConvPerChannel : public ::testing::TestWithParam<ConvCase>
+{
+};
+
+class CKer_DepthwiseConvPerChannel : public ::testing::TestWithParam<ConvCase>
+{
+};
+
+} // namespace
+
+TEST_P(CKer_ConvPerChannel, matches_naive)
+{
+  const auto &param = GetParam();
+  const int fs = param.filter_size;
+  const int output_size = (param.input_size + 2 * param.padding - fs) / param.stride + 1;
+
+  const Shape input_shape{1, param.input_size, param.input_size, param.input_depth};
+  const Shape filter_shape{param.output_depth, fs, fs, param.input_depth};
+  const Shape bias_shape{param.output_depth};
+  const Shape output_shape{1, output_size, output_size, param.output_depth};
+  const Shape im2col_shape{1, output_size, output_size, fs * fs * param.input_depth};
+
+  const auto input = makeValues(input_shape.FlatSize(), 100, 1);
+  const auto filter = makeValues(filter_shape.FlatSize(), 127, 2);
+  const auto bias = makeBias(param.output_depth);
+  std::vector<int32_t> multipliers, shifts;
+  makeMultipliers(param.output_depth, multipliers, shifts);
+
+  ConvParams params;
+  params.padding_type = param.padding == 0 ? PaddingType::kValid : PaddingType::kSame;
+  params.padding_values.width = param.padding;
+  params.padding_values.height = param.padding;
+  params.stride_width = param.stride;
+  params.stride_height = param.stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.input_offset = input_offset;
+  params.output_offset = output_offset;
+  params.quantized_activation_min = param.act_min;
+  params.quantized_activation_max = 127;
+
+  std::vector<int8_t> im2col(im2col_shape.FlatSize());
+  std::vector<int8_t> output(output_shape.FlatSize());
+  optimized_integer_ops::ConvPerChannel(params, multipliers.data(), shifts.data(), input_shape,
+                                        input.data(), filter_shape, filter.data(), bias_shape,
+                                        bias.data(), output_shape, output.data(), im2col_shape,
+                                        im2col.data());
+
+  const auto expected =
+      naiveConv(param, false, input, filter, bias, multipliers, shifts, output_size);
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_EQ(output[i], expected[i]) << "at " << i;
+}
+
+INSTANTIATE_TEST_CASE_P(CKer_ConvPerChannel, CKer_ConvPerChannel,
+                        ::testing::Values(
+                            // 1x1 without im2col
+                            ConvCase{5, 8, 6, 1, 1, 0, -128}, ConvCase{4, 3, 17, 1, 1, 0, -5},
+                            // im2col
+                            ConvCase{7, 8, 6, 1, 2, 0, -128}, ConvCase{6, 4, 8, 3, 1, 1, -128},
+                            ConvCase{7, 5, 3, 3, 2, 0, -5}, ConvCase{8, 16, 16, 3, 2, 1, -128}));
+
+TEST_P(CKer_DepthwiseConvPerChannel, matches_naive)
+{
+  const auto &param = GetParam();
+  const int fs = param.filter_size;
+  const int output_size = (param.input_size + 2 * param.padding - fs) / param.stride + 1;
+
+  const Shape input_shape{1, param.input_size, param.input_size, param.input_depth};
+  const Shape filter_shape{1, fs, fs, param.output_depth};
+  const Shape bias_shape{param.output_depth};
+  const Shape output_shape{1, output_size, output_size, param.output_depth};
+
+  const auto input = makeValues(input_shape.FlatSize(), 100, 1);
+  const auto filter = makeValues(filter_shape.FlatSize(), 127, 2);
+  const auto bias = makeBias(param.output_depth);
+  std::vector<int32_t> multipliers, shifts;
+  makeMultipliers(param.output_depth, multipliers, shifts);
+  // Depthwise accumulates far less terms than Conv, so scale up outputs
+  for (auto &shift : shifts)
+    shift += 3;
+
+  DepthwiseConvParams params;
+  params.padding_type = param.padding == 0 ? PaddingType::kValid : PaddingType::kSame;
+  params.padding_values.width = param.padding;
+  params.padding_values.height = param.padding;
+  params.stride_width = param.stride;
+  params.stride_height = param.stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.depth_multiplier = param.output_depth / param.input_depth;
+  params.input_offset = input_offset;
+  params.output_offset = output_offset;
+  params.quantized_activation_min = param.act_min;
+  params.quantized_activation_max = 127;
+
+  std::vector<int8_t> output(output_shape.FlatSize());
+  optimized_integer_ops::DepthwiseConvPerChannel(
+      params, multipliers.data(), shifts.data(), input_shape, input.data(), filter_shape,
+      filter.data(), bias_shape, bias.data(), output_shape, output.data());
+
+  const auto expected =
+      naiveConv(param, true, input, filter, bias, multipliers, shifts, output_size);
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_EQ(output[i], expected[i]) << "at " << i;
+}
+
+INSTANTIATE_TEST_CASE_P(CKer_DepthwiseConvPerChannel, CKer_DepthwiseConvPerChannel,
+                        ::testing::Values(ConvCase{5, 8, 8, 3, 1, 1, -128},
+                                          ConvCase{7, 4, 4, 3, 2, 0, -5},
+                                          // depth multiplier 2 and 3
+                                          ConvCase{6, 4, 8, 3, 1, 1, -128},
+                                          ConvCase{5, 3, 9, 1, 1, 0, -128}));
+
+TEST(CKer_FullyConnectedPerChannel, matches_naive)
+{
+  // Units are not a multiple of SIMD widths
+  constexpr int batches = 3;
+  constexpr int accum_depth = 37;
+  constexpr int output_depth = 13;
+
+  const Shape input_shape{batches, accum_depth};
+  const Shape weights_shape{output_depth, accum_depth};
+  const Shape bias_shape{output_depth};
+  const Shape output_shape{batches, output_depth};
+
+  const auto input = makeValues(input_shape.FlatSize(), 100, 1);
+  const auto weights = makeValues(weights_shape.FlatSize(), 127, 2);
+  const auto bias = makeBias(output_depth);
+  std::vector<int32_t> multipliers, shifts;
+  makeMultipliers(output_depth, multipliers, shifts);
+
+  for (const int32_t act_min : {-128, -5})
+  {
+    FullyConnectedParams params;
+    params.input_offset = input_offset;
+    params.output_offset = output_offset;
+    params.quantized_activation_min = act_min;
+    params.quantized_activation_max = 127;
+
+    for (const bool has_bias : {true, false})
+    {
+      std::vector<int8_t> output(output_shape.FlatSize());
+      optimized_integer_ops::FullyConnectedPerChannel(
+          params, multipliers.data(), shifts.data(), input_shape, input.data(), weights_shape,
+          weights.data(), bias_shape, has_bias ? bias.data() : nullptr, output_shape,
+          output.data());
+
+      for (int b = 0; b < batches; ++b)
+      {
+        for (int u = 0; u < output_depth; ++u)
+        {
+          int32_t acc = has_bias ? bias[u] : 0;
+          for (int k = 0; k < accum_depth; ++k)
+            acc += (input[b * accum_depth + k] + input_offset) * weights[u * accum_depth + k];
+          EXPECT_EQ(output[b * output_depth + u],
+                    requantize(acc, multipliers[u], shifts[u], act_min, 127))
+              << "at batch " << b << ", unit " << u;
+        }
+      }
+    }
+  }
+}
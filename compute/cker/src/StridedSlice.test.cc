@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/StridedSlice.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+const Shape input_shape{2, 3, 4, 5};
+
+std::vector<float> makeInput()
+{
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i);
+  return input;
+}
+
+StridedSliceParams makeParams(const std::vector<int32_t> &begin, const std::vector<int32_t> &end,
+                              const std::vector<int32_t> &strides)
+{
+  return buildStridedSliceParams(begin.data(), end.data(), strides.data(), 0, 0, 0, 4);
+}
+
+} // namespace
+
+TEST(CKer_StridedSlice, strided_depth)
+{
+  const auto input = makeInput();
+  const auto params = makeParams({1, 0, 1, 0}, {2, 3, 4, 5}, {1, 2, 1, 2});
+  const Shape output_shape{1, 2, 3, 3};
+  std::vector<float> output(output_shape.FlatSize());
+
+  StridedSlice(params, input_shape, input.data(), output_shape, output.data());
+
+  size_t i = 0;
+  for (int h = 0; h < 3; h += 2)
+    for (int w = 1; w < 4; ++w)
+      for (int d = 0; d < 5; d += 2)
+        EXPECT_EQ(output[i++], input[Offset(input_shape, 1, h, w, d)]);
+}
+
+TEST(CKer_StridedSlice, empty_depth)
+{
+  const auto input = makeInput();
+  // Depth stops before it starts, so nothing is read nor written
+  const auto params = makeParams({0, 0, 0, 3}, {2, 3, 4, 2}, {1, 1, 1, 1});
+  const Shape output_shape{2, 3, 4, 0};
+  std::vector<float> output(1, -1.0f);
+
+  StridedSlice(params, input_shape, input.data(), output_shape, output.data());
+
+  EXPECT_EQ(output[0], -1.0f);
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BatchMatMul benchmark on shapes of multi-head attention
+ *
+ * Q, K and V are [1, HEADS, SEQ, DEPTH] and scores are [1, HEADS, SEQ, SEQ].
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/BatchMatMul.h>
+
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(HEADS, 12);
+NONIUS_PARAM(SEQ, 128);
+NONIUS_PARAM(DEPTH, 64);
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+void batch_matmul(nonius::chronometer &meter, const Shape &lhs_shape, const Shape &rhs_shape,
+                  const Shape &output_shape, bool adj_y)
+{
+  BatchMatMulParams params;
+  params.adj_x = false;
+  params.adj_y = adj_y;
+
+  std::vector<float> lhs(lhs_shape.FlatSize(), 1.0f);
+  std::vector<float> rhs(rhs_shape.FlatSize(), 1.0f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    BatchMatMul(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(), output_shape,
+                output.data());
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("BatchMatMul Q x K^T", [](nonius::chronometer meter) {
+  const int heads = meter.param<HEADS>();
+  const int seq = meter.param<SEQ>();
+  const int depth = meter.param<DEPTH>();
+
+  const Shape qk_shape{1, heads, seq, depth};
+  const Shape scores_shape{1, heads, seq, seq};
+  batch_matmul(meter, qk_shape, qk_shape, scores_shape, true);
+})
+
+NONIUS_BENCHMARK("BatchMatMul scores x V", [](nonius::chronometer meter) {
+  const int heads = meter.param<HEADS>();
+  const int seq = meter.param<SEQ>();
+  const int depth = meter.param<DEPTH>();
+
+  const Shape scores_shape{1, heads, seq, seq};
+  const Shape v_shape{1, heads, seq, depth};
+  batch_matmul(meter, scores_shape, v_shape, v_shape, false);
+})
+
+// V is shared by all heads and broadcasted
+NONIUS_BENCHMARK("BatchMatMul scores x V (broadcast)", [](nonius::chronometer meter) {
+  const int heads = meter.param<HEADS>();
+  const int seq = meter.param<SEQ>();
+  const int depth = meter.param<DEPTH>();
+
+  const Shape scores_shape{1, heads, seq, seq};
+  const Shape v_shape{seq, depth};
+  const Shape output_shape{1, heads, seq, depth};
+  batch_matmul(meter, scores_shape, v_shape, output_shape, false);
+})
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Float convolution of cker with unit stride and SAME padding
+ *
+ * The kernel selected by Conv::prepare (Winograd for 3x3, GEMM for 1x1) is compared with
+ * im2col of Eigen and the reference kernel.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/Conv.h>
+
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(SIZE, 56);
+NONIUS_PARAM(IFM_C, 64);
+NONIUS_PARAM(OFM_C, 64);
+NONIUS_PARAM(KER, 3);
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+enum class Kernel
+{
+  Selected,
+  Im2col,
+  Reference,
+};
+
+void conv(nonius::chronometer &meter, Kernel kernel)
+{
+  const int batch = meter.param<BATCH>();
+  const int size = meter.param<SIZE>();
+  const int ifm_c = meter.param<IFM_C>();
+  const int ofm_c = meter.param<OFM_C>();
+  const int ker = meter.param<KER>();
+
+  const Shape input_shape{batch, size, size, ifm_c};
+  const Shape filter_shape{ofm_c, ker, ker, ifm_c};
+  const Shape bias_shape{ofm_c};
+  const Shape output_shape{batch, size, size, ofm_c};
+
+  ConvParams params;
+  params.padding_type = PaddingType::kSame;
+  params.padding_values.width = (ker - 1) / 2;
+  params.padding_values.height = (ker - 1) / 2;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = 0.0f;
+  params.float_activation_max = 6.0f;
+
+  std::vector<float> input(input_shape.FlatSize(), 0.5f);
+  std::vector<float> filter(filter_shape.FlatSize(), 0.1f);
+  std::vector<float> bias(bias_shape.FlatSize(), 0.0f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  Conv selected;
+  bool is_replaced_weights = false;
+  selected.prepare(params, input_shape, filter_shape, filter.data(), is_replaced_weights);
+
+  const Shape hwcn_filter_shape{filter_shape.FlatSize() / ofm_c, ofm_c};
+  std::vector<float> hwcn_filter(filter_shape.FlatSize());
+  TransposeFloatTensor(filter.data(), hwcn_filter_shape, hwcn_filter.data());
+
+  meter.measure([&](int) {
+    // Run!
+    switch (kernel)
+    {
+      case Kernel::Selected:
+        selected(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+                 bias.data(), output_shape, output.data());
+        break;
+      case Kernel::Im2col:
+        multithreaded::Conv(params, input_shape, input.data(), filter_shape, hwcn_filter.data(),
+                            bias_shape, bias.data(), output_shape, output.data());
+        break;
+      case Kernel::Reference:
+        reference::Conv(params, input_shape, input.data(), filter_shape, filter.data(),
+                        bias_shape, bias.data(), output_shape, output.data());
+        break;
+    }
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("Conv (selected)", [](nonius::chronometer meter) {
+  conv(meter, Kernel::Selected);
+})
+
+NONIUS_BENCHMARK("Conv (Eigen im2col)", [](nonius::chronometer meter) {
+  conv(meter, Kernel::Im2col);
+})
+
+NONIUS_BENCHMARK("Conv (reference)", [](nonius::chronometer meter) {
+  conv(meter, Kernel::Reference);
+})
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Data movement kernel (Transpose/Concat/Pad/StridedSlice) benchmark
+ *
+ * Every benchmark reads and writes about the same number of bytes as "memcpy", so
+ * (memcpy time / kernel time) is the fraction of memcpy bandwidth the kernel achieves.
+ * GB/s is printed to stderr from the bytes moved per run and the mean time reported by nonius.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/Concatenation.h>
+#include <cker/operation/Pad.h>
+#include <cker/operation/StridedSlice.h>
+#include <cker/operation/Transpose.h>
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(N, 1);
+NONIUS_PARAM(H, 128);
+NONIUS_PARAM(W, 128);
+NONIUS_PARAM(C, 64);
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+Shape input_shape(nonius::chronometer &meter)
+{
+  return Shape{meter.param<N>(), meter.param<H>(), meter.param<W>(), meter.param<C>()};
+}
+
+void report_bytes(const char *name, size_t bytes)
+{
+  std::cerr << name << ": " << bytes << " bytes moved per run (GB/s = bytes / mean ns)"
+            << std::endl;
+}
+
+void transpose(nonius::chronometer &meter, const int (&perm)[4])
+{
+  const auto in_shape = input_shape(meter);
+  Shape out_shape(4);
+  TransposeParams params;
+  params.perm_count = 4;
+  for (int i = 0; i < 4; ++i)
+  {
+    params.perm[i] = perm[i];
+    out_shape.SetDim(i, in_shape.Dims(perm[i]));
+  }
+
+  std::vector<float> input(in_shape.FlatSize(), 1.0f);
+  std::vector<float> output(out_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    Transpose(params, in_shape, input.data(), out_shape, output.data());
+  });
+}
+
+} // namespace
+
+NONIUS_BENCHMARK("memcpy", [](nonius::chronometer meter) {
+  const auto shape = input_shape(meter);
+  std::vector<float> input(shape.FlatSize(), 1.0f);
+  std::vector<float> output(shape.FlatSize());
+  report_bytes("memcpy", 2 * input.size() * sizeof(float));
+
+  meter.measure([&](int) {
+    // Run!
+    std::memcpy(output.data(), input.data(), input.size() * sizeof(float));
+  });
+})
+
+NONIUS_BENCHMARK("Transpose NHWC->NCHW", [](nonius::chronometer meter) {
+  const int perm[4] = {0, 3, 1, 2};
+  transpose(meter, perm);
+})
+
+NONIUS_BENCHMARK("Transpose NCHW->NHWC", [](nonius::chronometer meter) {
+  const int perm[4] = {0, 2, 3, 1};
+  transpose(meter, perm);
+})
+
+NONIUS_BENCHMARK("Transpose general (3, 1, 0, 2)", [](nonius::chronometer meter) {
+  const int perm[4] = {3, 1, 0, 2};
+  transpose(meter, perm);
+})
+
+NONIUS_BENCHMARK("Concatenation (2 inputs, last axis)", [](nonius::chronometer meter) {
+  auto half_shape = input_shape(meter);
+  half_shape.SetDim(3, half_shape.Dims(3) / 2);
+  const auto out_shape = input_shape(meter);
+
+  std::vector<float> input0(half_shape.FlatSize(), 1.0f);
+  std::vector<float> input1(half_shape.FlatSize(), 2.0f);
+  std::vector<float> output(out_shape.FlatSize());
+
+  const Shape *input_shapes[2] = {&half_shape, &half_shape};
+  const float *input_data[2] = {input0.data(), input1.data()};
+  ConcatenationParams params;
+  params.axis = 3;
+  params.inputs_count = 2;
+
+  meter.measure([&](int) {
+    // Run!
+    Concatenation(params, input_shapes, input_data, out_shape, output.data());
+  });
+})
+
+NONIUS_BENCHMARK("Pad (1 pixel on H and W)", [](nonius::chronometer meter) {
+  const auto in_shape = input_shape(meter);
+  const Shape out_shape{in_shape.Dims(0), in_shape.Dims(1) + 2, in_shape.Dims(2) + 2,
+                        in_shape.Dims(3)};
+  const int32_t padding[8] = {0, 0, 1, 1, 1, 1, 0, 0};
+  const float constant_value = 0.0f;
+
+  std::vector<float> input(in_shape.FlatSize(), 1.0f);
+  std::vector<float> output(out_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    Pad(padding, 4, in_shape, input.data(), out_shape, output.data(), &constant_value);
+  });
+})
+
+NONIUS_BENCHMARK("StridedSlice (half of H, unit stride)", [](nonius::chronometer meter) {
+  const auto in_shape = input_shape(meter);
+  const Shape out_shape{in_shape.Dims(0), in_shape.Dims(1) / 2, in_shape.Dims(2),
+                        in_shape.Dims(3)};
+  const int32_t begin[4] = {0, 0, 0, 0};
+  const int32_t end[4] = {in_shape.Dims(0), in_shape.Dims(1) / 2, in_shape.Dims(2),
+                          in_shape.Dims(3)};
+  const int32_t strides[4] = {1, 1, 1, 1};
+  const auto params = buildStridedSliceParams(begin, end, strides, 0, 0, 0, 4);
+
+  std::vector<float> input(in_shape.FlatSize(), 1.0f);
+  std::vector<float> output(out_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    StridedSlice(params, in_shape, input.data(), out_shape, output.data());
+  });
+})
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Elementwise chains (GELU, Swish) run op by op compared with FusedElementwise
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/FusedElementwise.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/Tanh.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(SIZE, 1024 * 1024);
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+// Run a binary op as the cpu backend does, broadcasting a scalar operand
+void binary(BinaryArithmeticOpType type, const Shape &shape, const float *lhs,
+            const Shape &rhs_shape, const float *rhs, float *output)
+{
+  BinaryArithmeticOpParam op_params;
+  op_params.type = type;
+  op_params.float_activation_min = std::numeric_limits<float>::lowest();
+  op_params.float_activation_max = std::numeric_limits<float>::max();
+  if (ProcessBroadcastShapes(shape, rhs_shape, &op_params))
+    BroadcastBinaryArithmeticOp(op_params, shape, lhs, rhs_shape, rhs, shape, output);
+  else
+    BinaryArithmeticOp(op_params, shape, lhs, rhs_shape, rhs, shape, output);
+}
+
+ElementwiseStep unary(ElementwiseOpType type)
+{
+  ElementwiseStep step;
+  step.type = type;
+  return step;
+}
+
+ElementwiseStep binary(ElementwiseOpType type, const float *operand, int64_t size)
+{
+  ElementwiseStep step;
+  step.type = type;
+  step.operand = operand;
+  step.operand_size = size;
+  step.broadcast = size == 1 ? ElementwiseBroadcast::kScalar : ElementwiseBroadcast::kFull;
+  return step;
+}
+
+// GELU of tanh approximation, 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+const float kGeluCoeff = 0.044715f;
+const float kGeluScale = std::sqrt(2.0f / M_PI);
+const float kOne = 1.0f;
+const float kHalf = 0.5f;
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("GELU - op by op", [](nonius::chronometer meter) {
+  const int size = meter.param<SIZE>();
+  const Shape shape{size};
+  const Shape scalar{1};
+  std::vector<float> x(size, 0.5f), t0(size), t1(size);
+
+  meter.measure([&](int) {
+    // Run!
+    binary(BinaryArithmeticOpType::MUL, shape, x.data(), shape, x.data(), t0.data());
+    binary(BinaryArithmeticOpType::MUL, shape, t0.data(), shape, x.data(), t1.data());
+    binary(BinaryArithmeticOpType::MUL, shape, t1.data(), scalar, &kGeluCoeff, t0.data());
+    binary(BinaryArithmeticOpType::ADD, shape, t0.data(), shape, x.data(), t1.data());
+    binary(BinaryArithmeticOpType::MUL, shape, t1.data(), scalar, &kGeluScale, t0.data());
+    Tanh(shape, t0.data(), shape, t1.data());
+    binary(BinaryArithmeticOpType::ADD, shape, t1.data(), scalar, &kOne, t0.data());
+    binary(BinaryArithmeticOpType::MUL, shape, t0.data(), shape, x.data(), t1.data());
+    binary(BinaryArithmeticOpType::MUL, shape, t1.data(), scalar, &kHalf, t0.data());
+  });
+})
+
+NONIUS_BENCHMARK("GELU - fused", [](nonius::chronometer meter) {
+  const int size = meter.param<SIZE>();
+  std::vector<float> x(size, 0.5f), output(size);
+  const std::vector<ElementwiseStep> steps{
+      binary(ElementwiseOpType::kMul, x.data(), size),
+      binary(ElementwiseOpType::kMul, x.data(), size),
+      binary(ElementwiseOpType::kMul, &kGeluCoeff, 1),
+      binary(ElementwiseOpType::kAdd, x.data(), size),
+      binary(ElementwiseOpType::kMul, &kGeluScale, 1),
+      unary(ElementwiseOpType::kTanh),
+      binary(ElementwiseOpType::kAdd, &kOne, 1),
+      binary(ElementwiseOpType::kMul, x.data(), size),
+      binary(ElementwiseOpType::kMul, &kHalf, 1)};
+
+  meter.measure([&](int) {
+    // Run!
+    FusedElementwise(steps, x.data(), size, output.data());
+  });
+})
+
+NONIUS_BENCHMARK("Swish - op by op", [](nonius::chronometer meter) {
+  const int size = meter.param<SIZE>();
+  const Shape shape{size};
+  std::vector<float> x(size, 0.5f), t0(size), t1(size);
+
+  meter.measure([&](int) {
+    // Run!
+    Logistic(shape, x.data(), shape, t0.data());
+    binary(BinaryArithmeticOpType::MUL, shape, t0.data(), shape, x.data(), t1.data());
+  });
+})
+
+NONIUS_BENCHMARK("Swish - fused", [](nonius::chronometer meter) {
+  const int size = meter.param<SIZE>();
+  std::vector<float> x(size, 0.5f), output(size);
+  const std::vector<ElementwiseStep> steps{unary(ElementwiseOpType::kLogistic),
+                                           binary(ElementwiseOpType::kMul, x.data(), size)};
+
+  meter.measure([&](int) {
+    // Run!
+    FusedElementwise(steps, x.data(), size, output.data());
+  });
+})
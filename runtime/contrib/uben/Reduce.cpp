@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Reduce and Mean benchmark over axis combinations of a NHWC tensor
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(N, 1);
+NONIUS_PARAM(H, 32);
+NONIUS_PARAM(W, 32);
+NONIUS_PARAM(C, 768);
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+struct Tensors
+{
+  Shape input_shape;
+  Shape output_shape;
+  std::vector<float> input;
+  std::vector<float> output;
+};
+
+Tensors tensors(nonius::chronometer &meter, const std::vector<int> &axes)
+{
+  const Shape input_shape{meter.param<N>(), meter.param<H>(), meter.param<W>(), meter.param<C>()};
+  Shape output_shape = input_shape;
+  for (auto axis : axes)
+  {
+    output_shape.SetDim(axis, 1);
+  }
+  return Tensors{input_shape, output_shape, std::vector<float>(input_shape.FlatSize(), 1.0f),
+                 std::vector<float>(output_shape.FlatSize())};
+}
+
+void sum(nonius::chronometer &meter, const std::vector<int> &axes)
+{
+  auto t = tensors(meter, axes);
+  Reduce reduce;
+  reduce.prepare(4, axes.size());
+
+  meter.measure([&](int) {
+    // Run!
+    reduce.ReduceGeneric<float>(t.input_shape, t.input.data(), t.output_shape, t.output.data(),
+                                axes, true, 0.0f,
+                                [](const float current, const float in) { return current + in; });
+  });
+}
+
+void mean(nonius::chronometer &meter, std::vector<int> axes)
+{
+  auto t = tensors(meter, axes);
+
+  meter.measure([&](int) {
+    // Run!
+    Mean(t.input_shape, t.input.data(), t.output_shape, t.output.data(), axes);
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("ReduceSum(C)", [](nonius::chronometer meter) { sum(meter, {3}); })
+NONIUS_BENCHMARK("ReduceSum(N, H, W)", [](nonius::chronometer meter) { sum(meter, {0, 1, 2}); })
+NONIUS_BENCHMARK("ReduceSum(all)", [](nonius::chronometer meter) { sum(meter, {0, 1, 2, 3}); })
+// Not contiguous, so it goes through the generic implementation
+NONIUS_BENCHMARK("ReduceSum(H, C)", [](nonius::chronometer meter) { sum(meter, {1, 3}); })
+
+NONIUS_BENCHMARK("Mean(C)", [](nonius::chronometer meter) { mean(meter, {3}); })
+NONIUS_BENCHMARK("Mean(H, W)", [](nonius::chronometer meter) { mean(meter, {1, 2}); })
@@ -28,24 +28,26 @@
 //
 // Parameters
 //
+NONIUS_PARAM(ROWS, 1);
 NONIUS_PARAM(LEN, 1000);
 
 //
 // Implementations
 //
 NONIUS_BENCHMARK("cker::Softmax(float)", [](nonius::chronometer meter) {
+  auto rows = meter.param<ROWS>();
   auto len = meter.param<LEN>();
 
   nnfw::cker::SoftmaxParams params;
-  nnfw::cker::Shape shape{1, len};
+  nnfw::cker::Shape shape{rows, len};
 
   params.beta = 1.0;
 
   std::vector<float> input;
   std::vector<float> output;
 
-  input.resize(len);
-  output.resize(len);
+  input.resize(rows * len);
+  output.resize(rows * len);
 
   meter.measure([&](int) {
     // Run!
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file TensorUtils benchmark (Portable vs. x86 SIMD implementations)
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/TensorUtils.h>
+
+#include <stdexcept>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(ROWS, 1024);
+NONIUS_PARAM(COLS, 1024);
+NONIUS_PARAM(BATCH, 1);
+
+namespace
+{
+
+#ifdef USE_X86_SIMD
+void require(nnfw::cker::X86Isa isa)
+{
+  if (nnfw::cker::GetX86Isa() < isa)
+    throw std::runtime_error{"Instruction set is not supported (or limited by CKER_X86_ISA)"};
+}
+#endif // USE_X86_SIMD
+
+template <typename Fn> void measure_float(nonius::chronometer &meter, Fn fn)
+{
+  auto rows = meter.param<ROWS>();
+  auto cols = meter.param<COLS>();
+  auto batch = meter.param<BATCH>();
+
+  std::vector<float> matrix(rows * cols, 0.5f);
+  std::vector<float> vector(batch * cols, 0.25f);
+  std::vector<float> result(batch * rows, 0.0f);
+
+  meter.measure([&](int) {
+    // Run!
+    fn(matrix.data(), rows, cols, vector.data(), batch, result.data(), 1);
+  });
+}
+
+template <typename Fn> void measure_int8(nonius::chronometer &meter, Fn fn)
+{
+  auto rows = meter.param<ROWS>();
+  auto cols = meter.param<COLS>();
+  auto batch = meter.param<BATCH>();
+
+  std::vector<int8_t> matrix(rows * cols, 3);
+  std::vector<int8_t> vector(batch * cols, -5);
+  std::vector<float> scaling_factors(batch, 0.125f);
+  std::vector<float> result(batch * rows, 0.0f);
+
+  meter.measure([&](int) {
+    // Run!
+    fn(matrix.data(), rows, cols, vector.data(), scaling_factors.data(), batch, result.data(), 1);
+  });
+}
+
+template <typename Fn> void measure_quantize(nonius::chronometer &meter, Fn fn)
+{
+  auto len = meter.param<ROWS>() * meter.param<COLS>();
+
+  std::vector<float> values(len);
+  for (int i = 0; i < len; ++i)
+    values[i] = static_cast<float>(i % 255) - 127.0f;
+  std::vector<int8_t> quantized(len);
+  float min, max, scaling_factor;
+
+  meter.measure([&](int) {
+    // Run!
+    fn(values.data(), len, quantized.data(), &min, &max, &scaling_factor);
+  });
+}
+
+using FloatMatVecFn = void (*)(const float *, int, int, const float *, int, float *, int);
+using Int8MatVecFn = void (*)(const int8_t *, const int, const int, const int8_t *,
+                              const float *, int, float *, int);
+using QuantizeFn = void (*)(const float *, const int, int8_t *, float *, float *, float *);
+
+} // namespace
+
+//
+// Implementations
+//
+using namespace nnfw::cker;
+
+NONIUS_BENCHMARK("MatrixBatchVectorMAC(float) - Portable", [](nonius::chronometer meter) {
+  measure_float(meter, static_cast<FloatMatVecFn>(PortableMatrixBatchVectorMultiplyAccumulate));
+})
+
+NONIUS_BENCHMARK("MatrixBatchVectorMAC(int8) - Portable", [](nonius::chronometer meter) {
+  measure_int8(meter, static_cast<Int8MatVecFn>(PortableMatrixBatchVectorMultiplyAccumulate));
+})
+
+NONIUS_BENCHMARK("SymmetricQuantizeFloats - Portable", [](nonius::chronometer meter) {
+  measure_quantize(meter, static_cast<QuantizeFn>(PortableSymmetricQuantizeFloats));
+})
+
+#ifdef USE_X86_SIMD
+
+NONIUS_BENCHMARK("MatrixBatchVectorMAC(float) - Sse4", [](nonius::chronometer meter) {
+  require(X86Isa::kSse4);
+  measure_float(meter, static_cast<FloatMatVecFn>(Sse4MatrixBatchVectorMultiplyAccumulate));
+})
+
+NONIUS_BENCHMARK("MatrixBatchVectorMAC(int8) - Sse4", [](nonius::chronometer meter) {
+  require(X86Isa::kSse4);
+  measure_int8(meter, static_cast<Int8MatVecFn>(Sse4MatrixBatchVectorMultiplyAccumulate));
+})
+
+NONIUS_BENCHMARK("SymmetricQuantizeFloats - Sse4", [](nonius::chronometer meter) {
+  require(X86Isa::kSse4);
+  measure_quantize(meter, static_cast<QuantizeFn>(Sse4SymmetricQuantizeFloats));
+})
+
+NONIUS_BENCHMARK("MatrixBatchVectorMAC(float) - Avx2", [](nonius::chronometer meter) {
+  require(X86Isa::kAvx2);
+  measure_float(meter, static_cast<FloatMatVecFn>(Avx2MatrixBatchVectorMultiplyAccumulate));
+})
+
+NONIUS_BENCHMARK("MatrixBatchVectorMAC(int8) - Avx2", [](nonius::chronometer meter) {
+  require(X86Isa::kAvx2);
+  measure_int8(meter, static_cast<Int8MatVecFn>(Avx2MatrixBatchVectorMultiplyAccumulate));
+})
+
+NONIUS_BENCHMARK("SymmetricQuantizeFloats - Avx2", [](nonius::chronometer meter) {
+  require(X86Isa::kAvx2);
+  measure_quantize(meter, static_cast<QuantizeFn>(Avx2SymmetricQuantizeFloats));
+})
+
+NONIUS_BENCHMARK("MatrixBatchVectorMAC(float) - Avx512", [](nonius::chronometer meter) {
+  require(X86Isa::kAvx512);
+  measure_float(meter, static_cast<FloatMatVecFn>(Avx512MatrixBatchVectorMultiplyAccumulate));
+})
+
+NONIUS_BENCHMARK("MatrixBatchVectorMAC(int8) - Avx512", [](nonius::chronometer meter) {
+  require(X86Isa::kAvx512);
+  measure_int8(meter, static_cast<Int8MatVecFn>(Avx512MatrixBatchVectorMultiplyAccumulate));
+})
+
+NONIUS_BENCHMARK("SymmetricQuantizeFloats - Avx512", [](nonius::chronometer meter) {
+  require(X86Isa::kAvx512);
+  measure_quantize(meter, static_cast<QuantizeFn>(Avx512SymmetricQuantizeFloats));
+})
+
+#endif // USE_X86_SIMD
@@ -21,5 +21,6 @@
 #include "benchmark/MemoryPoller.h"
 #include "benchmark/CsvWriter.h"
 #include "benchmark/Util.h"
+#include "benchmark/Histogram.h"
 
 #endif // __NNFW_BENCHMARK_H__
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_HISTOGRAM_H__
+#define __NNFW_BENCHMARK_HISTOGRAM_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace benchmark
+{
+
+// Log-linear histogram of non-negative values, like HdrHistogram.
+// Each power-of-2 range is split into 128 buckets, so a recorded value is kept within 1% of
+// relative error in any range. Recording is a few integer operations without allocation.
+// NOTE This is not thread-safe. Record to a histogram per thread and merge them.
+class Histogram
+{
+public:
+  Histogram();
+
+  void record(uint64_t value);
+  void merge(const Histogram &other);
+
+  uint64_t count() const { return _count; }
+  uint64_t min() const { return _count == 0 ? 0 : _min; }
+  uint64_t max() const { return _max; }
+  double mean() const { return _count == 0 ? 0.0 : static_cast<double>(_sum) / _count; }
+  // Value which the given percent of recorded values are less than or equal to, e.g. 99.9
+  uint64_t percentile(double percent) const;
+
+private:
+  static uint32_t bucketIndex(uint64_t value);
+  static uint64_t highestEquivalentValue(uint32_t index);
+
+private:
+  std::vector<uint64_t> _buckets;
+  uint64_t _count;
+  uint64_t _sum;
+  uint64_t _min;
+  uint64_t _max;
+};
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_HISTOGRAM_H__
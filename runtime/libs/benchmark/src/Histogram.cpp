@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/Histogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+
+// Values less than kSubBuckets are kept as they are. Each power-of-2 range above it is split into
+// kHalfSubBuckets buckets.
+constexpr uint32_t kSubBucketBits = 8;
+constexpr uint64_t kSubBuckets = 1u << kSubBucketBits;
+constexpr uint64_t kHalfSubBuckets = kSubBuckets / 2;
+constexpr uint32_t kNumBuckets = (64 - kSubBucketBits + 1) * kHalfSubBuckets + kHalfSubBuckets;
+
+uint32_t mostSignificantBit(uint64_t value)
+{
+  assert(value != 0);
+  uint32_t msb = 0;
+  while (value >>= 1)
+    ++msb;
+  return msb;
+}
+
+} // namespace
+
+namespace benchmark
+{
+
+Histogram::Histogram()
+    : _buckets(kNumBuckets, 0), _count(0), _sum(0), _min(std::numeric_limits<uint64_t>::max()),
+      _max(0)
+{
+  // DO NOTHING
+}
+
+uint32_t Histogram::bucketIndex(uint64_t value)
+{
+  if (value < kSubBuckets)
+    return static_cast<uint32_t>(value);
+
+  // value >> shift is in [kHalfSubBuckets, kSubBuckets)
+  const uint32_t shift = mostSignificantBit(value) - (kSubBucketBits - 1);
+  return static_cast<uint32_t>(shift * kHalfSubBuckets + (value >> shift));
+}
+
+uint64_t Histogram::highestEquivalentValue(uint32_t index)
+{
+  if (index < kSubBuckets)
+    return index;
+
+  const uint32_t shift = index / kHalfSubBuckets - 1;
+  const uint64_t sub_bucket = index - shift * kHalfSubBuckets;
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+void Histogram::record(uint64_t value)
+{
+  _buckets[bucketIndex(value)] += 1;
+  _count += 1;
+  _sum += value;
+  _min = std::min(_min, value);
+  _max = std::max(_max, value);
+}
+
+void Histogram::merge(const Histogram &other)
+{
+  for (uint32_t i = 0; i < kNumBuckets; ++i)
+    _buckets[i] += other._buckets[i];
+  _count += other._count;
+  _sum += other._sum;
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+}
+
+uint64_t Histogram::percentile(double percent) const
+{
+  if (_count == 0)
+    return 0;
+
+  const auto target = std::max<uint64_t>(
+      static_cast<uint64_t>(std::ceil(std::min(percent, 100.0) / 100.0 * _count)), 1);
+  uint64_t accumulated = 0;
+  for (uint32_t i = 0; i < kNumBuckets; ++i)
+  {
+    accumulated += _buckets[i];
+    if (accumulated >= target)
+      return std::min(highestEquivalentValue(i), _max);
+  }
+  return _max;
+}
+
+} // namespace benchmark
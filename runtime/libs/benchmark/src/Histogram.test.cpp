@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/Histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using benchmark::Histogram;
+
+TEST(Histogram, empty)
+{
+  Histogram histogram;
+
+  EXPECT_EQ(histogram.count(), 0);
+  EXPECT_EQ(histogram.min(), 0);
+  EXPECT_EQ(histogram.max(), 0);
+  EXPECT_EQ(histogram.mean(), 0.0);
+  EXPECT_EQ(histogram.percentile(50.0), 0);
+}
+
+TEST(Histogram, small_values_are_exact)
+{
+  Histogram histogram;
+  for (uint64_t value = 1; value <= 100; ++value)
+    histogram.record(value);
+
+  EXPECT_EQ(histogram.count(), 100);
+  EXPECT_EQ(histogram.min(), 1);
+  EXPECT_EQ(histogram.max(), 100);
+  EXPECT_DOUBLE_EQ(histogram.mean(), 50.5);
+  EXPECT_EQ(histogram.percentile(50.0), 50);
+  EXPECT_EQ(histogram.percentile(99.0), 99);
+  EXPECT_EQ(histogram.percentile(100.0), 100);
+  EXPECT_EQ(histogram.percentile(0.0), 1);
+}
+
+TEST(Histogram, relative_error)
+{
+  // Each value is alone, so its percentile is the value kept by its bucket
+  for (uint64_t value = 200; value < (uint64_t{1} << 40); value = value * 3 / 2 + 7)
+  {
+    Histogram histogram;
+    histogram.record(value);
+    histogram.record(UINT64_MAX);
+
+    const auto kept = histogram.percentile(50.0);
+    EXPECT_GE(kept, value);
+    EXPECT_LE(kept - value, value / 100) << "value " << value;
+  }
+}
+
+TEST(Histogram, merge)
+{
+  Histogram first;
+  Histogram second;
+  for (uint64_t value = 1; value <= 50; ++value)
+    first.record(value);
+  for (uint64_t value = 51; value <= 100; ++value)
+    second.record(value);
+
+  first.merge(second);
+
+  EXPECT_EQ(first.count(), 100);
+  EXPECT_EQ(first.min(), 1);
+  EXPECT_EQ(first.max(), 100);
+  EXPECT_EQ(first.percentile(90.0), 90);
+
+  // Merging an empty histogram changes nothing
+  first.merge(Histogram{});
+  EXPECT_EQ(first.count(), 100);
+  EXPECT_EQ(first.min(), 1);
+}
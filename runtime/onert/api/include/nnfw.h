@@ -79,6 +79,12 @@ typedef enum {
   NNFW_TYPE_TENSOR_BOOL = 3,
   /** A tensor of 8 bit unsigned integer */
   NNFW_TYPE_TENSOR_UINT8 = 4,
+  /**
+   * A tensor of 8 bit signed integers that represent real numbers.
+   *
+   * real_value = (integer_value - zeroPoint) * scale.
+   */
+  NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED = 5,
 } NNFW_TYPE;
 
 /**
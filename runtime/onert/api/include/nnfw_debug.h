@@ -25,4 +25,80 @@ NNFW_STATUS nnfw_set_config(nnfw_session *session, const char *key, const char *
 
 NNFW_STATUS nnfw_get_config(nnfw_session *session, const char *key, char *value, size_t value_size);
 
+/**
+ * @brief Get statistics of executions cached for input shapes
+ *
+ * The session must be prepared with EXECUTOR_CACHE_SIZE config larger than 0.
+ *
+ * @param[in]  session   session prepared
+ * @param[out] hits      number of times a cached execution is used for new input shapes
+ * @param[out] misses    number of times an execution is compiled for new input shapes
+ * @param[out] evictions number of executions evicted from the cache
+ * @return @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_executor_cache_stats(nnfw_session *session, uint32_t *hits, uint32_t *misses,
+                                          uint32_t *evictions);
+
+/**
+ * @brief Statistics of an op sequence accumulated over runs
+ */
+typedef struct nnfw_op_stats
+{
+  /** Names of operations in the op sequence joined by '.', truncated if it is too long */
+  char name[64];
+  /** Backend id the op sequence runs on */
+  char backend[16];
+  /** Subgraph index of the op sequence */
+  uint32_t subgraph;
+  /** Index of the first operation in the op sequence */
+  uint32_t first_op;
+  /** Number of times the op sequence has run */
+  uint64_t count;
+  /** Total time in nanoseconds */
+  uint64_t time_ns;
+  /** Total bytes of inputs and outputs, tensors of unknown shapes are not counted */
+  uint64_t bytes_read;
+  uint64_t bytes_written;
+  /** Total operations estimated from shapes, a multiply-add is counted as 2 */
+  uint64_t flops;
+  /**
+   * Hardware counters of the thread running the op sequence, collected with PERF_COUNTERS
+   * config. They are 0 if the counters are not available. IPC is instructions / cycles.
+   */
+  uint64_t cycles;
+  uint64_t instructions;
+  /** Last level cache misses */
+  uint64_t cache_misses;
+  uint64_t branch_misses;
+} nnfw_op_stats;
+
+/**
+ * @brief Get the number of op sequences statistics are collected for
+ *
+ * The session must be prepared with OP_STATS or PERF_COUNTERS config enabled.
+ *
+ * @param[in]  session session prepared
+ * @param[out] size    number of op sequences
+ * @return @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_op_stats_size(nnfw_session *session, uint32_t *size);
+
+/**
+ * @brief Get statistics of an op sequence
+ *
+ * @param[in]  session session prepared
+ * @param[in]  index   index of the op sequence, less than the size from nnfw_get_op_stats_size
+ * @param[out] stats   statistics of the op sequence
+ * @return @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_op_stats(nnfw_session *session, uint32_t index, nnfw_op_stats *stats);
+
+/**
+ * @brief Reset statistics of all op sequences to 0
+ *
+ * @param[in] session session prepared
+ * @return @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_reset_op_stats(nnfw_session *session);
+
 #endif // __NNFW_DEBUG_H__
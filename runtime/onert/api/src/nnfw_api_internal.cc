@@ -15,15 +15,21 @@
  */
 
 #include "nnfw_api_internal.h"
+#include "nnfw_version.h"
 #include "CustomKernelRegistry.h"
 #include "compiler/Compiler.h"
 #include "util/ConfigSource.h"
 #include "exec/Execution.h"
+#include "exec/ExecutionCache.h"
 #include "circle_loader.h"
 #include "tflite_loader.h"
 #include "json/json.h"
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <dirent.h>
@@ -95,23 +101,16 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
     mfs >> root;
     Json::Value models = root["models"];
     Json::Value model_types = root["model-types"];
+    // "weights" is optional. It lists external weights files in the same order as "models".
+    Json::Value weights = root["weights"];
 
-    auto model_file_path = package_dir + std::string("/") + models[0].asString(); // first model
-    auto model_type = model_types[0].asString(); // first model's type
-    if (model_type == "tflite")
-    {
-      _subgraphs = onert::tflite_loader::loadModel(model_file_path.c_str());
-    }
-    else if (model_type == "circle")
-    {
-      _subgraphs = onert::circle_loader::loadModel(model_file_path.c_str());
-    }
-    else
-    {
-      std::cerr << "Unsupported model type in MANIFEST" << std::endl;
-      return NNFW_STATUS_ERROR;
-    }
-    _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+    _package_dir = package_dir;
+    _model_file_path = package_dir + std::string("/") + models[0].asString(); // first model
+    _model_type = model_types[0].asString(); // first model's type
+    _weights_file_path.clear();
+    if (weights.isArray() && weights.size() > 0 && !weights[0].asString().empty())
+      _weights_file_path = package_dir + std::string("/") + weights[0].asString();
+    _subgraphs = loadSubgraphs();
   }
   catch (const std::exception &e)
   {
@@ -124,6 +123,27 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
   return NNFW_STATUS_NO_ERROR;
 }
 
+std::shared_ptr<onert::ir::Subgraphs> nnfw_session::loadSubgraphs()
+{
+  std::shared_ptr<onert::ir::Subgraphs> subgraphs;
+  if (_model_type == "tflite")
+  {
+    subgraphs = onert::tflite_loader::loadModel(_model_file_path.c_str());
+  }
+  else if (_model_type == "circle")
+  {
+    const char *weights_file_path =
+        _weights_file_path.empty() ? nullptr : _weights_file_path.c_str();
+    subgraphs = onert::circle_loader::loadModel(_model_file_path.c_str(), weights_file_path);
+  }
+  else
+  {
+    throw std::runtime_error("Unsupported model type in MANIFEST");
+  }
+  subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+  return subgraphs;
+}
+
 NNFW_STATUS nnfw_session::prepare()
 {
   if (!_subgraphs || !primary_subgraph() || primary_subgraph()->isBuildingPhase())
@@ -147,11 +167,58 @@ NNFW_STATUS nnfw_session::prepare()
     using onert::util::config_source;
     config_source(std::move(_source));
 
+    // Input shapes this execution is compiled for, including ones from apply_tensorinfo
+    const auto &inputs = primary_subgraph()->getInputs();
+    for (uint32_t i = 0; i < inputs.size(); ++i)
+    {
+      const auto &input = primary_subgraph()->operands().at(inputs.at(i));
+      _input_shapes[onert::ir::IOIndex{i}] = input.shape();
+    }
+
+    // Adaptive scheduling may be enabled by set_config after the compiler is created
+    auto &options = _compiler->options();
+    if (!options.adaptive_planner)
+    {
+      options.adaptive_planner = onert::compiler::AdaptivePlanner::createFromGlobalConfig();
+      if (options.adaptive_planner)
+        options.he_scheduler = true;
+    }
+
+    // Schedules of HEScheduler are cached next to the package, for the model files and runtime
+    // version
+    if (!options.schedule_cache && options.he_scheduler &&
+        onert::util::getConfigBool(onert::util::config::SCHEDULE_CACHE))
+    {
+      std::ostringstream model_key;
+      model_key << onert::compiler::ScheduleCache::stampFile(_model_file_path) << ";";
+      if (!_weights_file_path.empty())
+        model_key << onert::compiler::ScheduleCache::stampFile(_weights_file_path);
+      model_key << ";" << std::hex << std::setw(8) << std::setfill('0') << NNFW_VERSION;
+      options.schedule_cache = std::make_shared<onert::compiler::ScheduleCache>(
+          _package_dir + "/schedule.cache", model_key.str());
+    }
+
+    // Executions compiled later for other input shapes or plans may share constants with this
+    shareConstants(*primary_subgraph(), nullptr);
+
     _subgraphs.reset();
     _compiler->compile();
     std::shared_ptr<onert::exec::ExecutorMap> executors;
     _compiler->release(executors);
     _execution = std::make_shared<onert::exec::Execution>(executors);
+    if (options.adaptive_planner)
+      options.adaptive_planner->acceptProposal();
+
+    const auto cache_size = onert::util::getConfigInt(onert::util::config::EXECUTOR_CACHE_SIZE);
+    if (cache_size > 0)
+    {
+      const auto cache_memory_mb =
+          onert::util::getConfigInt(onert::util::config::EXECUTOR_CACHE_MEMORY_MB);
+      _execution_cache = std::make_unique<onert::exec::ExecutionCache>(
+          cache_size, static_cast<size_t>(std::max(cache_memory_mb, 0)) * 1024 * 1024);
+      _execution_cache->insert(_input_shapes, _execution,
+                               onert::exec::ExecutionCache::estimateMemory(*_execution));
+    }
   }
   catch (const std::exception &e)
   {
@@ -162,6 +229,151 @@ NNFW_STATUS nnfw_session::prepare()
   return NNFW_STATUS_NO_ERROR;
 }
 
+void nnfw_session::shareConstants(onert::ir::Graph &graph,
+                                  std::unordered_set<onert::ir::OperandIndex> *shared_constants)
+{
+  graph.operands().iterate([&](const onert::ir::OperandIndex &ind, onert::ir::Operand &obj) {
+    if (!obj.isConstant() || !obj.data())
+      return;
+
+    auto &constant = _constants[ind];
+    auto data = constant.lock();
+    if (data && data->size() == obj.data()->size())
+    {
+      // Backends referring to the data instead of copying it share it with other executions
+      obj.data(std::move(data));
+      if (shared_constants)
+        shared_constants->insert(ind);
+    }
+    else
+    {
+      constant = obj.shareData();
+    }
+  });
+}
+
+nnfw_session::CompiledExecution nnfw_session::compileExecution(
+    const std::unordered_map<onert::ir::IOIndex, onert::ir::Shape> &input_shapes,
+    const onert::compiler::CompilerOptions &options)
+{
+  // Compile the model again with the input shapes to run with, so that all tensors are planned
+  // statically. Options are the same as the first compilation.
+  // TODO Copy the graph instead of reloading, which copies all constants until they are shared
+  auto subgraphs = loadSubgraphs();
+  auto primary = subgraphs->primary();
+  for (const auto &input_shape : input_shapes)
+  {
+    auto ind = primary->getInputs().at(input_shape.first);
+    primary->operands().at(ind).info().shape(input_shape.second);
+  }
+  std::unordered_set<onert::ir::OperandIndex> shared_constants;
+  shareConstants(*primary, &shared_constants);
+
+  onert::compiler::Compiler compiler{subgraphs};
+  compiler.options() = options;
+  // Schedule cache keeps schedules for the input shapes of prepare() only
+  compiler.options().schedule_cache = nullptr;
+  subgraphs.reset();
+  compiler.compile();
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  compiler.release(executors);
+  auto execution = std::make_shared<onert::exec::Execution>(executors);
+  const auto memory_size = onert::exec::ExecutionCache::estimateMemory(*execution, shared_constants);
+  return CompiledExecution{execution, memory_size};
+}
+
+void nnfw_session::selectExecution()
+{
+  if (!_execution_cache || !_input_shapes_changed)
+    return;
+
+  // The plan being compiled is for the previous input shapes
+  dropReplan();
+
+  auto execution = _execution_cache->find(_input_shapes);
+  if (!execution)
+  {
+    auto compiled = compileExecution(_input_shapes, _compiler->options());
+    // Backends are assigned by the current cost model, but the plan is kept as it is
+    if (_compiler->options().adaptive_planner)
+      _compiler->options().adaptive_planner->discardProposal();
+
+    execution = compiled.execution;
+    _execution_cache->insert(_input_shapes, execution, compiled.memory_size);
+  }
+
+  _execution = execution;
+  _input_shapes_changed = false;
+}
+
+void nnfw_session::replanExecution()
+{
+  const auto &planner = _compiler->options().adaptive_planner;
+  if (!planner)
+    return;
+
+  if (!_replan.valid())
+  {
+    if (!planner->needsReplan())
+      return;
+
+    // Schedule backends again with measured exec times in background, so that executions go on
+    // with the current plan. Measurements are dropped while HEScheduler reads the cost model.
+    planner->pauseRecording();
+    auto input_shapes = _input_shapes;
+    auto options = _compiler->options();
+    _replan = std::async(std::launch::async, [this, planner, input_shapes, options]() {
+      try
+      {
+        auto compiled = compileExecution(input_shapes, options);
+        planner->resumeRecording();
+        return compiled;
+      }
+      catch (...)
+      {
+        planner->resumeRecording();
+        throw;
+      }
+    });
+    return;
+  }
+
+  if (_replan.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+    return;
+
+  CompiledExecution compiled;
+  try
+  {
+    compiled = _replan.get();
+  }
+  catch (const std::exception &e)
+  {
+    // Keep the current plan
+    std::cerr << "Error during re-planning : " << e.what() << std::endl;
+    planner->discardProposal();
+    return;
+  }
+
+  // Switch to the new plan only if it is cheaper enough than the current one
+  if (!planner->acceptProposal())
+    return;
+
+  compiled.execution->bindIO(*_execution);
+  _execution = compiled.execution;
+  if (_execution_cache)
+    _execution_cache->insert(_input_shapes, _execution, compiled.memory_size);
+}
+
+void nnfw_session::dropReplan()
+{
+  if (!_replan.valid())
+    return;
+
+  _replan.wait();
+  _replan = {};
+  _compiler->options().adaptive_planner->discardProposal();
+}
+
 NNFW_STATUS nnfw_session::run()
 {
   if (!_execution)
@@ -173,7 +385,9 @@ NNFW_STATUS nnfw_session::run()
 
   try
   {
+    selectExecution();
     _execution->execute();
+    replanExecution();
   }
   catch (const std::exception &e)
   {
@@ -188,6 +402,7 @@ NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const vo
 {
   try
   {
+    selectExecution();
     _execution->setInput(onert::ir::IOIndex(index), buffer, length);
   }
   catch (const std::exception &e)
@@ -203,6 +418,7 @@ NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *b
 {
   try
   {
+    selectExecution();
     _execution->setOutput(onert::ir::IOIndex(index), buffer, length);
   }
   catch (const std::exception &e)
@@ -261,6 +477,7 @@ NNFW_STATUS nnfw_session::set_input_layout(uint32_t index, NNFW_LAYOUT layout)
       std::cerr << "Error during nnfw_session::set_input_layout, not supported layout" << std::endl;
       return NNFW_STATUS_ERROR;
     }
+    selectExecution();
     _execution->setInputLayout(onert::ir::IOIndex(index), convertLayout(layout));
   }
   catch (const std::exception &e)
@@ -282,6 +499,7 @@ NNFW_STATUS nnfw_session::set_output_layout(uint32_t index, NNFW_LAYOUT layout)
                 << std::endl;
       return NNFW_STATUS_ERROR;
     }
+    selectExecution();
     _execution->setOutputLayout(onert::ir::IOIndex(index), convertLayout(layout));
   }
   catch (const std::exception &e)
@@ -307,6 +525,8 @@ static NNFW_TYPE datatype_to_nnfw_dtype(onert::ir::DataType dt)
       return NNFW_TYPE_TENSOR_BOOL;
     case DataType::UINT8:
       return NNFW_TYPE_TENSOR_UINT8;
+    case DataType::QUANT8_ASYMM_SIGNED:
+      return NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED;
     case DataType::UINT32:
     case DataType::QUANT8_SYMM:
     default:
@@ -362,7 +582,22 @@ NNFW_STATUS nnfw_session::apply_tensorinfo(uint32_t index, nnfw_tensorinfo ti)
     for (int32_t i = 0; i < ti.rank; i++)
       new_shape.dim(i) = ti.dims[i];
 
-    _execution->changeInputShape(onert::ir::IOIndex(index), new_shape);
+    if (_execution_cache)
+    {
+      // Execution for the new shapes is selected or compiled right before it is used
+      auto input_shape = _input_shapes.find(onert::ir::IOIndex(index));
+      if (input_shape == _input_shapes.end())
+      {
+        std::cerr << "Error during apply_tensorinfo : index is out of range." << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+      input_shape->second = new_shape;
+      _input_shapes_changed = true;
+    }
+    else
+    {
+      _execution->changeInputShape(onert::ir::IOIndex(index), new_shape);
+    }
   }
 
   return NNFW_STATUS_NO_ERROR;
@@ -378,6 +613,8 @@ NNFW_STATUS nnfw_session::input_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
                 << std::endl;
       return NNFW_STATUS_ERROR;
     }
+    if (_execution)
+      selectExecution();
     if (index >= primary_subgraph()->getInputs().size())
     {
       std::cerr << "Error during nnfw_session::input_tensorinfo, index is out of range."
@@ -411,6 +648,8 @@ NNFW_STATUS nnfw_session::output_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
                 << std::endl;
       return NNFW_STATUS_ERROR;
     }
+    if (_execution)
+      selectExecution();
     if (index >= primary_subgraph()->getOutputs().size())
     {
       std::cerr << "Error during nnfw_session::output_tensorinfo, index is out of range."
@@ -533,6 +772,13 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.trace_filepath = value;
   }
+  else if (skey == config::TRACE_SAMPLE_INTERVAL)
+  {
+    const auto interval = toInt(value);
+    if (interval < 1)
+      return NNFW_STATUS_ERROR;
+    options.trace_sample_interval = interval;
+  }
   else if (skey == config::GRAPH_DOT_DUMP)
   {
     options.graph_dump_level = toInt(value);
@@ -545,6 +791,10 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.executor = value;
   }
+  else if (skey == config::LINEAR_ORDER)
+  {
+    options.linear_order = value;
+  }
   else if (skey == config::OP_BACKEND_ALLOPS)
   {
     options.manual_scheduler_options.backend_for_all = value;
@@ -557,10 +807,33 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.he_profiling_mode = toBool(value);
   }
+  else if (skey == config::OP_STATS)
+  {
+    // Statistics collected so far are kept if it is enabled again
+    if (!toBool(value))
+      options.op_stats = nullptr;
+    else if (!options.op_stats)
+      options.op_stats = std::make_shared<onert::exec::OpStats>();
+  }
+  else if (skey == config::PERF_COUNTERS)
+  {
+    options.perf_counters = toBool(value);
+    if (options.perf_counters && !options.op_stats)
+      options.op_stats = std::make_shared<onert::exec::OpStats>();
+  }
   else if (skey == config::DISABLE_COMPILE)
   {
     options.disable_compile = toBool(value);
   }
+  else if (skey == config::EXECUTOR_CACHE_SIZE || skey == config::EXECUTOR_CACHE_MEMORY_MB ||
+           skey == config::ADAPTIVE_SCHEDULER || skey == config::ADAPTIVE_REPLAN_INTERVAL ||
+           skey == config::ADAPTIVE_MAX_REPLANS || skey == config::ADAPTIVE_MIN_GAIN)
+  {
+    // Read when the session is prepared
+    if (!_source)
+      return NNFW_STATUS_ERROR;
+    _source->set(skey, value);
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -627,3 +900,75 @@ NNFW_STATUS nnfw_session::get_config(const char *key, char *value, size_t value_
 
   return NNFW_STATUS_NO_ERROR;
 }
+
+NNFW_STATUS nnfw_session::get_executor_cache_stats(uint32_t *hits, uint32_t *misses,
+                                                   uint32_t *evictions)
+{
+  if (!hits || !misses || !evictions)
+    return NNFW_STATUS_ERROR;
+
+  // The session must be prepared with EXECUTOR_CACHE_SIZE
+  if (!_execution_cache)
+    return NNFW_STATUS_ERROR;
+
+  const auto &stats = _execution_cache->stats();
+  *hits = stats.hits;
+  *misses = stats.misses;
+  *evictions = stats.evictions;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_op_stats_size(uint32_t *size)
+{
+  if (!size)
+    return NNFW_STATUS_ERROR;
+
+  // The session must be prepared with OP_STATS or PERF_COUNTERS
+  if (!_execution || !_compiler->options().op_stats)
+    return NNFW_STATUS_ERROR;
+
+  *size = static_cast<uint32_t>(_compiler->options().op_stats->size());
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_op_stats(uint32_t index, nnfw_op_stats *stats)
+{
+  if (!stats)
+    return NNFW_STATUS_ERROR;
+
+  // The session must be prepared with OP_STATS or PERF_COUNTERS
+  if (!_execution || !_compiler->options().op_stats)
+    return NNFW_STATUS_ERROR;
+
+  const auto &op_stats = _compiler->options().op_stats;
+  if (index >= op_stats->size())
+    return NNFW_STATUS_ERROR;
+
+  const auto &entry = op_stats->at(index);
+  strncpy(stats->name, entry.name.c_str(), sizeof(stats->name) - 1);
+  stats->name[sizeof(stats->name) - 1] = '\0';
+  strncpy(stats->backend, entry.backend.c_str(), sizeof(stats->backend) - 1);
+  stats->backend[sizeof(stats->backend) - 1] = '\0';
+  stats->subgraph = entry.subgraph;
+  stats->first_op = entry.first_op;
+  stats->count = entry.count.load(std::memory_order_relaxed);
+  stats->time_ns = entry.time_ns.load(std::memory_order_relaxed);
+  stats->bytes_read = entry.bytes_read.load(std::memory_order_relaxed);
+  stats->bytes_written = entry.bytes_written.load(std::memory_order_relaxed);
+  stats->flops = entry.flops.load(std::memory_order_relaxed);
+  stats->cycles = entry.cycles.load(std::memory_order_relaxed);
+  stats->instructions = entry.instructions.load(std::memory_order_relaxed);
+  stats->cache_misses = entry.cache_misses.load(std::memory_order_relaxed);
+  stats->branch_misses = entry.branch_misses.load(std::memory_order_relaxed);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::reset_op_stats()
+{
+  // The session must be prepared with OP_STATS or PERF_COUNTERS
+  if (!_execution || !_compiler->options().op_stats)
+    return NNFW_STATUS_ERROR;
+
+  _compiler->options().op_stats->reset();
+  return NNFW_STATUS_NO_ERROR;
+}
@@ -19,11 +19,17 @@
 
 #include "nnfw.h"
 #include "nnfw_dev.h"
+#include "nnfw_debug.h"
 
 #include <util/GeneralConfigSource.h>
+#include <ir/Index.h>
+#include <ir/Shape.h>
 
+#include <future>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace onert
 {
@@ -37,15 +43,18 @@ class KernelRegistry;
 namespace exec
 {
 class Execution;
+class ExecutionCache;
 } // namespace exec
 namespace ir
 {
+struct Data;
 class Graph;
 class Subgraphs;
 } // namespace ir
 namespace compiler
 {
 class Compiler;
+struct CompilerOptions;
 } // namespace compiler
 } // namespace onert
 
@@ -81,8 +90,31 @@ public:
   NNFW_STATUS set_config(const char *key, const char *value);
   NNFW_STATUS get_config(const char *key, char *value, size_t value_size);
 
+  NNFW_STATUS get_executor_cache_stats(uint32_t *hits, uint32_t *misses, uint32_t *evictions);
+
+  NNFW_STATUS get_op_stats_size(uint32_t *size);
+  NNFW_STATUS get_op_stats(uint32_t index, nnfw_op_stats *stats);
+  NNFW_STATUS reset_op_stats();
+
+private:
+  // Execution compiled for input shapes, with its estimated memory for the execution cache
+  struct CompiledExecution
+  {
+    std::shared_ptr<onert::exec::Execution> execution;
+    size_t memory_size;
+  };
+
 private:
   onert::ir::Graph *primary_subgraph();
+  std::shared_ptr<onert::ir::Subgraphs> loadSubgraphs();
+  void shareConstants(onert::ir::Graph &graph,
+                      std::unordered_set<onert::ir::OperandIndex> *shared_constants);
+  CompiledExecution
+  compileExecution(const std::unordered_map<onert::ir::IOIndex, onert::ir::Shape> &input_shapes,
+                   const onert::compiler::CompilerOptions &options);
+  void selectExecution();
+  void replanExecution();
+  void dropReplan();
 
 private:
   std::shared_ptr<onert::ir::Subgraphs> _subgraphs;
@@ -90,6 +122,25 @@ private:
   std::shared_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::frontend::custom::KernelRegistry> _kernel_registry;
 
+  // Package directory, where schedule cache is saved
+  std::string _package_dir;
+  // Model files to reload when an execution for new input shapes is compiled
+  std::string _model_file_path;
+  std::string _model_type;
+  std::string _weights_file_path;
+
+  // Executions compiled for input shapes, enabled by EXECUTOR_CACHE_SIZE
+  std::unique_ptr<onert::exec::ExecutionCache> _execution_cache;
+  // Constant data of the primary subgraph, which executions compiled later refer to instead of
+  // reloaded copies while any execution keeps it. Compilations never overlap, so it is not locked.
+  std::unordered_map<onert::ir::OperandIndex, std::weak_ptr<onert::ir::Data>> _constants;
+  // Input shapes to run with. Execution is selected by these when they are changed.
+  std::unordered_map<onert::ir::IOIndex, onert::ir::Shape> _input_shapes;
+  bool _input_shapes_changed{false};
+  // Execution compiled with the updated cost model of adaptive scheduling in background. It is
+  // declared after members it uses, so that it is waited for before they are destroyed.
+  std::future<CompiledExecution> _replan;
+
 protected:
   std::unique_ptr<onert::util::GeneralConfigSource> _source;
 };
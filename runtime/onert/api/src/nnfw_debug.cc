@@ -34,3 +34,21 @@ NNFW_STATUS nnfw_get_config(nnfw_session *session, const char *key, char *value,
 {
   return session->get_config(key, value, value_size);
 }
+
+NNFW_STATUS nnfw_get_executor_cache_stats(nnfw_session *session, uint32_t *hits, uint32_t *misses,
+                                          uint32_t *evictions)
+{
+  return session->get_executor_cache_stats(hits, misses, evictions);
+}
+
+NNFW_STATUS nnfw_get_op_stats_size(nnfw_session *session, uint32_t *size)
+{
+  return session->get_op_stats_size(size);
+}
+
+NNFW_STATUS nnfw_get_op_stats(nnfw_session *session, uint32_t index, nnfw_op_stats *stats)
+{
+  return session->get_op_stats(index, stats);
+}
+
+NNFW_STATUS nnfw_reset_op_stats(nnfw_session *session) { return session->reset_op_stats(); }
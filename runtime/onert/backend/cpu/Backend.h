@@ -21,8 +21,10 @@
 #include "ConstantInitializer.h"
 #include "KernelGenerator.h"
 #include "ShapeFixer.h"
+#include "TensorRegister.h"
 
 #include <backend/Backend.h>
+#include <util/ConfigSource.h>
 
 #include <memory>
 
@@ -47,11 +49,24 @@ public:
     const auto &operands = graph.operands();
     auto context = std::make_unique<BackendContext>(this, &graph);
     auto tb = std::make_shared<TensorBuilder>();
+    tb->referConstants(graph);
+    const auto weight_dtype = util::getConfigString(util::config::CPU_WEIGHT_DTYPE);
+    if (weight_dtype == "float16")
+      tb->narrowWeights(graph, ir::DataType::FLOAT16);
+    else if (weight_dtype == "bfloat16")
+      tb->narrowWeights(graph, ir::DataType::BFLOAT16);
+    else if (weight_dtype != "float32")
+      throw std::runtime_error{"Invalid CPU_WEIGHT_DTYPE: " + weight_dtype};
     context->tensor_builder = tb;
     context->constant_initializer = std::make_shared<ConstantInitializer>(operands, tb);
     context->kernel_gen = std::make_shared<KernelGenerator>(operands, tb, kb);
     context->shape_fixer = std::make_shared<ShapeFixer>(operands);
-    context->tensor_register = nullptr;
+    // Elementwise chains are found on registration to be planned before kernel generation
+    if (util::getConfigBool(util::config::CPU_FUSE_ELEMENTWISE))
+      context->tensor_register =
+          std::make_shared<TensorRegister>(this, operands, graph.getOutputs(), tb);
+    else
+      context->tensor_register = nullptr;
     context->optimizer = nullptr;
     return context;
   }
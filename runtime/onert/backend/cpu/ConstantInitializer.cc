@@ -16,6 +16,31 @@
 
 #include "ConstantInitializer.h"
 
+#include <cker/BFloat16.h>
+
+namespace
+{
+
+template <typename T>
+void narrowInit(const onert::ir::Operand &model_obj, onert::backend::ITensor &obj)
+{
+  assert(model_obj.data());
+  assert(model_obj.typeInfo().type() == onert::ir::DataType::FLOAT32);
+  const auto num_elements = model_obj.shape().num_elements();
+  const auto from = reinterpret_cast<const float *>(model_obj.data()->base());
+
+  obj.access([&](onert::backend::ITensor &tensor) {
+    // cpu tensors have no padding, so elements are in the same order
+    auto into = reinterpret_cast<T *>(tensor.buffer());
+    for (uint64_t i = 0; i < num_elements; ++i)
+    {
+      into[i] = static_cast<T>(from[i]);
+    }
+  });
+}
+
+} // namespace
+
 namespace onert
 {
 namespace backend
@@ -30,6 +55,26 @@ ConstantInitializer::ConstantInitializer(const ir::Operands &operands,
   // DO NOTHING
 }
 
+void ConstantInitializer::registerWeightInitializer(const ir::OperandIndex &index,
+                                                    const ir::Operand &obj)
+{
+  if (!obj.isConstant())
+    return;
+
+  switch (_tensor_builder->at(index)->data_type())
+  {
+    case ir::DataType::FLOAT16:
+      _init_map[index] = narrowInit<ir::float16>;
+      break;
+    case ir::DataType::BFLOAT16:
+      _init_map[index] = narrowInit<nnfw::cker::BFloat16>;
+      break;
+    default:
+      registerCopyInitializer(index, obj);
+      break;
+  }
+}
+
 void ConstantInitializer::visit(const ir::operation::Conv2D &node)
 {
   const auto &kernel_index = node.getInputs().at(ir::operation::Conv2D::KERNEL);
@@ -56,7 +101,7 @@ void ConstantInitializer::visit(const ir::operation::FullyConnected &node)
 {
   const auto &weight_index = node.getInputs().at(ir::operation::FullyConnected::WEIGHT);
   const auto &weight_obj = _operands.at(weight_index);
-  registerCopyInitializer(weight_index, weight_obj);
+  registerWeightInitializer(weight_index, weight_obj);
 
   const auto &bias_index = node.getInputs().at(ir::operation::FullyConnected::BIAS);
   const auto &bias_obj = _operands.at(bias_index);
@@ -43,6 +43,9 @@ public:
 private:
   std::shared_ptr<ITensorBuilder> tensor_builder() const override { return _tensor_builder; }
 
+  // Same as registerCopyInitializer except that it narrows weights if the tensor builder decided
+  void registerWeightInitializer(const ir::OperandIndex &index, const ir::Operand &obj);
+
 private:
   std::shared_ptr<TensorBuilder> _tensor_builder;
 };
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ElementwiseChain.h"
+
+#include <ir/Operations.Include.h>
+
+#include <cassert>
+#include <limits>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+namespace
+{
+
+bool isStaticFloat(const ir::Operand &operand)
+{
+  return operand.typeInfo().type() == ir::DataType::FLOAT32 && !operand.shape().hasUnknownDim();
+}
+
+// Get how an operand is broadcast to the chain, false if it is not elementwise
+bool elementwiseBroadcast(const ir::Shape &operand, const ir::Shape &chain,
+                          nnfw::cker::ElementwiseBroadcast &broadcast)
+{
+  if (operand == chain)
+  {
+    broadcast = nnfw::cker::ElementwiseBroadcast::kFull;
+    return true;
+  }
+  if (operand.num_elements() == 1)
+  {
+    broadcast = nnfw::cker::ElementwiseBroadcast::kScalar;
+    return true;
+  }
+
+  // Operand of trailing dimensions of the chain, ignoring its leading 1s
+  int leading = 0;
+  while (leading < operand.rank() && operand.dim(leading) == 1)
+    ++leading;
+  const int rank = operand.rank() - leading;
+  if (rank > chain.rank())
+    return false;
+  for (int i = 0; i < rank; ++i)
+  {
+    if (operand.dim(leading + i) != chain.dim(chain.rank() - rank + i))
+      return false;
+  }
+  broadcast = nnfw::cker::ElementwiseBroadcast::kInner;
+  return true;
+}
+
+bool appendActivation(ir::Activation activation, ElementwiseLink &link)
+{
+  nnfw::cker::ElementwiseStep step;
+  step.type = nnfw::cker::ElementwiseOpType::kClamp;
+  switch (activation)
+  {
+    case ir::Activation::NONE:
+      return true;
+    case ir::Activation::RELU:
+      step.min = 0.0f;
+      step.max = std::numeric_limits<float>::max();
+      break;
+    case ir::Activation::RELU1:
+      step.min = -1.0f;
+      step.max = 1.0f;
+      break;
+    case ir::Activation::RELU6:
+      step.min = 0.0f;
+      step.max = 6.0f;
+      break;
+    default:
+      return false;
+  }
+  link.steps.emplace_back(step, ir::OperandIndex{});
+  return true;
+}
+
+/**
+ * @brief Make a link of an operation for an elementwise chain of @c chain_shape
+ * @param value Value of the chain, undefined for the first operation of the chain
+ * @return false if the operation cannot be a link of the chain
+ */
+bool makeElementwiseLink(const ir::Operands &operands, const ir::Operation &node,
+                         const ir::OperandIndex &value, const ir::Shape &chain_shape,
+                         ElementwiseLink &link)
+{
+  if (node.getOutputs().size() != 1)
+    return false;
+  for (const auto &index : node.getInputs() + node.getOutputs())
+  {
+    if (!isStaticFloat(operands.at(index)))
+      return false;
+  }
+  link.output = node.getOutputs().at(0);
+  if (!(operands.at(link.output).shape() == chain_shape))
+    return false;
+
+  using nnfw::cker::ElementwiseOpType;
+  nnfw::cker::ElementwiseStep step;
+  ir::Activation activation = ir::Activation::NONE;
+  switch (node.opcode())
+  {
+    case ir::OpCode::Abs:
+      step.type = ElementwiseOpType::kAbs;
+      break;
+    case ir::OpCode::Cos:
+      step.type = ElementwiseOpType::kCos;
+      break;
+    case ir::OpCode::Exp:
+      step.type = ElementwiseOpType::kExp;
+      break;
+    case ir::OpCode::Log:
+      step.type = ElementwiseOpType::kLog;
+      break;
+    case ir::OpCode::Logistic:
+      step.type = ElementwiseOpType::kLogistic;
+      break;
+    case ir::OpCode::Neg:
+      step.type = ElementwiseOpType::kNeg;
+      break;
+    case ir::OpCode::ReLU:
+      step.type = ElementwiseOpType::kClamp;
+      step.min = 0.0f;
+      step.max = std::numeric_limits<float>::max();
+      break;
+    case ir::OpCode::Sin:
+      step.type = ElementwiseOpType::kSin;
+      break;
+    case ir::OpCode::Tanh:
+      step.type = ElementwiseOpType::kTanh;
+      break;
+    case ir::OpCode::Add:
+      step.type = ElementwiseOpType::kAdd;
+      activation = static_cast<const ir::operation::Add &>(node).param().activation;
+      break;
+    case ir::OpCode::Sub:
+      step.type = ElementwiseOpType::kSub;
+      activation = static_cast<const ir::operation::Sub &>(node).param().activation;
+      break;
+    case ir::OpCode::Mul:
+      step.type = ElementwiseOpType::kMul;
+      activation = static_cast<const ir::operation::Mul &>(node).param().activation;
+      break;
+    case ir::OpCode::Div:
+      step.type = ElementwiseOpType::kDiv;
+      activation = static_cast<const ir::operation::Div &>(node).param().activation;
+      break;
+    default:
+      return false;
+  }
+
+  const auto &inputs = node.getInputs();
+  if (inputs.size() == 1)
+  {
+    link.value = inputs.at(0);
+    if (value.valid() && link.value != value)
+      return false;
+    link.steps.emplace_back(step, ir::OperandIndex{});
+  }
+  else
+  {
+    assert(inputs.size() == 2);
+    const auto &lhs = inputs.at(0);
+    const auto &rhs = inputs.at(1);
+    // The value of the chain must be one of inputs, and the first operation takes the input of
+    // the chain shape
+    const bool value_is_lhs =
+        value.valid() ? lhs == value : operands.at(lhs).shape() == chain_shape;
+    link.value = value_is_lhs ? lhs : rhs;
+    const auto operand = value_is_lhs ? rhs : lhs;
+    if ((value.valid() && link.value != value) || operand == link.value)
+      return false;
+    if (!elementwiseBroadcast(operands.at(operand).shape(), chain_shape, step.broadcast))
+      return false;
+    step.reversed = !value_is_lhs;
+    link.steps.emplace_back(step, operand);
+  }
+  if (!(operands.at(link.value).shape() == chain_shape))
+    return false;
+
+  return appendActivation(activation, link);
+}
+
+} // namespace
+
+ElementwiseChain findElementwiseChain(const ir::Operands &operands,
+                                      const ir::OperandIndexSequence &graph_outputs,
+                                      const ir::OpSequence &op_seq, size_t begin)
+{
+  const auto &operations = op_seq.operations();
+  const auto &first = *(operations[begin].node);
+  if (first.getOutputs().size() != 1 || !isStaticFloat(operands.at(first.getOutputs().at(0))))
+    return {};
+  const auto &chain_shape = operands.at(first.getOutputs().at(0)).shape();
+
+  ElementwiseChain chain;
+  for (size_t i = begin; i < operations.size(); ++i)
+  {
+    ir::OperandIndex value;
+    if (!chain.empty())
+    {
+      // The previous output is not written, so it must be used only in the chain
+      value = chain.back().output;
+      if (operands.at(value).getUses().size() != 1 || graph_outputs.contains(value))
+        break;
+    }
+
+    ElementwiseLink link;
+    if (!makeElementwiseLink(operands, *(operations[i].node), value, chain_shape, link))
+      break;
+    chain.emplace_back(std::move(link));
+  }
+  if (chain.size() < 2)
+    return {};
+
+  return chain;
+}
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
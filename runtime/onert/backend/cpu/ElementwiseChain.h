@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_ELEMENTWISE_CHAIN_H__
+#define __ONERT_BACKEND_CPU_ELEMENTWISE_CHAIN_H__
+
+#include <cker/operation/FusedElementwise.h>
+#include <ir/OpSequence.h>
+#include <ir/OperandIndexSequence.h>
+#include <ir/Operands.h>
+
+#include <utility>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+/**
+ * @brief An operation of an elementwise chain, which reads the value of the chain from @c value
+ *        and writes the next value to @c output
+ */
+struct ElementwiseLink
+{
+  ir::OperandIndex value;
+  ir::OperandIndex output;
+  // Steps with their operands, which are undefined for unary steps
+  std::vector<std::pair<nnfw::cker::ElementwiseStep, ir::OperandIndex>> steps;
+};
+
+using ElementwiseChain = std::vector<ElementwiseLink>;
+
+/**
+ * @brief Find elementwise operations from @c begin of @c op_seq which can be fused into one loop
+ * @return Links of the chain, empty if less than 2 operations can be fused
+ * @note   Outputs of the links but the last are never written, so they are used only in the chain
+ */
+ElementwiseChain findElementwiseChain(const ir::Operands &operands,
+                                      const ir::OperandIndexSequence &graph_outputs,
+                                      const ir::OpSequence &op_seq, size_t begin);
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_ELEMENTWISE_CHAIN_H__
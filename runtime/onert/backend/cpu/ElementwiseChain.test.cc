@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ElementwiseChain.h"
+
+#include <ir/Graph.h>
+#include <ir/operation/Abs.h>
+#include <ir/operation/Add.h>
+#include <ir/operation/Exp.h>
+#include <ir/operation/Neg.h>
+
+#include <gtest/gtest.h>
+
+#include <cassert>
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+
+namespace
+{
+
+/**
+ * @brief Graph of float operations of the same shape, whose operations are in one OpSequence
+ */
+class ElementwiseGraph
+{
+public:
+  ElementwiseGraph() : op_seq{ir::Layout::NHWC}
+  {
+    // OpSequence refers to indices of operations
+    _indices.reserve(8);
+  }
+
+  ir::OperandIndex addOperand()
+  {
+    return graph.addOperand(ir::Shape{2, 3}, ir::TypeInfo{ir::DataType::FLOAT32});
+  }
+
+  template <typename Op> ir::OperandIndex addUnary(const ir::OperandIndex &input)
+  {
+    auto output = addOperand();
+    addOperation(std::make_unique<Op>(ir::OperandIndexSequence{input},
+                                      ir::OperandIndexSequence{output}));
+    return output;
+  }
+
+  ir::OperandIndex addAdd(const ir::OperandIndex &lhs, const ir::OperandIndex &rhs)
+  {
+    auto output = addOperand();
+    addOperation(std::make_unique<ir::operation::Add>(
+        ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{output},
+        ir::operation::Add::Param{ir::Activation::NONE}));
+    return output;
+  }
+
+  // Length of the chain from the first operation
+  size_t findChain()
+  {
+    graph.finishBuilding();
+    for (const auto &index : _indices)
+      op_seq.appendOperation(index, graph.operations().at(index));
+    return findElementwiseChain(graph.operands(), graph.getOutputs(), op_seq, 0).size();
+  }
+
+private:
+  void addOperation(std::unique_ptr<ir::Operation> &&node)
+  {
+    assert(_indices.size() < _indices.capacity());
+    _indices.emplace_back(graph.addOperation(std::move(node)));
+  }
+
+public:
+  ir::Graph graph;
+  ir::OpSequence op_seq;
+
+private:
+  std::vector<ir::OperationIndex> _indices;
+};
+
+} // namespace
+
+// in -> Exp -> Neg -> Abs -> out
+TEST(CPU_ElementwiseChain, chain)
+{
+  ElementwiseGraph g;
+  auto in = g.addOperand();
+  auto out = g.addUnary<ir::operation::Abs>(
+      g.addUnary<ir::operation::Neg>(g.addUnary<ir::operation::Exp>(in)));
+  g.graph.addInput(in);
+  g.graph.addOutput(out);
+
+  EXPECT_EQ(g.findChain(), 3u);
+}
+
+// in -> Exp -> a -> Neg -> b -> Abs -> c, and Add(b, c) -> out
+TEST(CPU_ElementwiseChain, stop_at_multi_use)
+{
+  ElementwiseGraph g;
+  auto in = g.addOperand();
+  auto a = g.addUnary<ir::operation::Exp>(in);
+  auto b = g.addUnary<ir::operation::Neg>(a);
+  auto c = g.addUnary<ir::operation::Abs>(b);
+  auto out = g.addAdd(b, c);
+  g.graph.addInput(in);
+  g.graph.addOutput(out);
+
+  // b is written for Add, so Abs is not fused
+  EXPECT_EQ(g.findChain(), 2u);
+}
+
+// in -> Exp -> a -> Neg -> b, where a is also a graph output
+TEST(CPU_ElementwiseChain, stop_at_graph_output)
+{
+  ElementwiseGraph g;
+  auto in = g.addOperand();
+  auto a = g.addUnary<ir::operation::Exp>(in);
+  auto b = g.addUnary<ir::operation::Neg>(a);
+  g.graph.addInput(in);
+  g.graph.addOutput(a);
+  g.graph.addOutput(b);
+
+  // A chain of Exp alone is not fused
+  EXPECT_EQ(g.findChain(), 0u);
+}
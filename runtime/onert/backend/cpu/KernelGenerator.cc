@@ -67,9 +67,20 @@
 #include "kernel/ZerosLikeLayer.h"
 #include "kernel/SquaredDiffLayer.h"
 #include "kernel/LogicalOrLayer.h"
+#include "kernel/BatchMatMulLayer.h"
+#include "kernel/LSTMLayer.h"
+#include "kernel/RNNLayer.h"
+#include "kernel/FusedElementwiseLayer.h"
+#include "kernel/TransposeConvLayer.h"
+#include "kernel/ResizeBilinearLayer.h"
+#include "kernel/DepthToSpaceLayer.h"
+#include "kernel/SpaceToDepthLayer.h"
+#include "kernel/BatchToSpaceNDLayer.h"
+#include "kernel/SpaceToBatchNDLayer.h"
 
 #include <backend/Backend.h>
 #include <backend/IConfig.h>
+#include <exec/NopFunction.h>
 #include <memory>
 #include <util/Utils.h>
 #include <util/logging.h>
@@ -107,23 +118,64 @@ void KernelGenerator::visit(const ir::OpSequence &op_seq)
                        : std::make_unique<exec::FunctionSequence>();
 
   _current_op_seq_layout = op_seq.getLayout();
-  for (const auto &e : op_seq.operations())
+  const auto &operations = op_seq.operations();
+  for (size_t i = 0; i < operations.size();)
   {
-    const auto &node = *(e.node);
-    node.accept(*this);
-    _return_fn_seq->append(releaseFunction());
+    size_t num_generated = 1;
+    const auto chain = _tensor_builder->elementwiseChainAt(operations[i].index);
+    if (chain)
+    {
+      fuseElementwise(*chain);
+      num_generated = chain->size();
+    }
+    else
+    {
+      operations[i].node->accept(*this);
+      _return_fn_seq->append(releaseFunction());
+    }
 
-    for (const auto &ind : node.getInputs() + node.getOutputs())
+    for (size_t end = i + num_generated; i < end; ++i)
     {
-      auto tensor = _tensor_builder->at(ind);
-      if (tensor)
+      const auto &node = *(operations[i].node);
+      for (const auto &ind : node.getInputs() + node.getOutputs())
       {
-        tensor->increase_ref();
+        auto tensor = _tensor_builder->at(ind);
+        // Intermediates of a fused chain have no buffer
+        if (tensor && !_tensor_builder->isElementwiseIntermediate(ind))
+        {
+          tensor->increase_ref();
+        }
       }
     }
   }
 }
 
+void KernelGenerator::fuseElementwise(const ElementwiseChain &chain)
+{
+  std::vector<kernel::FusedElementwiseStep> steps;
+  for (const auto &link : chain)
+  {
+    for (const auto &step : link.steps)
+    {
+      const auto operand = step.second.valid() ? _tensor_builder->at(step.second).get() : nullptr;
+      steps.push_back({step.first, operand});
+    }
+  }
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::FusedElementwiseLayer>();
+
+  fn->configure(_tensor_builder->at(chain.front().value).get(), steps,
+                _tensor_builder->at(chain.back().output).get());
+
+  // Functions still map to operations one by one, the fused ones but the last do nothing
+  for (size_t i = 0; i + 1 < chain.size(); ++i)
+    _return_fn_seq->append(std::make_unique<exec::NopFunction>());
+  _return_fn_seq->append(std::move(fn));
+
+  VERBOSE(KernelGenerator) << "Fused " << chain.size() << " elementwise operations to #"
+                           << chain.back().output.value() << std::endl;
+}
+
 void KernelGenerator::visit(const ir::operation::Conv2D &node)
 {
   using ir::operation::Conv2D;
@@ -1201,6 +1253,230 @@ void KernelGenerator::visit(const ir::operation::Tile &node)
   fn->configure(input_alloc, multiples_alloc, output_alloc);
   _return_fn = std::move(fn);
 }
+
+void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto lhs_index{node.getInputs().at(ir::operation::BatchMatMul::LHS)};
+  const auto rhs_index{node.getInputs().at(ir::operation::BatchMatMul::RHS)};
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto lhs_alloc = _tensor_builder->at(lhs_index).get();
+  auto rhs_alloc = _tensor_builder->at(rhs_index).get();
+
+  const auto adj_x = node.param().adj_x;
+  const auto adj_y = node.param().adj_y;
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::BatchMatMulLayer>();
+
+  fn->configure(lhs_alloc, rhs_alloc, adj_x, adj_y, output_alloc);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::LSTM &node)
+{
+  using ir::operation::LSTM;
+
+  const auto output_state_out_index{node.getOutputs().at(LSTM::Output::OUTPUT_STATE_OUT)};
+  const auto cell_state_out_index{node.getOutputs().at(LSTM::Output::CELL_STATE_OUT)};
+  const auto output_index{node.getOutputs().at(LSTM::Output::OUTPUT)};
+
+  const auto input_index{node.getInputs().at(LSTM::Input::INPUT)};
+  const auto output_state_in_index{node.getInputs().at(LSTM::Input::OUTPUT_STATE_IN)};
+  const auto cell_state_in_index{node.getInputs().at(LSTM::Input::CELL_STATE_IN)};
+
+  bool constant_weights = true;
+  const auto weight_alloc = [&](LSTM::Input input) -> const operand::Tensor * {
+    const auto index{node.getInputs().at(input)};
+    // Optional operands are not given or have no elements
+    if (!index.valid() || _ctx.at(index).shape().num_elements() == 0)
+      return nullptr;
+    constant_weights = constant_weights && _ctx.at(index).isConstant();
+    return _tensor_builder->at(index).get();
+  };
+
+  kernel::LSTMWeightTensors weights;
+  weights.input_to_input = weight_alloc(LSTM::Input::INPUT_TO_INPUT_WEIGHTS);
+  weights.input_to_forget = weight_alloc(LSTM::Input::INPUT_TO_FORGET_WEIGHTS);
+  weights.input_to_cell = weight_alloc(LSTM::Input::INPUT_TO_CELL_WEIGHTS);
+  weights.input_to_output = weight_alloc(LSTM::Input::INPUT_TO_OUTPUT_WEIGHTS);
+  weights.recurrent_to_input = weight_alloc(LSTM::Input::RECURRENT_TO_INPUT_WEIGHTS);
+  weights.recurrent_to_forget = weight_alloc(LSTM::Input::RECURRENT_TO_FORGET_WEIGHTS);
+  weights.recurrent_to_cell = weight_alloc(LSTM::Input::RECURRENT_TO_CELL_WEIGHTS);
+  weights.recurrent_to_output = weight_alloc(LSTM::Input::RECURRENT_TO_OUTPUT_WEIGHTS);
+  weights.cell_to_input = weight_alloc(LSTM::Input::CELL_TO_INPUT_WEIGHTS);
+  weights.cell_to_forget = weight_alloc(LSTM::Input::CELL_TO_FORGET_WEIGHTS);
+  weights.cell_to_output = weight_alloc(LSTM::Input::CELL_TO_OUTPUT_WEIGHTS);
+  weights.input_gate_bias = weight_alloc(LSTM::Input::INPUT_GATE_BIAS);
+  weights.forget_gate_bias = weight_alloc(LSTM::Input::FORGET_GATE_BIAS);
+  weights.cell_bias = weight_alloc(LSTM::Input::CELL_BIAS);
+  weights.output_gate_bias = weight_alloc(LSTM::Input::OUTPUT_GATE_BIAS);
+  weights.projection_weights = weight_alloc(LSTM::Input::PROJECTION_WEIGHTS);
+  weights.projection_bias = weight_alloc(LSTM::Input::PROJECTION_BIAS);
+
+  // Input gate weights are given all or nothing, nothing with CIFG
+  if ((weights.input_to_input == nullptr) != (weights.recurrent_to_input == nullptr))
+    throw std::runtime_error{"LSTM: input gate weights must be given together"};
+
+  auto output_state_out_alloc = _tensor_builder->at(output_state_out_index).get();
+  auto cell_state_out_alloc = _tensor_builder->at(cell_state_out_index).get();
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+  auto output_state_in_alloc = _tensor_builder->at(output_state_in_index).get();
+  auto cell_state_in_alloc = _tensor_builder->at(cell_state_in_index).get();
+
+  const auto &param = node.param();
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::LSTMLayer>();
+
+  fn->configure(input_alloc, weights, constant_weights, output_state_in_alloc,
+                cell_state_in_alloc, param.activation, param.cell_threshold,
+                param.projection_threshold, output_state_out_alloc, cell_state_out_alloc,
+                output_alloc);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RNN &node)
+{
+  const auto output_index{node.getOutputs().at(ir::operation::RNN::Output::OUTPUT)};
+  const auto hidden_state_out_index{
+      node.getOutputs().at(ir::operation::RNN::Output::HIDDEN_STATE_OUT)};
+
+  const auto input_index{node.getInputs().at(ir::operation::RNN::Input::INPUT)};
+  const auto weights_index{node.getInputs().at(ir::operation::RNN::Input::WEIGHTS)};
+  const auto recurrent_weights_index{
+      node.getInputs().at(ir::operation::RNN::Input::RECURRENT_WEIGHTS)};
+  const auto bias_index{node.getInputs().at(ir::operation::RNN::Input::BIAS)};
+  const auto hidden_state_in_index{node.getInputs().at(ir::operation::RNN::Input::HIDDEN_STATE_IN)};
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto hidden_state_out_alloc = _tensor_builder->at(hidden_state_out_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+  auto weights_alloc = _tensor_builder->at(weights_index).get();
+  auto recurrent_weights_alloc = _tensor_builder->at(recurrent_weights_index).get();
+  auto bias_alloc = _tensor_builder->at(bias_index).get();
+  auto hidden_state_in_alloc = _tensor_builder->at(hidden_state_in_index).get();
+
+  const auto activation = node.param().activation;
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::RNNLayer>();
+
+  fn->configure(input_alloc, weights_alloc, recurrent_weights_alloc, bias_alloc,
+                hidden_state_in_alloc, activation, output_alloc, hidden_state_out_alloc);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+
+  const auto stride = node.param().stride;
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature(_current_op_seq_layout);
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature(_current_op_seq_layout);
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _ctx.at(ker_index).shape();
+  const auto ker_height = ker_shape.dim(1);
+  const auto ker_width = ker_shape.dim(2);
+  // Padding is the one of the convolution from output to input
+  const auto padding = ir::calculatePadding(node.param().padding, ofm_shape, ifm_shape, stride,
+                                            ker_width, ker_height);
+
+  auto ofm_alloc = _tensor_builder->at(ofm_index).get();
+  auto ifm_alloc = _tensor_builder->at(ifm_index).get();
+  auto ker_alloc = _tensor_builder->at(ker_index).get();
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::TransposeConvLayer>();
+
+  fn->configure(ifm_alloc, ker_alloc, _ctx.at(ker_index).isConstant(), padding.left, padding.top,
+                stride.horizontal, stride.vertical, ofm_alloc);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::ResizeBilinear::Input::INPUT)};
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::ResizeBilinearLayer>();
+
+  fn->configure(input_alloc, output_alloc);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::DepthToSpace &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::DepthToSpace::Input::INPUT)};
+  const auto block_size = node.param().block_size;
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::DepthToSpaceLayer>();
+
+  fn->configure(input_alloc, block_size, output_alloc);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::SpaceToDepth &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::SpaceToDepth::Input::INPUT)};
+  const auto block_size = node.param().block_size;
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::SpaceToDepthLayer>();
+
+  fn->configure(input_alloc, block_size, output_alloc);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::BatchToSpaceND &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::BatchToSpaceND::Input::INPUT)};
+  const auto block_size_index{
+      node.getInputs().at(ir::operation::BatchToSpaceND::Input::BLOCK_SIZE)};
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+  auto block_size_alloc = _tensor_builder->at(block_size_index).get();
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::BatchToSpaceNDLayer>();
+
+  fn->configure(input_alloc, block_size_alloc, output_alloc);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::SpaceToBatchND &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::SpaceToBatchND::Input::INPUT)};
+  const auto block_size_index{
+      node.getInputs().at(ir::operation::SpaceToBatchND::Input::BLOCK_SIZE)};
+  const auto paddings_index{node.getInputs().at(ir::operation::SpaceToBatchND::Input::PADDINGS)};
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+  auto block_size_alloc = _tensor_builder->at(block_size_index).get();
+  auto paddings_alloc = _tensor_builder->at(paddings_index).get();
+
+  auto fn = std::make_unique<::onert::backend::cpu::kernel::SpaceToBatchNDLayer>();
+
+  fn->configure(input_alloc, block_size_alloc, paddings_alloc, output_alloc);
+  _return_fn = std::move(fn);
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
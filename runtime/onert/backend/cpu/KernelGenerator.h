@@ -96,6 +96,21 @@ public:
   void visit(const ir::operation::SquaredDifference &) override;
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::LogicalOr &) override;
+  void visit(const ir::operation::BatchMatMul &) override;
+  void visit(const ir::operation::LSTM &) override;
+  void visit(const ir::operation::RNN &) override;
+  void visit(const ir::operation::TransposeConv &) override;
+  void visit(const ir::operation::ResizeBilinear &) override;
+  void visit(const ir::operation::DepthToSpace &) override;
+  void visit(const ir::operation::SpaceToDepth &) override;
+  void visit(const ir::operation::BatchToSpaceND &) override;
+  void visit(const ir::operation::SpaceToBatchND &) override;
+
+private:
+  /**
+   * @brief Generate a function for operations of an elementwise chain fused into one loop
+   */
+  void fuseElementwise(const ElementwiseChain &chain);
 
 private:
   const ir::Operands &_ctx;
@@ -210,6 +210,24 @@ void ShapeFixer::visit(const ir::operation::Tile &) { /* DO NOTHING */}
 
 void ShapeFixer::visit(const ir::operation::LogicalOr &) { /* DO NOTHING */}
 
+void ShapeFixer::visit(const ir::operation::BatchMatMul &) { /* DO NOTHING */}
+
+void ShapeFixer::visit(const ir::operation::LSTM &) { /* DO NOTHING */}
+
+void ShapeFixer::visit(const ir::operation::RNN &) { /* DO NOTHING */}
+
+void ShapeFixer::visit(const ir::operation::TransposeConv &) { /* DO NOTHING */}
+
+void ShapeFixer::visit(const ir::operation::ResizeBilinear &) { /* DO NOTHING */}
+
+void ShapeFixer::visit(const ir::operation::DepthToSpace &) { /* DO NOTHING */}
+
+void ShapeFixer::visit(const ir::operation::SpaceToDepth &) { /* DO NOTHING */}
+
+void ShapeFixer::visit(const ir::operation::BatchToSpaceND &) { /* DO NOTHING */}
+
+void ShapeFixer::visit(const ir::operation::SpaceToBatchND &) { /* DO NOTHING */}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
@@ -91,6 +91,15 @@ public:
   void visit(const ir::operation::ZerosLike &) override;
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::LogicalOr &) override;
+  void visit(const ir::operation::BatchMatMul &) override;
+  void visit(const ir::operation::LSTM &) override;
+  void visit(const ir::operation::RNN &) override;
+  void visit(const ir::operation::TransposeConv &) override;
+  void visit(const ir::operation::ResizeBilinear &) override;
+  void visit(const ir::operation::DepthToSpace &) override;
+  void visit(const ir::operation::SpaceToDepth &) override;
+  void visit(const ir::operation::BatchToSpaceND &) override;
+  void visit(const ir::operation::SpaceToBatchND &) override;
 
 private:
   const ir::Operands &_ctx;
@@ -38,7 +38,8 @@ void StaticTensorManager::allocateConsts(void)
   {
     const auto &ind = pair.first;
     auto tensor = pair.second;
-    if (_as_constants[ind])
+    // Tensors referring to data already have their buffer
+    if (_as_constants[ind] && tensor->buffer() == nullptr)
     {
       auto mem_alloc = _const_mgr->allocate(ind, tensor->total_size());
       tensor->setBuffer(mem_alloc);
@@ -58,7 +59,8 @@ void StaticTensorManager::allocateNonconsts(void)
   {
     const auto &ind = pair.first;
     auto tensor = pair.second;
-    if (!_as_constants[ind] && !tensor->is_dynamic())
+    // Tensors never claimed, e.g. intermediates of fused operations, are not allocated
+    if (!_as_constants[ind] && !tensor->is_dynamic() && _claimed[ind])
     {
       auto *buffer = _nonconst_mgr->getBuffer(ind);
       tensor->setBuffer(buffer);
@@ -82,6 +84,19 @@ void StaticTensorManager::buildTensor(const ir::OperandIndex &ind,
   _as_constants[ind] = as_const;
 }
 
+void StaticTensorManager::referConst(const ir::OperandIndex &ind,
+                                     const std::shared_ptr<const ir::Data> &data)
+{
+  assert(_tensors->find(ind) != _tensors->end());
+  assert(_as_constants[ind]);
+  auto tensor = (*_tensors)[ind];
+  assert(tensor->total_size() == data->size());
+  tensor->setBuffer(data);
+  VERBOSE(CPU_StaticTensorManager) << "CONSTANT TENSOR(#" << ind.value()
+                                   << "): refers to " << static_cast<const void *>(data->base())
+                                   << std::endl;
+}
+
 void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
 {
   assert(_tensors->find(ind) != _tensors->end());
@@ -90,7 +105,10 @@ void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
   assert(!(*_tensors)[ind]->is_dynamic());
 
   if (!_as_constants[ind])
+  {
     _nonconst_mgr->claimPlan(ind, size);
+    _claimed[ind] = true;
+  }
 }
 
 void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
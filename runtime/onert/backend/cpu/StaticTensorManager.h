@@ -44,6 +44,10 @@ public:
   void deallocateNonconsts(void);
 
   void buildTensor(const ir::OperandIndex &ind, const ir::OperandInfo &tensor_info, bool as_const);
+  /**
+   * @brief Let a constant tensor refer to data instead of allocating its own memory
+   */
+  void referConst(const ir::OperandIndex &ind, const std::shared_ptr<const ir::Data> &data);
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
@@ -55,6 +59,7 @@ private:
   std::unique_ptr<cpu_common::MemoryManager> _nonconst_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
   ir::OperandIndexMap<bool> _as_constants;
+  ir::OperandIndexMap<bool> _claimed;
 };
 
 } // namespace cpu
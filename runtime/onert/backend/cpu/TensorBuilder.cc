@@ -16,8 +16,10 @@
 
 #include "TensorBuilder.h"
 
+#include <ir/Operations.Include.h>
 #include <util/logging.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace onert
@@ -34,9 +36,44 @@ TensorBuilder::TensorBuilder()
   /* empty */
 }
 
-void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::OperandInfo &info,
-                                       ir::Layout, bool as_const)
+void TensorBuilder::narrowWeights(const ir::Graph &graph, ir::DataType type)
 {
+  assert(type == ir::DataType::FLOAT16 || type == ir::DataType::BFLOAT16);
+
+  // Only FullyConnected widens weights block by block. Kernels of Conv2D and DepthwiseConv2D read
+  // whole float filters, so narrowed filters would be kept in both types.
+  auto isWeight = [&](const ir::OperandIndex &ind, const ir::OperationIndex &use) {
+    const auto &node = graph.operations().at(use);
+    return node.opcode() == ir::OpCode::FullyConnected &&
+           node.getInputs().at(ir::operation::FullyConnected::WEIGHT) == ind;
+  };
+
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    if (!obj.isConstant() || obj.typeInfo().type() != ir::DataType::FLOAT32)
+      return;
+
+    const auto &uses = obj.getUses().list();
+    if (uses.empty() ||
+        !std::all_of(uses.begin(), uses.end(),
+                     [&](const ir::OperationIndex &use) { return isWeight(ind, use); }))
+      return;
+
+    VERBOSE(CPU_TensorBuilder) << "Weight #" << ind.value() << " is narrowed" << std::endl;
+    _narrowed_weights[ind] = type;
+  });
+}
+
+void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind,
+                                       const ir::OperandInfo &model_info, ir::Layout,
+                                       bool as_const)
+{
+  auto info = model_info;
+  auto narrowed = _narrowed_weights.find(ind);
+  if (narrowed != _narrowed_weights.end())
+  {
+    info.type(narrowed->second);
+  }
+
   _tensor_info_map.emplace(ind, info);
 
   if (as_const)
@@ -52,8 +89,50 @@ void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::Op
   }
 }
 
+void TensorBuilder::registerElementwiseChain(const ir::OperationIndex &first,
+                                             const ElementwiseChain &chain)
+{
+  assert(chain.size() >= 2);
+  const auto &output = chain.back().output;
+  for (const auto &link : chain)
+  {
+    if (link.output != output)
+      _elementwise_intermediates.insert(link.output);
+  }
+
+  // Planners release an operand after the operation using it last, which is in the middle of the
+  // chain but the function of the chain writes the output after reading it
+  auto &operands = _elementwise_operands[output];
+  operands.append(chain.front().value);
+  for (const auto &link : chain)
+  {
+    for (const auto &step : link.steps)
+    {
+      if (step.second.valid())
+        operands.append(step.second);
+    }
+  }
+  for (const auto &operand : operands)
+    _deferred_releases[operand] = output;
+
+  _elementwise_chains.emplace(first, chain);
+}
+
+const ElementwiseChain *TensorBuilder::elementwiseChainAt(const ir::OperationIndex &first) const
+{
+  auto found = _elementwise_chains.find(first);
+  if (found == _elementwise_chains.end())
+    return nullptr;
+
+  return &found->second;
+}
+
 void TensorBuilder::notifyFirstUse(const ir::OperandIndex &ind)
 {
+  // Intermediates of fused chains are never written
+  if (isElementwiseIntermediate(ind))
+    return;
+
   assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
   const auto tensor_info = _tensor_info_map.at(ind);
 
@@ -62,10 +141,34 @@ void TensorBuilder::notifyFirstUse(const ir::OperandIndex &ind)
     const auto size = tensor_info.total_size();
     _static_tensor_mgr->claimPlan(ind, size);
   }
+
+  // Release operands of the chain writing this, which are no longer used
+  auto chain = _elementwise_operands.find(ind);
+  if (chain == _elementwise_operands.end())
+    return;
+  for (const auto &operand : chain->second)
+  {
+    auto deferred = _deferred_releases.find(operand);
+    if (deferred == _deferred_releases.end() || deferred->second != ind)
+      continue;
+
+    _deferred_releases.erase(deferred);
+    if (_released_early.erase(operand) > 0)
+      notifyLastUse(operand);
+  }
 }
 
 void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
 {
+  if (isElementwiseIntermediate(ind))
+    return;
+
+  if (_deferred_releases.find(ind) != _deferred_releases.end())
+  {
+    _released_early.insert(ind);
+    return;
+  }
+
   if (!at(ind)->is_dynamic())
   {
     _static_tensor_mgr->releasePlan(ind);
@@ -79,6 +182,23 @@ bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
 
 void TensorBuilder::prepare(void)
 {
+  if (_graph_to_refer)
+  {
+    const auto &operands = _graph_to_refer->operands();
+    for (const auto &ind : _constants)
+    {
+      const auto &obj = operands.at(ind);
+      const auto &info = _tensor_info_map.at(ind);
+      // cpu tensors are NHWC, and narrowed weights are converted
+      const bool as_is = (_graph_to_refer->layout() == ir::Layout::NHWC ||
+                          obj.shape().rank() < 4) &&
+                         info.typeInfo().type() == obj.typeInfo().type() &&
+                         info.shape() == obj.shape();
+      if (as_is && obj.data() && obj.data()->size() == info.total_size())
+        _static_tensor_mgr->referConst(ind, obj.shareData());
+    }
+  }
+
   _static_tensor_mgr->allocateConsts();
   _static_tensor_mgr->allocateNonconsts();
 }
@@ -18,14 +18,18 @@
 #define __ONERT_BACKEND_CPU_TENSOR_BUILDER_H__
 
 #include "DynamicTensorManager.h"
+#include "ElementwiseChain.h"
 #include "StaticTensorManager.h"
 #include "TensorRegistry.h"
 #include "operand/Tensor.h"
 
 #include <backend/ITensorBuilder.h>
+#include <ir/Graph.h>
 #include <ir/OperandIndexMap.h>
+#include <ir/OperationIndexMap.h>
 
 #include <unordered_map>
+#include <unordered_set>
 
 namespace onert
 {
@@ -50,6 +54,44 @@ public:
   void registerTensorInfo(const ir::OperandIndex &ind, const ir::OperandInfo &info,
                           ir::Layout backend_layout, bool as_const) override;
 
+  /**
+   * @brief     Store constant weights of FullyConnected in a narrower floating point type
+   * @param[in] graph Graph to find weights from
+   * @param[in] type  FLOAT16 or BFLOAT16
+   * @note      This must be called before tensors are registered. Only FLOAT32 constants which
+   *            are used as weights only are narrowed.
+   */
+  void narrowWeights(const ir::Graph &graph, ir::DataType type);
+
+  /**
+   * @brief     Let constant tensors refer to data of the graph instead of copying it
+   * @param[in] graph Graph to refer to, which must outlive preparation of this
+   * @note      Only constants in the same type, shape and layout as in the model are referred.
+   *            Executions compiled from graphs sharing constant data share the memory.
+   */
+  void referConstants(const ir::Graph &graph) { _graph_to_refer = &graph; }
+
+  /**
+   * @brief     Plan tensors of an elementwise chain fused into one function as of one operation
+   * @param[in] first Index of the first operation of the chain
+   * @param[in] chain Links of the chain
+   * @note      Outputs of the links but the last are never written, so they are not allocated.
+   *            The other operands of the chain are read until the last link, so their memory is
+   *            not released before the output of the chain is claimed.
+   */
+  void registerElementwiseChain(const ir::OperationIndex &first, const ElementwiseChain &chain);
+
+  /**
+   * @brief  Get the elementwise chain from an operation
+   * @return nullptr if no chain is registered from @c first
+   */
+  const ElementwiseChain *elementwiseChainAt(const ir::OperationIndex &first) const;
+
+  bool isElementwiseIntermediate(const ir::OperandIndex &ind) const
+  {
+    return _elementwise_intermediates.find(ind) != _elementwise_intermediates.end();
+  }
+
   void notifyFirstUse(const ir::OperandIndex &) override;
   void notifyLastUse(const ir::OperandIndex &) override;
 
@@ -90,6 +132,14 @@ private:
   std::unique_ptr<DynamicTensorManager> _dynamic_tensor_mgr;
   ir::OperandIndexMap<ir::OperandInfo> _tensor_info_map;
   ir::OperandIndexSequence _constants;
+  ir::OperandIndexMap<ir::DataType> _narrowed_weights;
+  const ir::Graph *_graph_to_refer{nullptr};
+  ir::OperationIndexMap<ElementwiseChain> _elementwise_chains;
+  std::unordered_set<ir::OperandIndex> _elementwise_intermediates;
+  // Outputs of chains to the operands read by the chains, and vice versa for pending releases
+  ir::OperandIndexMap<ir::OperandIndexSequence> _elementwise_operands;
+  ir::OperandIndexMap<ir::OperandIndex> _deferred_releases;
+  std::unordered_set<ir::OperandIndex> _released_early;
 };
 
 } // namespace cpu
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TensorBuilder.h"
+
+#include <ir/Graph.h>
+#include <ir/operation/Add.h>
+#include <ir/operation/Conv2D.h>
+#include <ir/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+
+namespace
+{
+
+bool overlaps(const operand::Tensor &lhs, const operand::Tensor &rhs)
+{
+  return lhs.buffer() < rhs.buffer() + rhs.total_size() &&
+         rhs.buffer() < lhs.buffer() + lhs.total_size();
+}
+
+} // namespace
+
+// in -> Add(side) -> mid -> Tanh -> out
+TEST(CPU_TensorBuilder, elementwise_chain)
+{
+  const ir::OperandIndex in{0u}, side{1u}, mid{2u}, out{3u};
+  const ir::OperationIndex add{0u}, tanh{1u};
+  const auto info = ir::OperandInfo::createStaticInfo(ir::Shape{1, 16},
+                                                      ir::TypeInfo{ir::DataType::FLOAT32});
+
+  TensorBuilder tensor_builder;
+  for (const auto &ind : {in, side, mid, out})
+    tensor_builder.registerTensorInfo(ind, info, ir::Layout::NHWC, false);
+
+  nnfw::cker::ElementwiseStep step;
+  ElementwiseChain chain(2);
+  step.type = nnfw::cker::ElementwiseOpType::kAdd;
+  chain[0] = {in, mid, {{step, side}}};
+  step.type = nnfw::cker::ElementwiseOpType::kTanh;
+  chain[1] = {mid, out, {{step, ir::OperandIndex{}}}};
+  tensor_builder.registerElementwiseChain(add, chain);
+
+  ASSERT_NE(tensor_builder.elementwiseChainAt(add), nullptr);
+  ASSERT_EQ(tensor_builder.elementwiseChainAt(tanh), nullptr);
+  ASSERT_TRUE(tensor_builder.isElementwiseIntermediate(mid));
+  ASSERT_FALSE(tensor_builder.isElementwiseIntermediate(out));
+
+  // Notified as Linear::planTensors does for each operation
+  tensor_builder.notifyFirstUse(in);
+  tensor_builder.notifyFirstUse(side);
+  tensor_builder.notifyFirstUse(mid);
+  tensor_builder.notifyLastUse(in);
+  tensor_builder.notifyLastUse(side);
+  tensor_builder.notifyFirstUse(out);
+  tensor_builder.notifyLastUse(mid);
+  tensor_builder.notifyLastUse(out);
+  tensor_builder.prepare();
+
+  // The fused function reads the input and the operand while writing the output
+  ASSERT_NE(tensor_builder.at(out)->buffer(), nullptr);
+  EXPECT_FALSE(overlaps(*tensor_builder.at(out), *tensor_builder.at(in)));
+  EXPECT_FALSE(overlaps(*tensor_builder.at(out), *tensor_builder.at(side)));
+  EXPECT_EQ(tensor_builder.at(mid)->buffer(), nullptr);
+}
+
+// Released after the chain as usual when used later
+TEST(CPU_TensorBuilder, elementwise_chain_operand_used_later)
+{
+  const ir::OperandIndex in{0u}, mid{1u}, out{2u}, next{3u};
+  const auto info = ir::OperandInfo::createStaticInfo(ir::Shape{1, 16},
+                                                      ir::TypeInfo{ir::DataType::FLOAT32});
+
+  TensorBuilder tensor_builder;
+  for (const auto &ind : {in, mid, out, next})
+    tensor_builder.registerTensorInfo(ind, info, ir::Layout::NHWC, false);
+
+  nnfw::cker::ElementwiseStep step;
+  step.type = nnfw::cker::ElementwiseOpType::kExp;
+  ElementwiseChain chain(2);
+  chain[0] = {in, mid, {{step, ir::OperandIndex{}}}};
+  chain[1] = {mid, out, {{step, ir::OperandIndex{}}}};
+  tensor_builder.registerElementwiseChain(ir::OperationIndex{0u}, chain);
+
+  tensor_builder.notifyFirstUse(in);
+  tensor_builder.notifyFirstUse(mid);
+  tensor_builder.notifyFirstUse(out);
+  tensor_builder.notifyLastUse(mid);
+  // Add(in, out) -> next
+  tensor_builder.notifyFirstUse(next);
+  tensor_builder.notifyLastUse(in);
+  tensor_builder.notifyLastUse(out);
+  tensor_builder.notifyLastUse(next);
+  tensor_builder.prepare();
+
+  EXPECT_FALSE(overlaps(*tensor_builder.at(out), *tensor_builder.at(in)));
+  EXPECT_FALSE(overlaps(*tensor_builder.at(next), *tensor_builder.at(in)));
+  EXPECT_FALSE(overlaps(*tensor_builder.at(next), *tensor_builder.at(out)));
+}
+
+// Only weights of FullyConnected are narrowed, which it widens block by block
+TEST(CPU_TensorBuilder, narrow_weights)
+{
+  static const float zeros[16] = {};
+  ir::Graph graph;
+  auto addOperand = [&](const ir::Shape &shape, bool constant) {
+    auto index = graph.addOperand(shape, ir::TypeInfo{ir::DataType::FLOAT32});
+    if (constant)
+      graph.operands().at(index).data(std::make_unique<ir::ExternalData>(
+          reinterpret_cast<const uint8_t *>(zeros), shape.num_elements() * sizeof(float)));
+    return index;
+  };
+
+  auto fc_input = addOperand(ir::Shape{1, 4}, false);
+  auto fc_weight = addOperand(ir::Shape{4, 4}, true);
+  auto fc_bias = addOperand(ir::Shape{4}, true);
+  auto fc_output = addOperand(ir::Shape{1, 4}, false);
+  ir::operation::FullyConnected::Param fc_param;
+  fc_param.activation = ir::Activation::NONE;
+  graph.addOperation(std::make_unique<ir::operation::FullyConnected>(
+      ir::OperandIndexSequence{fc_input, fc_weight, fc_bias}, ir::OperandIndexSequence{fc_output},
+      fc_param));
+
+  auto conv_input = addOperand(ir::Shape{1, 2, 2, 4}, false);
+  auto conv_kernel = addOperand(ir::Shape{4, 1, 1, 4}, true);
+  auto conv_bias = addOperand(ir::Shape{4}, true);
+  auto conv_output = addOperand(ir::Shape{1, 2, 2, 4}, false);
+  ir::operation::Conv2D::Param conv_param;
+  conv_param.stride.horizontal = 1;
+  conv_param.stride.vertical = 1;
+  conv_param.padding.type = ir::PaddingType::VALID;
+  conv_param.activation = ir::Activation::NONE;
+  graph.addOperation(std::make_unique<ir::operation::Conv2D>(
+      ir::OperandIndexSequence{conv_input, conv_kernel, conv_bias},
+      ir::OperandIndexSequence{conv_output}, conv_param));
+
+  graph.addInput(fc_input);
+  graph.addInput(conv_input);
+  graph.addOutput(fc_output);
+  graph.addOutput(conv_output);
+  graph.finishBuilding();
+
+  TensorBuilder tensor_builder;
+  tensor_builder.narrowWeights(graph, ir::DataType::BFLOAT16);
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    tensor_builder.registerTensorInfo(ind, obj.info(), ir::Layout::NHWC, obj.isConstant());
+  });
+
+  EXPECT_EQ(tensor_builder.at(fc_weight)->data_type(), ir::DataType::BFLOAT16);
+  EXPECT_EQ(tensor_builder.at(fc_bias)->data_type(), ir::DataType::FLOAT32);
+  EXPECT_EQ(tensor_builder.at(conv_kernel)->data_type(), ir::DataType::FLOAT32);
+  EXPECT_EQ(tensor_builder.at(conv_bias)->data_type(), ir::DataType::FLOAT32);
+}
+
+// Constants refer to the data of the model, which other graphs may share
+TEST(CPU_TensorBuilder, refer_constants)
+{
+  std::vector<float> values(16, 1.0f);
+  auto data = std::make_shared<ir::CachedData>(reinterpret_cast<const uint8_t *>(values.data()),
+                                               values.size() * sizeof(float));
+
+  ir::Graph graph;
+  const ir::TypeInfo type{ir::DataType::FLOAT32};
+  auto input = graph.addOperand(ir::Shape{1, 16}, type);
+  auto constant = graph.addOperand(ir::Shape{1, 16}, type);
+  auto output = graph.addOperand(ir::Shape{1, 16}, type);
+  graph.operands().at(constant).data(data);
+  graph.addOperation(std::make_unique<ir::operation::Add>(
+      ir::OperandIndexSequence{input, constant}, ir::OperandIndexSequence{output},
+      ir::operation::Add::Param{ir::Activation::NONE}));
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  TensorBuilder tensor_builder;
+  tensor_builder.referConstants(graph);
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    tensor_builder.registerTensorInfo(ind, obj.info(), ir::Layout::NHWC, obj.isConstant());
+  });
+  for (const auto &ind : {input, output})
+    tensor_builder.notifyFirstUse(ind);
+  tensor_builder.prepare();
+
+  auto tensor = tensor_builder.at(constant);
+  EXPECT_EQ(tensor->buffer(), data->base());
+
+  // The tensor keeps the data after the graph releases it, and drops it when no longer used
+  graph.operands().at(constant).releaseData();
+  std::weak_ptr<ir::CachedData> weak_data = data;
+  data.reset();
+  ASSERT_FALSE(weak_data.expired());
+  tensor->increase_ref();
+  tensor->decrease_ref();
+  EXPECT_TRUE(weak_data.expired());
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TensorRegister.h"
+
+#include "ElementwiseChain.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+TensorRegister::TensorRegister(const backend::Backend *backend, const ir::Operands &operands,
+                               const ir::OperandIndexSequence &graph_outputs,
+                               const std::shared_ptr<TensorBuilder> &tensor_builder)
+    : _backend{backend}, _operands{operands}, _graph_outputs{graph_outputs},
+      _tensor_builder{tensor_builder}
+{
+  assert(tensor_builder != nullptr);
+}
+
+void TensorRegister::visit(const ir::OpSequence &op_seq)
+{
+  const auto &operations = op_seq.operations();
+  for (const auto &e : operations)
+  {
+    for (const auto &ind : e.node->getInputs() + e.node->getOutputs())
+    {
+      // Outputs of a permutation to other backends are not registered for CPU
+      if (lowerInfo(ind)->def_factors().getOnlyElement().backend() != _backend)
+        continue;
+      defaultRegisterTensorInfo(ind);
+    }
+  }
+
+  for (size_t i = 0; i < operations.size();)
+  {
+    const auto chain = findElementwiseChain(_operands, _graph_outputs, op_seq, i);
+    if (chain.empty())
+    {
+      ++i;
+      continue;
+    }
+
+    _tensor_builder->registerElementwiseChain(operations[i].index, chain);
+    i += chain.size();
+  }
+}
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
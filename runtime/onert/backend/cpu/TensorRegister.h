@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_TENSOR_REGISTER_H__
+#define __ONERT_BACKEND_CPU_TENSOR_REGISTER_H__
+
+#include "TensorBuilder.h"
+
+#include <backend/Backend.h>
+#include <backend/ITensorRegister.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+/**
+ * @brief Register tensors of op sequences with elementwise chains to be fused by KernelGenerator,
+ *        so that tensors of a chain are planned as of one operation
+ */
+class TensorRegister : public ITensorRegister
+{
+public:
+  TensorRegister(const backend::Backend *backend, const ir::Operands &operands,
+                 const ir::OperandIndexSequence &graph_outputs,
+                 const std::shared_ptr<TensorBuilder> &tensor_builder);
+
+public:
+  void visit(const ir::OpSequence &op_seq) override;
+
+private:
+  const ir::Operands &operands() const override { return _operands; }
+  std::shared_ptr<ITensorBuilder> tensor_builder() const override { return _tensor_builder; }
+
+private:
+  const backend::Backend *_backend;
+  const ir::Operands &_operands;
+  const ir::OperandIndexSequence &_graph_outputs;
+  const std::shared_ptr<TensorBuilder> _tensor_builder;
+};
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_TENSOR_REGISTER_H__
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BatchMatMulLayer.h"
+
+#include <cker/operation/BatchMatMul.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+void BatchMatMulLayer::batchMatMulFloat32()
+{
+  nnfw::cker::BatchMatMulParams op_params;
+  op_params.adj_x = _adj_x;
+  op_params.adj_y = _adj_y;
+
+  nnfw::cker::BatchMatMul(
+      op_params, convertTensorToCkerShape(_lhs), reinterpret_cast<const float *>(_lhs->buffer()),
+      convertTensorToCkerShape(_rhs), reinterpret_cast<const float *>(_rhs->buffer()),
+      convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
+void BatchMatMulLayer::configure(const operand::Tensor *lhs, const operand::Tensor *rhs,
+                                 bool adj_x, bool adj_y, operand::Tensor *output)
+{
+  _lhs = lhs;
+  _rhs = rhs;
+  _adj_x = adj_x;
+  _adj_y = adj_y;
+  _output = output;
+}
+
+void BatchMatMulLayer::run()
+{
+  if (_lhs->data_type() == OperandType::FLOAT32)
+  {
+    batchMatMulFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"BatchMatMul: unsupported data type"};
+  }
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_KERNEL_BATCHMATMULLAYER_H__
+#define __ONERT_BACKEND_CPU_KERNEL_BATCHMATMULLAYER_H__
+
+#include "../operand/Tensor.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+class BatchMatMulLayer : public ::onert::exec::IFunction
+{
+public:
+  BatchMatMulLayer() : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false)
+  {
+    // DO NOTHING
+  }
+
+public:
+  void batchMatMulFloat32();
+
+  void configure(const operand::Tensor *lhs, const operand::Tensor *rhs, bool adj_x, bool adj_y,
+                 operand::Tensor *output);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  const operand::Tensor *_lhs;
+  const operand::Tensor *_rhs;
+  operand::Tensor *_output;
+
+  bool _adj_x;
+  bool _adj_y;
+};
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_KERNEL_BATCHMATMULLAYER_H__
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BatchToSpaceNDLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/BatchToSpaceND.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+template <typename T> void BatchToSpaceNDLayer::batchToSpaceND()
+{
+  // Crops are always 0 as the operation has no crops input
+  nnfw::cker::BatchToSpaceND<T>(
+      convertTensorToCkerShape(_input), reinterpret_cast<const T *>(_input->buffer()),
+      reinterpret_cast<const int32_t *>(_block_shape->buffer()), nullptr,
+      convertTensorToCkerShape(_output), reinterpret_cast<T *>(_output->buffer()));
+}
+
+void BatchToSpaceNDLayer::configure(const operand::Tensor *input,
+                                    const operand::Tensor *block_shape, operand::Tensor *output)
+{
+  _input = input;
+  _block_shape = block_shape;
+  _output = output;
+}
+
+void BatchToSpaceNDLayer::run()
+{
+  if (_input->num_dimensions() != 4)
+  {
+    throw std::runtime_error{"BatchToSpaceND: only 4D input is supported"};
+  }
+
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      batchToSpaceND<float>();
+      break;
+    case OperandType::INT32:
+      batchToSpaceND<int32_t>();
+      break;
+    case OperandType::QUANT8_ASYMM:
+      batchToSpaceND<uint8_t>();
+      break;
+    default:
+      throw std::runtime_error{"BatchToSpaceND: unsupported data type"};
+  }
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
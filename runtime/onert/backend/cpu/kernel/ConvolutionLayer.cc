@@ -57,9 +57,8 @@ void ConvolutionLayer::convFloat32()
   if (!_prepare)
   {
     bool is_replaced_weights = false;
-    kernel.prepare(convertTensorToCkerShape(_kernel),
-                   reinterpret_cast<const float *>(_kernel->buffer()), op_params.padding_type,
-                   is_replaced_weights);
+    kernel.prepare(op_params, convertTensorToCkerShape(_input), convertTensorToCkerShape(_kernel),
+                   reinterpret_cast<const float *>(_kernel->buffer()), is_replaced_weights);
 
     if (is_replaced_weights)
     {
@@ -118,6 +117,43 @@ void ConvolutionLayer::convQuant8()
          reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  if (!_prepare)
+  {
+    GetQuantizedConvolutionMultipliersAndShifts(
+        _input, _kernel, _output, _kernel->dimension(0), _per_channel_output_multiplier,
+        _per_channel_output_shift);
+    kernel.prepareQuant(convertTensorToCkerShape(_input), convertTensorToCkerShape(_kernel),
+                        convertTensorToCkerShape(_output), _strideWidth, _strideHeight);
+    _prepare = true;
+  }
+  kernel(op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+         convertTensorToCkerShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+         convertTensorToCkerShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+         convertTensorToCkerShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+         convertTensorToCkerShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void ConvolutionLayer::configure(const operand::Tensor *input, const operand::Tensor *kernel,
                                  const operand::Tensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
@@ -149,6 +185,10 @@ void ConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    convQuant8PerChannel();
+  }
 }
 
 #undef ANDROID_NN_CONV_PARAMETERS
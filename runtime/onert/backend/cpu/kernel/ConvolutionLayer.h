@@ -23,6 +23,7 @@
 #include <exec/IFunction.h>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace nnfw
 {
@@ -52,6 +53,8 @@ public:
 
   void convQuant8();
 
+  void convQuant8PerChannel();
+
   void configure(const operand::Tensor *input, const operand::Tensor *kernel,
                  const operand::Tensor *bias, const ir::PaddingType paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
@@ -85,6 +88,10 @@ private:
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
 
+  // Quantized multipliers of each output channel for int8
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+
   bool _prepare;
 };
 
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConvolutionLayer.h"
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+constexpr int input_size = 5;
+constexpr int input_depth = 8;
+constexpr int output_depth = 8;
+
+/**
+ * @brief Run an int8 Conv with a per-channel filter, and compare it with the float Conv of the
+ *        dequantized values, which it must match up to rounding of the output
+ */
+void runPerChannelConv(int filter_size, int stride, int padding)
+{
+  const int output_size = (input_size + 2 * padding - filter_size) / stride + 1;
+  const ir::Shape input_shape{1, input_size, input_size, input_depth};
+  const ir::Shape filter_shape{output_depth, filter_size, filter_size, input_depth};
+  const ir::Shape bias_shape{output_depth};
+  const ir::Shape output_shape{1, output_size, output_size, output_depth};
+
+  std::vector<int8_t> q_input_data;
+  float input_scale = 0.0f;
+  int32_t input_zero_point = 0;
+  quantizeAsymmetric(makeValues(input_shape.num_elements(), 1.0f, 1), q_input_data, input_scale,
+                     input_zero_point);
+  std::vector<int8_t> q_filter_data;
+  const auto filter_scales = quantizeSymmetricPerChannel(
+      makeValues(filter_shape.num_elements(), 0.5f, 2), output_depth, false, q_filter_data);
+  const auto bias_values = makeValues(output_depth, 0.2f, 3);
+  std::vector<int32_t> q_bias_data(output_depth);
+  for (int c = 0; c < output_depth; ++c)
+    q_bias_data[c] = std::round(bias_values[c] / (input_scale * filter_scales[c]));
+
+  // Float Conv of the dequantized values
+  std::vector<float> input_data(q_input_data.size());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = (q_input_data[i] - input_zero_point) * input_scale;
+  std::vector<float> filter_data(q_filter_data.size());
+  const size_t filter_channel_size = filter_data.size() / output_depth;
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = q_filter_data[i] * filter_scales[i / filter_channel_size];
+  std::vector<float> bias_data(output_depth);
+  for (int c = 0; c < output_depth; ++c)
+    bias_data[c] = q_bias_data[c] * input_scale * filter_scales[c];
+  std::vector<float> expected_data(output_shape.num_elements());
+
+  auto input = makeTensor(input_shape, input_data);
+  auto filter = makeTensor(filter_shape, filter_data);
+  auto bias = makeTensor(bias_shape, bias_data);
+  auto expected = makeTensor(output_shape, expected_data);
+  filter->increase_ref();
+
+  kernel::ConvolutionLayer float_layer;
+  float_layer.configure(input.get(), filter.get(), bias.get(), ir::PaddingType::EXPLICIT, padding,
+                        padding, padding, padding, stride, stride, ir::Activation::NONE,
+                        expected.get());
+  float_layer.run();
+
+  std::vector<int8_t> q_output_data;
+  float output_scale = 0.0f;
+  int32_t output_zero_point = 0;
+  quantizeAsymmetric(expected_data, q_output_data, output_scale, output_zero_point);
+  std::fill(q_output_data.begin(), q_output_data.end(), 0);
+
+  auto q_input = makeTensor(input_shape, ir::DataType::QUANT8_ASYMM_SIGNED, q_input_data,
+                            input_scale, input_zero_point);
+  auto q_filter = makePerChannelTensor(filter_shape, q_filter_data, filter_scales);
+  auto q_bias = makeTensor(bias_shape, ir::DataType::INT32, q_bias_data);
+  auto q_output = makeTensor(output_shape, ir::DataType::QUANT8_ASYMM_SIGNED, q_output_data,
+                             output_scale, output_zero_point);
+
+  kernel::ConvolutionLayer layer;
+  layer.configure(q_input.get(), q_filter.get(), q_bias.get(), ir::PaddingType::EXPLICIT, padding,
+                  padding, padding, padding, stride, stride, ir::Activation::NONE,
+                  q_output.get());
+  layer.run();
+
+  for (size_t i = 0; i < q_output_data.size(); ++i)
+  {
+    const float output = (q_output_data[i] - output_zero_point) * output_scale;
+    EXPECT_NEAR(output, expected_data[i], output_scale * 1.01f) << "at " << i;
+  }
+}
+
+} // namespace
+
+TEST(ConvolutionLayer, int8_per_channel_pointwise) { runPerChannelConv(1, 1, 0); }
+
+TEST(ConvolutionLayer, int8_per_channel_im2col)
+{
+  runPerChannelConv(3, 1, 1);
+  runPerChannelConv(3, 2, 0);
+  runPerChannelConv(1, 2, 0);
+}
@@ -17,6 +17,7 @@
 #include "DepthwiseConvolutionLayer.h"
 
 #include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/optimized/integer_ops/DepthwiseConv.h>
 
 namespace onert
 {
@@ -96,6 +97,42 @@ void DepthwiseConvolutionLayer::convQuant8()
       reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void DepthwiseConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  // Filter is [1, H, W, output channels]
+  if (_per_channel_output_multiplier.empty())
+  {
+    GetQuantizedConvolutionMultipliersAndShifts(
+        _input, _kernel, _output, _kernel->dimension(3), _per_channel_output_multiplier,
+        _per_channel_output_shift);
+  }
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::optimized_integer_ops::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      convertTensorToCkerShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      convertTensorToCkerShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      convertTensorToCkerShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      convertTensorToCkerShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void DepthwiseConvolutionLayer::configure(const operand::Tensor *input,
                                           const operand::Tensor *kernel,
                                           const operand::Tensor *bias, const uint32_t paddingLeft,
@@ -128,6 +165,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    convQuant8PerChannel();
+  }
 }
 
 } // namespace kernel
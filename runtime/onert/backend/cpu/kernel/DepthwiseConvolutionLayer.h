@@ -41,6 +41,8 @@ public:
 
   void convQuant8();
 
+  void convQuant8PerChannel();
+
   void configure(const operand::Tensor *input, const operand::Tensor *kernel,
                  const operand::Tensor *bias, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
@@ -73,6 +75,10 @@ private:
   uint32_t _multiplier;
 
   ir::Activation _activation;
+
+  // Quantized multipliers of each output channel for int8
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
 };
 
 } // namespace kernel
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DepthwiseConvolutionLayer.h"
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+constexpr int input_size = 5;
+constexpr int filter_size = 3;
+constexpr int output_size = input_size - filter_size + 1;
+constexpr int depth = 4;
+
+/**
+ * @brief Run an int8 DepthwiseConv with a per-channel filter, and compare it with the float
+ *        DepthwiseConv of the dequantized values, which it must match up to rounding of the output
+ */
+void runPerChannelDepthwiseConv(int multiplier, int stride)
+{
+  const int output_depth = depth * multiplier;
+  const int strided_output_size = (input_size - filter_size) / stride + 1;
+  const ir::Shape input_shape{1, input_size, input_size, depth};
+  const ir::Shape filter_shape{1, filter_size, filter_size, output_depth};
+  const ir::Shape bias_shape{output_depth};
+  const ir::Shape output_shape{1, strided_output_size, strided_output_size, output_depth};
+
+  std::vector<int8_t> q_input_data;
+  float input_scale = 0.0f;
+  int32_t input_zero_point = 0;
+  quantizeAsymmetric(makeValues(input_shape.num_elements(), 1.0f, 1), q_input_data, input_scale,
+                     input_zero_point);
+  std::vector<int8_t> q_filter_data;
+  const auto filter_scales = quantizeSymmetricPerChannel(
+      makeValues(filter_shape.num_elements(), 0.5f, 2), output_depth, true, q_filter_data);
+  const auto bias_values = makeValues(output_depth, 0.2f, 3);
+  std::vector<int32_t> q_bias_data(output_depth);
+  for (int c = 0; c < output_depth; ++c)
+    q_bias_data[c] = std::round(bias_values[c] / (input_scale * filter_scales[c]));
+
+  // Float DepthwiseConv of the dequantized values
+  std::vector<float> input_data(q_input_data.size());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = (q_input_data[i] - input_zero_point) * input_scale;
+  std::vector<float> filter_data(q_filter_data.size());
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = q_filter_data[i] * filter_scales[i % output_depth];
+  std::vector<float> bias_data(output_depth);
+  for (int c = 0; c < output_depth; ++c)
+    bias_data[c] = q_bias_data[c] * input_scale * filter_scales[c];
+  std::vector<float> expected_data(output_shape.num_elements());
+
+  auto input = makeTensor(input_shape, input_data);
+  auto filter = makeTensor(filter_shape, filter_data);
+  auto bias = makeTensor(bias_shape, bias_data);
+  auto expected = makeTensor(output_shape, expected_data);
+
+  kernel::DepthwiseConvolutionLayer float_layer;
+  float_layer.configure(input.get(), filter.get(), bias.get(), 0, 0, 0, 0, stride, stride,
+                        multiplier, ir::Activation::NONE, expected.get());
+  float_layer.run();
+
+  std::vector<int8_t> q_output_data;
+  float output_scale = 0.0f;
+  int32_t output_zero_point = 0;
+  quantizeAsymmetric(expected_data, q_output_data, output_scale, output_zero_point);
+  std::fill(q_output_data.begin(), q_output_data.end(), 0);
+
+  auto q_input = makeTensor(input_shape, ir::DataType::QUANT8_ASYMM_SIGNED, q_input_data,
+                            input_scale, input_zero_point);
+  auto q_filter = makePerChannelTensor(filter_shape, q_filter_data, filter_scales);
+  auto q_bias = makeTensor(bias_shape, ir::DataType::INT32, q_bias_data);
+  auto q_output = makeTensor(output_shape, ir::DataType::QUANT8_ASYMM_SIGNED, q_output_data,
+                             output_scale, output_zero_point);
+
+  kernel::DepthwiseConvolutionLayer layer;
+  layer.configure(q_input.get(), q_filter.get(), q_bias.get(), 0, 0, 0, 0, stride, stride,
+                  multiplier, ir::Activation::NONE, q_output.get());
+  layer.run();
+
+  for (size_t i = 0; i < q_output_data.size(); ++i)
+  {
+    const float output = (q_output_data[i] - output_zero_point) * output_scale;
+    EXPECT_NEAR(output, expected_data[i], output_scale * 1.01f) << "at " << i;
+  }
+}
+
+} // namespace
+
+TEST(DepthwiseConvolutionLayer, int8_per_channel)
+{
+  runPerChannelDepthwiseConv(1, 1);
+  runPerChannelDepthwiseConv(1, 2);
+}
+
+TEST(DepthwiseConvolutionLayer, int8_per_channel_multiplier) { runPerChannelDepthwiseConv(2, 1); }
@@ -16,7 +16,9 @@
 
 #include "FullyConnectedLayer.h"
 
+#include <cker/BFloat16.h>
 #include <cker/operation/FullyConnected.h>
+#include <cker/operation/optimized/integer_ops/FullyConnected.h>
 
 namespace onert
 {
@@ -85,8 +87,41 @@ void FullyConnectedLayer::fullyConnectedQuant8()
       reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void FullyConnectedLayer::fullyConnectedQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  if (_per_channel_output_multiplier.empty())
+  {
+    GetQuantizedConvolutionMultipliersAndShifts(
+        _input, _weights, _output, _weights->dimension(0), _per_channel_output_multiplier,
+        _per_channel_output_shift);
+  }
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_offset();
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::optimized_integer_ops::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      convertTensorToCkerShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      convertTensorToCkerShape(_weights), reinterpret_cast<const int8_t *>(_weights->buffer()),
+      convertTensorToCkerShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      convertTensorToCkerShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
+  if (!_weights->data_channel_scales().empty())
+  {
+    throw std::runtime_error{"FullyConnected: per-channel hybrid weights are not supported"};
+  }
+
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
   if (!temp_arena.prepared)
   {
@@ -105,6 +140,39 @@ void FullyConnectedLayer::fullyConnectedHybrid()
       reinterpret_cast<float *>(_output->buffer()), temp_arena);
 }
 
+void FullyConnectedLayer::fullyConnectedWidenWeights()
+{
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+  op_params.activation = convertActivationType(_activation);
+
+  const auto bias_data = reinterpret_cast<const float *>(_bias->buffer());
+
+  if (_weights->data_type() == OperandType::FLOAT16)
+  {
+    nnfw::cker::FullyConnectedWidenWeights(
+        op_params, convertTensorToCkerShape(_input),
+        reinterpret_cast<const float *>(_input->buffer()), convertTensorToCkerShape(_weights),
+        reinterpret_cast<const ir::float16 *>(_weights->buffer()), convertTensorToCkerShape(_bias),
+        bias_data, convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()),
+        *_temp_arena);
+  }
+  else
+  {
+    assert(_weights->data_type() == OperandType::BFLOAT16);
+    nnfw::cker::FullyConnectedWidenWeights(
+        op_params, convertTensorToCkerShape(_input),
+        reinterpret_cast<const float *>(_input->buffer()), convertTensorToCkerShape(_weights),
+        reinterpret_cast<const nnfw::cker::BFloat16 *>(_weights->buffer()),
+        convertTensorToCkerShape(_bias), bias_data, convertTensorToCkerShape(_output),
+        reinterpret_cast<float *>(_output->buffer()), *_temp_arena);
+  }
+}
+
 void FullyConnectedLayer::configure(const operand::Tensor *input, const operand::Tensor *weights,
                                     const operand::Tensor *bias, ir::Activation activation,
                                     operand::Tensor *output)
@@ -124,6 +192,10 @@ void FullyConnectedLayer::run()
     {
       fullyConnectedHybrid();
     }
+    else if (isNarrowedFloat(_weights))
+    {
+      fullyConnectedWidenWeights();
+    }
     else
     {
       fullyConnectedFloat32();
@@ -133,6 +205,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT8_ASYMM_SIGNED)
+  {
+    fullyConnectedQuant8PerChannel();
+  }
 }
 
 } // namespace kernel
@@ -50,8 +50,12 @@ public:
 
   void fullyConnectedQuant8();
 
+  void fullyConnectedQuant8PerChannel();
+
   void fullyConnectedHybrid();
 
+  void fullyConnectedWidenWeights();
+
   void configure(const operand::Tensor *input, const operand::Tensor *weights,
                  const operand::Tensor *bias, ir::Activation activation, operand::Tensor *output);
 
@@ -71,6 +75,10 @@ private:
 
   ir::Activation _activation;
   std::unique_ptr<nnfw::cker::FCTempArena> _temp_arena;
+
+  // Quantized multipliers of each output unit for int8
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
 };
 
 } // namespace kernel
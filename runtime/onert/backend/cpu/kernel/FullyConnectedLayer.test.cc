@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FullyConnectedLayer.h"
+#include "TestUtils.h"
+
+#include <cker/BFloat16.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+constexpr int n_batch = 2;
+constexpr int n_input = 19;
+constexpr int n_units = 21;
+
+std::vector<float> runFullyConnected(std::vector<float> &input_data, operand::Tensor *weights,
+                                     std::vector<float> &bias_data)
+{
+  std::vector<float> output_data(n_batch * n_units);
+  auto input = makeTensor(ir::Shape{n_batch, n_input}, input_data);
+  auto bias = makeTensor(ir::Shape{n_units}, bias_data);
+  auto output = makeTensor(ir::Shape{n_batch, n_units}, output_data);
+
+  kernel::FullyConnectedLayer layer;
+  layer.configure(input.get(), weights, bias.get(), ir::Activation::NONE, output.get());
+  layer.run();
+  return output_data;
+}
+
+/**
+ * @brief Compare FC of weights in a 2-byte type with the float path
+ *
+ * @param relative_error Error bound of each weight by rounding, relative to its magnitude
+ */
+template <typename T> void runNarrowedFullyConnected(ir::DataType type, float relative_error)
+{
+  auto input_data = makeValues(n_batch * n_input, 1.0f, 1);
+  auto weights_data = makeValues(n_units * n_input, 0.5f, 2);
+  auto bias_data = makeValues(n_units, 0.2f, 3);
+  auto narrowed_data = narrowValues<T>(weights_data);
+  auto widened_data = widenValues(narrowed_data);
+
+  auto weights = makeTensor(ir::Shape{n_units, n_input}, weights_data);
+  auto widened = makeTensor(ir::Shape{n_units, n_input}, widened_data);
+  auto narrowed = makeTensor(ir::Shape{n_units, n_input}, type, narrowed_data);
+
+  const auto expected = runFullyConnected(input_data, weights.get(), bias_data);
+  const auto expected_widened = runFullyConnected(input_data, widened.get(), bias_data);
+  const auto output = runFullyConnected(input_data, narrowed.get(), bias_data);
+
+  for (int b = 0; b < n_batch; ++b)
+  {
+    for (int u = 0; u < n_units; ++u)
+    {
+      const int i = b * n_units + u;
+      // Same as the float path on the rounded weights
+      EXPECT_NEAR(output[i], expected_widened[i], 1e-5f) << "at " << i;
+
+      // Close to the float path on the original weights
+      float bound = 1e-6f;
+      for (int k = 0; k < n_input; ++k)
+        bound += std::abs(weights_data[u * n_input + k] * input_data[b * n_input + k]) *
+                 relative_error;
+      EXPECT_NEAR(output[i], expected[i], bound) << "at " << i;
+    }
+  }
+}
+
+/**
+ * @brief Run an int8 FC with per-channel weights, and compare it with the float FC of the
+ *        dequantized values, which it must match up to rounding of the output
+ */
+void runPerChannelFullyConnected()
+{
+  std::vector<int8_t> q_input_data;
+  float input_scale = 0.0f;
+  int32_t input_zero_point = 0;
+  quantizeAsymmetric(makeValues(n_batch * n_input, 1.0f, 1), q_input_data, input_scale,
+                     input_zero_point);
+  std::vector<int8_t> q_weights_data;
+  const auto weights_scales = quantizeSymmetricPerChannel(makeValues(n_units * n_input, 0.5f, 2),
+                                                          n_units, false, q_weights_data);
+  const auto bias_values = makeValues(n_units, 0.2f, 3);
+  std::vector<int32_t> q_bias_data(n_units);
+  for (int u = 0; u < n_units; ++u)
+    q_bias_data[u] = std::round(bias_values[u] / (input_scale * weights_scales[u]));
+
+  // Float FC of the dequantized values
+  std::vector<float> input_data(q_input_data.size());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = (q_input_data[i] - input_zero_point) * input_scale;
+  std::vector<float> weights_data(q_weights_data.size());
+  for (size_t i = 0; i < weights_data.size(); ++i)
+    weights_data[i] = q_weights_data[i] * weights_scales[i / n_input];
+  std::vector<float> bias_data(n_units);
+  for (int u = 0; u < n_units; ++u)
+    bias_data[u] = q_bias_data[u] * input_scale * weights_scales[u];
+  auto weights = makeTensor(ir::Shape{n_units, n_input}, weights_data);
+  const auto expected = runFullyConnected(input_data, weights.get(), bias_data);
+
+  std::vector<int8_t> q_output_data;
+  float output_scale = 0.0f;
+  int32_t output_zero_point = 0;
+  quantizeAsymmetric(expected, q_output_data, output_scale, output_zero_point);
+  std::fill(q_output_data.begin(), q_output_data.end(), 0);
+
+  auto q_input = makeTensor(ir::Shape{n_batch, n_input}, ir::DataType::QUANT8_ASYMM_SIGNED,
+                            q_input_data, input_scale, input_zero_point);
+  auto q_weights = makePerChannelTensor(ir::Shape{n_units, n_input}, q_weights_data,
+                                        weights_scales);
+  auto q_bias = makeTensor(ir::Shape{n_units}, ir::DataType::INT32, q_bias_data);
+  auto q_output = makeTensor(ir::Shape{n_batch, n_units}, ir::DataType::QUANT8_ASYMM_SIGNED,
+                             q_output_data, output_scale, output_zero_point);
+
+  kernel::FullyConnectedLayer layer;
+  layer.configure(q_input.get(), q_weights.get(), q_bias.get(), ir::Activation::NONE,
+                  q_output.get());
+  layer.run();
+
+  for (size_t i = 0; i < q_output_data.size(); ++i)
+  {
+    const float output = (q_output_data[i] - output_zero_point) * output_scale;
+    EXPECT_NEAR(output, expected[i], output_scale * 1.01f) << "at " << i;
+  }
+}
+
+} // namespace
+
+TEST(FullyConnectedLayer, float16_weights)
+{
+  // float16 keeps 10 fraction bits, and the weights are far from its subnormal range
+  runNarrowedFullyConnected<ir::float16>(ir::DataType::FLOAT16, std::ldexp(1.0f, -11));
+}
+
+TEST(FullyConnectedLayer, bfloat16_weights)
+{
+  // bfloat16 keeps 7 fraction bits
+  runNarrowedFullyConnected<nnfw::cker::BFloat16>(ir::DataType::BFLOAT16, std::ldexp(1.0f, -8));
+}
+
+TEST(FullyConnectedLayer, int8_per_channel_weights) { runPerChannelFullyConnected(); }
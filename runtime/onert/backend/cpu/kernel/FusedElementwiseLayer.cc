@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FusedElementwiseLayer.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+void FusedElementwiseLayer::configure(const operand::Tensor *input,
+                                      const std::vector<FusedElementwiseStep> &steps,
+                                      operand::Tensor *output)
+{
+  _input = input;
+  _steps = steps;
+  _output = output;
+
+  _cker_steps.clear();
+  for (const auto &step : _steps)
+    _cker_steps.emplace_back(step.step);
+}
+
+void FusedElementwiseLayer::run()
+{
+  const int64_t size = _output->total_size() / sizeof(float);
+  if (static_cast<int64_t>(_input->total_size() / sizeof(float)) != size)
+  {
+    throw std::runtime_error{"FusedElementwise: input and output sizes are different"};
+  }
+
+  for (size_t i = 0; i < _steps.size(); ++i)
+  {
+    const auto operand = _steps[i].operand;
+    if (operand == nullptr)
+      continue;
+
+    auto &step = _cker_steps[i];
+    step.operand = reinterpret_cast<const float *>(operand->buffer());
+    step.operand_size = operand->total_size() / sizeof(float);
+    if (step.broadcast == nnfw::cker::ElementwiseBroadcast::kFull && step.operand_size != size)
+    {
+      throw std::runtime_error{"FusedElementwise: operand and output sizes are different"};
+    }
+  }
+
+  nnfw::cker::FusedElementwise(_cker_steps, reinterpret_cast<const float *>(_input->buffer()),
+                               size, reinterpret_cast<float *>(_output->buffer()));
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_KERNEL_FUSEDELEMENTWISELAYER_H__
+#define __ONERT_BACKEND_CPU_KERNEL_FUSEDELEMENTWISELAYER_H__
+
+#include "../operand/Tensor.h"
+
+#include <cker/operation/FusedElementwise.h>
+#include <exec/IFunction.h>
+
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+/**
+ * @brief A step of a fused chain, whose operand tensor is read at run for dynamic buffers
+ */
+struct FusedElementwiseStep
+{
+  nnfw::cker::ElementwiseStep step;
+  const operand::Tensor *operand; //< nullptr for unary step
+};
+
+/**
+ * @brief Elementwise operations of an op sequence fused into one pass over memory
+ */
+class FusedElementwiseLayer : public ::onert::exec::IFunction
+{
+public:
+  FusedElementwiseLayer() : _input{nullptr}, _output{nullptr}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void configure(const operand::Tensor *input, const std::vector<FusedElementwiseStep> &steps,
+                 operand::Tensor *output);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  const operand::Tensor *_input;
+  std::vector<FusedElementwiseStep> _steps;
+  std::vector<nnfw::cker::ElementwiseStep> _cker_steps;
+  operand::Tensor *_output;
+};
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_KERNEL_FUSEDELEMENTWISELAYER_H__
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LSTMLayer.h"
+
+#include <cker/operation/LSTM.h>
+
+#include <cstring>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+namespace
+{
+
+template <typename T>
+void stackGates(const std::vector<const operand::Tensor *> &gates, std::vector<T> &stacked,
+                std::vector<float> &scales)
+{
+  std::vector<const T *> gates_data;
+  scales.clear();
+  for (const auto gate : gates)
+  {
+    gates_data.emplace_back(reinterpret_cast<const T *>(gate->buffer()));
+    scales.emplace_back(gate->data_scale());
+  }
+  // Biases are rank-1 [n_cell], which are stacked as columns of one element
+  const auto front = gates.front();
+  const int cols = front->num_dimensions() == 1 ? 1 : front->dimension(1);
+  nnfw::cker::StackGates(gates_data, front->dimension(0), cols, stacked);
+}
+
+// Read a float vector, dequantizing int8 symmetric one
+void readVector(const operand::Tensor *tensor, std::vector<float> &vector)
+{
+  if (tensor == nullptr)
+  {
+    vector.clear();
+    return;
+  }
+
+  const auto size = tensor->dimension(0);
+  vector.resize(size);
+  if (tensor->data_type() == OperandType::QUANT8_SYMM)
+  {
+    const auto data = reinterpret_cast<const int8_t *>(tensor->buffer());
+    const auto scale = tensor->data_scale();
+    for (size_t i = 0; i < size; ++i)
+      vector[i] = data[i] * scale;
+  }
+  else
+  {
+    std::memcpy(vector.data(), tensor->buffer(), size * sizeof(float));
+  }
+}
+
+void copyState(const operand::Tensor *in, operand::Tensor *out)
+{
+  if (in->buffer() != out->buffer())
+    std::memcpy(out->buffer(), in->buffer(), in->total_size());
+}
+
+} // namespace
+
+LSTMLayer::LSTMLayer()
+    : _input(nullptr), _weights(), _constant_weights(false), _output_state_in(nullptr),
+      _cell_state_in(nullptr), _output_state_out(nullptr), _cell_state_out(nullptr),
+      _output(nullptr), _activation(ir::Activation::TANH), _cell_clip(0.0f),
+      _projection_clip(0.0f), _prepared(false), _float_weights(nullptr), _hybrid_weights(nullptr),
+      _temp_arena(new nnfw::cker::RecurrentTempArena())
+{
+  // DO NOTHING
+}
+
+LSTMLayer::~LSTMLayer() = default;
+
+template <typename T> void LSTMLayer::prepareWeights(nnfw::cker::LSTMWeights<T> &weights)
+{
+  std::vector<const operand::Tensor *> input_gates;
+  std::vector<const operand::Tensor *> recurrent_gates;
+  std::vector<const operand::Tensor *> biases;
+  // The input gate is coupled with the forget gate without its weights (CIFG)
+  if (_weights.input_to_input != nullptr)
+  {
+    input_gates.emplace_back(_weights.input_to_input);
+    recurrent_gates.emplace_back(_weights.recurrent_to_input);
+    biases.emplace_back(_weights.input_gate_bias);
+  }
+  input_gates.insert(input_gates.end(), {_weights.input_to_forget, _weights.input_to_cell,
+                                         _weights.input_to_output});
+  recurrent_gates.insert(recurrent_gates.end(), {_weights.recurrent_to_forget,
+                                                 _weights.recurrent_to_cell,
+                                                 _weights.recurrent_to_output});
+  biases.insert(biases.end(),
+                {_weights.forget_gate_bias, _weights.cell_bias, _weights.output_gate_bias});
+
+  weights.n_gates = input_gates.size();
+  stackGates(input_gates, weights.input_weights, weights.input_scales);
+  stackGates(recurrent_gates, weights.recurrent_weights, weights.recurrent_scales);
+  std::vector<float> unused_scales;
+  stackGates(biases, weights.bias, unused_scales);
+
+  readVector(_weights.input_to_input ? _weights.cell_to_input : nullptr, weights.cell_to_input);
+  readVector(_weights.cell_to_forget, weights.cell_to_forget);
+  readVector(_weights.cell_to_output, weights.cell_to_output);
+
+  // Constant weights are not read again once stacked
+  if (_constant_weights)
+  {
+    std::vector<const operand::Tensor *> stacked;
+    stacked.insert(stacked.end(), input_gates.begin(), input_gates.end());
+    stacked.insert(stacked.end(), recurrent_gates.begin(), recurrent_gates.end());
+    stacked.insert(stacked.end(), biases.begin(), biases.end());
+    stacked.insert(stacked.end(),
+                   {_weights.cell_to_input, _weights.cell_to_forget, _weights.cell_to_output});
+    for (const auto tensor : stacked)
+    {
+      // TODO Remove const_cast
+      if (tensor != nullptr)
+        const_cast<operand::Tensor *>(tensor)->decrease_ref();
+    }
+  }
+}
+
+template <typename T> void LSTMLayer::lstm(nnfw::cker::LSTMWeights<T> &weights)
+{
+  if (!_prepared || !_constant_weights)
+  {
+    prepareWeights(weights);
+    _prepared = true;
+  }
+  if (_weights.projection_weights)
+  {
+    weights.projection_weights = reinterpret_cast<const T *>(_weights.projection_weights->buffer());
+    weights.projection_scale = _weights.projection_weights->data_scale();
+    weights.projection_bias =
+        _weights.projection_bias
+            ? reinterpret_cast<const float *>(_weights.projection_bias->buffer())
+            : nullptr;
+  }
+
+  // States are updated in place in output states
+  copyState(_output_state_in, _output_state_out);
+  copyState(_cell_state_in, _cell_state_out);
+
+  nnfw::cker::LSTMParams op_params;
+  op_params.activation = convertActivationType(_activation);
+  op_params.cell_clip = _cell_clip;
+  op_params.projection_clip = _projection_clip;
+
+  const int n_batch = _input->dimension(0);
+  const int n_input = _input->dimension(1);
+  const int n_cell = _weights.input_to_forget->dimension(0);
+  const int n_output = _weights.recurrent_to_forget->dimension(1);
+
+  nnfw::cker::LSTM(op_params, weights, /*n_time=*/1, n_batch, n_input, n_cell, n_output,
+                   reinterpret_cast<const float *>(_input->buffer()),
+                   reinterpret_cast<float *>(_output_state_out->buffer()),
+                   reinterpret_cast<float *>(_cell_state_out->buffer()),
+                   reinterpret_cast<float *>(_output->buffer()), *_temp_arena);
+}
+
+void LSTMLayer::lstmFloat32()
+{
+  if (!_float_weights)
+    _float_weights.reset(new nnfw::cker::LSTMWeights<float>());
+  lstm(*_float_weights);
+}
+
+void LSTMLayer::lstmHybrid()
+{
+  if (!_hybrid_weights)
+    _hybrid_weights.reset(new nnfw::cker::LSTMWeights<int8_t>());
+  lstm(*_hybrid_weights);
+}
+
+void LSTMLayer::configure(const operand::Tensor *input, const LSTMWeightTensors &weights,
+                          bool constant_weights, const operand::Tensor *output_state_in,
+                          const operand::Tensor *cell_state_in, ir::Activation activation,
+                          float cell_clip, float projection_clip,
+                          operand::Tensor *output_state_out, operand::Tensor *cell_state_out,
+                          operand::Tensor *output)
+{
+  assert(weights.projection_weights == nullptr ||
+         weights.projection_weights->data_type() == weights.input_to_forget->data_type());
+
+  _input = input;
+  _weights = weights;
+  _constant_weights = constant_weights;
+  _output_state_in = output_state_in;
+  _cell_state_in = cell_state_in;
+  _activation = activation;
+  _cell_clip = cell_clip;
+  _projection_clip = projection_clip;
+  _output_state_out = output_state_out;
+  _cell_state_out = cell_state_out;
+  _output = output;
+}
+
+void LSTMLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+  {
+    throw std::runtime_error{"LSTM: unsupported data type"};
+  }
+
+  if (_weights.input_to_forget->data_type() == OperandType::QUANT8_SYMM)
+  {
+    lstmHybrid();
+  }
+  else
+  {
+    lstmFloat32();
+  }
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
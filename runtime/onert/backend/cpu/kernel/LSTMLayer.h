@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_KERNEL_LSTMLAYER_H__
+#define __ONERT_BACKEND_CPU_KERNEL_LSTMLAYER_H__
+
+#include "../operand/Tensor.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+namespace nnfw
+{
+namespace cker
+{
+template <typename WeightT> struct LSTMWeights;
+class RecurrentTempArena;
+} // namespace cker
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+/**
+ * @brief Weights and biases of LSTM, optional ones are nullptr if they are not given
+ */
+struct LSTMWeightTensors
+{
+  const operand::Tensor *input_to_input; //< Optional, nullptr with CIFG
+  const operand::Tensor *input_to_forget;
+  const operand::Tensor *input_to_cell;
+  const operand::Tensor *input_to_output;
+  const operand::Tensor *recurrent_to_input; //< Optional, nullptr with CIFG
+  const operand::Tensor *recurrent_to_forget;
+  const operand::Tensor *recurrent_to_cell;
+  const operand::Tensor *recurrent_to_output;
+  const operand::Tensor *cell_to_input;  //< Optional
+  const operand::Tensor *cell_to_forget; //< Optional
+  const operand::Tensor *cell_to_output; //< Optional
+  const operand::Tensor *input_gate_bias; //< Optional, nullptr with CIFG
+  const operand::Tensor *forget_gate_bias;
+  const operand::Tensor *cell_bias;
+  const operand::Tensor *output_gate_bias;
+  const operand::Tensor *projection_weights; //< Optional
+  const operand::Tensor *projection_bias;    //< Optional
+};
+
+class LSTMLayer : public ::onert::exec::IFunction
+{
+public:
+  LSTMLayer();
+  ~LSTMLayer();
+
+public:
+  void lstmFloat32();
+
+  void lstmHybrid();
+
+  /**
+   * @param constant_weights  Whether weights are constant, so that they are stacked only once
+   */
+  void configure(const operand::Tensor *input, const LSTMWeightTensors &weights,
+                 bool constant_weights, const operand::Tensor *output_state_in,
+                 const operand::Tensor *cell_state_in, ir::Activation activation,
+                 float cell_clip, float projection_clip, operand::Tensor *output_state_out,
+                 operand::Tensor *cell_state_out, operand::Tensor *output);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  template <typename T> void prepareWeights(nnfw::cker::LSTMWeights<T> &weights);
+  template <typename T> void lstm(nnfw::cker::LSTMWeights<T> &weights);
+
+private:
+  const operand::Tensor *_input;
+  LSTMWeightTensors _weights;
+  bool _constant_weights;
+  const operand::Tensor *_output_state_in;
+  const operand::Tensor *_cell_state_in;
+  operand::Tensor *_output_state_out;
+  operand::Tensor *_cell_state_out;
+  operand::Tensor *_output;
+
+  ir::Activation _activation;
+  float _cell_clip;
+  float _projection_clip;
+
+  bool _prepared;
+  std::unique_ptr<nnfw::cker::LSTMWeights<float>> _float_weights;
+  std::unique_ptr<nnfw::cker::LSTMWeights<int8_t>> _hybrid_weights;
+  std::unique_ptr<nnfw::cker::RecurrentTempArena> _temp_arena;
+};
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_KERNEL_LSTMLAYER_H__
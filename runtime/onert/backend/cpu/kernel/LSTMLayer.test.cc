@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "LSTMLayer.h"
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+constexpr int n_batch = 2;
+constexpr int n_input = 3;
+constexpr int n_cell = 4;
+constexpr int n_output = n_cell;
+
+float sigmoid(float x) { return 1.0f / (1.0f + std::exp(-x)); }
+
+/**
+ * @brief Float weights of LSTM, whose gate vectors are empty if they are not used
+ */
+struct LSTMData
+{
+  // Gates in order of input, forget, cell and output
+  std::vector<float> input_to[4];
+  std::vector<float> recurrent_to[4];
+  std::vector<float> bias[4];
+  std::vector<float> cell_to[3]; //< Peephole of input, forget and output
+};
+
+LSTMData makeData(bool cifg, bool peephole)
+{
+  LSTMData data;
+  for (int g = 0; g < 4; ++g)
+  {
+    if (cifg && g == 0)
+      continue;
+    data.input_to[g] = makeValues(n_cell * n_input, 0.5f, g);
+    data.recurrent_to[g] = makeValues(n_cell * n_output, 0.5f, g + 4);
+    data.bias[g] = makeValues(n_cell, 0.2f, g + 8);
+  }
+  if (peephole)
+  {
+    for (int g = 0; g < 3; ++g)
+    {
+      if (cifg && g == 0)
+        continue;
+      data.cell_to[g] = makeValues(n_cell, 0.3f, g + 12);
+    }
+  }
+  return data;
+}
+
+// One step of LSTM with tanh activation and without projection
+void referenceLSTM(const LSTMData &data, bool cifg, const std::vector<float> &input,
+                   std::vector<float> &output_state, std::vector<float> &cell_state)
+{
+  std::vector<float> new_output(n_batch * n_output);
+  for (int b = 0; b < n_batch; ++b)
+  {
+    float gates[4][n_cell];
+    for (int g = 0; g < 4; ++g)
+    {
+      if (cifg && g == 0)
+        continue;
+      for (int c = 0; c < n_cell; ++c)
+      {
+        float sum = data.bias[g][c];
+        for (int i = 0; i < n_input; ++i)
+          sum += data.input_to[g][c * n_input + i] * input[b * n_input + i];
+        for (int o = 0; o < n_output; ++o)
+          sum += data.recurrent_to[g][c * n_output + o] * output_state[b * n_output + o];
+        gates[g][c] = sum;
+      }
+    }
+    for (int c = 0; c < n_cell; ++c)
+    {
+      float &cell = cell_state[b * n_cell + c];
+      const bool peephole = !data.cell_to[1].empty();
+      const float forget = sigmoid(gates[1][c] + (peephole ? data.cell_to[1][c] * cell : 0.0f));
+      const float input_gate =
+          cifg ? 1.0f - forget
+               : sigmoid(gates[0][c] + (peephole ? data.cell_to[0][c] * cell : 0.0f));
+      cell = forget * cell + input_gate * std::tanh(gates[2][c]);
+      const float output_gate =
+          sigmoid(gates[3][c] + (peephole ? data.cell_to[2][c] * cell : 0.0f));
+      new_output[b * n_output + c] = output_gate * std::tanh(cell);
+    }
+  }
+  output_state = new_output;
+}
+
+/**
+ * @brief Tensors of a LSTM layer, with float or int8 symmetric weights
+ */
+class LSTMTensors
+{
+public:
+  LSTMTensors(LSTMData &data, bool hybrid)
+  {
+    const ir::Shape input_shape{n_cell, n_input};
+    const ir::Shape recurrent_shape{n_cell, n_output};
+    const ir::Shape vector_shape{n_cell};
+    for (int g = 0; g < 4; ++g)
+    {
+      if (data.input_to[g].empty())
+        continue;
+      input_to[g] = makeWeights(input_shape, data.input_to[g], hybrid, _q_input_to[g]);
+      recurrent_to[g] =
+          makeWeights(recurrent_shape, data.recurrent_to[g], hybrid, _q_recurrent_to[g]);
+      bias[g] = makeTensor(vector_shape, data.bias[g]);
+    }
+    for (int g = 0; g < 3; ++g)
+    {
+      if (!data.cell_to[g].empty())
+        cell_to[g] = makeTensor(vector_shape, data.cell_to[g]);
+    }
+  }
+
+  kernel::LSTMWeightTensors weights() const
+  {
+    kernel::LSTMWeightTensors weights;
+    weights.input_to_input = input_to[0].get();
+    weights.input_to_forget = input_to[1].get();
+    weights.input_to_cell = input_to[2].get();
+    weights.input_to_output = input_to[3].get();
+    weights.recurrent_to_input = recurrent_to[0].get();
+    weights.recurrent_to_forget = recurrent_to[1].get();
+    weights.recurrent_to_cell = recurrent_to[2].get();
+    weights.recurrent_to_output = recurrent_to[3].get();
+    weights.cell_to_input = cell_to[0].get();
+    weights.cell_to_forget = cell_to[1].get();
+    weights.cell_to_output = cell_to[2].get();
+    weights.input_gate_bias = bias[0].get();
+    weights.forget_gate_bias = bias[1].get();
+    weights.cell_bias = bias[2].get();
+    weights.output_gate_bias = bias[3].get();
+    weights.projection_weights = nullptr;
+    weights.projection_bias = nullptr;
+    return weights;
+  }
+
+  std::vector<operand::Tensor *> tensors() const
+  {
+    std::vector<operand::Tensor *> tensors;
+    for (const auto *group : {input_to, recurrent_to, bias})
+    {
+      for (int g = 0; g < 4; ++g)
+      {
+        if (group[g])
+          tensors.emplace_back(group[g].get());
+      }
+    }
+    for (int g = 0; g < 3; ++g)
+    {
+      if (cell_to[g])
+        tensors.emplace_back(cell_to[g].get());
+    }
+    return tensors;
+  }
+
+private:
+  std::unique_ptr<operand::Tensor> makeWeights(const ir::Shape &shape, std::vector<float> &values,
+                                               bool hybrid, std::vector<int8_t> &quantized)
+  {
+    if (!hybrid)
+      return makeTensor(shape, values);
+    const float scale = quantizeSymmetric(values, quantized);
+    return makeTensor(shape, ir::DataType::QUANT8_SYMM, quantized, scale);
+  }
+
+private:
+  std::vector<int8_t> _q_input_to[4];
+  std::vector<int8_t> _q_recurrent_to[4];
+
+public:
+  std::unique_ptr<operand::Tensor> input_to[4];
+  std::unique_ptr<operand::Tensor> recurrent_to[4];
+  std::unique_ptr<operand::Tensor> bias[4];
+  std::unique_ptr<operand::Tensor> cell_to[3];
+};
+
+void runLSTM(bool cifg, bool peephole, bool hybrid, float tolerance)
+{
+  auto data = makeData(cifg, peephole);
+  LSTMTensors weights(data, hybrid);
+
+  auto input_data = makeValues(n_batch * n_input, 1.0f, 20);
+  auto output_state_in_data = makeValues(n_batch * n_output, 0.5f, 21);
+  auto cell_state_in_data = makeValues(n_batch * n_cell, 0.5f, 22);
+  std::vector<float> output_state_out_data(n_batch * n_output);
+  std::vector<float> cell_state_out_data(n_batch * n_cell);
+  std::vector<float> output_data(n_batch * n_output);
+
+  auto input = makeTensor(ir::Shape{n_batch, n_input}, input_data);
+  auto output_state_in = makeTensor(ir::Shape{n_batch, n_output}, output_state_in_data);
+  auto cell_state_in = makeTensor(ir::Shape{n_batch, n_cell}, cell_state_in_data);
+  auto output_state_out = makeTensor(ir::Shape{n_batch, n_output}, output_state_out_data);
+  auto cell_state_out = makeTensor(ir::Shape{n_batch, n_cell}, cell_state_out_data);
+  auto output = makeTensor(ir::Shape{n_batch, n_output}, output_data);
+
+  // Constant weights are referred by the layer like kernels generated by KernelGenerator
+  for (auto tensor : weights.tensors())
+    tensor->increase_ref();
+
+  kernel::LSTMLayer layer;
+  layer.configure(input.get(), weights.weights(), true, output_state_in.get(),
+                  cell_state_in.get(), ir::Activation::TANH, 0.0f, 0.0f, output_state_out.get(),
+                  cell_state_out.get(), output.get());
+
+  auto expected_output_state = output_state_in_data;
+  auto expected_cell_state = cell_state_in_data;
+  referenceLSTM(data, cifg, input_data, expected_output_state, expected_cell_state);
+
+  // Weights are stacked at the first run, and reused at the second one
+  for (int run = 0; run < 2; ++run)
+  {
+    layer.run();
+    for (int i = 0; i < n_batch * n_output; ++i)
+    {
+      EXPECT_NEAR(output_data[i], expected_output_state[i], tolerance);
+      EXPECT_NEAR(output_state_out_data[i], expected_output_state[i], tolerance);
+    }
+    for (int i = 0; i < n_batch * n_cell; ++i)
+      EXPECT_NEAR(cell_state_out_data[i], expected_cell_state[i], tolerance);
+
+    // Stacked weights are released
+    for (auto tensor : weights.tensors())
+      EXPECT_EQ(tensor->buffer(), nullptr);
+  }
+}
+
+} // namespace
+
+TEST(LSTMLayer, float32)
+{
+  runLSTM(/*cifg=*/false, /*peephole=*/false, /*hybrid=*/false, 1e-5f);
+}
+
+TEST(LSTMLayer, float32_cifg_peephole)
+{
+  runLSTM(/*cifg=*/true, /*peephole=*/true, /*hybrid=*/false, 1e-5f);
+}
+
+TEST(LSTMLayer, hybrid)
+{
+  // Weights and inputs are quantized to int8
+  runLSTM(/*cifg=*/false, /*peephole=*/true, /*hybrid=*/true, 2e-2f);
+}
+
+TEST(LSTMLayer, neg_unsupported_input_type)
+{
+  auto data = makeData(false, false);
+  LSTMTensors weights(data, false);
+
+  std::vector<uint8_t> input_data(n_batch * n_input);
+  std::vector<float> state_data(n_batch * n_cell);
+  std::vector<float> output_data(n_batch * n_output);
+  auto input = makeTensor(ir::Shape{n_batch, n_input}, ir::DataType::QUANT8_ASYMM, input_data,
+                          1.0f, 0);
+  auto state = makeTensor(ir::Shape{n_batch, n_cell}, state_data);
+  auto output = makeTensor(ir::Shape{n_batch, n_output}, output_data);
+
+  kernel::LSTMLayer layer;
+  layer.configure(input.get(), weights.weights(), true, state.get(), state.get(),
+                  ir::Activation::TANH, 0.0f, 0.0f, state.get(), state.get(), output.get());
+  EXPECT_ANY_THROW(layer.run());
+}
@@ -94,6 +94,30 @@ void GetQuantizedConvolutionMultiplier(const operand::Tensor *input, const opera
   *multiplier = input_product_scale / output_scale;
 }
 
+void GetQuantizedConvolutionMultipliersAndShifts(const operand::Tensor *input,
+                                                 const operand::Tensor *filter,
+                                                 const operand::Tensor *output, int num_channels,
+                                                 std::vector<int32_t> &multipliers,
+                                                 std::vector<int32_t> &shifts)
+{
+  const auto &filter_scales = filter->data_channel_scales();
+  if (!filter_scales.empty() && filter_scales.size() != static_cast<size_t>(num_channels))
+  {
+    throw std::runtime_error{"Number of filter scales does not match output channels"};
+  }
+
+  multipliers.resize(num_channels);
+  shifts.resize(num_channels);
+  for (int i = 0; i < num_channels; ++i)
+  {
+    const double filter_scale = filter_scales.empty() ? filter->data_scale() : filter_scales[i];
+    const double real_multiplier = input->data_scale() * filter_scale / output->data_scale();
+    int shift = 0;
+    QuantizeMultiplier(real_multiplier, &multipliers[i], &shift);
+    shifts[i] = shift;
+  }
+}
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift)
 {
@@ -145,11 +169,15 @@ void CalculateActivationRangeFloat(ir::Activation activation, float *activation_
   }
 }
 
-void CalculateActivationRangeUint8(ir::Activation activation, const operand::Tensor *output,
-                                   int32_t *act_min, int32_t *act_max)
+namespace
 {
-  const int32_t qmin = std::numeric_limits<uint8_t>::min();
-  const int32_t qmax = std::numeric_limits<uint8_t>::max();
+
+template <typename T>
+void calculateActivationRangeQuantized(ir::Activation activation, const operand::Tensor *output,
+                                       int32_t *act_min, int32_t *act_max)
+{
+  const int32_t qmin = std::numeric_limits<T>::min();
+  const int32_t qmax = std::numeric_limits<T>::max();
   const auto scale = output->data_scale();
   const auto zero_point = output->data_offset();
   auto quantize = [scale, zero_point](float f) {
@@ -186,6 +214,20 @@ void CalculateActivationRangeUint8(ir::Activation activation, const operand::Ten
   }
 }
 
+} // namespace
+
+void CalculateActivationRangeUint8(ir::Activation activation, const operand::Tensor *output,
+                                   int32_t *act_min, int32_t *act_max)
+{
+  calculateActivationRangeQuantized<uint8_t>(activation, output, act_min, act_max);
+}
+
+void CalculateActivationRangeInt8(ir::Activation activation, const operand::Tensor *output,
+                                  int32_t *act_min, int32_t *act_max)
+{
+  calculateActivationRangeQuantized<int8_t>(activation, output, act_min, act_max);
+}
+
 bool HaveSameShapes(const operand::Tensor *input1, const operand::Tensor *input2)
 {
   if (input1 == input2)
@@ -232,6 +274,7 @@ uint32_t sizeOfData(OperandType type, const std::vector<uint32_t> &dimensions)
     case OperandType::BOOL8:
     case OperandType::QUANT8_ASYMM:
     case OperandType::QUANT8_SYMM:
+    case OperandType::QUANT8_ASYMM_SIGNED:
       size = 1;
       break;
     default:
@@ -106,6 +106,10 @@ convertActivationType(const ir::Activation activation)
       return nnfw::cker::FusedActivationFunctionType::kRelu1;
     case ir::Activation::RELU6:
       return nnfw::cker::FusedActivationFunctionType::kRelu6;
+    case ir::Activation::TANH:
+      return nnfw::cker::FusedActivationFunctionType::kTanh;
+    case ir::Activation::SIGMOID:
+      return nnfw::cker::FusedActivationFunctionType::kSigmoid;
     default:
       throw std::runtime_error{"CPU backend: Cannot convert activation type"};
   }
@@ -137,6 +141,16 @@ void GetQuantizedConvolutionMultiplier(const operand::Tensor *inputDescr,
                                        const operand::Tensor *biasDescr,
                                        const operand::Tensor *outputDescr, double *multiplier);
 
+/**
+ * @brief Get quantized multipliers of each output channel of convolution, whose filter is
+ *        quantized per channel or per tensor
+ */
+void GetQuantizedConvolutionMultipliersAndShifts(const operand::Tensor *input,
+                                                 const operand::Tensor *filter,
+                                                 const operand::Tensor *output, int num_channels,
+                                                 std::vector<int32_t> &multipliers,
+                                                 std::vector<int32_t> &shifts);
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift);
 
@@ -146,6 +160,9 @@ void CalculateActivationRangeFloat(ir::Activation activation, float *activation_
 void CalculateActivationRangeUint8(ir::Activation activation, const operand::Tensor *output,
                                    int32_t *act_min, int32_t *act_max);
 
+void CalculateActivationRangeInt8(ir::Activation activation, const operand::Tensor *output,
+                                  int32_t *act_min, int32_t *act_max);
+
 bool HaveSameShapes(const operand::Tensor *input1, const operand::Tensor *input2);
 
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift);
@@ -154,6 +171,15 @@ uint32_t sizeOfData(OperandType type, const std::vector<uint32_t> &dimensions);
 
 nnfw::cker::PaddingType getPaddingType(ir::PaddingType ir_padding_type);
 
+/**
+ * @brief Whether a tensor holds float values in a narrower type (FLOAT16 or BFLOAT16)
+ */
+inline bool isNarrowedFloat(const operand::Tensor *tensor)
+{
+  return tensor->data_type() == OperandType::FLOAT16 ||
+         tensor->data_type() == OperandType::BFLOAT16;
+}
+
 } // namespace kernel
 } // namespace cpu
 } // namespace backend
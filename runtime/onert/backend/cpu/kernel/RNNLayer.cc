@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RNNLayer.h"
+
+#include <cker/operation/RNN.h>
+
+#include <cstring>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+RNNLayer::RNNLayer()
+    : _input(nullptr), _weights(nullptr), _recurrent_weights(nullptr), _bias(nullptr),
+      _hidden_state_in(nullptr), _output(nullptr), _hidden_state_out(nullptr),
+      _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::RecurrentTempArena())
+{
+  // DO NOTHING
+}
+
+RNNLayer::~RNNLayer() = default;
+
+void RNNLayer::rnnFloat32()
+{
+  nnfw::cker::RNNParams op_params;
+  op_params.activation = convertActivationType(_activation);
+  op_params.weights_scale = 1.0f;
+  op_params.recurrent_weights_scale = 1.0f;
+
+  nnfw::cker::RNN(op_params, /*n_time=*/1, _input->dimension(0), _input->dimension(1),
+                  _weights->dimension(0), reinterpret_cast<const float *>(_input->buffer()),
+                  reinterpret_cast<const float *>(_weights->buffer()),
+                  reinterpret_cast<const float *>(_recurrent_weights->buffer()),
+                  reinterpret_cast<const float *>(_bias->buffer()),
+                  reinterpret_cast<float *>(_hidden_state_out->buffer()),
+                  reinterpret_cast<float *>(_output->buffer()), *_temp_arena);
+}
+
+void RNNLayer::rnnHybrid()
+{
+  nnfw::cker::RNNParams op_params;
+  op_params.activation = convertActivationType(_activation);
+  op_params.weights_scale = _weights->data_scale();
+  op_params.recurrent_weights_scale = _recurrent_weights->data_scale();
+
+  nnfw::cker::RNN(op_params, /*n_time=*/1, _input->dimension(0), _input->dimension(1),
+                  _weights->dimension(0), reinterpret_cast<const float *>(_input->buffer()),
+                  reinterpret_cast<const int8_t *>(_weights->buffer()),
+                  reinterpret_cast<const int8_t *>(_recurrent_weights->buffer()),
+                  reinterpret_cast<const float *>(_bias->buffer()),
+                  reinterpret_cast<float *>(_hidden_state_out->buffer()),
+                  reinterpret_cast<float *>(_output->buffer()), *_temp_arena);
+}
+
+void RNNLayer::configure(const operand::Tensor *input, const operand::Tensor *weights,
+                         const operand::Tensor *recurrent_weights, const operand::Tensor *bias,
+                         const operand::Tensor *hidden_state_in, ir::Activation activation,
+                         operand::Tensor *output, operand::Tensor *hidden_state_out)
+{
+  _input = input;
+  _weights = weights;
+  _recurrent_weights = recurrent_weights;
+  _bias = bias;
+  _hidden_state_in = hidden_state_in;
+  _activation = activation;
+  _output = output;
+  _hidden_state_out = hidden_state_out;
+}
+
+void RNNLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+  {
+    throw std::runtime_error{"RNN: unsupported data type"};
+  }
+
+  // Hidden state is updated in place in the output hidden state
+  if (_hidden_state_in->buffer() != _hidden_state_out->buffer())
+  {
+    std::memcpy(_hidden_state_out->buffer(), _hidden_state_in->buffer(),
+                _hidden_state_in->total_size());
+  }
+
+  if (_weights->data_type() == OperandType::QUANT8_SYMM)
+  {
+    rnnHybrid();
+  }
+  else
+  {
+    rnnFloat32();
+  }
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_KERNEL_RNNLAYER_H__
+#define __ONERT_BACKEND_CPU_KERNEL_RNNLAYER_H__
+
+#include "../operand/Tensor.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+namespace nnfw
+{
+namespace cker
+{
+class RecurrentTempArena;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+class RNNLayer : public ::onert::exec::IFunction
+{
+public:
+  RNNLayer();
+  ~RNNLayer();
+
+public:
+  void rnnFloat32();
+
+  void rnnHybrid();
+
+  void configure(const operand::Tensor *input, const operand::Tensor *weights,
+                 const operand::Tensor *recurrent_weights, const operand::Tensor *bias,
+                 const operand::Tensor *hidden_state_in, ir::Activation activation,
+                 operand::Tensor *output, operand::Tensor *hidden_state_out);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  const operand::Tensor *_input;
+  const operand::Tensor *_weights;
+  const operand::Tensor *_recurrent_weights;
+  const operand::Tensor *_bias;
+  const operand::Tensor *_hidden_state_in;
+  operand::Tensor *_output;
+  operand::Tensor *_hidden_state_out;
+
+  ir::Activation _activation;
+  std::unique_ptr<nnfw::cker::RecurrentTempArena> _temp_arena;
+};
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_KERNEL_RNNLAYER_H__
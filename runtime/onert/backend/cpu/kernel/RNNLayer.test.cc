@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "RNNLayer.h"
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+constexpr int n_batch = 2;
+constexpr int n_input = 5;
+constexpr int n_units = 4;
+
+void runRNN(bool hybrid, float tolerance)
+{
+  auto weights_data = makeValues(n_units * n_input, 0.5f, 1);
+  auto recurrent_data = makeValues(n_units * n_units, 0.5f, 2);
+  auto bias_data = makeValues(n_units, 0.2f, 3);
+  auto input_data = makeValues(n_batch * n_input, 1.0f, 4);
+  auto hidden_in_data = makeValues(n_batch * n_units, 0.5f, 5);
+  std::vector<float> hidden_out_data(n_batch * n_units);
+  std::vector<float> output_data(n_batch * n_units);
+
+  std::vector<int8_t> q_weights_data;
+  std::vector<int8_t> q_recurrent_data;
+  std::unique_ptr<operand::Tensor> weights;
+  std::unique_ptr<operand::Tensor> recurrent;
+  if (hybrid)
+  {
+    const float weights_scale = quantizeSymmetric(weights_data, q_weights_data);
+    const float recurrent_scale = quantizeSymmetric(recurrent_data, q_recurrent_data);
+    weights = makeTensor(ir::Shape{n_units, n_input}, ir::DataType::QUANT8_SYMM, q_weights_data,
+                         weights_scale);
+    recurrent = makeTensor(ir::Shape{n_units, n_units}, ir::DataType::QUANT8_SYMM,
+                           q_recurrent_data, recurrent_scale);
+  }
+  else
+  {
+    weights = makeTensor(ir::Shape{n_units, n_input}, weights_data);
+    recurrent = makeTensor(ir::Shape{n_units, n_units}, recurrent_data);
+  }
+  auto bias = makeTensor(ir::Shape{n_units}, bias_data);
+  auto input = makeTensor(ir::Shape{n_batch, n_input}, input_data);
+  auto hidden_in = makeTensor(ir::Shape{n_batch, n_units}, hidden_in_data);
+  auto hidden_out = makeTensor(ir::Shape{n_batch, n_units}, hidden_out_data);
+  auto output = makeTensor(ir::Shape{n_batch, n_units}, output_data);
+
+  kernel::RNNLayer layer;
+  layer.configure(input.get(), weights.get(), recurrent.get(), bias.get(), hidden_in.get(),
+                  ir::Activation::TANH, output.get(), hidden_out.get());
+  layer.run();
+
+  for (int b = 0; b < n_batch; ++b)
+  {
+    for (int u = 0; u < n_units; ++u)
+    {
+      float sum = bias_data[u];
+      for (int i = 0; i < n_input; ++i)
+        sum += weights_data[u * n_input + i] * input_data[b * n_input + i];
+      for (int h = 0; h < n_units; ++h)
+        sum += recurrent_data[u * n_units + h] * hidden_in_data[b * n_units + h];
+      const float expected = std::tanh(sum);
+      EXPECT_NEAR(output_data[b * n_units + u], expected, tolerance);
+      EXPECT_NEAR(hidden_out_data[b * n_units + u], expected, tolerance);
+    }
+  }
+}
+
+} // namespace
+
+TEST(RNNLayer, float32) { runRNN(/*hybrid=*/false, 1e-5f); }
+
+TEST(RNNLayer, hybrid)
+{
+  // Weights and inputs are quantized to int8
+  runRNN(/*hybrid=*/true, 2e-2f);
+}
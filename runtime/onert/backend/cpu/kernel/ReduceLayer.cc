@@ -32,10 +32,9 @@ namespace kernel
 namespace
 {
 
-template <typename T>
+template <typename T, typename Reducer>
 void evalLogic(const operand::Tensor *input, operand::Tensor *output, const std::vector<int> &axes,
-               bool keep_dims, T init_value, nnfw::cker::Reduce &reduce_kernel,
-               T reducer(const T current, const T in))
+               bool keep_dims, T init_value, nnfw::cker::Reduce &reduce_kernel, Reducer reducer)
 {
   reduce_kernel.prepare(input->num_dimensions(), axes.size());
   bool result = reduce_kernel.ReduceGeneric<T>(
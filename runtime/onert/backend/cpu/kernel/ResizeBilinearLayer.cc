@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ResizeBilinearLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/ResizeBilinear.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+void ResizeBilinearLayer::run()
+{
+  // Output size is given by the output shape
+  nnfw::cker::ResizeBilinearParams op_params;
+  op_params.align_corners = false;
+  op_params.half_pixel_centers = false;
+
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      nnfw::cker::ResizeBilinear<float>(
+          op_params, convertTensorToCkerShape(_input),
+          reinterpret_cast<const float *>(_input->buffer()), convertTensorToCkerShape(_output),
+          reinterpret_cast<float *>(_output->buffer()));
+      break;
+    case OperandType::QUANT8_ASYMM:
+      nnfw::cker::ResizeBilinear<uint8_t>(
+          op_params, convertTensorToCkerShape(_input),
+          reinterpret_cast<const uint8_t *>(_input->buffer()), convertTensorToCkerShape(_output),
+          reinterpret_cast<uint8_t *>(_output->buffer()));
+      break;
+    default:
+      throw std::runtime_error{"ResizeBilinear: unsupported data type"};
+  }
+}
+
+void ResizeBilinearLayer::configure(const operand::Tensor *input, operand::Tensor *output)
+{
+  _input = input;
+  _output = output;
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ResizeBilinearLayer.h"
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+constexpr int batches = 2;
+constexpr int depth = 3;
+
+// Bilinear interpolation of each output element without align_corners nor half_pixel_centers
+std::vector<float> resizeBilinear(const std::vector<float> &input, int in_h, int in_w, int out_h,
+                                  int out_w)
+{
+  const float scale_h = static_cast<float>(in_h) / out_h;
+  const float scale_w = static_cast<float>(in_w) / out_w;
+  auto at = [&](int b, int y, int x, int c) {
+    return input[((b * in_h + y) * in_w + x) * depth + c];
+  };
+
+  std::vector<float> output(batches * out_h * out_w * depth);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int y = 0; y < out_h; ++y)
+    {
+      const float in_y = y * scale_h;
+      const int y0 = std::floor(in_y);
+      const int y1 = std::min(static_cast<int>(std::ceil(in_y)), in_h - 1);
+      const float dy = in_y - y0;
+      for (int x = 0; x < out_w; ++x)
+      {
+        const float in_x = x * scale_w;
+        const int x0 = std::floor(in_x);
+        const int x1 = std::min(static_cast<int>(std::ceil(in_x)), in_w - 1);
+        const float dx = in_x - x0;
+        for (int c = 0; c < depth; ++c)
+        {
+          output[((b * out_h + y) * out_w + x) * depth + c] =
+              at(b, y0, x0, c) * (1 - dy) * (1 - dx) + at(b, y0, x1, c) * (1 - dy) * dx +
+              at(b, y1, x0, c) * dy * (1 - dx) + at(b, y1, x1, c) * dy * dx;
+        }
+      }
+    }
+  }
+  return output;
+}
+
+void runResizeBilinear(int in_h, int in_w, int out_h, int out_w)
+{
+  auto input_data = makeValues(batches * in_h * in_w * depth, 1.0f, 1);
+  std::vector<float> output_data(batches * out_h * out_w * depth);
+  auto input = makeTensor(ir::Shape{batches, in_h, in_w, depth}, input_data);
+  auto output = makeTensor(ir::Shape{batches, out_h, out_w, depth}, output_data);
+
+  kernel::ResizeBilinearLayer layer;
+  layer.configure(input.get(), output.get());
+  layer.run();
+
+  const auto expected = resizeBilinear(input_data, in_h, in_w, out_h, out_w);
+  for (size_t i = 0; i < output_data.size(); ++i)
+    EXPECT_NEAR(output_data[i], expected[i], 1e-5f) << "at " << i;
+}
+
+} // namespace
+
+TEST(ResizeBilinearLayer, upscale) { runResizeBilinear(3, 4, 7, 9); }
+
+TEST(ResizeBilinearLayer, downscale) { runResizeBilinear(8, 6, 3, 4); }
+
+TEST(ResizeBilinearLayer, same_size) { runResizeBilinear(4, 5, 4, 5); }
+
+TEST(ResizeBilinearLayer, quant8)
+{
+  constexpr int in_h = 3, in_w = 4, out_h = 5, out_w = 7;
+  std::vector<uint8_t> input_data(batches * in_h * in_w * depth);
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = (i * 37) % 256;
+  std::vector<uint8_t> output_data(batches * out_h * out_w * depth);
+  auto input = makeTensor(ir::Shape{batches, in_h, in_w, depth}, ir::DataType::QUANT8_ASYMM,
+                          input_data, 1.0f, 0);
+  auto output = makeTensor(ir::Shape{batches, out_h, out_w, depth}, ir::DataType::QUANT8_ASYMM,
+                           output_data, 1.0f, 0);
+
+  kernel::ResizeBilinearLayer layer;
+  layer.configure(input.get(), output.get());
+  layer.run();
+
+  const auto expected =
+      resizeBilinear(std::vector<float>(input_data.begin(), input_data.end()), in_h, in_w, out_h,
+                     out_w);
+  for (size_t i = 0; i < output_data.size(); ++i)
+    EXPECT_NEAR(output_data[i], std::round(expected[i]), 1.0f) << "at " << i;
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SpaceToBatchNDLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/SpaceToBatchND.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+template <typename T> void SpaceToBatchNDLayer::spaceToBatchND()
+{
+  nnfw::cker::SpaceToBatchParams op_params;
+  // Padding of quantized tensor is the zero point
+  op_params.output_offset =
+      _output->data_type() == OperandType::QUANT8_ASYMM ? _output->data_offset() : 0;
+
+  nnfw::cker::SpaceToBatchND<T>(
+      op_params, convertTensorToCkerShape(_input), reinterpret_cast<const T *>(_input->buffer()),
+      reinterpret_cast<const int32_t *>(_block_shape->buffer()),
+      reinterpret_cast<const int32_t *>(_paddings->buffer()), convertTensorToCkerShape(_output),
+      reinterpret_cast<T *>(_output->buffer()));
+}
+
+void SpaceToBatchNDLayer::configure(const operand::Tensor *input,
+                                    const operand::Tensor *block_shape,
+                                    const operand::Tensor *paddings, operand::Tensor *output)
+{
+  _input = input;
+  _block_shape = block_shape;
+  _paddings = paddings;
+  _output = output;
+}
+
+void SpaceToBatchNDLayer::run()
+{
+  if (_input->num_dimensions() != 4)
+  {
+    throw std::runtime_error{"SpaceToBatchND: only 4D input is supported"};
+  }
+
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      spaceToBatchND<float>();
+      break;
+    case OperandType::INT32:
+      spaceToBatchND<int32_t>();
+      break;
+    case OperandType::QUANT8_ASYMM:
+      spaceToBatchND<uint8_t>();
+      break;
+    default:
+      throw std::runtime_error{"SpaceToBatchND: unsupported data type"};
+  }
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SpaceToDepthLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/SpaceToDepth.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+template <typename T> void SpaceToDepthLayer::spaceToDepth()
+{
+  nnfw::cker::SpaceToDepth<T>(convertTensorToCkerShape(_input),
+                              reinterpret_cast<const T *>(_input->buffer()),
+                              convertTensorToCkerShape(_output),
+                              reinterpret_cast<T *>(_output->buffer()), _block_size);
+}
+
+void SpaceToDepthLayer::configure(const operand::Tensor *input, const int32_t block_size,
+                                  operand::Tensor *output)
+{
+  _input = input;
+  _block_size = block_size;
+  _output = output;
+}
+
+void SpaceToDepthLayer::run()
+{
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      spaceToDepth<float>();
+      break;
+    case OperandType::INT32:
+      spaceToDepth<int32_t>();
+      break;
+    case OperandType::QUANT8_ASYMM:
+      spaceToDepth<uint8_t>();
+      break;
+    default:
+      throw std::runtime_error{"SpaceToDepth: unsupported data type"};
+  }
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
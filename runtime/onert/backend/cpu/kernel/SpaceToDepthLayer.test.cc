@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SpaceToDepthLayer.h"
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+constexpr int batches = 2;
+constexpr int depth = 3;
+
+template <typename T> void runSpaceToDepth(ir::DataType type, int block_size)
+{
+  const int out_h = 3;
+  const int out_w = 2;
+  const int in_h = out_h * block_size;
+  const int in_w = out_w * block_size;
+  const int out_depth = depth * block_size * block_size;
+
+  std::vector<T> input_data(batches * in_h * in_w * depth);
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<T>(i % 251);
+  std::vector<T> output_data(input_data.size());
+  auto input = makeTensor(ir::Shape{batches, in_h, in_w, depth}, type, input_data);
+  auto output = makeTensor(ir::Shape{batches, out_h, out_w, out_depth}, type, output_data);
+
+  kernel::SpaceToDepthLayer layer;
+  layer.configure(input.get(), block_size, output.get());
+  layer.run();
+
+  // Each block of input pixels is stacked along the depth in row-major order
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int y = 0; y < in_h; ++y)
+    {
+      for (int x = 0; x < in_w; ++x)
+      {
+        for (int c = 0; c < depth; ++c)
+        {
+          const int out_c = ((y % block_size) * block_size + x % block_size) * depth + c;
+          const int out_index =
+              ((b * out_h + y / block_size) * out_w + x / block_size) * out_depth + out_c;
+          EXPECT_EQ(output_data[out_index], input_data[((b * in_h + y) * in_w + x) * depth + c]);
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(SpaceToDepthLayer, float32)
+{
+  runSpaceToDepth<float>(ir::DataType::FLOAT32, 2);
+  runSpaceToDepth<float>(ir::DataType::FLOAT32, 3);
+}
+
+TEST(SpaceToDepthLayer, int32) { runSpaceToDepth<int32_t>(ir::DataType::INT32, 2); }
+
+TEST(SpaceToDepthLayer, quant8) { runSpaceToDepth<uint8_t>(ir::DataType::QUANT8_ASYMM, 2); }
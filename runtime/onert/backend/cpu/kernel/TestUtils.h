@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __ONERT_BACKEND_CPU_KERNEL_TEST_UTILS_H__
+#define __ONERT_BACKEND_CPU_KERNEL_TEST_UTILS_H__
+
+#include "../operand/Tensor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+namespace test
+{
+
+/**
+ * @brief Make a tensor of a kernel test on the data given, which must outlive the tensor
+ */
+template <typename T>
+std::unique_ptr<operand::Tensor> makeTensor(const ir::Shape &shape, ir::DataType type,
+                                            std::vector<T> &data, float scale = 0.0f,
+                                            int32_t offset = 0)
+{
+  auto tensor = std::make_unique<operand::Tensor>(
+      ir::OperandInfo(shape, ir::TypeInfo(type, scale, offset), ir::MemAllocType::STATIC));
+  tensor->setBuffer(reinterpret_cast<uint8_t *>(data.data()));
+  return tensor;
+}
+
+template <typename T>
+std::unique_ptr<operand::Tensor> makeTensor(const ir::Shape &shape, std::vector<T> &data)
+{
+  return makeTensor(shape, ir::DataType::FLOAT32, data);
+}
+
+/**
+ * @brief Values of a simple pattern in [-range, range], which differ from each other
+ */
+inline std::vector<float> makeValues(size_t size, float range = 1.0f, int seed = 0)
+{
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; ++i)
+    values[i] = range * (static_cast<float>((i * 37 + seed * 11) % 97) / 48.0f - 1.0f);
+  return values;
+}
+
+/**
+ * @brief Quantize values to int8 symmetrically, and return the scale
+ */
+inline float quantizeSymmetric(const std::vector<float> &values, std::vector<int8_t> &quantized)
+{
+  float range = 0.0f;
+  for (const auto value : values)
+    range = std::max(range, std::abs(value));
+  const float scale = range == 0.0f ? 1.0f : range / 127.0f;
+  quantized.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i)
+    quantized[i] = static_cast<int8_t>(std::round(values[i] / scale));
+  return scale;
+}
+
+/**
+ * @brief Make a tensor of int8 values with a scale of each channel, for per-channel quantization
+ */
+inline std::unique_ptr<operand::Tensor> makePerChannelTensor(const ir::Shape &shape,
+                                                             std::vector<int8_t> &data,
+                                                             const std::vector<float> &scales)
+{
+  ir::TypeInfo type_info(ir::DataType::QUANT8_ASYMM_SIGNED, 0.0f, 0);
+  type_info.channel_scales(scales);
+  auto tensor = std::make_unique<operand::Tensor>(
+      ir::OperandInfo(shape, type_info, ir::MemAllocType::STATIC));
+  tensor->setBuffer(reinterpret_cast<uint8_t *>(data.data()));
+  return tensor;
+}
+
+/**
+ * @brief Quantize values to int8 with a zero point over their range, which includes zero
+ */
+inline void quantizeAsymmetric(const std::vector<float> &values, std::vector<int8_t> &quantized,
+                               float &scale, int32_t &zero_point)
+{
+  float min = 0.0f;
+  float max = 0.0f;
+  for (const auto value : values)
+  {
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+  scale = max == min ? 1.0f : (max - min) / 255.0f;
+  zero_point = static_cast<int32_t>(std::round(-128.0f - min / scale));
+  quantized.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    const float value = std::round(values[i] / scale) + zero_point;
+    quantized[i] = static_cast<int8_t>(std::max(-128.0f, std::min(127.0f, value)));
+  }
+}
+
+/**
+ * @brief Quantize values to int8 symmetrically with a scale of each channel, and return scales
+ *
+ * @param channel_last Whether channel is the last dimension, or the first one otherwise
+ */
+inline std::vector<float> quantizeSymmetricPerChannel(const std::vector<float> &values,
+                                                      size_t num_channels, bool channel_last,
+                                                      std::vector<int8_t> &quantized)
+{
+  const size_t channel_size = values.size() / num_channels;
+  auto channel_of = [&](size_t i) { return channel_last ? i % num_channels : i / channel_size; };
+
+  std::vector<float> scales(num_channels, 0.0f);
+  for (size_t i = 0; i < values.size(); ++i)
+    scales[channel_of(i)] = std::max(scales[channel_of(i)], std::abs(values[i]));
+  for (auto &scale : scales)
+    scale = scale == 0.0f ? 1.0f : scale / 127.0f;
+
+  quantized.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i)
+    quantized[i] = static_cast<int8_t>(std::round(values[i] / scales[channel_of(i)]));
+  return scales;
+}
+
+/**
+ * @brief Round values to a 2-byte float type, ir::float16 or nnfw::cker::BFloat16
+ */
+template <typename T> std::vector<T> narrowValues(const std::vector<float> &values)
+{
+  std::vector<T> narrowed;
+  narrowed.reserve(values.size());
+  for (const auto value : values)
+    narrowed.emplace_back(value);
+  return narrowed;
+}
+
+template <typename T> std::vector<float> widenValues(const std::vector<T> &values)
+{
+  std::vector<float> widened;
+  widened.reserve(values.size());
+  for (const auto value : values)
+    widened.push_back(static_cast<float>(value));
+  return widened;
+}
+
+} // namespace test
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_KERNEL_TEST_UTILS_H__
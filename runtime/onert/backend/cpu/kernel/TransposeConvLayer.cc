@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/optimized/TransposeConv.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+TransposeConvLayer::TransposeConvLayer()
+    : _input(nullptr), _kernel(nullptr), _constant_kernel(false), _output(nullptr),
+      _paddingLeft(0), _paddingTop(0), _strideWidth(0), _strideHeight(0), _prepared(false)
+{
+  // DO NOTHING
+}
+
+void TransposeConvLayer::transposeConvFloat32()
+{
+  const auto kernel_shape = convertTensorToCkerShape(_kernel);
+  if (!_prepared || !_constant_kernel)
+  {
+    // Kernel is reordered so that products of all its taps are computed by one GEMM. A constant
+    // kernel is reordered only once, and others are reordered on every run.
+    nnfw::cker::optimized::TransposeConvPrepareFilter(
+        kernel_shape, reinterpret_cast<const float *>(_kernel->buffer()), _prepared_kernel);
+    _prepared = true;
+  }
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+
+  nnfw::cker::optimized::TransposeConv(
+      op_params, convertTensorToCkerShape(_input),
+      reinterpret_cast<const float *>(_input->buffer()), kernel_shape, _prepared_kernel.data(),
+      convertTensorToCkerShape(_output), reinterpret_cast<float *>(_output->buffer()),
+      _col_buffer);
+}
+
+void TransposeConvLayer::configure(const operand::Tensor *input, const operand::Tensor *kernel,
+                                   bool constant_kernel, const uint32_t paddingLeft, const uint32_t paddingTop,
+                                   const uint32_t strideWidth, const uint32_t strideHeight,
+                                   operand::Tensor *output)
+{
+  _input = input;
+  _kernel = kernel;
+  _constant_kernel = constant_kernel;
+  _paddingLeft = paddingLeft;
+  _paddingTop = paddingTop;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _output = output;
+}
+
+void TransposeConvLayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    transposeConvFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+  }
+}
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
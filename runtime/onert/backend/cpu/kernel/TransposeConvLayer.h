@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_KERNEL_TRANSPOSECONVLAYER_H__
+#define __ONERT_BACKEND_CPU_KERNEL_TRANSPOSECONVLAYER_H__
+
+#include "../operand/Tensor.h"
+
+#include <exec/IFunction.h>
+
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace kernel
+{
+
+class TransposeConvLayer : public ::onert::exec::IFunction
+{
+public:
+  TransposeConvLayer();
+
+public:
+  void transposeConvFloat32();
+
+  void configure(const operand::Tensor *input, const operand::Tensor *kernel,
+                 bool constant_kernel, const uint32_t paddingLeft, const uint32_t paddingTop, const uint32_t strideW,
+                 const uint32_t strideH, operand::Tensor *output);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  const operand::Tensor *_input;
+  const operand::Tensor *_kernel;
+  bool _constant_kernel;
+  operand::Tensor *_output;
+
+  uint32_t _paddingLeft;
+  uint32_t _paddingTop;
+  uint32_t _strideWidth;
+  uint32_t _strideHeight;
+
+  bool _prepared;
+  std::vector<float> _prepared_kernel;
+  std::vector<float> _col_buffer;
+};
+
+} // namespace kernel
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_KERNEL_TRANSPOSECONVLAYER_H__
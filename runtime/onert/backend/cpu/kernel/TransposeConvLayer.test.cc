@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+#include "TestUtils.h"
+
+#include <cker/operation/TransposeConv.h>
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::cpu;
+using namespace onert::backend::cpu::kernel::test;
+
+namespace
+{
+
+constexpr int input_size = 4;
+constexpr int input_depth = 3;
+constexpr int output_depth = 5;
+constexpr int filter_size = 3;
+
+struct TransposeConvCase
+{
+  int stride;
+  int padding;
+};
+
+class TransposeConvLayerTest : public ::testing::TestWithParam<TransposeConvCase>
+{
+protected:
+  void SetUp() override
+  {
+    const auto &param = GetParam();
+    const int output_size = (input_size - 1) * param.stride + filter_size - 2 * param.padding;
+    input_shape = ir::Shape{2, input_size, input_size, input_depth};
+    filter_shape = ir::Shape{output_depth, filter_size, filter_size, input_depth};
+    output_shape = ir::Shape{2, output_size, output_size, output_depth};
+
+    input_data = makeValues(input_shape.num_elements(), 1.0f, 1);
+    filter_data = makeValues(filter_shape.num_elements(), 0.5f, 2);
+    output_data.resize(output_shape.num_elements());
+  }
+
+  // Scatter kernel of cker, which the layer must match
+  std::vector<float> reference() const
+  {
+    const auto &param = GetParam();
+    nnfw::cker::TransposeConvParams op_params;
+    op_params.padding_values.width = param.padding;
+    op_params.padding_values.height = param.padding;
+    op_params.stride_width = param.stride;
+    op_params.stride_height = param.stride;
+
+    std::vector<float> expected(output_shape.num_elements());
+    nnfw::cker::TransposeConv(op_params, toCkerShape(input_shape), input_data.data(),
+                              toCkerShape(filter_shape), filter_data.data(),
+                              toCkerShape(output_shape), expected.data());
+    return expected;
+  }
+
+  void expectReference()
+  {
+    const auto expected = reference();
+    for (size_t i = 0; i < output_data.size(); ++i)
+      EXPECT_NEAR(output_data[i], expected[i], 1e-5f) << "at " << i;
+  }
+
+  static nnfw::cker::Shape toCkerShape(const ir::Shape &shape)
+  {
+    return nnfw::cker::Shape{shape.dim(0), shape.dim(1), shape.dim(2), shape.dim(3)};
+  }
+
+  ir::Shape input_shape;
+  ir::Shape filter_shape;
+  ir::Shape output_shape;
+  std::vector<float> input_data;
+  std::vector<float> filter_data;
+  std::vector<float> output_data;
+};
+
+} // namespace
+
+TEST_P(TransposeConvLayerTest, constant_kernel)
+{
+  const auto &param = GetParam();
+  auto input = makeTensor(input_shape, input_data);
+  auto filter = makeTensor(filter_shape, filter_data);
+  auto output = makeTensor(output_shape, output_data);
+
+  kernel::TransposeConvLayer layer;
+  layer.configure(input.get(), filter.get(), true, param.padding, param.padding, param.stride,
+                  param.stride, output.get());
+  layer.run();
+  expectReference();
+
+  // Input changes between runs while the reordered kernel is reused
+  const auto new_input_data = makeValues(input_shape.num_elements(), 2.0f, 4);
+  std::copy(new_input_data.begin(), new_input_data.end(), input_data.begin());
+  layer.run();
+  expectReference();
+}
+
+TEST_P(TransposeConvLayerTest, non_constant_kernel)
+{
+  const auto &param = GetParam();
+  auto input = makeTensor(input_shape, input_data);
+  auto filter = makeTensor(filter_shape, filter_data);
+  auto output = makeTensor(output_shape, output_data);
+
+  kernel::TransposeConvLayer layer;
+  layer.configure(input.get(), filter.get(), false, param.padding, param.padding, param.stride,
+                  param.stride, output.get());
+  layer.run();
+  expectReference();
+
+  // Kernel computed by another operation changes between runs
+  const auto new_filter_data = makeValues(filter_shape.num_elements(), 1.5f, 5);
+  std::copy(new_filter_data.begin(), new_filter_data.end(), filter_data.begin());
+  layer.run();
+  expectReference();
+}
+
+INSTANTIATE_TEST_CASE_P(TransposeConvLayer, TransposeConvLayerTest,
+                        ::testing::Values(TransposeConvCase{1, 0}, TransposeConvCase{1, 1},
+                                          TransposeConvCase{2, 0}, TransposeConvCase{2, 1},
+                                          TransposeConvCase{3, 1}));
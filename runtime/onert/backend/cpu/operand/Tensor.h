@@ -20,6 +20,7 @@
 #include "Allocator.h"
 
 #include <backend/ITensor.h>
+#include <ir/Data.h>
 #include <ir/OperandInfo.h>
 
 namespace onert
@@ -38,29 +39,38 @@ public:
 
 public:
   Tensor(const ir::OperandInfo &info)
-      : _info(info), _buffer(nullptr), _num_references(0), _allocator(nullptr)
+      : _info(info), _buffer(nullptr), _num_references(0), _allocator(nullptr), _data(nullptr)
   {
     // DO NOTHING
   }
 
 public:
-  // Only one of two method 'setBuffer' must be called once
+  // Only one of the methods 'setBuffer' must be called once
   void setBuffer(uint8_t *buffer)
   {
-    assert(_buffer == nullptr && _allocator == nullptr);
+    assert(_buffer == nullptr && _allocator == nullptr && _data == nullptr);
     _buffer = buffer;
   }
   void setBuffer(const std::shared_ptr<cpu_common::Allocator> &alloc)
   {
-    assert(_buffer == nullptr && _allocator == nullptr);
+    assert(_buffer == nullptr && _allocator == nullptr && _data == nullptr);
     _allocator = alloc;
   }
+  // Constant tensor referring to data of the model, which must not be written
+  void setBuffer(const std::shared_ptr<const ir::Data> &data)
+  {
+    assert(_buffer == nullptr && _allocator == nullptr && _data == nullptr);
+    _data = data;
+  }
 
 public:
   uint8_t *buffer() const override
   {
     if (_allocator != nullptr)
       return _allocator->base();
+    else if (_data != nullptr)
+      // TODO Remove const_cast
+      return const_cast<uint8_t *>(_data->base());
     else
       return _buffer;
   }
@@ -82,6 +92,10 @@ public:
   ir::DataType data_type() const override { return _info.typeInfo().type(); }
   float data_scale() const { return _info.typeInfo().scale(); }
   int32_t data_offset() const { return _info.typeInfo().offset(); }
+  const std::vector<float> &data_channel_scales() const
+  {
+    return _info.typeInfo().channel_scales();
+  }
   bool has_padding() const override { return false; }
   void access(const std::function<void(ITensor &tensor)> &fn) final;
   bool is_dynamic() const override { return _info.isDynamic(); }
@@ -91,20 +105,23 @@ public:
   {
     assert(is_dynamic() ||
            // when not dynamic
-           (_buffer != nullptr || _allocator != nullptr));
+           (_buffer != nullptr || _allocator != nullptr || _data != nullptr));
 
     ++_num_references;
   }
   void decrease_ref()
   {
-    assert(_buffer != nullptr || _allocator != nullptr);
+    assert(_buffer != nullptr || _allocator != nullptr || _data != nullptr);
     assert(_num_references > 0);
     --_num_references;
-    // Only constant tensor has allocator pointer
+    // Only constant tensor has allocator pointer or data
     if (_num_references == 0)
     {
       if (_buffer != nullptr)
         _buffer = nullptr;
+      else if (_data != nullptr)
+        // Data may still be referred by tensors of other executions
+        _data = nullptr;
       else
       {
         _allocator->release();
@@ -136,6 +153,7 @@ private:
   uint8_t *_buffer;
   int32_t _num_references;
   std::shared_ptr<cpu_common::Allocator> _allocator;
+  std::shared_ptr<const ir::Data> _data;
 };
 
 } // namespace operand
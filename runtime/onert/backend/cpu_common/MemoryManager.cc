@@ -20,6 +20,7 @@
 
 #include <MemoryPlannerFactory.h>
 #include "util/ConfigSource.h"
+#include "util/logging.h"
 
 namespace onert
 {
@@ -61,6 +62,8 @@ void MemoryManager::allocate(void)
 {
   _mem_alloc = std::make_shared<cpu_common::Allocator>(_mem_planner->capacity());
   assert(_mem_alloc->base());
+  VERBOSE(MemoryManager) << "Capacity of planned memory: " << _mem_planner->capacity() << " bytes"
+                         << std::endl;
 }
 
 uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
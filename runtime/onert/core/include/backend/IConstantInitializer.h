@@ -171,6 +171,9 @@ public:
       const auto &model_obj = _operands.at(ind);
       auto tensor_obj = tensor_builder()->tensorAt(ind);
       assert(tensor_obj != nullptr);
+      // Tensor referring to the data of the model already has the values
+      if (model_obj.data() && tensor_obj->buffer() == model_obj.data()->base())
+        continue;
       fn(model_obj, *tensor_obj);
       VERBOSE(FillOperandData) << "Fill data for operand " << ind.value() << std::endl;
     }
@@ -222,6 +225,7 @@ public:
         _init_map[index] = copyInit<uint8_t>;
         break;
       case DataType::QUANT8_SYMM:
+      case DataType::QUANT8_ASYMM_SIGNED:
         _init_map[index] = copyInit<int8_t>;
         break;
       case DataType::FLOAT16:
@@ -262,6 +266,7 @@ public:
         _init_map[index] = std::bind(permuteInit<uint8_t>, _1, _2, _current_op_seq_layout);
         break;
       case DataType::QUANT8_SYMM:
+      case DataType::QUANT8_ASYMM_SIGNED:
         _init_map[index] = std::bind(permuteInit<int8_t>, _1, _2, _current_op_seq_layout);
         break;
       case DataType::FLOAT16:
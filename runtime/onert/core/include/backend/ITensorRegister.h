@@ -80,10 +80,13 @@ protected:
 protected:
   ir::Layout frontendLayout() const { return _current_op_seq_layout; }
   ir::Layout backendLayout(const ir::OperandIndex &index) const
+  {
+    return lowerInfo(index)->def_factors().getOnlyElement().layout();
+  }
+  const ir::operand::LowerInfo *lowerInfo(const ir::OperandIndex &index) const
   {
     assert(_lower_info_map != nullptr);
-    const auto lower_info = _lower_info_map->operand.at(index).get();
-    return lower_info->def_factors().getOnlyElement().layout();
+    return _lower_info_map->operand.at(index).get();
   }
 
 private:
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  AdaptivePlanner.h
+ * @brief This file contains AdaptivePlanner class which drives online re-planning of HEScheduler
+ */
+
+#ifndef __ONERT_COMPILER_ADAPTIVE_PLANNER_H__
+#define __ONERT_COMPILER_ADAPTIVE_PLANNER_H__
+
+#include "backend/Backend.h"
+#include "ir/Graph.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+class ExecTime;
+} // namespace exec
+
+namespace compiler
+{
+
+/**
+ * @brief Class to keep the cost model of adaptive scheduling and to decide when to re-plan
+ *
+ * HEScheduler reads the cost model shared by this planner and proposes its backend assignment as
+ * a plan. Executors feed measured times of operations back to the model. The planner asks for a
+ * new plan when the estimate of the current plan drifts, and adopts a new plan only if it is
+ * cheaper enough than the current one, so the assignment does not flap between backends.
+ *
+ * @note  Op sequences are partitioned again only as a result of the new backend assignment.
+ */
+class AdaptivePlanner
+{
+public:
+  struct Entry
+  {
+    const backend::Backend *backend;
+    std::string operation;
+    bool quant;
+    uint32_t size;
+  };
+
+  struct Plan
+  {
+    std::vector<Entry> entries;
+    int64_t transfer_time = 0; //< Time of data transfer between backends, in microseconds
+  };
+
+  /**
+   * @brief     Construct a new AdaptivePlanner object
+   * @param[in] replan_interval Number of executions between checks of the current plan
+   * @param[in] max_replans     Maximum number of new plans compiled after the first one
+   * @param[in] min_gain        Percent of the estimated gain required to switch the plan
+   */
+  AdaptivePlanner(uint32_t replan_interval, uint32_t max_replans, uint32_t min_gain);
+
+public:
+  /**
+   * @brief  Get the cost model shared by all compilations with this planner
+   * @note   It is created at the first call, loading measurements saved by profiling mode.
+   *         It must not be read while an execution records to it, see pauseRecording.
+   */
+  std::shared_ptr<exec::ExecTime> execTime(const std::vector<const backend::Backend *> &backends);
+  /**
+   * @brief Add a scheduled subgraph to the plan being compiled
+   */
+  void propose(const Plan &plan);
+  /**
+   * @brief Forget the plan being compiled, e.g. when it is compiled for another input shape
+   */
+  void discardProposal();
+  /**
+   * @brief  Decide whether the plan being compiled replaces the current one
+   * @return @c true if the proposed plan is adopted, otherwise @c false
+   */
+  bool acceptProposal();
+  /**
+   * @brief Blend a measured exec time of an operation into the cost model
+   */
+  void record(const backend::Backend *backend, const std::string &operation, bool quant,
+              uint32_t size, int64_t time);
+  /**
+   * @brief Get the estimated exec time of an operation, 1 if it is not measured yet
+   */
+  int64_t estimate(const backend::Backend *backend, const std::string &operation, bool quant,
+                   uint32_t size);
+  /**
+   * @brief Drop measurements until resumeRecording, while a plan is compiled with the cost model
+   *        in background of executions
+   */
+  void pauseRecording();
+  void resumeRecording();
+  /**
+   * @brief Count an execution with the current plan
+   */
+  void onExecutionEnd();
+  /**
+   * @brief  Check if the current plan is to be compiled again with the updated cost model
+   * @return @c true if the estimate of the current plan drifted enough, otherwise @c false
+   */
+  bool needsReplan();
+
+  uint32_t replans() const { return _replans; }
+
+public:
+  /**
+   * @brief  Create a planner if adaptive scheduling is enabled by global config
+   * @return Planner configured with ADAPTIVE_* configs, or nullptr if it is disabled
+   */
+  static std::shared_ptr<AdaptivePlanner> createFromGlobalConfig();
+  static bool isQuant(const ir::Graph &graph, const ir::Operation &node);
+  static uint32_t flattenedIOSize(const ir::Graph &graph, const ir::Operation &node);
+
+private:
+  int64_t planCost(const Plan &plan) const;
+  bool isGain(int64_t from, int64_t to) const;
+
+private:
+  const uint32_t _replan_interval;
+  const uint32_t _max_replans;
+  const uint32_t _min_gain;
+  std::mutex _mutex;
+  std::shared_ptr<exec::ExecTime> _exec_time;
+  std::unique_ptr<Plan> _current;
+  std::unique_ptr<Plan> _proposed;
+  int64_t _planned_cost = 0; //< Estimate of the current plan when it is adopted
+  uint32_t _runs = 0;
+  uint32_t _replans = 0;
+  bool _recording = true;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_ADAPTIVE_PLANNER_H__
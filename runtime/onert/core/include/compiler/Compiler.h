@@ -24,6 +24,9 @@
 
 #include "ir/Graph.h"
 #include "exec/IExecutor.h"
+#include "compiler/AdaptivePlanner.h"
+#include "compiler/ScheduleCache.h"
+#include "exec/OpStats.h"
 
 namespace onert
 {
@@ -51,12 +54,18 @@ struct CompilerOptions
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   std::string trace_filepath; //< File path to save trace records
+  int trace_sample_interval;  //< Trace one of every N executions
+  std::shared_ptr<exec::OpStats> op_stats; //< Statistics of op sequences are collected if set
+  bool perf_counters; //< Hardware counters are collected to op_stats if true
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   int op_seq_max_node;        //< Number of nodes that can be
   std::string executor;       //< Executor name to use
+  std::string linear_order;   //< Order of OpSequences, "DFS" or "MemoryAware"
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
   bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
+  std::shared_ptr<AdaptivePlanner> adaptive_planner; //< Re-plans HEScheduler online if set
+  std::shared_ptr<ScheduleCache> schedule_cache; //< Backend schedules are reused from it if set
   bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
   bool fp16_enable;       //< Whether fp16 mode ON/OFF
 };
@@ -106,6 +115,7 @@ public:
 
 private:
   void checkProfilerConditions();
+  void checkAdaptiveConditions();
   std::shared_ptr<ir::Graph> &primary_subgraph() { return _subgraphs->at(ir::SubgraphIndex{0}); }
 
 private:
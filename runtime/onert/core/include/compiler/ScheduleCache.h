@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * @file  ScheduleCache.h
+ * @brief This file contains ScheduleCache class which keeps schedules of compilation in a file
+ */
+
+#ifndef __ONERT_COMPILER_SCHEDULE_CACHE_H__
+#define __ONERT_COMPILER_SCHEDULE_CACHE_H__
+
+#include "ir/Index.h"
+#include "ir/OperationIndexMap.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Class to keep backend schedules of a model in a file, so that later compilations of the
+ *        same model skip scheduling
+ *
+ * A cache is valid only for the key it is saved with, which is made of the model, compiler
+ * options, HEScheduler measurements and runtime version. Schedules with another key are ignored
+ * and overwritten.
+ *
+ * Only backend assignment is cached, which saves the profiling runs of HEScheduler, so the cache
+ * is used only with HEScheduler. Other schedulers assign backends cheaper than the cache is read.
+ * Linear order, memory plans and kernels are still built from the schedule on every compilation.
+ */
+class ScheduleCache
+{
+public:
+  struct Schedule
+  {
+    ir::OperationIndexMap<std::string> backends; //< Backend id of each operation
+    std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks; //< Ranks by HEScheduler, or nullptr
+  };
+
+  /**
+   * @brief     Construct a new ScheduleCache object
+   * @param[in] path      File path of the cache
+   * @param[in] model_key Key of the model and runtime, e.g. stamps of the model files
+   */
+  ScheduleCache(const std::string &path, const std::string &model_key);
+
+public:
+  /**
+   * @brief Load schedules saved with the model key and the given options key
+   */
+  void load(const std::string &options_key);
+  /**
+   * @brief  Get the schedule of a subgraph
+   * @return Schedule loaded from the file, or nullptr if there is not
+   */
+  const Schedule *find(const ir::SubgraphIndex &index) const;
+  /**
+   * @brief Set the schedule of a subgraph, which is written by the next save()
+   */
+  void insert(const ir::SubgraphIndex &index, Schedule &&schedule);
+  /**
+   * @brief Write schedules to the file if any is inserted after load()
+   */
+  void save();
+
+public:
+  /**
+   * @brief  Get the stamp of a file from its size and modification time, which can be a part of
+   *         the model key
+   * @note   Contents are not read not to slow down every compilation for large weights, so a file
+   *         rewritten with the same size and time keeps the stamp
+   */
+  static std::string stampFile(const std::string &path);
+
+private:
+  const std::string _path;
+  const std::string _model_key;
+  std::string _key;
+  std::unordered_map<ir::SubgraphIndex, Schedule> _schedules;
+  bool _dirty = false;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_SCHEDULE_CACHE_H__
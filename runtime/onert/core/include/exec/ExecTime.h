@@ -64,6 +64,19 @@ public:
    */
   void updateOperationExecTime(const backend::Backend *backend, const std::string &operation,
                                bool quant, uint32_t op_size, int64_t time);
+  /**
+   * @brief Blend a measured exec time into the record of the operation by exponentially
+   *        weighted moving average, or add new entity if there is no one.
+   *
+   * @param[in] backend id of a backend
+   * @param[in] operation name of an operation
+   * @param[in] quant if input type quantized
+   * @param[in] op_size sum of operation's flattened sizes of inputs and outputs
+   * @param[in] time real measured value
+   * @param[in] weight weight of the measured value, between 0 and 1
+   */
+  void blendOperationExecTime(const backend::Backend *backend, const std::string &operation,
+                              bool quant, uint32_t op_size, int64_t time, float weight);
   /**
    * @brief Get the permute time from one backend to another
    *
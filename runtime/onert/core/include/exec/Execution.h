@@ -114,6 +114,11 @@ public:
    * @param[in] layout  Output data's data format
    */
   void setOutputLayout(const ir::IOIndex &index, ir::Layout layout);
+  /**
+   * @brief     Bind the same input/output buffers and input shapes as another execution
+   * @param[in] other Execution of the same model
+   */
+  void bindIO(const Execution &other);
   /**
    * @brief  Execution
    * @note   It should be called after setting input and output buffer
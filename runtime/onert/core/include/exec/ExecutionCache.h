@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  ExecutionCache.h
+ * @brief This file defines LRU cache of executions specialized for input shapes
+ */
+#ifndef __ONERT_EXEC_EXECUTION_CACHE_H__
+#define __ONERT_EXEC_EXECUTION_CACHE_H__
+
+#include "exec/Execution.h"
+
+#include <list>
+#include <memory>
+#include <unordered_set>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to keep Executions compiled for specific input shapes
+ *
+ * An Execution compiled with concrete input shapes has statically planned tensors, so running
+ * it is faster than changing input shapes of an Execution which goes through dynamic tensors.
+ * Executions are kept in least-recently-used order and evicted when the number of entries or
+ * their estimated memory exceeds the limit.
+ */
+class ExecutionCache
+{
+public:
+  /**
+   * @brief Shapes of all inputs, same form as IODescription::input_shape_signature
+   */
+  using Signature = std::unordered_map<ir::IOIndex, ir::Shape>;
+
+  struct Stats
+  {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+  };
+
+public:
+  /**
+   * @brief     Construct a new ExecutionCache object
+   * @param[in] max_entries Maximum number of executions to keep
+   * @param[in] max_memory  Maximum estimated memory of executions to keep in bytes,
+   *                        0 for no limit
+   */
+  ExecutionCache(size_t max_entries, size_t max_memory);
+
+public:
+  /**
+   * @brief     Find an execution compiled for the signature
+   * @param[in] signature Input shapes
+   * @return    Execution if found, otherwise @c nullptr
+   * @note      Found execution becomes the most recently used one
+   */
+  std::shared_ptr<Execution> find(const Signature &signature);
+  /**
+   * @brief     Insert an execution as the most recently used one
+   * @param[in] signature   Input shapes the execution is compiled for
+   * @param[in] execution   Execution to insert
+   * @param[in] memory_size Estimated memory of the execution in bytes
+   * @note      Least recently used executions are evicted to keep the limits, but the inserted
+   *            one is always kept
+   */
+  void insert(const Signature &signature, const std::shared_ptr<Execution> &execution,
+              size_t memory_size);
+
+  size_t size() const { return _entries.size(); }
+  size_t memory() const { return _memory; }
+  const Stats &stats() const { return _stats; }
+
+public:
+  /**
+   * @brief     Estimate memory of an execution
+   * @param[in] execution        Execution to estimate
+   * @param[in] shared_constants Constants whose memory is shared with executions estimated
+   *                             before, which are not counted again
+   * @return    Total size of tensors of primary subgraph in bytes
+   * @note      It does not consider memory reuse by planners, so it is an upper bound
+   */
+  static size_t
+  estimateMemory(const Execution &execution,
+                 const std::unordered_set<ir::OperandIndex> &shared_constants = {});
+
+private:
+  struct Entry
+  {
+    Signature signature;
+    std::shared_ptr<Execution> execution;
+    size_t memory_size;
+  };
+
+private:
+  void evict();
+
+private:
+  const size_t _max_entries;
+  const size_t _max_memory;
+  // Most recently used entry first
+  std::list<Entry> _entries;
+  size_t _memory{0};
+  Stats _stats;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_EXECUTION_CACHE_H__
@@ -22,8 +22,16 @@
 #include "ExecTime.h"
 #include "util/ITimer.h"
 #include "IExecutor.h"
-#include "misc/EventCollector.h"
-#include "misc/EventRecorder.h"
+#include "util/TraceBuffer.h"
+#include "util/PerfCounters.h"
+#include "compiler/AdaptivePlanner.h"
+#include "exec/OpStats.h"
+#include "ir/LoweredGraph.h"
+
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <unordered_map>
 
 namespace onert
 {
@@ -58,10 +66,108 @@ private:
   std::shared_ptr<ExecTime> _et;
 };
 
+/**
+ * @brief Observer to feed measured exec times of operations to adaptive scheduling
+ *
+ * The time of an op sequence is split to its operations in proportion to their estimates.
+ * Backends without timer and permutations are not measured.
+ */
+class AdaptiveObserver : public IExecutionObserver
+{
+public:
+  explicit AdaptiveObserver(std::shared_ptr<compiler::AdaptivePlanner> planner)
+      : _planner(std::move(planner))
+  {
+  }
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *) override { _planner->onExecutionEnd(); }
+
+private:
+  struct OpKey
+  {
+    std::string operation;
+    bool quant;
+    uint32_t size;
+  };
+
+  const std::vector<OpKey> &opKeys(IExecutor *exec, const ir::OpSequence *op_seq);
+
+private:
+  std::shared_ptr<compiler::AdaptivePlanner> _planner;
+  std::unordered_map<const backend::Backend *, std::unique_ptr<util::ITimer>> _timers;
+  std::unordered_map<const ir::OpSequence *, std::vector<OpKey>> _op_keys;
+};
+
+/**
+ * @brief Observer to accumulate time, traffic and flops of op sequences to OpStats
+ *
+ * Bytes and flops are computed from operand shapes at construction, so op sequences with
+ * dynamic tensors are counted with 0 bytes and flops.
+ */
+class OpStatsObserver : public IExecutionObserver
+{
+public:
+  OpStatsObserver(std::shared_ptr<OpStats> stats, const ir::SubgraphIndex &subg_index,
+                  const ir::LoweredGraph &lowered_graph);
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+
+private:
+  struct Slot
+  {
+    OpStats::Entry *entry;
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+    uint64_t flops;
+    uint64_t begin; //< Each op sequence runs once in an execution, so it is not shared
+  };
+
+private:
+  std::shared_ptr<OpStats> _stats;
+  std::unordered_map<const ir::OpSequence *, Slot> _slots;
+};
+
+/**
+ * @brief Observer to accumulate hardware counters of op sequences to OpStats
+ *
+ * Counters are read on the thread running an op sequence before and after it, so work of
+ * kernels offloaded to other threads is not counted. If counters are not available, e.g. by
+ * perf_event_paranoid, nothing is collected.
+ */
+class PerfCounterObserver : public IExecutionObserver
+{
+public:
+  PerfCounterObserver(std::shared_ptr<OpStats> stats, const ir::SubgraphIndex &subg_index,
+                      const ir::LoweredGraph &lowered_graph);
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+
+private:
+  struct Slot
+  {
+    OpStats::Entry *entry;
+    util::PerfCounters::Values begin;
+    bool begun;
+  };
+
+private:
+  std::shared_ptr<OpStats> _stats;
+  std::unordered_map<const ir::OpSequence *, Slot> _slots;
+};
+
+/**
+ * @brief Observer to write Chrome trace of executions
+ *
+ * Events are recorded in binary to per-thread ring buffers, and converted to Chrome trace JSON
+ * when the observer is destroyed. Only the last events of each thread are kept, so it can be
+ * left on for long-running sessions. Every sample_interval-th execution is traced, and
+ * sample_interval less than 1 traces every execution.
+ */
 class ChromeTracingObserver : public IExecutionObserver
 {
 public:
-  ChromeTracingObserver(const std::string &filepath);
+  ChromeTracingObserver(const std::string &filepath, int sample_interval = 1);
   ~ChromeTracingObserver();
   void handleBegin(IExecutor *) override;
   void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
@@ -69,12 +175,38 @@ public:
   void handleEnd(IExecutor *) override;
 
 private:
-  static std::string opSequenceTag(const ir::OpSequence *op_seq);
+  void record(const ir::OpSequence *op_seq, const backend::Backend *backend,
+              util::TraceEvent::Phase phase);
+  uint8_t backendId(const backend::Backend *backend);
+  std::string opSequenceTag(const util::TraceEvent &event) const;
+  void writeToFile();
+
+private:
+  // Events kept per thread, 1MB of TraceEvent
+  static constexpr uint32_t kEventCapacity = 64 * 1024;
+  // Resource usage samples kept, one per traced execution
+  static constexpr uint32_t kUsageCapacity = 4096;
+  // Backend id 0 is for events of the whole graph
+  static constexpr uint32_t kMaxBackends = 16;
+
+  struct UsageSample
+  {
+    uint64_t timestamp;
+    long maxrss;
+    long minflt;
+  };
 
 private:
   std::ofstream _ofs;
-  EventRecorder _recorder;
-  EventCollector _collector;
+  const uint32_t _sample_interval;
+  uint64_t _run_count{0};
+  bool _sampled{false};
+  util::TraceBuffer _buffer;
+  std::array<std::atomic<const backend::Backend *>, kMaxBackends> _backends;
+  std::array<std::string, kMaxBackends> _backend_names;
+  std::unordered_map<uint32_t, std::string> _op_names;
+  std::vector<UsageSample> _usages;
+  uint64_t _usage_count{0};
 };
 
 } // namespace exec
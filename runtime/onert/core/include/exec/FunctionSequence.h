@@ -83,6 +83,10 @@ public:
   }
 
   void run() override;
+  void runSync() override;
+
+private:
+  template <typename RunFn> void runWithShapeInference(RunFn run_fn);
 
 private:
   const ir::OpSequence &_op_seq;
@@ -81,6 +81,7 @@ public:
             permute<uint8_t>(src_tensor, dst_tensor, *rank_it);
             break;
           case ir::DataType::QUANT8_SYMM:
+          case ir::DataType::QUANT8_ASYMM_SIGNED:
             permute<int8_t>(src_tensor, dst_tensor, *rank_it);
             break;
           default:
@@ -271,6 +272,7 @@ private:
       case ir::DataType::UINT8:
         return typeid(uint8_t);
       case ir::DataType::QUANT8_SYMM:
+      case ir::DataType::QUANT8_ASYMM_SIGNED:
         return typeid(int8_t);
       default:
         throw std::runtime_error("IPermuteFunction: Not supported data type");
@@ -45,7 +45,7 @@ class JSON
 public:
   explicit JSON(const std::vector<const backend::Backend *> &backends,
                 MeasurementData &measurements)
-      : _measurement_file("exec_time.json"), _backends(), _measurements(measurements)
+      : _measurement_file(measurementFile()), _backends(), _measurements(measurements)
   {
     for (const auto b : backends)
     {
@@ -57,6 +57,10 @@ public:
    * @brief Update _operations_exec_time_file with new data.
    */
   void uploadOperationsExecTime() const;
+  /**
+   * @brief Get the path of the file that measurements are loaded from and uploaded to
+   */
+  static const char *measurementFile() { return "exec_time.json"; }
 
 private:
   ///@brief file containing measurements
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  OpStats.h
+ * @brief This file defines OpStats class which accumulates statistics of op sequences
+ */
+#ifndef __ONERT_EXEC_OP_STATS_H__
+#define __ONERT_EXEC_OP_STATS_H__
+
+#include "ir/Graph.h"
+#include "ir/Index.h"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Statistics of op sequences accumulated over executions
+ *
+ * An entry is identified by its subgraph, its first operation and its backend, so executors
+ * compiled again for other input shapes accumulate to the same entries.
+ */
+class OpStats
+{
+public:
+  struct Entry
+  {
+    Entry(const std::string &name, const std::string &backend, uint32_t subgraph,
+          uint32_t first_op)
+        : name{name}, backend{backend}, subgraph{subgraph}, first_op{first_op}
+    {
+    }
+
+    const std::string name; //< Names of operations joined by '.'
+    const std::string backend;
+    const uint32_t subgraph;
+    const uint32_t first_op;
+
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> time_ns{0};
+    std::atomic<uint64_t> bytes_read{0};
+    std::atomic<uint64_t> bytes_written{0};
+    std::atomic<uint64_t> flops{0};
+
+    // Hardware counters, collected by PerfCounterObserver
+    std::atomic<uint64_t> cycles{0};
+    std::atomic<uint64_t> instructions{0};
+    std::atomic<uint64_t> cache_misses{0};
+    std::atomic<uint64_t> branch_misses{0};
+  };
+
+public:
+  /**
+   * @brief Get the entry of an op sequence, it is added if it does not exist
+   */
+  Entry &entry(const std::string &name, const std::string &backend, uint32_t subgraph,
+               uint32_t first_op);
+
+  size_t size() const;
+  /**
+   * @brief Get an entry in order of addition
+   */
+  const Entry &at(size_t index) const;
+  /**
+   * @brief Reset all counters to 0, entries are kept
+   */
+  void reset();
+
+public:
+  /**
+   * @brief  Estimate floating point (or integer) operations of an operation from operand shapes
+   * @note   Multiply-add is counted as 2. Operations without a specific rule are counted as the
+   *         number of output elements.
+   */
+  static uint64_t estimateFlops(const ir::Graph &graph, const ir::Operation &op);
+
+private:
+  mutable std::mutex _mutex;
+  std::deque<Entry> _entries; //< deque keeps addresses of entries
+  std::map<std::tuple<uint32_t, uint32_t, std::string>, size_t> _index;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_OP_STATS_H__
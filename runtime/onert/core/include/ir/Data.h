@@ -18,6 +18,10 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <stdexcept>
+
+#include <sys/mman.h>
+#include <unistd.h>
 
 namespace onert
 {
@@ -69,6 +73,42 @@ private:
   const size_t _size;
 };
 
+/**
+ * @brief Read-only data mapped from a file region
+ *
+ * @note  @c offset does not need to be page-aligned. The enclosing pages are mapped and
+ *        the region is released on destruction, so @c fd may be closed right after.
+ */
+class MMapedData final : public Data
+{
+public:
+  MMapedData(int fd, off_t offset, size_t size) : _size{size}
+  {
+    const auto page_size = static_cast<off_t>(sysconf(_SC_PAGESIZE));
+    _page_gap = static_cast<size_t>(offset % page_size);
+    _mmap_size = _size + _page_gap;
+    _mmap_base = mmap(nullptr, _mmap_size, PROT_READ, MAP_PRIVATE, fd, offset - _page_gap);
+    if (_mmap_base == MAP_FAILED)
+      throw std::runtime_error{"Failed to mmap external data"};
+  }
+
+public:
+  ~MMapedData() { munmap(_mmap_base, _mmap_size); }
+
+public:
+  size_t size(void) const override { return _size; }
+  const uint8_t *base(void) const override
+  {
+    return reinterpret_cast<const uint8_t *>(_mmap_base) + _page_gap;
+  }
+
+private:
+  void *_mmap_base;
+  size_t _mmap_size;
+  size_t _page_gap;
+  const size_t _size;
+};
+
 } // namespace ir
 } // namespace onert
 
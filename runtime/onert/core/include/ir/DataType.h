@@ -37,6 +37,8 @@ enum class DataType
   UINT8 = 5,
   QUANT8_SYMM = 6,
   FLOAT16 = 7,
+  BFLOAT16 = 8,
+  QUANT8_ASYMM_SIGNED = 9,
 };
 
 inline size_t sizeOfDataType(DataType data_type)
@@ -54,9 +56,12 @@ inline size_t sizeOfDataType(DataType data_type)
     case DataType::UINT8:
       return sizeof(uint8_t);
     case DataType::QUANT8_SYMM:
+    case DataType::QUANT8_ASYMM_SIGNED:
       return sizeof(int8_t);
     case DataType::FLOAT16:
       return sizeof(float16);
+    case DataType::BFLOAT16:
+      return sizeof(uint16_t);
     default:
       throw std::runtime_error{"Unsupported type size"};
   }
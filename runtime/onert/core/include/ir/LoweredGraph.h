@@ -36,7 +36,11 @@ namespace ir
 class LoweredGraph
 {
 public:
-  LoweredGraph(const Graph &graph, const compiler::CompilerOptions &options);
+  /**
+   * @param schedule Schedule from schedule cache, which is used instead of scheduling if valid
+   */
+  LoweredGraph(const Graph &graph, const compiler::CompilerOptions &options,
+               const compiler::ScheduleCache::Schedule *schedule = nullptr);
 
   Graph &graph() { return _graph; }
   const Graph &graph() const { return _graph; }
@@ -54,8 +58,10 @@ public:
   const backend::BackendContexts &backend_contexts() { return _backend_contexts; }
   const backend::BackendContexts &backend_contexts() const { return _backend_contexts; }
   std::shared_ptr<ir::OperationIndexMap<int64_t>> indexed_ranks() { return _indexed_ranks; }
+  compiler::ScheduleCache::Schedule schedule() const;
 
 private:
+  bool restoreSchedule(const compiler::ScheduleCache::Schedule &schedule);
   void makeOpSequences(OperandIndexMap<std::unique_ptr<operand::LowerInfo>> &operands_lower_info,
                        const compiler::CompilerOptions &options);
 
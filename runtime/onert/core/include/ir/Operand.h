@@ -65,6 +65,11 @@ public:
     _const = true;
   }
   const Data *data(void) const { return _data.get(); }
+  /**
+   * @brief Get data to refer to without a copy
+   * @note  Data is kept alive by the returned pointer even after releaseData()
+   */
+  std::shared_ptr<Data> shareData(void) const { return _data; }
 
   void releaseData(void) { _data.reset(); }
 
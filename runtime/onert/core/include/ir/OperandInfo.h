@@ -98,7 +98,16 @@ public:
   /**
    * @brief set shape
    */
-  void shape(const ir::Shape &new_shape) { _shape = new_shape; }
+  void shape(const ir::Shape &new_shape)
+  {
+    _shape_changed = _shape_changed || new_shape != _shape;
+    _shape = new_shape;
+  }
+  /**
+   * @brief   Return whether the shape has been set to differ from the one declared in the model
+   * @return  @c true if the shape has been changed, otherwise @c false
+   */
+  bool isShapeChanged() const { return _shape_changed; }
   /**
    * @brief   Return tensor data type info
    * @return  Tensor data type
@@ -123,6 +132,7 @@ private:
   TypeInfo _typeInfo;
 
   MemAllocType _alloc_type;
+  bool _shape_changed{false};
 };
 
 } // namespace ir
@@ -99,3 +99,4 @@
 #include "ir/operation/Pow.h"
 #include "ir/operation/ZerosLike.h"
 #include "ir/operation/Tile.h"
+#include "ir/operation/BatchMatMul.h"
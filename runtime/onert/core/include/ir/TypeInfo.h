@@ -18,6 +18,7 @@
 #define __ONERT_IR_TYPEINFO_H__
 
 #include <cstdint>
+#include <vector>
 
 #include "ir/DataType.h"
 
@@ -40,14 +41,29 @@ public:
   DataType type() const { return _type; }
   float scale() const { return _scale; }
   int32_t offset() const { return _offset; }
+  /**
+   * @brief Scales of channels with per-channel quantization, empty with per-tensor quantization
+   */
+  const std::vector<float> &channel_scales() const { return _channel_scales; }
+  /**
+   * @brief Axis of channels with per-channel quantization
+   */
+  int32_t channel_axis() const { return _channel_axis; }
 
 public:
   void type(const DataType type) { _type = type; }
+  void channel_scales(const std::vector<float> &scales, int32_t axis = 0)
+  {
+    _channel_scales = scales;
+    _channel_axis = axis;
+  }
 
 private:
   DataType _type;
   float _scale;
   int32_t _offset;
+  std::vector<float> _channel_scales;
+  int32_t _channel_axis{0};
 };
 
 bool operator==(const TypeInfo &lhs, const TypeInfo &rhs);
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  PerfCounters.h
+ * @brief This file defines per-thread hardware performance counters
+ */
+#ifndef __ONERT_UTIL_PERF_COUNTERS_H__
+#define __ONERT_UTIL_PERF_COUNTERS_H__
+
+#include <array>
+#include <cstdint>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Hardware performance counters of the calling thread, by Linux perf_event_open
+ *
+ * Counters are opened as a group, so they are scheduled together and read at once. Counters
+ * the CPU or the kernel does not support are left out and read as 0. When no counter can be
+ * opened, e.g. perf_event_paranoid forbids it, the group is not available.
+ * Only user space of the calling thread is counted, not threads created before it is opened.
+ */
+class PerfCounters
+{
+public:
+  enum Counter
+  {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    CACHE_MISSES, //< Last level cache misses
+    BRANCH_MISSES,
+    COUNT
+  };
+
+  using Values = std::array<uint64_t, COUNT>;
+
+public:
+  /**
+   * @brief Get counters of the calling thread, opened on the first call of each thread
+   */
+  static PerfCounters &thisThread();
+
+public:
+  PerfCounters();
+  ~PerfCounters();
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+
+public:
+  bool available() const { return _leader >= 0; }
+  /**
+   * @brief Read values accumulated since the counters are opened
+   * @return false if the counters are not available or reading fails
+   */
+  bool read(Values &values) const;
+
+private:
+  int _leader{-1};
+  std::array<int, COUNT> _fds;
+  // Position of each counter in the group read, -1 if it is not opened
+  std::array<int, COUNT> _positions;
+  uint32_t _num_opened{0};
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_PERF_COUNTERS_H__
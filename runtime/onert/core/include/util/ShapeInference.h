@@ -20,11 +20,15 @@
 #include "Utils.h"
 
 #include "ir/operation/AvgPool2D.h"
+#include "ir/operation/BatchMatMul.h"
 #include "ir/operation/Concat.h"
 #include "ir/operation/MaxPool2D.h"
 #include "ir/operation/Conv2D.h"
 #include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/L2Pool2D.h"
 #include "ir/operation/Reshape.h"
+#include "ir/operation/Squeeze.h"
+#include "ir/operation/StridedSlice.h"
 #include "ir/Operands.h"
 #include "ir/Index.h"
 #include "ir/Layout.h"
@@ -41,40 +45,88 @@ namespace shape_inference
 using Shapes = std::vector<ir::Shape>;
 
 // Define shape calculation for operations. List them in alphabetic order.
-// Remove TODO when the function name matching the alphabet is added
+
+ir::Shape inferArgMaxShape(const ir::Shape &in_shape, int axis);
 
 Shapes inferAvgPoolShape(const ir::Shape &in_shape, const ir::operation::AvgPool2D::Param &param,
                          ir::Layout layout = ir::Layout::NHWC);
 
+ir::Shape inferBatchMatMulShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape,
+                                const ir::operation::BatchMatMul::Param &param);
+
+ir::Shape inferBatchToSpaceNDShape(const ir::Shape &in_shape, const int32_t *block_buf);
+
 ir::Shape inferConcatShape(const Shapes &in_shapes, const ir::operation::Concat::Param &param);
 
 Shapes inferConv2DShape(const ir::Shape &in_shape, const ir::Shape &ker_shape,
                         const ir::operation::Conv2D::Param &param,
                         ir::Layout layout = ir::Layout::NHWC);
 
+ir::Shape inferDepthToSpaceShape(const ir::Shape &in_shape, int32_t block_size);
+
 Shapes inferDepthwiseConv2DShape(const ir::Shape &in_shape, const ir::Shape &ker_shape,
                                  const ir::operation::DepthwiseConv2D::Param &param,
                                  ir::Layout layout = ir::Layout::NHWC);
 
 ir::Shape inferEltwiseShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape);
 
+ir::Shape inferEmbeddingLookupShape(const ir::Shape &lookups_shape, const ir::Shape &values_shape);
+
 ir::Shape inferExpandDimsShape(const ir::Shape &in_shape, int32_t axis);
 
+ir::Shape inferFillShape(const int32_t *dims_buf, int32_t rank);
+
 Shapes inferFullyConnectedShape(const ir::Shape &in_shape, const ir::Shape &ker_shape);
 
-// TODO write op starting from G
-// TODO write op starting from L
+ir::Shape inferGatherShape(const ir::Shape &input_shape, const ir::Shape &indices_shape, int axis);
+
+Shapes inferL2Pool2DShape(const ir::Shape &in_shape, const ir::operation::L2Pool2D::Param &param,
+                          ir::Layout layout = ir::Layout::NHWC);
 
 Shapes inferMaxPoolShape(const ir::Shape &in_shape, const ir::operation::MaxPool2D::Param &param,
                          ir::Layout layout = ir::Layout::NHWC);
 
-// TODO write op starting from N
-// TODO write op starting from P
-// TODO write op starting from R
-// TODO write op starting from S
-// TODO write op starting from T
-// TODO write op starting from U
-// TODO write op starting from Z
+ir::Shape inferOneHotShape(const ir::Shape &indices_shape, int32_t depth, int axis);
+
+ir::Shape inferPackShape(const ir::Shape &in_shape, int32_t axis, int32_t num);
+
+ir::Shape inferPadShape(const ir::Shape &in_shape, const int32_t *pad_buf);
+
+ir::Shape inferReduceShape(const ir::Shape &in_shape, const std::vector<int> &axes,
+                           bool keep_dims);
+
+ir::Shape inferReshapeShape(const int32_t *shape_buf, int32_t shape_num_elements,
+                            size_t total_num_elements);
+
+ir::Shape inferResizeBilinearShape(const ir::Shape &in_shape, int32_t output_height,
+                                   int32_t output_width);
+
+ir::Shape inferSelectShape(const ir::Shape &cond_shape, const ir::Shape &true_shape,
+                           const ir::Shape &false_shape);
+
+ir::Shape inferSliceShape(const ir::Shape &in_shape, const int32_t *begins_buf,
+                          const int32_t *sizes_buf);
+
+ir::Shape inferSpaceToBatchNDShape(const ir::Shape &in_shape, const int32_t *block_buf,
+                                   const int32_t *paddings_buf);
+
+ir::Shape inferSpaceToDepthShape(const ir::Shape &in_shape, int32_t block_size);
+
+ir::Shape inferSplitShape(const ir::Shape &in_shape, int axis, int num_splits);
+
+ir::Shape inferSqueezeShape(const ir::Shape &in_shape, const ir::operation::Squeeze::Param &param);
+
+ir::Shape inferStridedSliceShape(const ir::Shape &in_shape, const int32_t *starts_buf,
+                                 const int32_t *ends_buf, const int32_t *strides_buf,
+                                 const ir::operation::StridedSlice::Param &param);
+
+ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiples_buf);
+
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, int32_t k);
+
+ir::Shape inferTransposeShape(const ir::Shape &in_shape, const std::vector<int> &perm);
+
+ir::Shape inferUnpackShape(const ir::Shape &in_shape, int axis);
 
 /**
  * @brief Class to infer shape before running kernels. It does the following:
@@ -97,26 +149,119 @@ public:
    */
   void infer(const ir::OpSequence &op_seq) { op_seq.accept(*this); };
 
+  /**
+   * @brief Infer shape of outputs of an operation
+   * @note  Operations must be visited in topological order so that inferred shapes propagate
+   * @param op operation
+   */
+  void infer(const ir::Operation &op) { op.accept(*this); };
+
   void dump();
 
 private:
-  // TODO Define visitors for operations. List them in alphabetic order.
-  // Remove TODO when any op starting from the alphabet is added
+  // Visitors for operations. List them in alphabetic order.
+  void visit(const ir::operation::Abs &op);
   void visit(const ir::operation::Add &op);
+  void visit(const ir::operation::ArgMax &op);
+  void visit(const ir::operation::AvgPool2D &op);
+  void visit(const ir::operation::BatchMatMul &op);
+  void visit(const ir::operation::BatchToSpaceND &op);
+  void visit(const ir::operation::Cast &op);
+  void visit(const ir::operation::Comparison &op);
   void visit(const ir::operation::Concat &op);
-  // TODO write op starting from D
+  void visit(const ir::operation::Conv2D &op);
+  void visit(const ir::operation::ConvertFp16ToFp32 &op);
+  void visit(const ir::operation::ConvertFp32ToFp16 &op);
+  void visit(const ir::operation::Cos &op);
+  void visit(const ir::operation::Custom &op);
+  void visit(const ir::operation::DepthToSpace &op);
+  void visit(const ir::operation::DepthwiseConv2D &op);
+  void visit(const ir::operation::Dequantize &op);
+  void visit(const ir::operation::Div &op);
+  void visit(const ir::operation::EmbeddingLookup &op);
+  void visit(const ir::operation::Exp &op);
   void visit(const ir::operation::ExpandDims &op);
-  // TODO write op starting from F
-  // TODO write op starting from G
-  // TODO write op starting from L
-  // TODO write op starting from M
-  // TODO write op starting from N
-  // TODO write op starting from P
+  void visit(const ir::operation::Fill &op);
+  void visit(const ir::operation::Floor &op);
+  void visit(const ir::operation::FullyConnected &op);
+  void visit(const ir::operation::Gather &op);
+  void visit(const ir::operation::HashtableLookup &op);
+  void visit(const ir::operation::If &op);
+  void visit(const ir::operation::InstanceNorm &op);
+  void visit(const ir::operation::L2Normalization &op);
+  void visit(const ir::operation::L2Pool2D &op);
+  void visit(const ir::operation::LSTM &op);
+  void visit(const ir::operation::LocalResponseNormalization &op);
+  void visit(const ir::operation::Log &op);
+  void visit(const ir::operation::LogicalAnd &op);
+  void visit(const ir::operation::LogicalNot &op);
+  void visit(const ir::operation::LogicalOr &op);
+  void visit(const ir::operation::Logistic &op);
+  void visit(const ir::operation::Max &op);
+  void visit(const ir::operation::MaxPool2D &op);
+  void visit(const ir::operation::Mean &op);
+  void visit(const ir::operation::Min &op);
+  void visit(const ir::operation::Mul &op);
+  void visit(const ir::operation::Neg &op);
+  void visit(const ir::operation::OneHot &op);
+  void visit(const ir::operation::PReLU &op);
+  void visit(const ir::operation::Pack &op);
+  void visit(const ir::operation::Pad &op);
+  void visit(const ir::operation::Permute &op);
+  void visit(const ir::operation::Pow &op);
+  void visit(const ir::operation::RNN &op);
+  void visit(const ir::operation::RSQRT &op);
+  void visit(const ir::operation::ReLU &op);
+  void visit(const ir::operation::ReLU1 &op);
+  void visit(const ir::operation::ReLU6 &op);
+  void visit(const ir::operation::ReduceAny &op);
+  void visit(const ir::operation::ReduceMax &op);
+  void visit(const ir::operation::ReduceMin &op);
+  void visit(const ir::operation::ReduceProd &op);
+  void visit(const ir::operation::ReduceSum &op);
   void visit(const ir::operation::Reshape &op);
-  // TODO write op starting from S
+  void visit(const ir::operation::ResizeBilinear &op);
+  void visit(const ir::operation::Reverse &op);
+  void visit(const ir::operation::Round &op);
+  void visit(const ir::operation::SQRT &op);
+  void visit(const ir::operation::Select &op);
+  void visit(const ir::operation::Shape &op);
+  void visit(const ir::operation::Sin &op);
+  void visit(const ir::operation::Slice &op);
+  void visit(const ir::operation::Softmax &op);
+  void visit(const ir::operation::SpaceToBatchND &op);
+  void visit(const ir::operation::SpaceToDepth &op);
+  void visit(const ir::operation::Split &op);
+  void visit(const ir::operation::SquaredDifference &op);
+  void visit(const ir::operation::Squeeze &op);
+  void visit(const ir::operation::StridedSlice &op);
+  void visit(const ir::operation::Sub &op);
   void visit(const ir::operation::Tanh &op);
-  // TODO write op starting from U
-  // TODO write op starting from Z
+  void visit(const ir::operation::Tile &op);
+  void visit(const ir::operation::TopKV2 &op);
+  void visit(const ir::operation::Transpose &op);
+  void visit(const ir::operation::TransposeConv &op);
+  void visit(const ir::operation::Unpack &op);
+  void visit(const ir::operation::While &op);
+  void visit(const ir::operation::ZerosLike &op);
+
+private:
+  /**
+   * @brief Performs shape inference for binary arithmetic operation
+   */
+  void handleBinaryArithmeticOp(const ir::Operation &op, const ir::OperandIndex lhs_idx,
+                                const ir::OperandIndex rhs_idx);
+  /**
+   * @brief Performs shape inference for unary op whose output shape is
+   *        always same with input shape
+   */
+  void handleSimpleUnaryOp(const ir::Operation &op, const ir::OperandIndex input_idx);
+  /**
+   * @brief Handles an output whose shape depends on values of non-constant inputs.
+   *        The shape declared in the model is kept only if it is known and no input of the
+   *        operation has a shape changed from the declared one, or the output is marked dynamic.
+   */
+  void handleValueDependentOutput(const ir::Operation &op, const ir::OperandIndex output_idx);
 
 private:
   ir::Operands &_operands;
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  TraceBuffer.h
+ * @brief This file defines per-thread ring buffers of binary trace events
+ */
+#ifndef __ONERT_UTIL_TRACE_BUFFER_H__
+#define __ONERT_UTIL_TRACE_BUFFER_H__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Fixed-size binary trace event
+ *
+ * Strings are resolved when events are drained, so recording does not allocate.
+ */
+struct TraceEvent
+{
+  enum class Phase : uint8_t
+  {
+    BEGIN,
+    END
+  };
+
+  uint64_t timestamp; //< Nanoseconds of steady clock
+  uint32_t op_seq;    //< Id of the op sequence, its first operation index
+  uint16_t op_count;  //< Number of operations in the op sequence
+  uint8_t backend;    //< Id of the backend given by the recorder
+  Phase phase;
+};
+
+static_assert(sizeof(TraceEvent) == 16, "TraceEvent must be 16 bytes");
+
+/**
+ * @brief Per-thread ring buffers of TraceEvent
+ *
+ * Each thread records to its own ring without any lock or read-modify-write, so recording costs a
+ * clock read and a few stores. When a ring is full the oldest events are overwritten.
+ * Rings must be drained while no thread records, e.g. at the end of an execution.
+ */
+class TraceBuffer
+{
+public:
+  /**
+   * @brief     Construct a new TraceBuffer object
+   * @param[in] capacity Number of events kept per thread, rounded up to a power of 2
+   */
+  explicit TraceBuffer(uint32_t capacity);
+
+public:
+  static uint64_t now()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  void record(const TraceEvent &event) { localRing()->push(event); }
+
+  /**
+   * @brief     Pass events recorded since the last drain to fn, and forget them
+   * @param[in] fn Function called as fn(thread_index, event) in recorded order of each thread
+   * @return    Number of events overwritten before they are drained, or dropped with them
+   *
+   * BEGIN and END events are drained in pairs. Each thread must have ended all it began, so an END
+   * event without a BEGIN event before it has lost its BEGIN event by overwriting, and is dropped.
+   */
+  template <typename Fn> uint64_t drain(Fn fn)
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    uint64_t dropped = 0;
+    for (uint32_t thread_index = 0; thread_index < _rings.size(); ++thread_index)
+    {
+      auto &ring = *_rings[thread_index];
+      const uint64_t head = ring.head.load(std::memory_order_acquire);
+      uint64_t tail = ring.tail;
+      if (head - tail > ring.mask + 1)
+      {
+        dropped += head - tail - (ring.mask + 1);
+        tail = head - (ring.mask + 1);
+      }
+      uint64_t open = 0;
+      for (; tail < head; ++tail)
+      {
+        const auto &event = ring.events[tail & ring.mask];
+        if (event.phase == TraceEvent::Phase::BEGIN)
+        {
+          ++open;
+        }
+        else if (open > 0)
+        {
+          --open;
+        }
+        else
+        {
+          ++dropped;
+          continue;
+        }
+        fn(thread_index, event);
+      }
+      ring.tail = head;
+    }
+    return dropped;
+  }
+
+private:
+  struct Ring
+  {
+    explicit Ring(uint32_t capacity) : events{new TraceEvent[capacity]}, mask{capacity - 1} {}
+
+    void push(const TraceEvent &event)
+    {
+      // Only the owner thread writes head, so a relaxed load is enough
+      const uint64_t pos = head.load(std::memory_order_relaxed);
+      events[pos & mask] = event;
+      head.store(pos + 1, std::memory_order_release);
+    }
+
+    std::unique_ptr<TraceEvent[]> events;
+    const uint32_t mask;
+    std::atomic<uint64_t> head{0};
+    uint64_t tail{0}; //< Accessed by drain only
+  };
+
+private:
+  Ring *localRing()
+  {
+    // Remember the ring of the last buffer this thread recorded to. Buffers are compared by their
+    // unique ids since an address may be reused by a later buffer.
+    struct Cache
+    {
+      uint64_t buffer_id = 0;
+      Ring *ring = nullptr;
+    };
+    thread_local Cache cache;
+    if (cache.buffer_id != _id)
+    {
+      cache.ring = registerThread();
+      cache.buffer_id = _id;
+    }
+    return cache.ring;
+  }
+
+  Ring *registerThread();
+
+private:
+  const uint64_t _id;
+  const uint32_t _capacity;
+  std::mutex _mutex;
+  std::vector<std::unique_ptr<Ring>> _rings;
+  std::unordered_map<std::thread::id, Ring *> _thread_rings;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_TRACE_BUFFER_H__
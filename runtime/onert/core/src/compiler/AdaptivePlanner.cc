@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/AdaptivePlanner.h"
+
+#include "exec/ExecTime.h"
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace onert
+{
+namespace compiler
+{
+
+namespace
+{
+
+// Weight of a new measurement in the moving average of exec time
+constexpr float kMeasurementWeight = 0.25f;
+
+} // namespace
+
+AdaptivePlanner::AdaptivePlanner(uint32_t replan_interval, uint32_t max_replans,
+                                 uint32_t min_gain)
+    : _replan_interval{replan_interval}, _max_replans{max_replans}, _min_gain{min_gain}
+{
+  assert(replan_interval > 0);
+  assert(min_gain < 100);
+}
+
+std::shared_ptr<exec::ExecTime>
+AdaptivePlanner::execTime(const std::vector<const backend::Backend *> &backends)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  if (_exec_time == nullptr)
+    _exec_time = std::make_shared<exec::ExecTime>(backends);
+  return _exec_time;
+}
+
+void AdaptivePlanner::propose(const Plan &plan)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  if (_proposed == nullptr)
+    _proposed = std::make_unique<Plan>();
+  // A plan covers all subgraphs of a model, each of them is scheduled separately
+  _proposed->entries.insert(_proposed->entries.end(), plan.entries.begin(), plan.entries.end());
+  _proposed->transfer_time += plan.transfer_time;
+}
+
+void AdaptivePlanner::discardProposal()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _proposed.reset();
+}
+
+bool AdaptivePlanner::acceptProposal()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  if (_proposed == nullptr)
+    return false;
+
+  auto proposed = std::move(_proposed);
+  const auto proposed_cost = planCost(*proposed);
+  if (_current == nullptr)
+  {
+    _current = std::move(proposed);
+    _planned_cost = proposed_cost;
+    return true;
+  }
+
+  ++_replans;
+  const auto current_cost = planCost(*_current);
+  if (!isGain(current_cost, proposed_cost))
+  {
+    // Keep the current plan, and measure drift from now on
+    VERBOSE(AdaptivePlanner) << "Keep the current plan(" << current_cost << "us), new plan("
+                             << proposed_cost << "us) is not cheaper enough" << std::endl;
+    _planned_cost = current_cost;
+    return false;
+  }
+
+  VERBOSE(AdaptivePlanner) << "Switch the plan(" << current_cost << "us) to new plan("
+                           << proposed_cost << "us)" << std::endl;
+  _current = std::move(proposed);
+  _planned_cost = proposed_cost;
+  return true;
+}
+
+void AdaptivePlanner::record(const backend::Backend *backend, const std::string &operation,
+                             bool quant, uint32_t size, int64_t time)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  assert(_exec_time != nullptr);
+  if (!_recording)
+    return;
+  _exec_time->blendOperationExecTime(backend, operation, quant, size, time, kMeasurementWeight);
+}
+
+int64_t AdaptivePlanner::estimate(const backend::Backend *backend, const std::string &operation,
+                                  bool quant, uint32_t size)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  assert(_exec_time != nullptr);
+  const auto time = _exec_time->getOperationExecTime(backend, operation, quant, size);
+  return time == exec::ExecTime::NOT_FOUND ? 1 : time;
+}
+
+void AdaptivePlanner::pauseRecording()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _recording = false;
+}
+
+void AdaptivePlanner::resumeRecording()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _recording = true;
+}
+
+void AdaptivePlanner::onExecutionEnd()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  ++_runs;
+}
+
+bool AdaptivePlanner::needsReplan()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  if (_current == nullptr || _runs < _replan_interval || _replans >= _max_replans)
+    return false;
+
+  _runs = 0;
+  const auto current_cost = planCost(*_current);
+  const auto drift = std::llabs(current_cost - _planned_cost);
+  VERBOSE(AdaptivePlanner) << "Estimate of the current plan: " << current_cost
+                           << "us, planned: " << _planned_cost << "us" << std::endl;
+  return drift * 100 >= _planned_cost * static_cast<int64_t>(_min_gain);
+}
+
+int64_t AdaptivePlanner::planCost(const Plan &plan) const
+{
+  int64_t cost = plan.transfer_time;
+  for (const auto &entry : plan.entries)
+  {
+    const auto time =
+        _exec_time->getOperationExecTime(entry.backend, entry.operation, entry.quant, entry.size);
+    // Not measured yet, it is optimistic to make the planner explore it
+    cost += time == exec::ExecTime::NOT_FOUND ? 1 : time;
+  }
+  return cost;
+}
+
+bool AdaptivePlanner::isGain(int64_t from, int64_t to) const
+{
+  return to * 100 < from * static_cast<int64_t>(100 - _min_gain);
+}
+
+std::shared_ptr<AdaptivePlanner> AdaptivePlanner::createFromGlobalConfig()
+{
+  if (!util::getConfigBool(util::config::ADAPTIVE_SCHEDULER))
+    return nullptr;
+
+  const auto replan_interval = util::getConfigInt(util::config::ADAPTIVE_REPLAN_INTERVAL);
+  const auto max_replans = util::getConfigInt(util::config::ADAPTIVE_MAX_REPLANS);
+  const auto min_gain = util::getConfigInt(util::config::ADAPTIVE_MIN_GAIN);
+  if (replan_interval <= 0 || max_replans < 0 || min_gain < 0 || min_gain >= 100)
+    throw std::runtime_error("Invalid config for adaptive scheduling");
+
+  return std::make_shared<AdaptivePlanner>(replan_interval, max_replans, min_gain);
+}
+
+bool AdaptivePlanner::isQuant(const ir::Graph &graph, const ir::Operation &node)
+{
+  for (const auto &input : node.getInputs())
+  {
+    const auto &obj = graph.operands().at(input);
+    if (obj.typeInfo().type() == ir::DataType::QUANT8_ASYMM)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t AdaptivePlanner::flattenedIOSize(const ir::Graph &graph, const ir::Operation &node)
+{
+  uint32_t size = 0;
+  for (const auto &ind : node.getInputs() + node.getOutputs())
+  {
+    size += graph.operands().at(ind).info().total_size();
+  }
+  return size;
+}
+
+} // namespace compiler
+} // namespace onert
@@ -27,6 +27,8 @@
 #include "compiler/ManualScheduler.h"
 #include "compiler/HEScheduler.h"
 #include "exec/ExecTime.h"
+#include "exec/ExecutionObservers.h"
+#include "exec/ExecutorBase.h"
 #include "ir/operation/LowerInfo.h"
 #include "dumper/dot/DotDumper.h"
 #include "compiler/Linear.h"
@@ -35,6 +37,11 @@
 #include "util/logging.h"
 #include "ir/OperationDumper.h"
 #include "misc/string_helpers.h"
+#include "misc/polymorphic_downcast.h"
+
+#include <fstream>
+#include <map>
+#include <sstream>
 
 namespace onert
 {
@@ -77,11 +84,19 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   }
 
   options.trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
+  options.trace_sample_interval = util::getConfigInt(util::config::TRACE_SAMPLE_INTERVAL);
+  options.perf_counters = util::getConfigBool(util::config::PERF_COUNTERS);
+  if (util::getConfigBool(util::config::OP_STATS) || options.perf_counters)
+    options.op_stats = std::make_shared<exec::OpStats>();
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.op_seq_max_node = util::getConfigInt(util::config::OP_SEQ_MAX_NODE);
   options.executor = util::getConfigString(util::config::EXECUTOR);
+  options.linear_order = util::getConfigString(util::config::LINEAR_ORDER);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
+  options.adaptive_planner = AdaptivePlanner::createFromGlobalConfig();
+  if (options.adaptive_planner)
+    options.he_scheduler = true;
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
 
@@ -149,6 +164,51 @@ void setInputToDynamicTensor(const std::shared_ptr<onert::ir::Graph> &primary_su
   }
 }
 
+/**
+ * @brief Make the key of options and input shapes that schedule cache is valid for
+ */
+std::string scheduleCacheKey(const CompilerOptions &options, const ir::Graph &primary_subgraph)
+{
+  std::ostringstream key;
+  key << nnfw::misc::join(options.backend_list.begin(), options.backend_list.end(), "/") << ";"
+      << options.executor << ";" << options.he_scheduler << ";";
+
+  // Sort manual scheduler options, as unordered_map does not keep the order
+  const auto &ms_options = options.manual_scheduler_options;
+  key << ms_options.backend_for_all << ";";
+  std::map<int, std::string> opcode_to_backend;
+  for (const auto &pair : ms_options.opcode_to_backend)
+    opcode_to_backend.emplace(static_cast<int>(pair.first), pair.second);
+  for (const auto &pair : opcode_to_backend)
+    key << pair.first << "=" << pair.second << ",";
+  key << ";";
+  std::map<uint32_t, std::string> index_to_backend;
+  for (const auto &pair : ms_options.index_to_backend)
+    index_to_backend.emplace(pair.first.value(), pair.second);
+  for (const auto &pair : index_to_backend)
+    key << pair.first << "=" << pair.second << ",";
+  key << ";";
+
+  // HEScheduler assigns backends by input sizes
+  for (const auto &input : primary_subgraph.getInputs())
+  {
+    for (const auto dim : primary_subgraph.operands().at(input).shape().dims())
+      key << dim << "x";
+    key << ",";
+  }
+
+  // HEScheduler also assigns backends by measurements, which change with every profiling run
+  if (options.he_scheduler)
+  {
+    const auto measurement_file = exec::JSON::measurementFile();
+    if (std::ifstream(measurement_file).is_open())
+      key << ";" << ScheduleCache::stampFile(measurement_file);
+    else
+      key << ";none";
+  }
+  return key.str();
+}
+
 Compiler::Compiler(const std::shared_ptr<ir::Subgraphs> &subgs)
     : _subgraphs{subgs}, _executors{nullptr}, _state{State::CREATED}
 {
@@ -169,6 +229,19 @@ void Compiler::checkProfilerConditions()
     throw std::runtime_error("Profiling mode works only with 'Dataflow' executor");
 }
 
+void Compiler::checkAdaptiveConditions()
+{
+  if (!_options.he_scheduler)
+    throw std::runtime_error("Heterogeneous scheduler must be enabled for adaptive scheduling.");
+
+  if (_options.he_profiling_mode)
+    throw std::runtime_error("Adaptive scheduling cannot be used with profiling mode");
+
+  // Parallel executor runs operations concurrently, so their measured times overlap
+  if (_options.executor == "Parallel")
+    throw std::runtime_error("Adaptive scheduling works only with 'Linear' or 'Dataflow' executor");
+}
+
 void Compiler::compile(void)
 {
   {
@@ -179,12 +252,22 @@ void Compiler::compile(void)
                                           _options.backend_list.end(), "/")
                       << std::endl;
     VERBOSE(Compiler) << "trace_filepath           : " << _options.trace_filepath << std::endl;
+    VERBOSE(Compiler) << "trace_sample_interval    : " << _options.trace_sample_interval
+                      << std::endl;
+    VERBOSE(Compiler) << "op_stats                 : " << (_options.op_stats != nullptr)
+                      << std::endl;
+    VERBOSE(Compiler) << "perf_counters            : " << _options.perf_counters << std::endl;
     VERBOSE(Compiler) << "graph_dump_level         : " << _options.graph_dump_level << std::endl;
     VERBOSE(Compiler) << "op_seq_max_node          : " << _options.op_seq_max_node << std::endl;
     VERBOSE(Compiler) << "executor                 : " << _options.executor << std::endl;
+    VERBOSE(Compiler) << "linear_order             : " << _options.linear_order << std::endl;
     VERBOSE(Compiler) << "manual_scheduler_options : (Too many things to print)" << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
+    VERBOSE(Compiler) << "adaptive_scheduler       : " << (_options.adaptive_planner != nullptr)
+                      << std::endl;
+    VERBOSE(Compiler) << "schedule_cache           : " << (_options.schedule_cache != nullptr)
+                      << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
     VERBOSE(Compiler) << std::noboolalpha;
@@ -213,6 +296,15 @@ void Compiler::compile(void)
   // Mode check
   if (_options.he_profiling_mode)
     checkProfilerConditions();
+  if (_options.adaptive_planner)
+    checkAdaptiveConditions();
+
+  // Schedules are cached only for HEScheduler, and not restored for profiling and adaptive
+  // scheduling, which schedule by new measurements
+  const bool use_schedule_cache = _options.schedule_cache && _options.he_scheduler &&
+                                  !_options.he_profiling_mode && !_options.adaptive_planner;
+  if (use_schedule_cache)
+    _options.schedule_cache->load(scheduleCacheKey(_options, *primary_subgraph()));
 
   /***************************************************
    * Backend independent analysis & optimization phase
@@ -226,7 +318,12 @@ void Compiler::compile(void)
     dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
 
     // Lower: Assign backend
-    lowered_subgs[index] = std::make_unique<ir::LoweredGraph>(subg, _options);
+    const ScheduleCache::Schedule *schedule = nullptr;
+    if (use_schedule_cache)
+      schedule = _options.schedule_cache->find(index);
+    lowered_subgs[index] = std::make_unique<ir::LoweredGraph>(subg, _options, schedule);
+    if (use_schedule_cache)
+      _options.schedule_cache->insert(index, lowered_subgs[index]->schedule());
 
     // Check backend(s) for subgraph support FP16
     bool backends_support_fp16 = true;
@@ -247,6 +344,9 @@ void Compiler::compile(void)
 
   _subgraphs.reset();
 
+  if (use_schedule_cache)
+    _options.schedule_cache->save();
+
   /*************************************************************
    *  Backend independent analysis & optimization phase finished
    *************************************************************/
@@ -272,9 +372,27 @@ void Compiler::compile(void)
     lowered_subg->graph().operations().iterate(
         [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
 
+    // Observers are made here since the executor does not know its subgraph index
+    std::vector<std::unique_ptr<exec::IExecutionObserver>> op_stats_observers;
+    if (_options.op_stats)
+    {
+      op_stats_observers.emplace_back(
+          std::make_unique<exec::OpStatsObserver>(_options.op_stats, subg_index, *lowered_subg));
+      if (_options.perf_counters)
+      {
+        op_stats_observers.emplace_back(std::make_unique<exec::PerfCounterObserver>(
+            _options.op_stats, subg_index, *lowered_subg));
+      }
+    }
+
     auto executor = std::unique_ptr<exec::IExecutor>{
         ExecutorFactory::get().create(std::move(lowered_subg), _options, _executors)};
     executor->setIndexedRanks(indexed_ranks);
+    for (auto &observer : op_stats_observers)
+    {
+      nnfw::misc::polymorphic_downcast<exec::ExecutorBase *>(executor.get())
+          ->addObserver(std::move(observer));
+    }
     _executors->insert(std::make_pair(subg_index, std::move(executor)));
   }
 
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DataflowTensorPlanner.h"
+
+#include "backend/Backend.h"
+#include "backend/ITensorBuilder.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+
+namespace
+{
+
+/**
+ * @brief Set of OpSequences, represented by their positions in the order
+ */
+class PositionSet
+{
+public:
+  explicit PositionSet(size_t size) : _words((size + 63) / 64, 0) {}
+
+public:
+  void set(size_t pos) { _words[pos / 64] |= (uint64_t{1} << (pos % 64)); }
+  bool test(size_t pos) const { return (_words[pos / 64] >> (pos % 64)) & 1; }
+  void merge(const PositionSet &other)
+  {
+    for (size_t i = 0; i < _words.size(); ++i)
+      _words[i] |= other._words[i];
+  }
+  void intersect(const PositionSet &other)
+  {
+    for (size_t i = 0; i < _words.size(); ++i)
+      _words[i] &= other._words[i];
+  }
+
+private:
+  std::vector<uint64_t> _words;
+};
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+void DataflowTensorPlanner::planTensors(const ir::LoweredGraph &lowered_graph,
+                                        const std::vector<ir::OpSequenceIndex> &order)
+{
+  const auto &graph = lowered_graph.graph();
+  const auto &op_seqs = lowered_graph.op_seqs();
+  const auto num_op_seqs = order.size();
+
+  if (num_op_seqs == 0)
+    return;
+
+  // Position of OpSequence which each operation belongs to
+  std::unordered_map<ir::OperationIndex, size_t> op_position;
+  for (size_t pos = 0; pos < num_op_seqs; ++pos)
+  {
+    for (const auto &elem : op_seqs.at(order[pos]))
+    {
+      op_position[elem.index] = pos;
+    }
+  }
+
+  // descendants[pos] : OpSequences that cannot start before order[pos] finishes
+  // NOTE order is topological, so descendants of a position are always after the position
+  std::vector<PositionSet> descendants(num_op_seqs, PositionSet{num_op_seqs});
+  for (size_t pos = num_op_seqs; pos-- > 0;)
+  {
+    for (const auto &elem : op_seqs.at(order[pos]))
+    {
+      for (const auto &output : elem.node->getOutputs())
+      {
+        for (const auto &use : graph.operands().at(output).getUses().list())
+        {
+          const auto it = op_position.find(use);
+          if (it == op_position.end() || it->second == pos)
+            continue;
+
+          assert(it->second > pos);
+          descendants[pos].set(it->second);
+          descendants[pos].merge(descendants[it->second]);
+        }
+      }
+    }
+  }
+
+  ir::OperandIndexMap<std::shared_ptr<backend::ITensorBuilder>> tensor_builder_map;
+  ir::OperandIndexMap<uint32_t> def_map;
+  ir::OperandIndexSequence constants;
+
+  // Prepare scanning (Same as Linear::planTensors)
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    const auto lower_info = lowered_graph.getLowerInfo(ind);
+    if (lower_info->def_factors().size() == 0 && lower_info->use_factors().size() == 0)
+    {
+      VERBOSE(DataflowTensorPlanner) << "Operand #" << ind.value()
+                                     << " will not be used. no more process." << std::endl;
+      return;
+    }
+
+    def_map[ind] = obj.getDef().size(); // should be 1 or 0
+
+    bool is_const = obj.isConstant();
+    if (is_const)
+    {
+      constants.append(ind);
+    }
+
+    auto factor = lower_info->def_factors().getOnlyElement();
+    auto backend = factor.backend();
+    auto tensor_builder = lowered_graph.backend_contexts().at(backend)->tensor_builder;
+    if (!tensor_builder->isRegistered(ind))
+    {
+      // These tensors do not exist in any op_seq (No use and def)
+      const auto info = obj.info();
+      const auto backend_layout = factor.layout();
+      tensor_builder->registerTensorInfo(ind, info, backend_layout, is_const);
+    }
+
+    tensor_builder_map[ind] = tensor_builder;
+  });
+
+  // Find where each tensor can be released
+  //
+  // A tensor is alive until all its users finish. Any OpSequence which is not a descendant of
+  // all the users may run at the same time with one of the users, so the tensor must be kept
+  // until the last of such OpSequences in the order.
+  //
+  //      [OP_SEQS0]
+  //       |      |
+  //      [0]    [1]            # [0] is used by OP_SEQS1 only
+  //       |      |
+  //  [OP_SEQS1] [OP_SEQS2]     # OP_SEQS2 may run concurrently with OP_SEQS1
+  //       |      |
+  //      [2]    [3]
+  //       \      /
+  //      [OP_SEQS3]            # Every OpSequence from here depends on OP_SEQS1
+  //
+  // With order {OP_SEQS0, OP_SEQS1, OP_SEQS2, OP_SEQS3}, [0] is released after OP_SEQS2 (not
+  // after OP_SEQS1), so [3] does not reuse memory of [0].
+  std::vector<std::vector<ir::OperandIndex>> releases(num_op_seqs);
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    if (tensor_builder_map.find(ind) == tensor_builder_map.end())
+      return;
+    // Constants and model outputs are alive until the end
+    if (obj.isConstant() || graph.getOutputs().contains(ind))
+      return;
+
+    std::vector<size_t> users;
+    for (const auto &use : obj.getUses().list())
+    {
+      users.emplace_back(op_position.at(use));
+    }
+    // Unused output is written by its definer, so it is alive while the definer runs
+    if (users.empty())
+    {
+      for (const auto &def : obj.getDef().list())
+      {
+        users.emplace_back(op_position.at(def));
+      }
+    }
+    assert(!users.empty());
+
+    PositionSet after_all_users = descendants[users.front()];
+    for (const auto user : users)
+    {
+      after_all_users.intersect(descendants[user]);
+    }
+
+    // A user is not a descendant of itself, so this stops at the last user at the latest
+    size_t last = num_op_seqs - 1;
+    while (after_all_users.test(last))
+    {
+      assert(last > 0);
+      --last;
+    }
+    releases[last].emplace_back(ind);
+  });
+
+  // Start scanning to do notify{First|Last}Use for each tensor
+
+  // Allocate constant operands first
+  VERBOSE(DataflowTensorPlanner) << "TENSORS as CONSTANT" << std::endl;
+  for (const auto &ind : constants)
+  {
+    tensor_builder_map[ind]->notifyFirstUse(ind);
+  }
+
+  // Allocate Model's inputs
+  VERBOSE(DataflowTensorPlanner) << "TENSORS as MODEL INPUT" << std::endl;
+  for (const auto &ind : graph.getInputs())
+  {
+    auto it = tensor_builder_map.find(ind);
+    if (it == tensor_builder_map.end()) // for GeneratedTests.xxx_weights_as_inputs
+      continue;
+    it->second->notifyFirstUse(ind);
+  }
+
+  // At each OpSequence,
+  // 1. Scan DEF of outputs. If the DEF, allocate it
+  // 2. Deallocate tensors which cannot be alive with tensors allocated after this
+  VERBOSE(DataflowTensorPlanner) << "TENSORS" << std::endl;
+  for (size_t pos = 0; pos < num_op_seqs; ++pos)
+  {
+    for (const auto &elem : op_seqs.at(order[pos]))
+    {
+      for (const auto &ind : elem.node->getOutputs())
+      {
+        assert(def_map.find(ind) != def_map.end());
+        if (def_map[ind])
+        {
+          def_map[ind] = 0;
+          tensor_builder_map[ind]->notifyFirstUse(ind);
+        }
+      }
+    }
+
+    for (const auto &ind : releases[pos])
+    {
+      tensor_builder_map[ind]->notifyLastUse(ind);
+    }
+  }
+
+  // Dispose model outputs and constants
+  ir::OperandIndexMap<bool> disposed;
+  for (const auto &ind : graph.getOutputs() + constants)
+  {
+    auto it = tensor_builder_map.find(ind);
+    if (it == tensor_builder_map.end() || disposed[ind])
+      continue;
+    disposed[ind] = true;
+    it->second->notifyLastUse(ind);
+  }
+
+  assert(
+      std::all_of(def_map.begin(), def_map.end(),
+                  [](std::pair<const ir::OperandIndex, uint32_t> it) { return it.second == 0; }));
+}
+
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_DATAFLOW_TENSOR_PLANNER_H__
+#define __ONERT_COMPILER_DATAFLOW_TENSOR_PLANNER_H__
+
+#include <vector>
+
+#include "ir/Index.h"
+#include "ir/LoweredGraph.h"
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Class to plan tensors for DataflowExecutor and ParallelExecutor
+ *
+ * Those executors run an OpSequence as soon as its inputs are ready, so OpSequences can run in
+ * any topological order or even concurrently. Liveness from a single linear order is not valid
+ * for them, so this planner derives it from the dependency DAG of OpSequences instead.
+ *
+ * Tensors are claimed in the given topological order. A tensor is released right after the last
+ * OpSequence in the order that is not a descendant of every user of the tensor. Each tensor
+ * claimed after that is produced by a descendant of all the users, so it can never be alive
+ * together with the released one in any schedule.
+ */
+class DataflowTensorPlanner
+{
+public:
+  /**
+   * @brief Call notifyFirstUse/notifyLastUse of tensor builders for all tensors of the graph
+   *
+   * @param lowered_graph Lowered graph
+   * @param order Topological order of OpSequences (e.g. the result of Linear::linearize)
+   */
+  static void planTensors(const ir::LoweredGraph &lowered_graph,
+                          const std::vector<ir::OpSequenceIndex> &order);
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_DATAFLOW_TENSOR_PLANNER_H__
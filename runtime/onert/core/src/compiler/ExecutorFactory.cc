@@ -25,6 +25,7 @@
 #include "compiler/ExecutionBuilder.h"
 #include "exec/ExecTime.h"
 #include "compiler/Linear.h"
+#include "compiler/DataflowTensorPlanner.h"
 #include "backend/IConstantInitializer.h"
 #include "backend/IKernelGenerator.h"
 #include "backend/IShapeFixer.h"
@@ -183,7 +184,7 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
    * Code generation phase
    ***********************/
 
-  auto order = Linear::linearize(*lowered_graph);
+  auto order = Linear::linearize(*lowered_graph, options.linear_order);
   runTensorRegistration(lowered_graph.get(), order);
   Linear::dump(*lowered_graph, order);
   Linear::planTensors(*lowered_graph, order);
@@ -248,10 +249,20 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
   auto exec = new exec::LinearExecutor{std::move(lowered_graph), tensor_builders,
                                        std::move(code_map), order};
 
+  if (options.adaptive_planner)
+  {
+    std::unique_ptr<exec::IExecutionObserver> obs =
+        std::make_unique<exec::AdaptiveObserver>(options.adaptive_planner);
+    exec->addObserver(std::move(obs));
+    // Backend timers like CLTimer read the time of functions when they are finished
+    exec->setProfilingMode(true);
+  }
+
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp =
-        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath);
+        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath,
+                                                      options.trace_sample_interval);
     exec->addObserver(std::move(ctp));
   }
 
@@ -271,7 +282,7 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     pair.second->fixShapes();
   }
 
-  auto order = Linear::linearize(*lowered_graph);
+  auto order = Linear::linearize(*lowered_graph, options.linear_order);
   runTensorRegistration(lowered_graph.get(), order);
 
   backend::TensorBuilderSet tensor_builders;
@@ -280,17 +291,9 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     tensor_builders.insert(e.second->tensor_builder);
   }
 
-  // To make tensors never be deallocated, this is a workaround to use static memory planner
-  for (auto &tensor_builder : tensor_builders)
-  {
-    lowered_graph->graph().operands().iterate(
-        [&](const ir::OperandIndex &ind, const ir::Operand &) {
-          if (tensor_builder->isRegistered(ind))
-          {
-            tensor_builder->notifyFirstUse(ind);
-          }
-        });
-  }
+  // OpSequences may run in any topological order, so liveness of tensors is derived from the
+  // dependency DAG rather than from the linear order
+  DataflowTensorPlanner::planTensors(*lowered_graph, order);
 
   for (auto &tensor_builder : tensor_builders)
   {
@@ -366,13 +369,23 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
       dataflow_exec->addObserver(std::move(obs));
       dataflow_exec->setProfilingMode(true);
     }
+    // Parallel executor is not allowed for adaptive scheduling, see checkAdaptiveConditions
+    if (options.adaptive_planner)
+    {
+      std::unique_ptr<exec::IExecutionObserver> obs =
+          std::make_unique<exec::AdaptiveObserver>(options.adaptive_planner);
+      dataflow_exec->addObserver(std::move(obs));
+      // Backend timers like CLTimer read the time of functions when they are finished
+      dataflow_exec->setProfilingMode(true);
+    }
     exec = dataflow_exec;
   }
 
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp =
-        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath);
+        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath,
+                                                      options.trace_sample_interval);
     exec->addObserver(std::move(ctp));
   }
 
@@ -253,6 +253,8 @@ std::unique_ptr<compiler::BackendResolver> HEScheduler::schedule(const ir::Graph
   {
     scheduleBranch(rank.second, visited);
   }
+  if (_planner)
+    proposePlan();
   VERBOSE(HEScheduler::schedule) << "task scheduling finished" << std::endl;
   return std::move(_backend_resolver);
 }
@@ -283,7 +285,8 @@ int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
 int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backend *backend)
 {
   // if there is no profiling info don't use this backend during scheduling
-  if (!_is_profiling_mode)
+  // Adaptive scheduling explores it like profiling mode, and measures it while running
+  if (!_is_profiling_mode && !_planner)
   {
     VERBOSE(HEScheduler::tryBackend)
         << "Trying to HE schedule while there is no profiling info for " << node.name()
@@ -314,6 +317,30 @@ int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backen
   return _is_supported[backend][node.name()] ? 1 : _exec_time->getMax();
 }
 
+void HEScheduler::proposePlan()
+{
+  AdaptivePlanner::Plan plan;
+  _graph->operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &node) {
+    const auto backend = _backend_resolver->getBackend(index);
+    plan.entries.push_back({backend, node.name(), isQuant(*_graph, node),
+                            getOperationsFlattenedIOSize(*_graph, node)});
+
+    for (const auto &input_operand_idx : node.getInputs())
+    {
+      const auto &input_operand = _graph->operands().at(input_operand_idx);
+      const bool quant = input_operand.typeInfo().type() == ir::DataType::QUANT8_ASYMM;
+      for (const auto &input_node_idx : input_operand.getDef().list())
+      {
+        const auto parent_backend = _backend_resolver->getBackend(input_node_idx);
+        if (parent_backend != backend)
+          plan.transfer_time += getPermuteTime(parent_backend, backend, quant,
+                                               input_operand.info().total_size() * 2);
+      }
+    }
+  });
+  _planner->propose(plan);
+}
+
 void HEScheduler::makeRank()
 {
   VERBOSE(HEScheduler::makeRank) << "task prioritizing" << std::endl;
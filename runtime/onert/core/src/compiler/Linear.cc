@@ -15,6 +15,9 @@
  */
 
 #include <algorithm>
+#include <queue>
+#include <stdexcept>
+#include <unordered_set>
 
 #include "Linear.h"
 
@@ -25,98 +28,314 @@
 #include "backend/Backend.h"
 #include "util/logging.h"
 
-namespace onert
-{
-namespace compiler
+namespace
 {
 
-std::vector<ir::OpSequenceIndex> Linear::linearize(const ir::LoweredGraph &lowered_graph)
+using namespace onert;
+
+/**
+ * @brief Dependencies between OpSequences via non-constant operands
+ */
+struct OpSeqGraph
 {
-  std::vector<ir::OpSequenceIndex> order;
+  // Consumers of each operand, in order of op_seqs iteration
+  std::unordered_map<ir::OperandIndex, std::vector<ir::OpSequenceIndex>> consumers;
+  // Non-constant inputs and outputs of each OpSequence without duplicates
+  std::unordered_map<ir::OpSequenceIndex, std::vector<ir::OperandIndex>> inputs;
+  std::unordered_map<ir::OpSequenceIndex, std::vector<ir::OperandIndex>> outputs;
+  // OpSequence that defines each operand
+  std::unordered_map<ir::OperandIndex, ir::OpSequenceIndex> producer;
+  // Memory size of each non-constant operand (0 if unknown)
+  std::unordered_map<ir::OperandIndex, uint64_t> size;
+
+  explicit OpSeqGraph(const ir::LoweredGraph &lowered_graph)
   {
-    const ir::Graph &graph = lowered_graph.graph();
-    const ir::OpSequences &op_seqs = lowered_graph.op_seqs();
-    const ir::Operands &operands = graph.operands();
-    // op_seqs can't access a op_seq by an operand so that input_to_op_seqs can offer it
-    std::unordered_map<ir::OperandIndex, std::list<ir::OpSequenceIndex>> input_to_op_seqs;
-
-    // Get the relations between input/op_seq to be used for dfs-post-iter
-    //
-    //      [0]               # input -> _input_to_op_seqs[0] = {OP_SEQS0}
-    //       |
-    //     [OP_SEQS0]
-    //       |
-    //      [1]---------.     # input -> _input_to_op_seqs[1] = {OP_SEQS1, OP_SEQS2}
-    //       |          |
-    //  [OP_SEQS1]  [OP_SEQS2]
-    //       |          |
-    //      [2]        [3]    # input -> _input_to_op_seqs[2] = {OP_SEQS3}
-    //       \         /      # input -> _input_to_op_seqs[3] = {OP_SEQS3}
-    //       [OP_SEQS3]
-    //            |
-    //           [4]
-    op_seqs.iterate([&](const ir::OpSequenceIndex &op_seq_idx, const ir::OpSequence &op_seq) {
-      for (auto input : op_seq.getInputs())
+    const auto &operands = lowered_graph.graph().operands();
+    auto unique_non_constants = [&](const ir::OperandIndexSequence &seq) {
+      std::vector<ir::OperandIndex> result;
+      for (const auto &ind : seq)
       {
-        // only valid_inputs
-        const auto &operand = operands.at(input);
-        if (operand.isConstant())
+        if (operands.at(ind).isConstant())
           continue;
-
-        auto it = input_to_op_seqs.find(input);
-        if (it == input_to_op_seqs.end())
-        {
-          std::list<ir::OpSequenceIndex> list{op_seq_idx};
-          input_to_op_seqs[input] = list;
-        }
-        else
-        {
-          it->second.push_back(op_seq_idx);
-        }
+        if (std::find(result.begin(), result.end(), ind) != result.end())
+          continue;
+        result.emplace_back(ind);
+        const auto &shape = operands.at(ind).shape();
+        bool known = true;
+        for (int i = 0; i < shape.rank(); ++i)
+          known = known && shape.dim(i) >= 0;
+        size[ind] = known ? operands.at(ind).info().total_size() : 0;
       }
-    });
+      return result;
+    };
+
+    lowered_graph.op_seqs().iterate(
+        [&](const ir::OpSequenceIndex &op_seq_idx, const ir::OpSequence &op_seq) {
+          inputs[op_seq_idx] = unique_non_constants(op_seq.getInputs());
+          outputs[op_seq_idx] = unique_non_constants(op_seq.getOutputs());
+          for (const auto &ind : inputs[op_seq_idx])
+            consumers[ind].emplace_back(op_seq_idx);
+          for (const auto &ind : outputs[op_seq_idx])
+            producer[ind] = op_seq_idx;
+        });
+  }
+
+  const std::vector<ir::OpSequenceIndex> &consumersOf(const ir::OperandIndex &ind) const
+  {
+    static const std::vector<ir::OpSequenceIndex> empty;
+    auto it = consumers.find(ind);
+    return it == consumers.end() ? empty : it->second;
+  }
+};
 
-    std::unordered_map<ir::OpSequenceIndex, bool> visited;
-    op_seqs.iterate(
-        [&](const ir::OpSequenceIndex &index, const ir::OpSequence &) { visited[index] = false; });
+/**
+ * @brief Reverse post-order of DFS on OpSequences
+ *
+ * NOTE This uses an explicit stack instead of recursion to work with deep graphs
+ */
+std::vector<ir::OpSequenceIndex> linearizeDFS(const ir::LoweredGraph &lowered_graph,
+                                              const OpSeqGraph &g)
+{
+  // Get the relations between input/op_seq to be used for dfs-post-iter
+  //
+  //      [0]               # input -> consumers[0] = {OP_SEQS0}
+  //       |
+  //     [OP_SEQS0]
+  //       |
+  //      [1]---------.     # input -> consumers[1] = {OP_SEQS1, OP_SEQS2}
+  //       |          |
+  //  [OP_SEQS1]  [OP_SEQS2]
+  //       |          |
+  //      [2]        [3]    # input -> consumers[2] = {OP_SEQS3}
+  //       \         /      # input -> consumers[3] = {OP_SEQS3}
+  //       [OP_SEQS3]
+  //            |
+  //           [4]
+  std::vector<ir::OpSequenceIndex> order;
+  std::unordered_set<ir::OpSequenceIndex> visited;
+
+  struct Frame
+  {
+    ir::OpSequenceIndex index;
+    std::vector<ir::OpSequenceIndex> successors;
+    size_t next;
+  };
+  auto make_frame = [&](const ir::OpSequenceIndex &index) {
+    Frame frame{index, {}, 0};
+    const auto &op_seq = lowered_graph.op_seqs().at(index);
+    // The outputs should be not constants
+    for (const auto &output : op_seq.getOutputs())
+    {
+      const auto &consumers = g.consumersOf(output);
+      frame.successors.insert(frame.successors.end(), consumers.begin(), consumers.end());
+    }
+    return frame;
+  };
 
-    std::function<void(const ir::OpSequenceIndex &, const ir::OpSequence &)> dfs_recursive =
-        [&](const ir::OpSequenceIndex &index, const ir::OpSequence &op_seq) -> void {
-      if (visited[index])
-        return;
-      visited[index] = true;
+  lowered_graph.op_seqs().iterate([&](const ir::OpSequenceIndex &root, const ir::OpSequence &) {
+    if (!visited.insert(root).second)
+      return;
 
-      // The outputs should be not constants
-      for (auto output : op_seq.getOutputs())
+    std::vector<Frame> stack;
+    stack.emplace_back(make_frame(root));
+    while (!stack.empty())
+    {
+      auto &top = stack.back();
+      if (top.next < top.successors.size())
       {
-        const auto it = input_to_op_seqs.find(output);
-        if (it != input_to_op_seqs.end())
-        {
-          const auto &op_seq_index_list = it->second;
-          for (const auto &index : op_seq_index_list)
-          {
-            auto &op_seq = op_seqs.at(index);
-            dfs_recursive(index, op_seq);
-          }
-        }
+        const auto successor = top.successors[top.next++];
+        if (visited.insert(successor).second)
+          stack.emplace_back(make_frame(successor));
+        continue;
       }
+      order.emplace_back(top.index);
+      stack.pop_back();
+    }
+  });
 
-      order.emplace_back(index);
-    };
+  // All of the nodes must have been visited.
+  assert(order.size() == g.inputs.size());
+
+  // NOTE. Now these op_seq are on the reverse order
+  std::reverse(order.begin(), order.end());
+  return order;
+}
 
-    op_seqs.iterate(dfs_recursive);
+/**
+ * @brief Topological order that greedily keeps live bytes small
+ *
+ * Among OpSequences whose inputs are ready, it picks the one that increases live bytes the least,
+ * i.e. (bytes of its outputs) - (bytes of inputs whose last use is this OpSequence). Ties are
+ * broken by taking the most recently readied one, which finishes a branch before starting
+ * another like DFS does. Scores are updated lazily through a priority queue, so it takes
+ * O((V + E) log V) time for V OpSequences and E edges.
+ */
+std::vector<ir::OpSequenceIndex> linearizeMemoryAware(const ir::LoweredGraph &lowered_graph,
+                                                      const OpSeqGraph &g)
+{
+  const auto &graph_outputs = lowered_graph.graph().getOutputs();
 
-    // All of the nodes must have been visited.
-    assert(
-        std::all_of(visited.begin(), visited.end(),
-                    [](const std::pair<const ir::OpSequenceIndex, bool> &v) { return v.second; }));
+  std::unordered_map<ir::OperandIndex, uint32_t> remaining_uses;
+  for (const auto &pair : g.consumers)
+  {
+    remaining_uses[pair.first] = pair.second.size();
+    // Model outputs are never freed
+    if (graph_outputs.contains(pair.first))
+      remaining_uses[pair.first]++;
+  }
 
-    // NOTE. Now these op_seq are on the reverse order
-    std::reverse(order.begin(), order.end());
+  std::unordered_map<ir::OpSequenceIndex, uint32_t> pending_inputs;
+  for (const auto &pair : g.inputs)
+  {
+    pending_inputs[pair.first] = 0;
+    for (const auto &ind : pair.second)
+    {
+      if (g.producer.find(ind) != g.producer.end())
+        pending_inputs[pair.first]++;
+    }
   }
+
+  auto score = [&](const ir::OpSequenceIndex &index) {
+    int64_t delta = 0;
+    for (const auto &ind : g.outputs.at(index))
+      delta += g.size.at(ind);
+    for (const auto &ind : g.inputs.at(index))
+    {
+      if (remaining_uses.at(ind) == 1)
+        delta -= g.size.at(ind);
+    }
+    return delta;
+  };
+
+  struct Candidate
+  {
+    int64_t score;
+    uint64_t stamp;
+    ir::OpSequenceIndex index;
+  };
+  auto worse = [](const Candidate &lhs, const Candidate &rhs) {
+    if (lhs.score != rhs.score)
+      return lhs.score > rhs.score;
+    return lhs.stamp < rhs.stamp;
+  };
+  std::priority_queue<Candidate, std::vector<Candidate>, decltype(worse)> ready(worse);
+  uint64_t stamp = 0;
+  auto push = [&](const ir::OpSequenceIndex &index) {
+    ready.push(Candidate{score(index), stamp++, index});
+  };
+
+  lowered_graph.op_seqs().iterate([&](const ir::OpSequenceIndex &index, const ir::OpSequence &) {
+    if (pending_inputs.at(index) == 0)
+      push(index);
+  });
+
+  std::vector<ir::OpSequenceIndex> order;
+  std::unordered_set<ir::OpSequenceIndex> scheduled;
+  while (!ready.empty())
+  {
+    const auto candidate = ready.top();
+    ready.pop();
+    // Skip stale entries. A fresh entry has been pushed whenever a score changed.
+    if (scheduled.find(candidate.index) != scheduled.end() ||
+        candidate.score != score(candidate.index))
+      continue;
+
+    const auto index = candidate.index;
+    scheduled.insert(index);
+    order.emplace_back(index);
+
+    for (const auto &ind : g.inputs.at(index))
+    {
+      if (--remaining_uses.at(ind) != 1)
+        continue;
+      // The last consumer of this operand now frees it, so its score has decreased
+      for (const auto &consumer : g.consumersOf(ind))
+      {
+        if (scheduled.find(consumer) == scheduled.end() && pending_inputs.at(consumer) == 0)
+          push(consumer);
+      }
+    }
+
+    for (const auto &ind : g.outputs.at(index))
+    {
+      for (const auto &consumer : g.consumersOf(ind))
+      {
+        if (--pending_inputs.at(consumer) == 0)
+          push(consumer);
+      }
+    }
+  }
+
+  assert(order.size() == g.inputs.size());
   return order;
 }
 
+/**
+ * @brief Peak bytes of non-constant operands alive at the same time when running in @c order
+ *
+ * NOTE This is the lower bound of the memory planner capacity for the order
+ */
+uint64_t peakLiveBytes(const ir::LoweredGraph &lowered_graph, const OpSeqGraph &g,
+                       const std::vector<ir::OpSequenceIndex> &order)
+{
+  const auto &graph_outputs = lowered_graph.graph().getOutputs();
+
+  std::unordered_map<ir::OperandIndex, uint32_t> remaining_uses;
+  uint64_t live = 0;
+  for (const auto &pair : g.consumers)
+  {
+    remaining_uses[pair.first] = pair.second.size();
+    // Operands not defined by any OpSequence (e.g. model inputs) are alive from the beginning
+    if (g.producer.find(pair.first) == g.producer.end())
+      live += g.size.at(pair.first);
+  }
+
+  uint64_t peak = live;
+  for (const auto &index : order)
+  {
+    for (const auto &ind : g.outputs.at(index))
+      live += g.size.at(ind);
+    peak = std::max(peak, live);
+    for (const auto &ind : g.inputs.at(index))
+    {
+      if (--remaining_uses.at(ind) == 0 && !graph_outputs.contains(ind))
+        live -= g.size.at(ind);
+    }
+  }
+  return peak;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+std::vector<ir::OpSequenceIndex> Linear::linearize(const ir::LoweredGraph &lowered_graph,
+                                                   const std::string &order_mode)
+{
+  const OpSeqGraph g{lowered_graph};
+
+  if (order_mode == "DFS")
+  {
+    return linearizeDFS(lowered_graph, g);
+  }
+  else if (order_mode == "MemoryAware")
+  {
+    auto dfs_order = linearizeDFS(lowered_graph, g);
+    auto mem_order = linearizeMemoryAware(lowered_graph, g);
+    const auto dfs_peak = peakLiveBytes(lowered_graph, g, dfs_order);
+    const auto mem_peak = peakLiveBytes(lowered_graph, g, mem_order);
+    VERBOSE(Linear) << "Peak live bytes - DFS: " << dfs_peak << ", MemoryAware: " << mem_peak
+                    << std::endl;
+    // Greedy choice is not always better, so take the better one
+    return mem_peak <= dfs_peak ? mem_order : dfs_order;
+  }
+
+  throw std::runtime_error("Linear: Unknown order mode '" + order_mode + "'");
+}
+
 void Linear::dump(const ir::LoweredGraph &lowered_graph,
                   const std::vector<ir::OpSequenceIndex> &order)
 {
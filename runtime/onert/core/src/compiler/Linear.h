@@ -19,6 +19,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 #include "ir/OpSequences.h"
 #include "ir/Index.h"
@@ -41,7 +42,16 @@ namespace compiler
 class Linear
 {
 public:
-  static std::vector<ir::OpSequenceIndex> linearize(const ir::LoweredGraph &lowered_graph);
+  /**
+   * @brief Get a topological order of OpSequences
+   *
+   * @param lowered_graph Lowered graph
+   * @param order_mode "DFS" for reverse post-order of DFS, or "MemoryAware" for the order which
+   *                   keeps peak bytes of live tensors small
+   * @return Topological order of OpSequences
+   */
+  static std::vector<ir::OpSequenceIndex> linearize(const ir::LoweredGraph &lowered_graph,
+                                                    const std::string &order_mode = "DFS");
   static void dump(const ir::LoweredGraph &lowered_graph,
                    const std::vector<ir::OpSequenceIndex> &order);
   static void planTensors(const ir::LoweredGraph &lowered_graph,
@@ -16,6 +16,7 @@
 
 #include "OperationValidator.h"
 
+#include <algorithm>
 #include <typeinfo>
 
 #include "ir/Graph.h"
@@ -49,8 +50,45 @@ void OperationValidator::operator()()
 
   _current_op_seq_layout = _graph.layout();
 
-  _graph.operations().iterate(
-      [&](const ir::OperationIndex &, const ir::Operation &node) { node.accept(*this); });
+  _graph.operations().iterate([&](const ir::OperationIndex &, const ir::Operation &node) {
+    checkQuant8Signed(node);
+    node.accept(*this);
+  });
+}
+
+void OperationValidator::checkQuant8Signed(const ir::Operation &node)
+{
+  // Kernels without int8 support would leave their outputs uninitialized
+  switch (node.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    case ir::OpCode::DepthwiseConv2D:
+    case ir::OpCode::FullyConnected:
+    case ir::OpCode::Permute:
+    case ir::OpCode::Reshape:
+    case ir::OpCode::Squeeze:
+      return;
+    default:
+      break;
+  }
+
+  for (const auto &index : node.getInputs() + node.getOutputs())
+  {
+    if (!index.valid() || !_ctx.exist(index))
+      continue;
+    if (_ctx.at(index).typeInfo().type() == ir::DataType::QUANT8_ASYMM_SIGNED)
+      throw std::runtime_error("OperationValidator: int8 is not supported by " + node.name());
+  }
+}
+
+void OperationValidator::checkChannelAxis(const ir::OperandIndex &index, int32_t axis)
+{
+  const auto &type_info = _ctx.at(index).typeInfo();
+  if (type_info.channel_scales().empty())
+    return;
+
+  // Kernels read scales along this axis of weights
+  OP_REQUIRES(type_info.channel_axis() == axis);
 }
 
 void OperationValidator::visit(const ir::operation::Abs &node)
@@ -75,6 +113,27 @@ void OperationValidator::visit(const ir::operation::AvgPool2D &node)
   OP_REQUIRES(_ctx.at(ifm_index).shape().rank() == 4);
 }
 
+void OperationValidator::visit(const ir::operation::BatchMatMul &node)
+{
+  const auto lhs_index(node.getInputs().at(ir::operation::BatchMatMul::Input::LHS));
+  const auto rhs_index(node.getInputs().at(ir::operation::BatchMatMul::Input::RHS));
+  const auto out_index{node.getOutputs().at(0)};
+
+  // Only float is supported by kernels
+  OP_REQUIRES(_ctx.at(lhs_index).typeInfo().type() == ir::DataType::FLOAT32);
+  OP_REQUIRES(_ctx.at(rhs_index).typeInfo().type() == ir::DataType::FLOAT32);
+  OP_REQUIRES(_ctx.at(out_index).typeInfo().type() == ir::DataType::FLOAT32);
+
+  if (_ctx.at(out_index).info().isDynamic())
+    return;
+
+  const auto lhs_rank = _ctx.at(lhs_index).shape().rank();
+  const auto rhs_rank = _ctx.at(rhs_index).shape().rank();
+  OP_REQUIRES(lhs_rank >= 2 && lhs_rank <= 5);
+  OP_REQUIRES(rhs_rank >= 2 && rhs_rank <= 5);
+  OP_REQUIRES(_ctx.at(out_index).shape().rank() == std::max(lhs_rank, rhs_rank));
+}
+
 void OperationValidator::visit(const ir::operation::BatchToSpaceND &node)
 {
   const auto ofm_index{node.getOutputs().at(0)};
@@ -124,6 +183,21 @@ void OperationValidator::visit(const ir::operation::Comparison &node)
   OP_REQUIRES(_ctx.at(output_index).typeInfo().type() == ir::DataType::BOOL8);
 }
 
+void OperationValidator::visit(const ir::operation::Conv2D &node)
+{
+  checkChannelAxis(node.getInputs().at(ir::operation::Conv2D::Input::KERNEL), 0);
+}
+
+void OperationValidator::visit(const ir::operation::DepthwiseConv2D &node)
+{
+  checkChannelAxis(node.getInputs().at(ir::operation::DepthwiseConv2D::Input::KERNEL), 3);
+}
+
+void OperationValidator::visit(const ir::operation::FullyConnected &node)
+{
+  checkChannelAxis(node.getInputs().at(ir::operation::FullyConnected::Input::WEIGHT), 0);
+}
+
 void OperationValidator::visit(const ir::operation::Softmax &node)
 {
   VERBOSE(Softmax) << "Configure SOFTMAX operation" << std::endl;
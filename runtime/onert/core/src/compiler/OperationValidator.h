@@ -46,9 +46,13 @@ public:
 public:
   void visit(const ir::operation::Abs &node) override;
   void visit(const ir::operation::AvgPool2D &node) override;
+  void visit(const ir::operation::BatchMatMul &node) override;
   void visit(const ir::operation::BatchToSpaceND &node) override;
   void visit(const ir::operation::Cast &node) override;
   void visit(const ir::operation::Comparison &node) override;
+  void visit(const ir::operation::Conv2D &node) override;
+  void visit(const ir::operation::DepthwiseConv2D &node) override;
+  void visit(const ir::operation::FullyConnected &node) override;
   void visit(const ir::operation::Softmax &node) override;
   void visit(const ir::operation::InstanceNorm &node) override;
   void visit(const ir::operation::Permute &node) override;
@@ -96,6 +100,10 @@ public:
   void visit(const ir::operation::Tile &node) override;
   void visit(const ir::operation::LogicalOr &node) override;
 
+private:
+  void checkQuant8Signed(const ir::Operation &node);
+  void checkChannelAxis(const ir::OperandIndex &index, int32_t axis);
+
 private:
   // TODO Remove _ctx field
   const ir::Graph &_graph;
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "compiler/ScheduleCache.h"
+
+#include "util/logging.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <sys/stat.h>
+
+namespace onert
+{
+namespace compiler
+{
+
+namespace
+{
+
+/*
+ * Cache file is a text file as follows
+ *
+ *   <key>
+ *   <subgraph index> <number of operations> <1 if ranked, 0 otherwise>
+ *   <operation index> <backend id> <rank>
+ *   ...
+ */
+
+bool readSchedule(std::istream &stream, uint32_t &subg_index, ScheduleCache::Schedule &schedule)
+{
+  uint32_t num_operations = 0;
+  bool ranked = false;
+  if (!(stream >> subg_index >> num_operations >> ranked))
+    return false;
+
+  if (ranked)
+    schedule.ranks = std::make_shared<ir::OperationIndexMap<int64_t>>();
+  for (uint32_t i = 0; i < num_operations; ++i)
+  {
+    uint32_t op_index = 0;
+    std::string backend_id;
+    int64_t rank = 0;
+    if (!(stream >> op_index >> backend_id >> rank))
+      return false;
+    schedule.backends[ir::OperationIndex{op_index}] = backend_id;
+    if (ranked)
+      schedule.ranks->emplace(ir::OperationIndex{op_index}, rank);
+  }
+  return true;
+}
+
+void writeSchedule(std::ostream &stream, const ir::SubgraphIndex &subg_index,
+                   const ScheduleCache::Schedule &schedule)
+{
+  stream << subg_index.value() << " " << schedule.backends.size() << " "
+         << (schedule.ranks != nullptr) << "\n";
+  for (const auto &pair : schedule.backends)
+  {
+    int64_t rank = 0;
+    if (schedule.ranks)
+      rank = schedule.ranks->at(pair.first);
+    stream << pair.first.value() << " " << pair.second << " " << rank << "\n";
+  }
+}
+
+} // namespace
+
+ScheduleCache::ScheduleCache(const std::string &path, const std::string &model_key)
+    : _path{path}, _model_key{model_key}
+{
+  // DO NOTHING
+}
+
+void ScheduleCache::load(const std::string &options_key)
+{
+  _key = _model_key + ";" + options_key;
+  _schedules.clear();
+  _dirty = false;
+
+  std::ifstream stream(_path);
+  std::string key;
+  if (!stream.is_open() || !std::getline(stream, key) || key != _key)
+  {
+    VERBOSE(ScheduleCache) << "No schedules for the key in " << _path << std::endl;
+    return;
+  }
+
+  while (stream >> std::ws && !stream.eof())
+  {
+    uint32_t subg_index = 0;
+    Schedule schedule;
+    if (!readSchedule(stream, subg_index, schedule))
+    {
+      VERBOSE(ScheduleCache) << "Ignore broken schedules in " << _path << std::endl;
+      _schedules.clear();
+      return;
+    }
+    _schedules[ir::SubgraphIndex{subg_index}] = std::move(schedule);
+  }
+  VERBOSE(ScheduleCache) << "Load schedules of " << _schedules.size() << " subgraph(s) from "
+                        << _path << std::endl;
+}
+
+const ScheduleCache::Schedule *ScheduleCache::find(const ir::SubgraphIndex &index) const
+{
+  auto it = _schedules.find(index);
+  return it == _schedules.end() ? nullptr : &it->second;
+}
+
+void ScheduleCache::insert(const ir::SubgraphIndex &index, Schedule &&schedule)
+{
+  // Do not write the file again for the same schedule
+  auto it = _schedules.find(index);
+  if (it != _schedules.end() && it->second.backends == schedule.backends &&
+      (it->second.ranks == nullptr) == (schedule.ranks == nullptr) &&
+      (schedule.ranks == nullptr || *it->second.ranks == *schedule.ranks))
+    return;
+
+  _schedules[index] = std::move(schedule);
+  _dirty = true;
+}
+
+void ScheduleCache::save()
+{
+  if (!_dirty)
+    return;
+
+  // Write to a temporary file and rename it, so that other processes never read a partial cache
+  const auto tmp_path = _path + ".tmp";
+  {
+    std::ofstream stream(tmp_path, std::ios::trunc);
+    if (!stream.is_open())
+    {
+      VERBOSE(ScheduleCache) << "Cannot write " << tmp_path << std::endl;
+      return;
+    }
+    stream << _key << "\n";
+    for (const auto &pair : _schedules)
+      writeSchedule(stream, pair.first, pair.second);
+  }
+  if (std::rename(tmp_path.c_str(), _path.c_str()) != 0)
+  {
+    VERBOSE(ScheduleCache) << "Cannot write " << _path << std::endl;
+    std::remove(tmp_path.c_str());
+    return;
+  }
+  _dirty = false;
+}
+
+std::string ScheduleCache::stampFile(const std::string &path)
+{
+  struct stat file_stat;
+  if (stat(path.c_str(), &file_stat) != 0)
+    throw std::runtime_error{"ScheduleCache: cannot stat " + path};
+
+  std::ostringstream ss;
+  ss << std::hex << file_stat.st_size << "-" << file_stat.st_mtim.tv_sec << "."
+     << file_stat.st_mtim.tv_nsec;
+  return ss.str();
+}
+
+} // namespace compiler
+} // namespace onert
@@ -20,6 +20,7 @@
 #include <cassert>
 #include <limits>
 #include <algorithm>
+#include <cmath>
 
 namespace onert
 {
@@ -119,6 +120,24 @@ void ExecTime::updateOperationExecTime(const backend::Backend *backend,
   }
 }
 
+void ExecTime::blendOperationExecTime(const backend::Backend *backend,
+                                      const std::string &operation, bool quant, uint32_t op_size,
+                                      int64_t time, float weight)
+{
+  assert(weight > 0.f && weight <= 1.f);
+  auto &recs = _measurements[backend][operation][quant];
+  auto it = recs.find(op_size);
+  if (it == recs.end() || it->second == getMax())
+  {
+    // Unsupported one is not blended, it is kept as it is
+    if (it == recs.end())
+      updateOperationExecTime(backend, operation, quant, op_size, time);
+    return;
+  }
+  const auto delta = static_cast<float>(time - it->second) * weight;
+  it->second = std::max<int64_t>(it->second + static_cast<int64_t>(std::lround(delta)), 0);
+}
+
 void ExecTime::updatePermuteTime(const backend::Backend *from_backend,
                                  const backend::Backend *to_backend, bool quant, uint32_t op_size,
                                  int64_t time)
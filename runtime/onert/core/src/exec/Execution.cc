@@ -131,6 +131,26 @@ void Execution::setOutputLayout(const ir::IOIndex &index, ir::Layout layout)
       output_desc->info, output_desc->buffer, output_desc->size, layout);
 }
 
+void Execution::bindIO(const Execution &other)
+{
+  for (const auto &signature : other._io_desc.input_shape_signature)
+    changeInputShape(signature.first, signature.second);
+
+  for (uint32_t i = 0; i < other._io_desc.inputs.size(); ++i)
+  {
+    const auto &input = other._io_desc.inputs.at(i);
+    if (input)
+      setInput(ir::IOIndex{i}, input->buffer, input->size, input->layout);
+  }
+
+  for (uint32_t i = 0; i < other._io_desc.outputs.size(); ++i)
+  {
+    const auto &output = other._io_desc.outputs.at(i);
+    if (output)
+      setOutput(ir::IOIndex{i}, output->buffer, output->size, output->layout);
+  }
+}
+
 void Execution::execute()
 {
   VERBOSE(Execution) << "Start execution" << std::endl;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ExecutionCache.h"
+
+#include "util/logging.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+ExecutionCache::ExecutionCache(size_t max_entries, size_t max_memory)
+    : _max_entries{max_entries}, _max_memory{max_memory}
+{
+  assert(max_entries > 0);
+}
+
+std::shared_ptr<Execution> ExecutionCache::find(const Signature &signature)
+{
+  for (auto it = _entries.begin(); it != _entries.end(); ++it)
+  {
+    if (it->signature == signature)
+    {
+      _stats.hits++;
+      VERBOSE(ExecutionCache) << "Hit (hits " << _stats.hits << ", misses " << _stats.misses
+                              << ")" << std::endl;
+      // Move to front as the most recently used one
+      _entries.splice(_entries.begin(), _entries, it);
+      return _entries.front().execution;
+    }
+  }
+
+  _stats.misses++;
+  VERBOSE(ExecutionCache) << "Miss (hits " << _stats.hits << ", misses " << _stats.misses << ")"
+                          << std::endl;
+  return nullptr;
+}
+
+void ExecutionCache::insert(const Signature &signature, const std::shared_ptr<Execution> &execution,
+                            size_t memory_size)
+{
+  for (auto it = _entries.begin(); it != _entries.end(); ++it)
+  {
+    if (it->signature == signature)
+    {
+      _memory -= it->memory_size;
+      _entries.erase(it);
+      break;
+    }
+  }
+
+  _entries.push_front(Entry{signature, execution, memory_size});
+  _memory += memory_size;
+
+  evict();
+}
+
+void ExecutionCache::evict()
+{
+  auto over_limit = [&]() {
+    return _entries.size() > _max_entries || (_max_memory != 0 && _memory > _max_memory);
+  };
+
+  // Keep the most recently used one even if it alone exceeds the memory limit
+  while (_entries.size() > 1 && over_limit())
+  {
+    const auto &lru = _entries.back();
+    VERBOSE(ExecutionCache) << "Evict an execution of " << lru.memory_size << " bytes"
+                            << std::endl;
+    _memory -= lru.memory_size;
+    _entries.pop_back();
+    _stats.evictions++;
+  }
+}
+
+size_t ExecutionCache::estimateMemory(const Execution &execution,
+                                      const std::unordered_set<ir::OperandIndex> &shared_constants)
+{
+  size_t memory_size = 0;
+  execution.primary_subgraph().operands().iterate(
+      [&](const ir::OperandIndex &ind, const ir::Operand &operand) {
+        if (operand.info().isDynamic())
+          return;
+        if (operand.isConstant() && shared_constants.find(ind) != shared_constants.end())
+          return;
+        memory_size += operand.info().total_size();
+      });
+  return memory_size;
+}
+
+} // namespace exec
+} // namespace onert
@@ -16,8 +16,16 @@
 
 #include "exec/ExecutionObservers.h"
 
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
 #include <string>
 
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "misc/EventRecorder.h"
 #include "util/logging.h"
 #include "exec/IExecutor.h"
 #include "misc/polymorphic_downcast.h"
@@ -69,54 +77,378 @@ void ProfileObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
   }
 };
 
-ChromeTracingObserver::ChromeTracingObserver(const std::string &filepath)
-    : _ofs{filepath, std::ofstream::out}, _recorder{}, _collector{&_recorder}
+void AdaptiveObserver::handleBegin(IExecutor *, const ir::OpSequence *,
+                                   const backend::Backend *backend)
+{
+  auto it = _timers.find(backend);
+  if (it == _timers.end())
+    it = _timers.emplace(backend, backend->config()->timer()).first;
+  if (it->second)
+    it->second->handleBegin();
+}
+
+void AdaptiveObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
+                                 const backend::Backend *backend)
+{
+  const auto &timer = _timers.at(backend);
+  if (timer == nullptr)
+    return;
+  timer->handleEnd();
+
+  const auto &op_keys = opKeys(exec, op_seq);
+  if (op_keys.empty())
+    return;
+
+  std::vector<int64_t> estimates;
+  int64_t total_estimate = 0;
+  for (const auto &key : op_keys)
+  {
+    estimates.push_back(_planner->estimate(backend, key.operation, key.quant, key.size));
+    total_estimate += estimates.back();
+  }
+
+  const int64_t time = timer->getTime();
+  for (size_t i = 0; i < op_keys.size(); ++i)
+  {
+    const auto &key = op_keys[i];
+    _planner->record(backend, key.operation, key.quant, key.size,
+                     time * estimates[i] / total_estimate);
+  }
+}
+
+const std::vector<AdaptiveObserver::OpKey> &AdaptiveObserver::opKeys(IExecutor *exec,
+                                                                     const ir::OpSequence *op_seq)
+{
+  auto it = _op_keys.find(op_seq);
+  if (it != _op_keys.end())
+    return it->second;
+
+  std::vector<OpKey> keys;
+  const auto &graph = exec->graph();
+  for (const auto &element : op_seq->operations())
+  {
+    const auto &node = *element.node;
+    // Permutations are not scheduled
+    if (node.name() == "Permute")
+      continue;
+    keys.push_back({node.name(), compiler::AdaptivePlanner::isQuant(graph, node),
+                    compiler::AdaptivePlanner::flattenedIOSize(graph, node)});
+  }
+  return _op_keys.emplace(op_seq, std::move(keys)).first->second;
+}
+
+namespace
+{
+
+uint64_t nowInNanoseconds()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint64_t totalSize(const ir::Graph &graph, const ir::OperandIndexSequence &indices)
+{
+  uint64_t size = 0;
+  for (const auto &index : indices)
+  {
+    if (!index.valid())
+      continue;
+    const auto &info = graph.operands().at(index).info();
+    if (!info.shape().hasUnknownDim())
+      size += info.total_size();
+  }
+  return size;
+}
+
+OpStats::Entry &opStatsEntry(OpStats &stats, const ir::SubgraphIndex &subg_index,
+                             const ir::LoweredGraph &lowered_graph,
+                             const ir::OpSequenceIndex &op_seq_index)
+{
+  const auto &op_seq = lowered_graph.op_seqs().at(op_seq_index);
+  std::string name;
+  for (const auto &element : op_seq.operations())
+    name += (name.empty() ? "" : ".") + element.node->name();
+  const auto backend = lowered_graph.getLowerInfo(op_seq_index)->backend();
+  return stats.entry(name, backend->config()->id(), subg_index.value(),
+                     op_seq.operations().at(0).index.value());
+}
+
+} // namespace
+
+OpStatsObserver::OpStatsObserver(std::shared_ptr<OpStats> stats,
+                                 const ir::SubgraphIndex &subg_index,
+                                 const ir::LoweredGraph &lowered_graph)
+    : _stats{std::move(stats)}
+{
+  const auto &graph = lowered_graph.graph();
+  lowered_graph.op_seqs().iterate(
+      [&](const ir::OpSequenceIndex &op_seq_index, const ir::OpSequence &op_seq) {
+        if (op_seq.size() == 0)
+          return;
+
+        uint64_t flops = 0;
+        for (const auto &element : op_seq.operations())
+          flops += OpStats::estimateFlops(graph, *element.node);
+        auto &entry = opStatsEntry(*_stats, subg_index, lowered_graph, op_seq_index);
+        _slots[&op_seq] = Slot{&entry, totalSize(graph, op_seq.getInputs()),
+                               totalSize(graph, op_seq.getOutputs()), flops, 0};
+      });
+}
+
+void OpStatsObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
+                                  const backend::Backend *)
+{
+  auto it = _slots.find(op_seq);
+  if (it != _slots.end())
+    it->second.begin = nowInNanoseconds();
+}
+
+void OpStatsObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
+                                const backend::Backend *)
+{
+  auto it = _slots.find(op_seq);
+  if (it == _slots.end())
+    return;
+
+  const auto &slot = it->second;
+  auto &entry = *slot.entry;
+  entry.count.fetch_add(1, std::memory_order_relaxed);
+  entry.time_ns.fetch_add(nowInNanoseconds() - slot.begin, std::memory_order_relaxed);
+  entry.bytes_read.fetch_add(slot.bytes_read, std::memory_order_relaxed);
+  entry.bytes_written.fetch_add(slot.bytes_written, std::memory_order_relaxed);
+  entry.flops.fetch_add(slot.flops, std::memory_order_relaxed);
+}
+
+PerfCounterObserver::PerfCounterObserver(std::shared_ptr<OpStats> stats,
+                                         const ir::SubgraphIndex &subg_index,
+                                         const ir::LoweredGraph &lowered_graph)
+    : _stats{std::move(stats)}
+{
+  lowered_graph.op_seqs().iterate(
+      [&](const ir::OpSequenceIndex &op_seq_index, const ir::OpSequence &op_seq) {
+        if (op_seq.size() == 0)
+          return;
+
+        auto &entry = opStatsEntry(*_stats, subg_index, lowered_graph, op_seq_index);
+        _slots[&op_seq] = Slot{&entry, {}, false};
+      });
+}
+
+void PerfCounterObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
+                                      const backend::Backend *)
+{
+  auto it = _slots.find(op_seq);
+  if (it == _slots.end())
+    return;
+
+  auto &slot = it->second;
+  slot.begun = util::PerfCounters::thisThread().read(slot.begin);
+}
+
+void PerfCounterObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
+                                    const backend::Backend *)
 {
+  auto it = _slots.find(op_seq);
+  if (it == _slots.end() || !it->second.begun)
+    return;
+
+  const auto &slot = it->second;
+  util::PerfCounters::Values end;
+  if (!util::PerfCounters::thisThread().read(end))
+    return;
+
+  const auto delta = [&](util::PerfCounters::Counter counter) {
+    return end[counter] - slot.begin[counter];
+  };
+  auto &entry = *slot.entry;
+  entry.cycles.fetch_add(delta(util::PerfCounters::CYCLES), std::memory_order_relaxed);
+  entry.instructions.fetch_add(delta(util::PerfCounters::INSTRUCTIONS),
+                               std::memory_order_relaxed);
+  entry.cache_misses.fetch_add(delta(util::PerfCounters::CACHE_MISSES),
+                               std::memory_order_relaxed);
+  entry.branch_misses.fetch_add(delta(util::PerfCounters::BRANCH_MISSES),
+                                std::memory_order_relaxed);
 }
 
-ChromeTracingObserver::~ChromeTracingObserver() { _recorder.writeToFile(_ofs); }
+namespace
+{
 
-void ChromeTracingObserver::handleBegin(IExecutor *)
+// Chrome trace takes timestamps in microseconds
+std::string toMicroseconds(uint64_t nanoseconds)
 {
-  _collector.onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, "runtime", "Graph"});
+  std::stringstream ss;
+  ss << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000;
+  return ss.str();
+}
+
+// Id of events of the whole graph instead of an op sequence
+constexpr uint32_t kGraphOpSeq = UINT32_MAX;
+
+} // namespace
+
+constexpr uint32_t ChromeTracingObserver::kEventCapacity;
+constexpr uint32_t ChromeTracingObserver::kUsageCapacity;
+constexpr uint32_t ChromeTracingObserver::kMaxBackends;
+
+ChromeTracingObserver::ChromeTracingObserver(const std::string &filepath,
+                                             int sample_interval)
+    : _ofs{filepath, std::ofstream::out},
+      _sample_interval{static_cast<uint32_t>(std::max(sample_interval, 1))},
+      _buffer{kEventCapacity}
+{
+  for (auto &backend : _backends)
+    backend.store(nullptr, std::memory_order_relaxed);
+  _backend_names[0] = "runtime";
+}
+
+ChromeTracingObserver::~ChromeTracingObserver() { writeToFile(); }
+
+void ChromeTracingObserver::handleBegin(IExecutor *exec)
+{
+  if (_op_names.empty())
+  {
+    // Names are kept here since the graph may be destroyed before the observer
+    exec->graph().operations().iterate(
+        [&](const ir::OperationIndex &index, const ir::Operation &op) {
+          _op_names[index.value()] = op.name();
+        });
+  }
+
+  _sampled = (_run_count++ % _sample_interval == 0);
+  if (!_sampled)
+    return;
+
+  _buffer.record(util::TraceEvent{util::TraceBuffer::now(), kGraphOpSeq, 0, 0,
+                                  util::TraceEvent::Phase::BEGIN});
 }
 
 void ChromeTracingObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
                                         const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  _collector.onEvent(
-      EventCollector::Event{EventCollector::Edge::BEGIN, backend_id, opSequenceTag(op_seq)});
+  record(op_seq, backend, util::TraceEvent::Phase::BEGIN);
 }
 
 void ChromeTracingObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
                                       const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  _collector.onEvent(
-      EventCollector::Event{EventCollector::Edge::END, backend_id, opSequenceTag(op_seq)});
+  record(op_seq, backend, util::TraceEvent::Phase::END);
 }
 
 void ChromeTracingObserver::handleEnd(IExecutor *)
 {
-  _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, "runtime", "Graph"});
+  if (!_sampled)
+    return;
+
+  const auto timestamp = util::TraceBuffer::now();
+  _buffer.record(util::TraceEvent{timestamp, kGraphOpSeq, 0, 0, util::TraceEvent::Phase::END});
+
+  // Backends may be unloaded before the observer is destroyed
+  for (uint32_t id = 1; id < kMaxBackends; ++id)
+  {
+    const auto backend = _backends[id].load(std::memory_order_acquire);
+    if (backend == nullptr)
+      break;
+    if (_backend_names[id].empty())
+      _backend_names[id] = backend->config()->id();
+  }
+
+  // Resource usage is sampled once per execution, not per event
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  if (_usages.size() < kUsageCapacity)
+    _usages.emplace_back();
+  _usages[_usage_count++ % kUsageCapacity] = UsageSample{timestamp, ru.ru_maxrss, ru.ru_minflt};
+}
+
+void ChromeTracingObserver::record(const ir::OpSequence *op_seq, const backend::Backend *backend,
+                                   util::TraceEvent::Phase phase)
+{
+  if (!_sampled)
+    return;
+
+  uint32_t id = 0;
+  uint16_t count = 0;
+  if (op_seq->size() > 0)
+  {
+    id = op_seq->operations().at(0).index.value();
+    count = static_cast<uint16_t>(op_seq->size());
+  }
+  _buffer.record(util::TraceEvent{util::TraceBuffer::now(), id, count, backendId(backend), phase});
 }
 
-std::string ChromeTracingObserver::opSequenceTag(const ir::OpSequence *op_seq)
+uint8_t ChromeTracingObserver::backendId(const backend::Backend *backend)
 {
-  if (op_seq->size() == 0)
+  // Op sequences may run on several threads, so the table is filled without a lock
+  for (uint32_t id = 1; id < kMaxBackends; ++id)
+  {
+    const backend::Backend *registered = _backends[id].load(std::memory_order_acquire);
+    if (registered == nullptr &&
+        _backends[id].compare_exchange_strong(registered, backend, std::memory_order_acq_rel))
+    {
+      return id;
+    }
+    if (registered == backend)
+      return id;
+  }
+  throw std::runtime_error{"ChromeTracingObserver: Too many backends"};
+}
+
+std::string ChromeTracingObserver::opSequenceTag(const util::TraceEvent &event) const
+{
+  if (event.op_seq == kGraphOpSeq)
+    return "Graph";
+  if (event.op_count == 0)
     return "Empty OpSequence";
 
-  auto first_op = op_seq->operations().at(0);
-  std::string tag = "$" + std::to_string(first_op.index.value());
-  tag += " " + first_op.node->name();
-  if (op_seq->size() > 1)
+  std::string tag = "$" + std::to_string(event.op_seq);
+  auto it = _op_names.find(event.op_seq);
+  if (it != _op_names.end())
+  {
+    tag += " " + it->second;
+  }
+  if (event.op_count > 1)
   {
-    tag += " (+" + std::to_string(op_seq->size() - 1) + ")";
+    tag += " (+" + std::to_string(event.op_count - 1) + ")";
   }
   return tag;
 }
 
+void ChromeTracingObserver::writeToFile()
+{
+  EventRecorder recorder;
+
+  const auto dropped = _buffer.drain([&](uint32_t, const util::TraceEvent &event) {
+    DurationEvent evt;
+    evt.name = opSequenceTag(event);
+    evt.tid = _backend_names[event.backend];
+    evt.ph = (event.phase == util::TraceEvent::Phase::BEGIN) ? "B" : "E";
+    evt.ts = toMicroseconds(event.timestamp);
+    recorder.emit(evt);
+  });
+  if (dropped > 0)
+  {
+    VERBOSE(ChromeTracingObserver) << dropped << " old events are overwritten" << std::endl;
+  }
+
+  for (const auto &usage : _usages)
+  {
+    CounterEvent evt;
+    evt.ph = "C";
+    evt.ts = toMicroseconds(usage.timestamp);
+
+    evt.name = "maxrss";
+    evt.values["value"] = std::to_string(usage.maxrss);
+    recorder.emit(evt);
+
+    evt.name = "minflt";
+    evt.values["value"] = std::to_string(usage.minflt);
+    recorder.emit(evt);
+  }
+
+  recorder.writeToFile(_ofs);
+}
+
 } // namespace exec
 
 } // namespace onert
@@ -106,6 +106,7 @@ std::unique_ptr<ISource> ExecutorBase::source(const ir::IOIndex &index, const ir
     case DataType::UINT8:
       return source<uint8_t>(index, buffer, length, io_layout);
     case DataType::QUANT8_SYMM:
+    case DataType::QUANT8_ASYMM_SIGNED:
       return source<int8_t>(index, buffer, length, io_layout);
     default:
       throw std::runtime_error("Not supported yet");
@@ -129,6 +130,7 @@ std::unique_ptr<ISink> ExecutorBase::sink(const ir::IOIndex &index, const ir::Ty
     case DataType::UINT8:
       return sink<uint8_t>(index, buffer, length, io_layout);
     case DataType::QUANT8_SYMM:
+    case DataType::QUANT8_ASYMM_SIGNED:
       return sink<int8_t>(index, buffer, length, io_layout);
     default:
       throw std::runtime_error("Not supported yet");
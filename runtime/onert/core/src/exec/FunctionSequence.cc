@@ -65,6 +65,16 @@ void FunctionSequence::iterate(const std::function<void(IFunction &)> &fn)
 }
 
 void FunctionSequenceForDynamicBackend::run()
+{
+  runWithShapeInference([](IFunction &function) { function.run(); });
+}
+
+void FunctionSequenceForDynamicBackend::runSync()
+{
+  runWithShapeInference([](IFunction &function) { function.runSync(); });
+}
+
+template <typename RunFn> void FunctionSequenceForDynamicBackend::runWithShapeInference(RunFn run_fn)
 {
   if (_op_seq.size() != _functions.size())
     throw std::runtime_error("operation and functions should be mapped one by one");
@@ -77,7 +87,7 @@ void FunctionSequenceForDynamicBackend::run()
     op->accept(*_dyn_shape_inferer);
 
     // run kernel
-    function->run();
+    run_fn(*function);
 
     op_iter++;
   }
@@ -49,7 +49,10 @@ void LinearExecutor::executeImpl()
     ruy::profiler::ScopeLabel label(seq_to_label(op_seq));
 #endif
     _subject.notifyJobBegin(this, op_seq, backend);
-    code.fn_seq->run();
+    if (_profiling)
+      code.fn_seq->runSync();
+    else
+      code.fn_seq->run();
     _subject.notifyJobEnd(this, op_seq, backend);
   }
   _subject.notifyModelEnd(this);
@@ -59,9 +59,14 @@ public:
 
 public:
   void executeImpl(void) override;
+  /**
+   * @brief Run functions synchronously, so that backend timers measure finished ones
+   */
+  void setProfilingMode(bool profiling) { _profiling = profiling; }
 
 private:
   std::vector<compiler::CodeAndInfo> _code;
+  bool _profiling{false};
 };
 
 } // namespace exec
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/OpStats.h"
+
+#include "ir/Operations.Include.h"
+
+namespace onert
+{
+namespace exec
+{
+
+OpStats::Entry &OpStats::entry(const std::string &name, const std::string &backend,
+                               uint32_t subgraph, uint32_t first_op)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  const auto key = std::make_tuple(subgraph, first_op, backend);
+  auto it = _index.find(key);
+  if (it == _index.end())
+  {
+    _entries.emplace_back(name, backend, subgraph, first_op);
+    it = _index.emplace(key, _entries.size() - 1).first;
+  }
+  return _entries[it->second];
+}
+
+size_t OpStats::size() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _entries.size();
+}
+
+const OpStats::Entry &OpStats::at(size_t index) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _entries.at(index);
+}
+
+void OpStats::reset()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  for (auto &entry : _entries)
+  {
+    entry.count = 0;
+    entry.time_ns = 0;
+    entry.bytes_read = 0;
+    entry.bytes_written = 0;
+    entry.flops = 0;
+    entry.cycles = 0;
+    entry.instructions = 0;
+    entry.cache_misses = 0;
+    entry.branch_misses = 0;
+  }
+}
+
+uint64_t OpStats::estimateFlops(const ir::Graph &graph, const ir::Operation &op)
+{
+  const auto &operands = graph.operands();
+  const auto shape = [&](const ir::OperandIndex &index) -> const ir::Shape & {
+    return operands.at(index).shape();
+  };
+
+  // Shapes of dynamic tensors are not known until execution
+  for (const auto &index : op.getInputs() + op.getOutputs())
+  {
+    if (index.valid() && shape(index).hasUnknownDim())
+      return 0;
+  }
+
+  uint64_t output_elements = 0;
+  for (const auto &output : op.getOutputs())
+    output_elements += shape(output).num_elements();
+
+  switch (op.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    {
+      // Kernel is OHWI
+      const auto &kernel = shape(op.getInputs().at(ir::operation::Conv2D::Input::KERNEL));
+      return 2 * output_elements * kernel.dim(1) * kernel.dim(2) * kernel.dim(3);
+    }
+    case ir::OpCode::DepthwiseConv2D:
+    {
+      // Kernel is 1HWO
+      const auto &kernel = shape(op.getInputs().at(ir::operation::DepthwiseConv2D::Input::KERNEL));
+      return 2 * output_elements * kernel.dim(1) * kernel.dim(2);
+    }
+    case ir::OpCode::TransposeConv:
+    {
+      const auto &input = shape(op.getInputs().at(ir::operation::TransposeConv::Input::INPUT));
+      const auto &kernel = shape(op.getInputs().at(ir::operation::TransposeConv::Input::KERNEL));
+      return 2 * input.num_elements() * kernel.dim(0) * kernel.dim(1) * kernel.dim(2);
+    }
+    case ir::OpCode::FullyConnected:
+    {
+      // Weight is [output size, input size]
+      const auto &weight = shape(op.getInputs().at(ir::operation::FullyConnected::Input::WEIGHT));
+      return 2 * output_elements * weight.dim(1);
+    }
+    case ir::OpCode::BatchMatMul:
+    {
+      const auto &node = static_cast<const ir::operation::BatchMatMul &>(op);
+      const auto &lhs = shape(op.getInputs().at(ir::operation::BatchMatMul::Input::LHS));
+      const auto depth =
+          node.param().adj_x ? lhs.dim(lhs.rank() - 2) : lhs.dim(lhs.rank() - 1);
+      return 2 * output_elements * depth;
+    }
+    case ir::OpCode::MaxPool2D:
+    {
+      const auto &param = static_cast<const ir::operation::MaxPool2D &>(op).param();
+      return output_elements * param.kh * param.kw;
+    }
+    case ir::OpCode::AvgPool2D:
+    {
+      const auto &param = static_cast<const ir::operation::AvgPool2D &>(op).param();
+      return output_elements * param.kh * param.kw;
+    }
+    default:
+      return output_elements;
+  }
+}
+
+} // namespace exec
+} // namespace onert
@@ -17,6 +17,7 @@
 #include "ir/LoweredGraph.h"
 
 #include <assert.h>
+#include <algorithm>
 #include <sstream>
 #include "util/logging.h"
 #include "pass/ConstantInsertionPass.h"
@@ -37,7 +38,8 @@ namespace onert
 namespace ir
 {
 
-LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &options)
+LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &options,
+                           const compiler::ScheduleCache::Schedule *schedule)
     : _graph{graph}
 {
   // Build backend contexts
@@ -64,7 +66,11 @@ LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &
 
   // TODO Move "schedule" phase out of here
   // Schedule
-  if (options.he_scheduler)
+  if (schedule && restoreSchedule(*schedule))
+  {
+    VERBOSE(LoweredGraph) << "Backends are assigned by schedule cache" << std::endl;
+  }
+  else if (options.he_scheduler)
   {
     auto scheduler = compiler::HEScheduler(_backend_contexts, options);
     _backend_resolver = scheduler.schedule(_graph);
@@ -123,9 +129,17 @@ LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &
 
   // Shape inference.
   {
+    // Visit operations in topological order so that inferred shapes reach all the consumers.
+    // OpSequence indices do not always follow it (e.g. after merging or permutation insertion).
+    std::vector<ir::OperationIndex> topol_order;
+    PostDfsConstIterator().iterate(_graph, [&](const OperationIndex &index, const Operation &) {
+      topol_order.emplace_back(index);
+    });
+    std::reverse(topol_order.begin(), topol_order.end());
+
     shape_inference::StaticInferer inferer(_graph.operands());
-    _op_seqs.iterate(
-        [&](const ir::OpSequenceIndex &, const ir::OpSequence &op_seq) { inferer.infer(op_seq); });
+    for (const auto &index : topol_order)
+      inferer.infer(_graph.operations().at(index));
     inferer.dump();
   }
 
@@ -136,6 +150,51 @@ LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &
   }
 }
 
+bool LoweredGraph::restoreSchedule(const compiler::ScheduleCache::Schedule &schedule)
+{
+  std::unordered_map<std::string, const backend::Backend *> backends;
+  for (const auto &pair : _backend_contexts)
+    backends.emplace(pair.first->config()->id(), pair.first);
+
+  // Cached schedule is only valid if it assigns a loaded backend to every operation
+  auto backend_resolver = std::make_unique<compiler::BackendResolver>();
+  bool valid = true;
+  size_t num_operations = 0;
+  _graph.operations().iterate([&](const OperationIndex &index, const Operation &) {
+    ++num_operations;
+    if (!valid)
+      return;
+    auto it = schedule.backends.find(index);
+    if (it == schedule.backends.end() || backends.find(it->second) == backends.end() ||
+        (schedule.ranks && schedule.ranks->find(index) == schedule.ranks->end()))
+    {
+      valid = false;
+      return;
+    }
+    backend_resolver->setBackend(index, backends.at(it->second));
+  });
+  if (!valid || num_operations != schedule.backends.size())
+  {
+    VERBOSE(LoweredGraph) << "Ignore schedule cache that does not match the graph" << std::endl;
+    return false;
+  }
+
+  _backend_resolver = std::move(backend_resolver);
+  if (schedule.ranks)
+    _indexed_ranks = std::make_shared<OperationIndexMap<int64_t>>(*schedule.ranks);
+  return true;
+}
+
+compiler::ScheduleCache::Schedule LoweredGraph::schedule() const
+{
+  compiler::ScheduleCache::Schedule schedule;
+  _backend_resolver->iterate([&](const OperationIndex &index, const backend::Backend &backend) {
+    schedule.backends.emplace(index, backend.config()->id());
+  });
+  schedule.ranks = _indexed_ranks;
+  return schedule;
+}
+
 const operation::LowerInfo *LoweredGraph::getLowerInfo(const OpSequenceIndex &op_seq_index) const
 {
   auto itr = _lower_info_map.op_seq.find(op_seq_index);
@@ -64,6 +64,15 @@ void OperationDumper::visit(const AvgPool2D &node)
   VERBOSE(LIR) << "  - Output : OFM(" << node.getOutputs().at(0).value() << ")" << std::endl;
 }
 
+void OperationDumper::visit(const BatchMatMul &node)
+{
+  VERBOSE(LIR) << "* BatchMatMul" << std::endl;
+  VERBOSE(LIR) << "  - Inputs : LHS(" << node.getInputs().at(BatchMatMul::Input::LHS).value()
+               << ") RHS(" << node.getInputs().at(BatchMatMul::Input::RHS).value() << ")"
+               << std::endl;
+  VERBOSE(LIR) << "  - Output : Output(" << node.getOutputs().at(0).value() << ")" << std::endl;
+}
+
 void OperationDumper::visit(const BatchToSpaceND &node)
 {
   VERBOSE(LIR) << "* BatchToSpaceND" << std::endl;
@@ -35,6 +35,7 @@ public:
   void visit(const operation::Add &node) override;
   void visit(const operation::ArgMax &) override;
   void visit(const operation::AvgPool2D &node) override;
+  void visit(const operation::BatchMatMul &node) override;
   void visit(const operation::BatchToSpaceND &node) override;
   void visit(const operation::Cast &) override;
   void visit(const operation::Comparison &) override;
@@ -38,6 +38,16 @@ bool operator==(const TypeInfo &lhs, const TypeInfo &rhs)
     return false;
   }
 
+  if (lhs.channel_scales() != rhs.channel_scales())
+  {
+    return false;
+  }
+
+  if (!lhs.channel_scales().empty() && lhs.channel_axis() != rhs.channel_axis())
+  {
+    return false;
+  }
+
   return true;
 }
 
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/PerfCounters.h"
+
+#include "util/logging.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace onert
+{
+namespace util
+{
+
+#ifdef __linux__
+
+namespace
+{
+
+int openCounter(uint32_t type, uint64_t config, int group_fd)
+{
+  struct perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = (group_fd == -1) ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+
+  // pid 0 and cpu -1 count the calling thread on any cpu
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+} // namespace
+
+PerfCounters::PerfCounters()
+{
+  static const std::array<std::pair<uint32_t, uint64_t>, COUNT> events{{
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+  }};
+
+  _fds.fill(-1);
+  _positions.fill(-1);
+  for (uint32_t i = 0; i < COUNT; ++i)
+  {
+    const int fd = openCounter(events[i].first, events[i].second, _leader);
+    if (fd < 0)
+    {
+      VERBOSE(PerfCounters) << "Counter " << i << " is not available: " << std::strerror(errno)
+                            << std::endl;
+      continue;
+    }
+    if (_leader < 0)
+      _leader = fd;
+    _fds[i] = fd;
+    _positions[i] = _num_opened++;
+  }
+
+  if (_leader >= 0)
+  {
+    ioctl(_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+PerfCounters::~PerfCounters()
+{
+  for (auto fd : _fds)
+  {
+    if (fd >= 0)
+      close(fd);
+  }
+}
+
+bool PerfCounters::read(Values &values) const
+{
+  if (_leader < 0)
+    return false;
+
+  // Group read format is the number of counters followed by their values
+  std::array<uint64_t, COUNT + 1> buffer;
+  const auto size = sizeof(uint64_t) * (_num_opened + 1);
+  if (::read(_leader, buffer.data(), size) != static_cast<ssize_t>(size))
+    return false;
+
+  for (uint32_t i = 0; i < COUNT; ++i)
+    values[i] = (_positions[i] >= 0) ? buffer[_positions[i] + 1] : 0;
+  return true;
+}
+
+#else // __linux__
+
+PerfCounters::PerfCounters()
+{
+  _fds.fill(-1);
+  _positions.fill(-1);
+}
+
+PerfCounters::~PerfCounters() = default;
+
+bool PerfCounters::read(Values &) const { return false; }
+
+#endif // __linux__
+
+PerfCounters &PerfCounters::thisThread()
+{
+  thread_local PerfCounters counters;
+  return counters;
+}
+
+} // namespace util
+} // namespace onert
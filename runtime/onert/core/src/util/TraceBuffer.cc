@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/TraceBuffer.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace util
+{
+
+namespace
+{
+
+uint64_t nextBufferId()
+{
+  // 0 is reserved for threads which have not recorded yet
+  static std::atomic<uint64_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t roundUpToPowerOf2(uint32_t value)
+{
+  uint32_t result = 1;
+  while (result < value)
+    result <<= 1;
+  return result;
+}
+
+} // namespace
+
+TraceBuffer::TraceBuffer(uint32_t capacity)
+    : _id{nextBufferId()}, _capacity{roundUpToPowerOf2(capacity)}
+{
+  assert(capacity > 0);
+}
+
+TraceBuffer::Ring *TraceBuffer::registerThread()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto &ring = _thread_rings[std::this_thread::get_id()];
+  if (ring == nullptr)
+  {
+    _rings.emplace_back(new Ring{_capacity});
+    ring = _rings.back().get();
+  }
+  return ring;
+}
+
+} // namespace util
+} // namespace onert
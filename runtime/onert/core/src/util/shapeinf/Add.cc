@@ -23,22 +23,8 @@ namespace shape_inference
 
 void StaticInferer::visit(const ir::operation::Add &op)
 {
-  const auto lhs_idx{op.getInputs().at(ir::operation::Add::Input::LHS)};
-  const auto &lhs = _operands.at(lhs_idx);
-  const auto rhs_idx{op.getInputs().at(ir::operation::Add::Input::RHS)};
-  const auto &rhs = _operands.at(rhs_idx);
-  const auto output_idx = op.getOutputs().at(0);
-  ir::Operand &output = _operands.at(output_idx);
-
-  if (lhs.info().isDynamic() || rhs.info().isDynamic())
-  {
-    output.info().setDynamic();
-    return;
-  }
-
-  // re-sizing output shape
-  ir::Shape new_shape = inferEltwiseShape(lhs.info().shape(), rhs.info().shape());
-  output.info().shape(new_shape);
+  handleBinaryArithmeticOp(op, op.getInputs().at(ir::operation::Add::Input::LHS),
+                           op.getInputs().at(ir::operation::Add::Input::RHS));
 }
 
 void DynamicInferer::visit(const ir::operation::Add &op)
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferBatchMatMulShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape,
+                                const ir::operation::BatchMatMul::Param &param)
+{
+  const int lhs_rank = lhs_shape.rank();
+  const int rhs_rank = rhs_shape.rank();
+  if (lhs_rank < 2 || rhs_rank < 2)
+    throw std::runtime_error("BatchMatMul: rank of inputs must be at least 2");
+
+  const auto lhs_rows = lhs_shape.dim(lhs_rank - (param.adj_x ? 1 : 2));
+  const auto lhs_cols = lhs_shape.dim(lhs_rank - (param.adj_x ? 2 : 1));
+  const auto rhs_rows = rhs_shape.dim(rhs_rank - (param.adj_y ? 1 : 2));
+  const auto rhs_cols = rhs_shape.dim(rhs_rank - (param.adj_y ? 2 : 1));
+  if (lhs_cols != rhs_rows)
+    throw std::runtime_error("BatchMatMul: inner dimensions of inputs do not match");
+
+  // Batch dimensions are broadcasted
+  const int out_rank = std::max(lhs_rank, rhs_rank);
+  ir::Shape out_shape(out_rank);
+  for (int idx = 0; idx < out_rank - 2; ++idx)
+  {
+    const int lhs_idx = idx - (out_rank - lhs_rank);
+    const int rhs_idx = idx - (out_rank - rhs_rank);
+    const auto lhs_dim = lhs_idx >= 0 ? lhs_shape.dim(lhs_idx) : 1;
+    const auto rhs_dim = rhs_idx >= 0 ? rhs_shape.dim(rhs_idx) : 1;
+    if (lhs_dim != rhs_dim && lhs_dim != 1 && rhs_dim != 1)
+      throw std::runtime_error("BatchMatMul: batch dimensions are not broadcastable");
+    out_shape.dim(idx) = std::max(lhs_dim, rhs_dim);
+  }
+  out_shape.dim(out_rank - 2) = lhs_rows;
+  out_shape.dim(out_rank - 1) = rhs_cols;
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::BatchMatMul &op)
+{
+  const auto lhs_idx{op.getInputs().at(ir::operation::BatchMatMul::Input::LHS)};
+  const auto rhs_idx{op.getInputs().at(ir::operation::BatchMatMul::Input::RHS)};
+  const auto &lhs = _operands.at(lhs_idx);
+  const auto &rhs = _operands.at(rhs_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (lhs.info().isDynamic() || rhs.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferBatchMatMulShape(lhs.info().shape(), rhs.info().shape(), op.param());
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferBatchToSpaceNDShape(const ir::Shape &in_shape, const int32_t *block_buf)
+{
+  assert(in_shape.rank() == 4);
+  const int32_t block_height = block_buf[0];
+  const int32_t block_width = block_buf[1];
+
+  if (in_shape.dim(0) % (block_height * block_width) != 0)
+    throw std::runtime_error("BatchToSpaceND: batch is not divisible by block size");
+
+  return ir::Shape{in_shape.dim(0) / (block_height * block_width), in_shape.dim(1) * block_height,
+                   in_shape.dim(2) * block_width, in_shape.dim(3)};
+}
+
+void StaticInferer::visit(const ir::operation::BatchToSpaceND &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::BatchToSpaceND::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto block_idx{op.getInputs().at(ir::operation::BatchToSpaceND::Input::BLOCK_SIZE)};
+  const auto &block = _operands.at(block_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  if (!block.isConstant())
+  {
+    handleValueDependentOutput(op, output_idx);
+    return;
+  }
+
+  auto block_buf = reinterpret_cast<const int32_t *>(block.data()->base());
+  assert(block_buf);
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferBatchToSpaceNDShape(input.info().shape(), block_buf);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferDepthToSpaceShape(const ir::Shape &in_shape, int32_t block_size)
+{
+  assert(in_shape.rank() == 4);
+  if (in_shape.dim(3) % (block_size * block_size) != 0)
+    throw std::runtime_error("DepthToSpace: depth is not divisible by block_size * block_size");
+
+  return ir::Shape{in_shape.dim(0), in_shape.dim(1) * block_size, in_shape.dim(2) * block_size,
+                   in_shape.dim(3) / (block_size * block_size)};
+}
+
+void StaticInferer::visit(const ir::operation::DepthToSpace &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::DepthToSpace::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferDepthToSpaceShape(input.info().shape(), op.param().block_size);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
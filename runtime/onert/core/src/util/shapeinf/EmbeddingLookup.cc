@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferEmbeddingLookupShape(const ir::Shape &lookups_shape, const ir::Shape &values_shape)
+{
+  assert(lookups_shape.rank() == 1);
+  ir::Shape out_shape(values_shape);
+  out_shape.dim(0) = lookups_shape.dim(0);
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::EmbeddingLookup &op)
+{
+  const auto lookups_idx{op.getInputs().at(ir::operation::EmbeddingLookup::Input::LOOKUPS)};
+  const auto &lookups = _operands.at(lookups_idx);
+  const auto values_idx{op.getInputs().at(ir::operation::EmbeddingLookup::Input::VALUES)};
+  const auto &values = _operands.at(values_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (lookups.info().isDynamic() || values.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferEmbeddingLookupShape(lookups.info().shape(), values.info().shape());
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferFillShape(const int32_t *dims_buf, int32_t rank)
+{
+  ir::Shape out_shape(rank);
+  for (int32_t idx = 0; idx < rank; ++idx)
+  {
+    if (dims_buf[idx] < 0)
+      throw std::runtime_error("Fill: dims must not be negative");
+    out_shape.dim(idx) = dims_buf[idx];
+  }
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::Fill &op)
+{
+  const auto dims_idx{op.getInputs().at(ir::operation::Fill::Input::INPUT)};
+  const auto &dims = _operands.at(dims_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (!dims.isConstant())
+  {
+    handleValueDependentOutput(op, output_idx);
+    return;
+  }
+
+  auto dims_buf = reinterpret_cast<const int32_t *>(dims.data()->base());
+  assert(dims_buf);
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferFillShape(dims_buf, dims.shape().num_elements());
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
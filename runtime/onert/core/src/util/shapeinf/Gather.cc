@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferGatherShape(const ir::Shape &input_shape, const ir::Shape &indices_shape, int axis)
+{
+  const int rank = input_shape.rank();
+  axis = ((axis >= 0) ? axis : rank + axis);
+  if (!(0 <= axis && axis < rank))
+    throw std::runtime_error("Gather: axis of dim is out of range");
+
+  ir::Shape out_shape;
+  for (int idx = 0; idx < axis; ++idx)
+    out_shape.append(input_shape.dim(idx));
+  for (int idx = 0; idx < indices_shape.rank(); ++idx)
+    out_shape.append(indices_shape.dim(idx));
+  for (int idx = axis + 1; idx < rank; ++idx)
+    out_shape.append(input_shape.dim(idx));
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::Gather &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::Gather::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto indices_idx{op.getInputs().at(ir::operation::Gather::Input::INDICES)};
+  const auto &indices = _operands.at(indices_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (input.info().isDynamic() || indices.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape =
+      inferGatherShape(input.info().shape(), indices.info().shape(), op.param().axis);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+void StaticInferer::visit(const ir::operation::HashtableLookup &op)
+{
+  const auto lookups_idx{op.getInputs().at(ir::operation::HashtableLookup::Input::LOOKUPS)};
+  const auto &lookups = _operands.at(lookups_idx);
+  const auto values_idx{op.getInputs().at(ir::operation::HashtableLookup::Input::VALUES)};
+  const auto &values = _operands.at(values_idx);
+
+  // get mutable output operands
+  const auto output_idx{op.getOutputs().at(ir::operation::HashtableLookup::Output::OUTPUT)};
+  ir::Operand &output = _operands.at(output_idx);
+  const auto hits_idx{op.getOutputs().at(ir::operation::HashtableLookup::Output::HITS)};
+  ir::Operand &hits = _operands.at(hits_idx);
+
+  if (lookups.info().isDynamic() || values.info().isDynamic())
+  {
+    output.info().setDynamic();
+    hits.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shapes. Output is gathered from values like EmbeddingLookup.
+  ir::Shape new_shape = inferEmbeddingLookupShape(lookups.info().shape(), values.info().shape());
+  output.info().shape(new_shape);
+  hits.info().shape(ir::Shape{lookups.info().shape().dim(0)});
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+void StaticInferer::visit(const ir::operation::LSTM &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::LSTM::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  if (input.info().isDynamic())
+  {
+    for (const auto &output_idx : op.getOutputs())
+      _operands.at(output_idx).info().setDynamic();
+    return;
+  }
+
+  const auto &input_to_input_weights =
+      _operands.at(op.getInputs().at(ir::operation::LSTM::Input::INPUT_TO_INPUT_WEIGHTS));
+  const auto &recurrent_to_input_weights =
+      _operands.at(op.getInputs().at(ir::operation::LSTM::Input::RECURRENT_TO_INPUT_WEIGHTS));
+  const auto &input_to_output_weights =
+      _operands.at(op.getInputs().at(ir::operation::LSTM::Input::INPUT_TO_OUTPUT_WEIGHTS));
+  const auto &recurrent_to_output_weights =
+      _operands.at(op.getInputs().at(ir::operation::LSTM::Input::RECURRENT_TO_OUTPUT_WEIGHTS));
+
+  const auto batch_size = input.info().shape().dim(0);
+  const auto num_units = input_to_output_weights.info().shape().dim(0);
+  const auto output_size = recurrent_to_output_weights.info().shape().dim(1);
+
+  // Without input gate (CIFG), the scratch buffer holds 3 gates instead of 4
+  auto has_weights = [](const ir::Operand &weights) {
+    return weights.shape().dim(0) != 0 && weights.shape().dim(1) != 0;
+  };
+  const bool has_input_gate =
+      has_weights(input_to_input_weights) && has_weights(recurrent_to_input_weights);
+  const int32_t num_gates = has_input_gate ? 4 : 3;
+
+  // re-sizing output shapes
+  _operands.at(op.getOutputs().at(ir::operation::LSTM::Output::SCRATCH_BUFFER))
+      .info()
+      .shape(ir::Shape{batch_size, num_units * num_gates});
+  _operands.at(op.getOutputs().at(ir::operation::LSTM::Output::OUTPUT_STATE_OUT))
+      .info()
+      .shape(ir::Shape{batch_size, output_size});
+  _operands.at(op.getOutputs().at(ir::operation::LSTM::Output::CELL_STATE_OUT))
+      .info()
+      .shape(ir::Shape{batch_size, num_units});
+  _operands.at(op.getOutputs().at(ir::operation::LSTM::Output::OUTPUT))
+      .info()
+      .shape(ir::Shape{batch_size, output_size});
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferOneHotShape(const ir::Shape &indices_shape, int32_t depth, int axis)
+{
+  const int rank = indices_shape.rank() + 1;
+  axis = ((axis == -1) ? rank - 1 : axis);
+  if (!(0 <= axis && axis < rank))
+    throw std::runtime_error("OneHot: axis of dim is out of range");
+
+  ir::Shape out_shape;
+  for (int idx = 0, in_idx = 0; idx < rank; ++idx)
+  {
+    if (idx == axis)
+      out_shape.append(depth);
+    else
+      out_shape.append(indices_shape.dim(in_idx++));
+  }
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::OneHot &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::OneHot::Input::INDICES)};
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape =
+      inferOneHotShape(input.info().shape(), op.param().depth, op.param().axis);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
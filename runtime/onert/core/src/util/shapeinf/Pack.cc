@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferPackShape(const ir::Shape &in_shape, int32_t axis, int32_t num)
+{
+  const int32_t rank = in_shape.rank() + 1;
+  axis = ((axis >= 0) ? axis : rank + axis);
+  if (!(0 <= axis && axis < rank))
+    throw std::runtime_error("Pack: axis of dim is out of range");
+
+  ir::Shape out_shape;
+  for (int32_t idx = 0, in_idx = 0; idx < rank; ++idx)
+  {
+    if (idx == axis)
+      out_shape.append(num);
+    else
+      out_shape.append(in_shape.dim(in_idx++));
+  }
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::Pack &op)
+{
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  for (const auto &input_idx : op.getInputs())
+  {
+    if (_operands.at(input_idx).info().isDynamic())
+    {
+      output.info().setDynamic();
+      return;
+    }
+  }
+
+  // All inputs have the same shape
+  const auto &input = _operands.at(op.getInputs().at(0));
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferPackShape(input.info().shape(), op.param().axis, op.param().num);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
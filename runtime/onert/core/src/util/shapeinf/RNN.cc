@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+void StaticInferer::visit(const ir::operation::RNN &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::RNN::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto weights_idx{op.getInputs().at(ir::operation::RNN::Input::WEIGHTS)};
+  const auto &weights = _operands.at(weights_idx);
+
+  // get mutable output operands
+  const auto output_idx{op.getOutputs().at(ir::operation::RNN::Output::OUTPUT)};
+  ir::Operand &output = _operands.at(output_idx);
+  const auto hidden_state_out_idx{op.getOutputs().at(ir::operation::RNN::Output::HIDDEN_STATE_OUT)};
+  ir::Operand &hidden_state_out = _operands.at(hidden_state_out_idx);
+
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    hidden_state_out.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shapes. Both are [batch_size, num_units].
+  const auto batch_size = input.info().shape().dim(0);
+  const auto num_units = weights.info().shape().dim(0);
+  output.info().shape(ir::Shape{batch_size, num_units});
+  hidden_state_out.info().shape(ir::Shape{batch_size, num_units});
+}
+
+} // namespace shape_inference
+} // namespace onert
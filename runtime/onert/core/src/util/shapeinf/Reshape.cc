@@ -40,6 +40,40 @@ namespace onert
 namespace shape_inference
 {
 
+ir::Shape inferReshapeShape(const int32_t *shape_buf, int32_t shape_num_elements,
+                            size_t total_num_elements)
+{
+  ir::Shape out_shape(shape_num_elements);
+  int32_t unknown_axis = -1;
+  size_t known_num_elements = 1;
+
+  for (int32_t idx = 0; idx < shape_num_elements; ++idx)
+  {
+    if (shape_buf[idx] == -1)
+    {
+      // At most one dim can be -1, which is inferred from the number of elements
+      if (unknown_axis != -1)
+        throw std::runtime_error("Reshape: 2nd param has more than one -1");
+      unknown_axis = idx;
+      continue;
+    }
+    out_shape.dim(idx) = shape_buf[idx];
+    known_num_elements *= shape_buf[idx];
+  }
+
+  if (unknown_axis != -1)
+  {
+    if (known_num_elements == 0 || total_num_elements % known_num_elements != 0)
+      throw std::runtime_error("Reshape: 2nd param is not compatible with the shape of input");
+    out_shape.dim(unknown_axis) = total_num_elements / known_num_elements;
+  }
+
+  if (static_cast<size_t>(out_shape.num_elements()) != total_num_elements)
+    throw std::runtime_error("Reshape: 2nd param is not compatible with the shape of input");
+
+  return out_shape;
+}
+
 // StaticInferer at compilation time
 void StaticInferer::visit(const ir::operation::Reshape &op)
 {
@@ -67,10 +101,15 @@ void StaticInferer::visit(const ir::operation::Reshape &op)
   const auto shape_idx{op.getInputs().at(ir::operation::Reshape::Input::SHAPE)};
   const auto &shape = _operands.at(shape_idx);
 
-  // if shape is from Const, TFLC put the shape of output into tensor
+  // if shape is from Const, compute output shape from it since input shape may have been changed
   if (shape.isConstant())
   {
-    // no change on output shape
+    auto shape_buf = reinterpret_cast<const int32_t *>(shape.data()->base());
+    assert(shape_buf);
+
+    ir::Shape new_shape = inferReshapeShape(shape_buf, shape.shape().num_elements(),
+                                            input.info().shape().num_elements());
+    output.info().shape(new_shape);
     return;
   }
 
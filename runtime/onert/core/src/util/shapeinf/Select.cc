@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferSelectShape(const ir::Shape &cond_shape, const ir::Shape &true_shape,
+                           const ir::Shape &false_shape)
+{
+  const auto value_shape = inferEltwiseShape(true_shape, false_shape);
+
+  // Condition of rank 1 selects along the first dimension
+  if (cond_shape.rank() == 1 && value_shape.rank() > 1)
+  {
+    if (cond_shape.dim(0) != value_shape.dim(0))
+      throw std::runtime_error("Select: condition does not match the first dimension of inputs");
+    return value_shape;
+  }
+
+  return inferEltwiseShape(cond_shape, value_shape);
+}
+
+void StaticInferer::visit(const ir::operation::Select &op)
+{
+  const auto cond_idx{op.getInputs().at(ir::operation::Select::Input::CONDITION)};
+  const auto &cond = _operands.at(cond_idx);
+  const auto true_idx{op.getInputs().at(ir::operation::Select::Input::INPUT_TRUE)};
+  const auto &input_true = _operands.at(true_idx);
+  const auto false_idx{op.getInputs().at(ir::operation::Select::Input::INPUT_FALSE)};
+  const auto &input_false = _operands.at(false_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (cond.info().isDynamic() || input_true.info().isDynamic() || input_false.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferSelectShape(cond.info().shape(), input_true.info().shape(),
+                                         input_false.info().shape());
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -123,8 +123,8 @@ Shapes inferAvgPoolShape(const ir::Shape &in_shape, const ir::operation::AvgPool
 // TODO move this when Concat.cc is created in util/shapeinf
 ir::Shape inferConcatShape(const Shapes &in_shapes, const ir::operation::Concat::Param &param)
 {
-  const int32_t concat_axis = param.axis;
   const auto &first_in_shape = in_shapes[0];
+  const int32_t concat_axis = param.axis >= 0 ? param.axis : param.axis + first_in_shape.rank();
 
   // Check that all shapes are equal except for concat axis dimension
   for (const auto &in_shape : in_shapes)
@@ -142,6 +142,31 @@ ir::Shape inferConcatShape(const Shapes &in_shapes, const ir::operation::Concat:
   return out_shape;
 }
 
+ir::Shape inferReduceShape(const ir::Shape &in_shape, const std::vector<int> &axes,
+                           bool keep_dims)
+{
+  const int rank = in_shape.rank();
+  std::vector<bool> is_reduced(rank, false);
+  for (const auto axis : axes)
+  {
+    const int current = axis < 0 ? axis + rank : axis;
+    if (!(0 <= current && current < rank))
+      throw std::runtime_error("Reduce: axis of dim is out of range");
+    is_reduced[current] = true;
+  }
+
+  ir::Shape out_shape;
+  for (int idx = 0; idx < rank; ++idx)
+  {
+    if (!is_reduced[idx])
+      out_shape.append(in_shape.dim(idx));
+    else if (keep_dims)
+      out_shape.append(1);
+  }
+
+  return out_shape;
+}
+
 // TODO move this when Conv2D.cc is created in util/shapeinf
 Shapes inferConv2DShape(const ir::Shape &in_shape, const ir::Shape &ker_shape,
                         const ir::operation::Conv2D::Param &param, ir::Layout layout)
@@ -193,6 +218,17 @@ Shapes inferFullyConnectedShape(const ir::Shape &in_shape, const ir::Shape &ker_
   return {{ir::Shape({static_cast<int32_t>(batch_size), num_units})}};
 }
 
+Shapes inferL2Pool2DShape(const ir::Shape &in_shape, const ir::operation::L2Pool2D::Param &param,
+                          const ir::Layout layout)
+{
+  assert(layout == ir::Layout::NHWC);
+  auto ifm_shape = in_shape.asFeature(layout);
+  const auto out_h_w = calcConvLikeHeightAndWidth(ifm_shape.H, ifm_shape.W, param.kh, param.kw,
+                                                  param.padding, param.stride);
+  // Pooling don't change number of channels and batch size
+  return {ir::Shape{ifm_shape.N, out_h_w.first, out_h_w.second, ifm_shape.C}};
+}
+
 // TODO move this when MaxPool.cc is created in util/shapeinf
 Shapes inferMaxPoolShape(const ir::Shape &in_shape, const ir::operation::MaxPool2D::Param &param,
                          const ir::Layout layout)
@@ -234,6 +270,86 @@ void StaticInferer::dump()
   });
 }
 
+void StaticInferer::handleBinaryArithmeticOp(const ir::Operation &op,
+                                             const ir::OperandIndex lhs_idx,
+                                             const ir::OperandIndex rhs_idx)
+{
+  const auto &lhs = _operands.at(lhs_idx);
+  const auto &rhs = _operands.at(rhs_idx);
+
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (lhs.info().isDynamic() || rhs.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferEltwiseShape(lhs.info().shape(), rhs.info().shape());
+  output.info().shape(new_shape);
+}
+
+void StaticInferer::handleSimpleUnaryOp(const ir::Operation &op, const ir::OperandIndex input_idx)
+{
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = input.info().shape();
+  output.info().shape(new_shape);
+}
+
+void StaticInferer::handleValueDependentOutput(const ir::Operation &op,
+                                               const ir::OperandIndex output_idx)
+{
+  ir::Operand &output = _operands.at(output_idx);
+  if (output.info().shape().hasUnknownDim())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // The declared shape was computed from the declared shapes of inputs
+  for (const auto &input_idx : op.getInputs())
+  {
+    if (input_idx.valid() && _operands.at(input_idx).info().isShapeChanged())
+    {
+      output.info().setDynamic();
+      return;
+    }
+  }
+}
+
+void StaticInferer::visit(const ir::operation::AvgPool2D &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::AvgPool2D::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferAvgPoolShape(input.info().shape(), op.param())[0];
+  output.info().shape(new_shape);
+}
+
 // TODO move this into Concat.cc
 void StaticInferer::visit(const ir::operation::Concat &op)
 {
@@ -263,6 +379,104 @@ void StaticInferer::visit(const ir::operation::Concat &op)
   output.info().shape(out_shape);
 }
 
+void StaticInferer::visit(const ir::operation::Conv2D &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::Conv2D::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto ker_idx{op.getInputs().at(ir::operation::Conv2D::Input::KERNEL)};
+  const auto &ker = _operands.at(ker_idx);
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (input.info().isDynamic() || ker.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape =
+      inferConv2DShape(input.info().shape(), ker.info().shape(), op.param())[0];
+  output.info().shape(new_shape);
+}
+
+void StaticInferer::visit(const ir::operation::DepthwiseConv2D &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::DepthwiseConv2D::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto ker_idx{op.getInputs().at(ir::operation::DepthwiseConv2D::Input::KERNEL)};
+  const auto &ker = _operands.at(ker_idx);
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (input.info().isDynamic() || ker.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape =
+      inferDepthwiseConv2DShape(input.info().shape(), ker.info().shape(), op.param())[0];
+  output.info().shape(new_shape);
+}
+
+void StaticInferer::visit(const ir::operation::FullyConnected &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::FullyConnected::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto ker_idx{op.getInputs().at(ir::operation::FullyConnected::Input::WEIGHT)};
+  const auto &ker = _operands.at(ker_idx);
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (input.info().isDynamic() || ker.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferFullyConnectedShape(input.info().shape(), ker.info().shape())[0];
+  output.info().shape(new_shape);
+}
+
+void StaticInferer::visit(const ir::operation::L2Pool2D &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::L2Pool2D::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferL2Pool2DShape(input.info().shape(), op.param())[0];
+  output.info().shape(new_shape);
+}
+
+void StaticInferer::visit(const ir::operation::MaxPool2D &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::MaxPool2D::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferMaxPoolShape(input.info().shape(), op.param())[0];
+  output.info().shape(new_shape);
+}
+
 /*
  * DynamicInferer
   - Write methods except visit()
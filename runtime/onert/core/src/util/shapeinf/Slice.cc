@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferSliceShape(const ir::Shape &input_shape, const int32_t *begins_buf,
+                          const int32_t *sizes_buf)
+{
+  const int rank = input_shape.rank();
+  ir::Shape out_shape(rank);
+
+  for (int idx = 0; idx < rank; ++idx)
+  {
+    const auto input_dim = input_shape.dim(idx);
+    const auto begin = begins_buf[idx];
+    const auto size = sizes_buf[idx];
+
+    if (begin < 0 || begin > input_dim)
+      throw std::runtime_error("Slice: begin is out of range");
+
+    if (size == -1)
+    {
+      // -1 means all the remaining elements
+      out_shape.dim(idx) = input_dim - begin;
+    }
+    else
+    {
+      if (size < 0 || begin + size > input_dim)
+        throw std::runtime_error("Slice: size is out of range");
+      out_shape.dim(idx) = size;
+    }
+  }
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::Slice &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::Slice::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto begins_idx{op.getInputs().at(ir::operation::Slice::Input::BEGINS)};
+  const auto &begins = _operands.at(begins_idx);
+  const auto sizes_idx{op.getInputs().at(ir::operation::Slice::Input::SIZES)};
+  const auto &sizes = _operands.at(sizes_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  if (!begins.isConstant() || !sizes.isConstant())
+  {
+    handleValueDependentOutput(op, output_idx);
+    return;
+  }
+
+  auto begins_buf = reinterpret_cast<const int32_t *>(begins.data()->base());
+  auto sizes_buf = reinterpret_cast<const int32_t *>(sizes.data()->base());
+  assert(begins_buf && sizes_buf);
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferSliceShape(input.info().shape(), begins_buf, sizes_buf);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
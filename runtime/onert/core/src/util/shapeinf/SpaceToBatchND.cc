@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferSpaceToBatchNDShape(const ir::Shape &in_shape, const int32_t *block_buf,
+                                   const int32_t *paddings_buf)
+{
+  assert(in_shape.rank() == 4);
+  const int32_t block_height = block_buf[0];
+  const int32_t block_width = block_buf[1];
+
+  // paddings_buf is [[top, bottom], [left, right]]
+  const int32_t padded_height = in_shape.dim(1) + paddings_buf[0] + paddings_buf[1];
+  const int32_t padded_width = in_shape.dim(2) + paddings_buf[2] + paddings_buf[3];
+
+  if (padded_height % block_height != 0 || padded_width % block_width != 0)
+    throw std::runtime_error("SpaceToBatchND: padded size is not divisible by block size");
+
+  return ir::Shape{in_shape.dim(0) * block_height * block_width, padded_height / block_height,
+                   padded_width / block_width, in_shape.dim(3)};
+}
+
+void StaticInferer::visit(const ir::operation::SpaceToBatchND &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::SpaceToBatchND::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto block_idx{op.getInputs().at(ir::operation::SpaceToBatchND::Input::BLOCK_SIZE)};
+  const auto &block = _operands.at(block_idx);
+  const auto paddings_idx{op.getInputs().at(ir::operation::SpaceToBatchND::Input::PADDINGS)};
+  const auto &paddings = _operands.at(paddings_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  if (!block.isConstant() || !paddings.isConstant())
+  {
+    handleValueDependentOutput(op, output_idx);
+    return;
+  }
+
+  auto block_buf = reinterpret_cast<const int32_t *>(block.data()->base());
+  auto paddings_buf = reinterpret_cast<const int32_t *>(paddings.data()->base());
+  assert(block_buf && paddings_buf);
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferSpaceToBatchNDShape(input.info().shape(), block_buf, paddings_buf);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferSqueezeShape(const ir::Shape &in_shape, const ir::operation::Squeeze::Param &param)
+{
+  const int rank = in_shape.rank();
+  std::vector<bool> should_squeeze(rank, false);
+
+  if (param.ndim == 0)
+  {
+    // Squeeze all dims of size 1
+    for (int idx = 0; idx < rank; ++idx)
+    {
+      if (in_shape.dim(idx) == 1)
+        should_squeeze[idx] = true;
+    }
+  }
+  else
+  {
+    for (int idx = 0; idx < param.ndim; ++idx)
+    {
+      const int current = param.dims[idx] < 0 ? param.dims[idx] + rank : param.dims[idx];
+      if (!(0 <= current && current < rank && in_shape.dim(current) == 1))
+        throw std::runtime_error("Squeeze: dim to squeeze must be in range and of size 1");
+      should_squeeze[current] = true;
+    }
+  }
+
+  ir::Shape out_shape;
+  for (int idx = 0; idx < rank; ++idx)
+  {
+    if (!should_squeeze[idx])
+      out_shape.append(in_shape.dim(idx));
+  }
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::Squeeze &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::Squeeze::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferSqueezeShape(input.info().shape(), op.param());
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace onert
+{
+namespace shape_inference
+{
+
+namespace
+{
+
+// Same as StartForAxis() and StopForAxis() of
+// tensorflow/lite/kernels/internal/strided_slice_logic.h
+int32_t startForAxis(const ir::operation::StridedSlice::Param &param, const ir::Shape &in_shape,
+                     const int32_t *starts_buf, const int32_t *strides_buf, int axis)
+{
+  const int32_t axis_size = in_shape.dim(axis);
+  const int32_t stride = strides_buf[axis];
+  int32_t start = starts_buf[axis];
+
+  if (param.begin_mask & (1 << axis))
+    start = stride > 0 ? std::numeric_limits<int32_t>::lowest()
+                       : std::numeric_limits<int32_t>::max();
+
+  if (start < 0)
+    start += axis_size;
+
+  if (stride > 0)
+    start = std::min(std::max(start, 0), axis_size);
+  else
+    start = std::min(std::max(start, -1), axis_size - 1);
+
+  return start;
+}
+
+int32_t stopForAxis(const ir::operation::StridedSlice::Param &param, const ir::Shape &in_shape,
+                    const int32_t *ends_buf, const int32_t *strides_buf, int axis,
+                    int32_t start_for_axis)
+{
+  // A shrunk axis takes exactly one element
+  if (param.shrink_axis_mask & (1 << axis))
+    return start_for_axis + 1;
+
+  const int32_t axis_size = in_shape.dim(axis);
+  const int32_t stride = strides_buf[axis];
+  int32_t stop = ends_buf[axis];
+
+  if (param.end_mask & (1 << axis))
+    stop = stride > 0 ? std::numeric_limits<int32_t>::max()
+                      : std::numeric_limits<int32_t>::lowest();
+
+  if (stop < 0)
+    stop += axis_size;
+
+  if (stride > 0)
+    stop = std::min(std::max(stop, 0), axis_size);
+  else
+    stop = std::min(std::max(stop, -1), axis_size - 1);
+
+  return stop;
+}
+
+} // namespace
+
+ir::Shape inferStridedSliceShape(const ir::Shape &in_shape, const int32_t *starts_buf,
+                                 const int32_t *ends_buf, const int32_t *strides_buf,
+                                 const ir::operation::StridedSlice::Param &param)
+{
+  ir::Shape out_shape;
+
+  for (int idx = 0; idx < in_shape.rank(); ++idx)
+  {
+    const int32_t stride = strides_buf[idx];
+    if (stride == 0)
+      throw std::runtime_error("StridedSlice: stride must not be 0");
+
+    const int32_t start = startForAxis(param, in_shape, starts_buf, strides_buf, idx);
+    const int32_t stop = stopForAxis(param, in_shape, ends_buf, strides_buf, idx, start);
+
+    if (param.shrink_axis_mask & (1 << idx))
+      continue;
+
+    // ceil((stop - start) / stride), but not less than 0
+    const int32_t dim = stride > 0 ? (stop - start + stride - 1) / stride
+                                   : (start - stop - stride - 1) / (-stride);
+    out_shape.append(std::max(dim, 0));
+  }
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::StridedSlice &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::StridedSlice::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto starts_idx{op.getInputs().at(ir::operation::StridedSlice::Input::STARTS)};
+  const auto &starts = _operands.at(starts_idx);
+  const auto ends_idx{op.getInputs().at(ir::operation::StridedSlice::Input::ENDS)};
+  const auto &ends = _operands.at(ends_idx);
+  const auto strides_idx{op.getInputs().at(ir::operation::StridedSlice::Input::STRIDES)};
+  const auto &strides = _operands.at(strides_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  if (!starts.isConstant() || !ends.isConstant() || !strides.isConstant())
+  {
+    handleValueDependentOutput(op, output_idx);
+    return;
+  }
+
+  auto starts_buf = reinterpret_cast<const int32_t *>(starts.data()->base());
+  auto ends_buf = reinterpret_cast<const int32_t *>(ends.data()->base());
+  auto strides_buf = reinterpret_cast<const int32_t *>(strides.data()->base());
+  assert(starts_buf && ends_buf && strides_buf);
+
+  // re-sizing output shape
+  ir::Shape new_shape =
+      inferStridedSliceShape(input.info().shape(), starts_buf, ends_buf, strides_buf, op.param());
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
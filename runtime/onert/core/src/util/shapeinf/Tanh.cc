@@ -23,23 +23,7 @@ namespace shape_inference
 
 void StaticInferer::visit(const ir::operation::Tanh &op)
 {
-  const auto input_idx{op.getInputs().at(ir::operation::Tanh::Input::INPUT)};
-  const auto &input = _operands.at(input_idx);
-
-  // get mutable output operand
-  const auto output_idx = op.getOutputs().at(0);
-  ir::Operand &output = _operands.at(output_idx);
-
-  // if input is dynamic, output also becomes dynamic
-  if (input.info().isDynamic())
-  {
-    output.info().setDynamic();
-    return;
-  }
-
-  // re-sizing output shape
-  ir::Shape new_shape = input.info().shape();
-  output.info().shape(new_shape);
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::Tanh::Input::INPUT));
 }
 
 void DynamicInferer::visit(const ir::operation::Tanh &op)
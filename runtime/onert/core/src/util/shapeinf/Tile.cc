@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiples_buf)
+{
+  ir::Shape out_shape(in_shape.rank());
+  for (int idx = 0; idx < in_shape.rank(); ++idx)
+  {
+    if (multiples_buf[idx] < 0)
+      throw std::runtime_error("Tile: multiples must not be negative");
+    out_shape.dim(idx) = in_shape.dim(idx) * multiples_buf[idx];
+  }
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::Tile &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::Tile::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto multiples_idx{op.getInputs().at(ir::operation::Tile::Input::MULTIPLES)};
+  const auto &multiples = _operands.at(multiples_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  if (!multiples.isConstant())
+  {
+    handleValueDependentOutput(op, output_idx);
+    return;
+  }
+
+  auto multiples_buf = reinterpret_cast<const int32_t *>(multiples.data()->base());
+  assert(multiples_buf);
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferTileShape(input.info().shape(), multiples_buf);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, int32_t k)
+{
+  const int rank = in_shape.rank();
+  if (rank < 1)
+    throw std::runtime_error("TopKV2: input must have rank 1 or more");
+  if (k > in_shape.dim(rank - 1))
+    throw std::runtime_error("TopKV2: k is larger than the last dimension");
+
+  ir::Shape out_shape(in_shape);
+  out_shape.dim(rank - 1) = k;
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::TopKV2 &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operands
+  const auto values_idx{op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES)};
+  ir::Operand &values = _operands.at(values_idx);
+  const auto indices_idx{op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_INDICES)};
+  ir::Operand &indices = _operands.at(indices_idx);
+
+  // if input is dynamic, outputs also become dynamic
+  if (input.info().isDynamic())
+  {
+    values.info().setDynamic();
+    indices.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shapes
+  ir::Shape new_shape = inferTopKV2Shape(input.info().shape(), op.param().k);
+  values.info().shape(new_shape);
+  indices.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferTransposeShape(const ir::Shape &in_shape, const std::vector<int> &perm)
+{
+  const int rank = in_shape.rank();
+  ir::Shape out_shape(rank);
+
+  // Empty perm means reversing dims
+  if (perm.empty())
+  {
+    for (int idx = 0; idx < rank; ++idx)
+      out_shape.dim(idx) = in_shape.dim(rank - idx - 1);
+    return out_shape;
+  }
+
+  if (static_cast<int>(perm.size()) != rank)
+    throw std::runtime_error("Transpose: size of perm is not same with rank of input");
+
+  std::vector<bool> visited(rank, false);
+  for (int idx = 0; idx < rank; ++idx)
+  {
+    const int from = perm[idx];
+    if (!(0 <= from && from < rank) || visited[from])
+      throw std::runtime_error("Transpose: perm is not a permutation");
+    visited[from] = true;
+    out_shape.dim(idx) = in_shape.dim(from);
+  }
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::Transpose &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::Transpose::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shape
+  ir::Shape new_shape = inferTransposeShape(input.info().shape(), op.param().perm);
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
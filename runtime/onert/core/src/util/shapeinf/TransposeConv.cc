@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+void StaticInferer::visit(const ir::operation::TransposeConv &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::TransposeConv::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+  const auto output_shape_idx{op.getInputs().at(ir::operation::TransposeConv::Input::OUTPUT_SHAPE)};
+  const auto &output_shape = _operands.at(output_shape_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // if input is dynamic, output also becomes dynamic
+  if (input.info().isDynamic())
+  {
+    output.info().setDynamic();
+    return;
+  }
+
+  if (!output_shape.isConstant())
+  {
+    handleValueDependentOutput(op, output_idx);
+    return;
+  }
+
+  auto output_shape_buf = reinterpret_cast<const int32_t *>(output_shape.data()->base());
+  assert(output_shape_buf);
+
+  // re-sizing output shape. Output shape is given as it is.
+  ir::Shape new_shape(output_shape.shape().num_elements());
+  for (int idx = 0; idx < new_shape.rank(); ++idx)
+    new_shape.dim(idx) = output_shape_buf[idx];
+  output.info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
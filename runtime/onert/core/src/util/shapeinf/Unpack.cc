@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ShapeInference.h"
+
+namespace onert
+{
+namespace shape_inference
+{
+
+ir::Shape inferUnpackShape(const ir::Shape &in_shape, int axis)
+{
+  const int rank = in_shape.rank();
+  axis = ((axis >= 0) ? axis : rank + axis);
+  if (!(0 <= axis && axis < rank))
+    throw std::runtime_error("Unpack: axis of dim is out of range");
+
+  ir::Shape out_shape;
+  for (int idx = 0; idx < rank; ++idx)
+  {
+    if (idx != axis)
+      out_shape.append(in_shape.dim(idx));
+  }
+
+  return out_shape;
+}
+
+void StaticInferer::visit(const ir::operation::Unpack &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::Unpack::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // if input is dynamic, outputs also become dynamic
+  if (input.info().isDynamic())
+  {
+    for (const auto &output_idx : op.getOutputs())
+      _operands.at(output_idx).info().setDynamic();
+    return;
+  }
+
+  // re-sizing output shapes. All outputs have the same shape.
+  ir::Shape new_shape = inferUnpackShape(input.info().shape(), op.param().axis);
+  for (const auto &output_idx : op.getOutputs())
+    _operands.at(output_idx).info().shape(new_shape);
+}
+
+} // namespace shape_inference
+} // namespace onert
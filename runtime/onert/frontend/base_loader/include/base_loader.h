@@ -24,6 +24,10 @@
 #include <memory>
 #include <fstream>
 #include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace onert
 {
@@ -53,7 +57,10 @@ public:
    *
    * @param graph reference on subgraphs
    */
-  explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs) : _subgraphs(subgs), _model{nullptr} {}
+  explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs)
+      : _base{nullptr}, _subgraphs(subgs), _model{nullptr}
+  {
+  }
 
   /**
    * @brief Load a model from file
@@ -149,10 +156,11 @@ protected:
   void loadZerosLike(const Operator *op, ir::Graph &subg);
   void loadTile(const Operator *op, ir::Graph &subg);
   void loadLogicalOr(const Operator *op, ir::Graph &subg);
+  void loadBatchMatMul(const Operator *op, ir::Graph &subg);
 
 protected:
-  // Buffer for loading (if needed)
-  std::vector<char> _buffer;
+  // Base address of the mapped model file
+  const uint8_t *_base;
   // Reference on loadable subgraphs
   std::unique_ptr<ir::Subgraphs> &_subgraphs;
   const Model *_model;
@@ -165,30 +173,46 @@ protected:
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const char *file_path)
 {
-  std::ifstream stream(file_path, std::fstream::in | std::fstream::binary);
-
-  if (!stream)
+  int fd = open(file_path, O_RDONLY);
+  if (fd < 0)
   {
-    std::string msg = "Failed to open file `";
-    msg += file_path;
-    msg += "`";
-    throw std::runtime_error{msg};
+    throw std::runtime_error{"Failed to open file `" + std::string{file_path} + "`"};
   }
 
-  stream.seekg(0, stream.end);
-  auto size = stream.tellg();
-  stream.seekg(0, stream.beg);
-
-  _buffer.resize(size);
-  stream.read(_buffer.data(), size);
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0)
+  {
+    close(fd);
+    throw std::runtime_error{"Failed to get size of file `" + std::string{file_path} + "`"};
+  }
+  const auto size = static_cast<size_t>(file_stat.st_size);
 
-  stream.close();
+  // Map the model instead of reading it so that pages are only touched as they are parsed.
+  // Constant data is copied out while loading, so the mapping is released afterwards.
+  void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED)
+  {
+    throw std::runtime_error{"Failed to mmap file `" + std::string{file_path} + "`"};
+  }
+  _base = reinterpret_cast<const uint8_t *>(mapped);
 
   // Prepare verifier
-  _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_buffer.data()),
-                                         _buffer.size());
+  _verifier = std::make_unique<Verifier>(_base, size);
 
-  loadModel();
+  try
+  {
+    loadModel();
+  }
+  catch (...)
+  {
+    munmap(mapped, size);
+    _base = nullptr;
+    throw;
+  }
+
+  munmap(mapped, size);
+  _base = nullptr;
 }
 
 template <typename LoaderDomain, typename SpecificLoader>
@@ -227,6 +251,8 @@ BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::tensorTypeToDataType(const
       return ir::DataType::BOOL8;
     case TensorType::TensorType_UINT8:
       return ir::DataType::QUANT8_ASYMM;
+    case TensorType::TensorType_INT8:
+      return ir::DataType::QUANT8_ASYMM_SIGNED;
     default:
       throw std::runtime_error(
           std::string("Unsupported tensor type: ").append(EnumNameTensorType(type)));
@@ -265,18 +291,35 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   auto q_params = tensor->quantization();
   float scale = 0.0;
   long zero_point = 0;
+  std::vector<float> channel_scales;
+  int32_t channel_axis = 0;
   if (q_params != nullptr)
   {
-    if (q_params->scale())
+    if (q_params->scale() && q_params->scale()->size() > 0)
     {
-      if (q_params->scale()->size() != 1)
+      scale = q_params->scale()->Get(0);
+      // Per-channel quantization, which is symmetric
+      if (q_params->scale()->size() > 1)
       {
-        throw std::runtime_error("Only 1 scale for a tensor is supported.");
+        channel_scales.assign(q_params->scale()->begin(), q_params->scale()->end());
+        channel_axis = q_params->quantized_dimension();
+        if (channel_axis < 0 || channel_axis >= static_cast<int32_t>(shape.rank()) ||
+            shape.dim(channel_axis) != static_cast<int32_t>(channel_scales.size()))
+          throw std::runtime_error("Number of scales must match the quantized dimension.");
+        if (q_params->zero_point())
+        {
+          for (const auto channel_zero_point : *q_params->zero_point())
+          {
+            if (channel_zero_point != 0)
+              throw std::runtime_error("Per-channel quantization must be symmetric.");
+          }
+        }
+        if (data_type == ir::DataType::QUANT8_ASYMM_SIGNED)
+          data_type = ir::DataType::QUANT8_SYMM;
       }
-      scale = q_params->scale()->Get(0);
     }
 
-    if (q_params->zero_point())
+    if (q_params->zero_point() && channel_scales.empty())
     {
       if (q_params->zero_point()->size() != 1)
       {
@@ -293,6 +336,7 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   }
   // Create TypeInfo
   ir::TypeInfo type_info(data_type, scale, zero_point);
+  type_info.channel_scales(channel_scales, channel_axis);
   // Create operand
   const auto operand_index = subg.addOperand(shape, type_info);
 
@@ -547,7 +591,8 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadFC(const Operator *op, ir::Gr
   const auto &input_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::INPUT));
   auto &weights_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::WEIGHT));
   if (input_operand.typeInfo().type() == ir::DataType::FLOAT32 &&
-      weights_operand.typeInfo().type() == ir::DataType::QUANT8_ASYMM)
+      (weights_operand.typeInfo().type() == ir::DataType::QUANT8_ASYMM ||
+       weights_operand.typeInfo().type() == ir::DataType::QUANT8_ASYMM_SIGNED))
   {
     weights_operand.type(ir::DataType::QUANT8_SYMM);
   }
@@ -1444,6 +1489,29 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadPow(const Operator *op, ir::G
   subg.addOperation(std::move(new_op));
 }
 
+template <typename LoaderDomain, typename SpecificLoader>
+void BaseLoader<LoaderDomain, SpecificLoader>::loadBatchMatMul(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  ir::operation::BatchMatMul::Param param;
+  // Options are optional, and their fields are false by default
+  param.adj_x = false;
+  param.adj_y = false;
+  const auto *options = op->builtin_options_as_BatchMatMulOptions();
+  if (options != nullptr)
+  {
+    param.adj_x = options->adjoint_lhs();
+    param.adj_y = options->adjoint_rhs();
+  }
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::BatchMatMul(inputs, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadLogicalNot(const Operator *op, ir::Graph &subg)
 {
@@ -1702,6 +1770,9 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadOperation(const Operator *op,
     case BuiltinOperator::BuiltinOperator_TILE:
       loadTile(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_BATCH_MATMUL:
+      loadBatchMatMul(op, subg);
+      return;
     default:
       throw std::runtime_error(
           std::string("Unsupported operation: ").append(EnumNameBuiltinOperator(builtin_op)));
@@ -1712,7 +1783,7 @@ template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadModel()
 {
   LoaderDomain::VerifyModelBuffer(*_verifier.get());
-  _model = LoaderDomain::GetModel(_buffer.data());
+  _model = LoaderDomain::GetModel(_base);
   // Version unused
   // const auto version = _model->version();
   // Description unused
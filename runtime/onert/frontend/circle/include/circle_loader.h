@@ -25,7 +25,14 @@ namespace onert
 {
 namespace circle_loader
 {
-std::unique_ptr<ir::Subgraphs> loadModel(const char *filename);
+/**
+ * @brief Load a circle model
+ *
+ * @param filename          Path to the circle model
+ * @param weights_filename  Path to the external weights file, or nullptr if the model has none
+ */
+std::unique_ptr<ir::Subgraphs> loadModel(const char *filename,
+                                         const char *weights_filename = nullptr);
 } // namespace circle_loader
 } // namespace onert
 
@@ -18,6 +18,10 @@
 #include "base_loader.h"
 #include "circle_schema_generated.h"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace onert
 {
 namespace circle_loader
@@ -70,7 +74,57 @@ struct LoaderDomain
 class CircleLoader final : public base_loader::BaseLoader<LoaderDomain, CircleLoader>
 {
 public:
-  using BaseLoader::BaseLoader;
+  CircleLoader(std::unique_ptr<ir::Subgraphs> &subgs, const char *weights_path)
+      : BaseLoader(subgs), _weights_fd{-1}, _weights_size{0}
+  {
+    if (weights_path == nullptr)
+      return;
+
+    _weights_fd = open(weights_path, O_RDONLY);
+    if (_weights_fd < 0)
+    {
+      throw std::runtime_error{"Failed to open weights file `" + std::string{weights_path} + "`"};
+    }
+
+    struct stat file_stat;
+    if (fstat(_weights_fd, &file_stat) != 0)
+    {
+      close(_weights_fd);
+      throw std::runtime_error{"Failed to get size of weights file `" + std::string{weights_path} +
+                               "`"};
+    }
+    _weights_size = static_cast<uint64_t>(file_stat.st_size);
+  }
+
+  ~CircleLoader()
+  {
+    if (_weights_fd >= 0)
+      close(_weights_fd);
+  }
+
+  ir::OperandIndex loadOperand(const circle::Tensor *tensor, ir::Graph &subg)
+  {
+    const auto operand_index = BaseLoader::loadOperand(tensor, subg);
+
+    // Constant tensors whose contents live in the external weights file
+    const auto *buffer = _model->buffers()->Get(tensor->buffer());
+    if (buffer->data() == nullptr && buffer->size() != 0)
+    {
+      if (_weights_fd < 0)
+        throw std::runtime_error("Model refers to external weights, but no weights file is given");
+
+      // Written so that a corrupted offset or size cannot wrap the sum around
+      const uint64_t offset = buffer->offset();
+      const uint64_t size = buffer->size();
+      if (offset > _weights_size || size > _weights_size - offset)
+        throw std::runtime_error("External weights of tensor are out of the weights file");
+
+      auto ptr = std::make_unique<ir::MMapedData>(_weights_fd, offset, size);
+      subg.setOperandValue(operand_index, std::move(ptr));
+    }
+
+    return operand_index;
+  }
 
   std::unique_ptr<ir::Graph> loadSubgraph(const circle::SubGraph *circle_subg)
   {
@@ -104,6 +158,11 @@ public:
     return subg;
   }
 
+private:
+  int _weights_fd;
+  uint64_t _weights_size;
+
+public:
   void loadOperation(const circle::Operator *op, ir::Graph &subg)
   {
     const auto builtin_op = _model->operator_codes()->Get(op->opcode_index())->builtin_code();
@@ -122,10 +181,10 @@ public:
 
 } // namespace
 
-std::unique_ptr<ir::Subgraphs> loadModel(const char *filename)
+std::unique_ptr<ir::Subgraphs> loadModel(const char *filename, const char *weights_filename)
 {
   auto subgraphs = std::make_unique<ir::Subgraphs>();
-  CircleLoader loader(subgraphs);
+  CircleLoader loader(subgraphs, weights_filename);
   loader.loadFromFile(filename);
   return subgraphs;
 }
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "circle_loader.h"
+#include "circle_schema_generated.h"
+#include "ir/operation/BatchMatMul.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+// Temporary file that is removed when it goes out of scope
+class TempFile
+{
+public:
+  TempFile(const void *data, size_t size)
+  {
+    char path[] = "/tmp/circle_loader_test_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0)
+      throw std::runtime_error{"Failed to create a temporary file"};
+    const auto written = write(fd, data, size);
+    close(fd);
+    _path = path;
+    if (written != static_cast<ssize_t>(size))
+      throw std::runtime_error{"Failed to write a temporary file"};
+  }
+  ~TempFile() { unlink(_path.c_str()); }
+
+  const char *path() const { return _path.c_str(); }
+
+private:
+  std::string _path;
+};
+
+// ADD of an input and a 4-element constant whose values are in the external weights file
+std::vector<uint8_t> buildAddModel(uint64_t weights_offset, uint64_t weights_size)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+
+  std::vector<flatbuffers::Offset<circle::Buffer>> buffers{
+      circle::CreateBufferDirect(fbb), circle::CreateBufferDirect(fbb),
+      circle::CreateBufferDirect(fbb, nullptr, weights_offset, weights_size)};
+
+  const std::vector<int32_t> shape{1, 4};
+  std::vector<flatbuffers::Offset<circle::Tensor>> tensors{
+      circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 1, "input"),
+      circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 2, "constant"),
+      circle::CreateTensorDirect(fbb, &shape, circle::TensorType_FLOAT32, 0, "output")};
+
+  const std::vector<int32_t> op_inputs{0, 1};
+  const std::vector<int32_t> op_outputs{2};
+  std::vector<flatbuffers::Offset<circle::Operator>> operators{circle::CreateOperatorDirect(
+      fbb, 0, &op_inputs, &op_outputs, circle::BuiltinOptions_AddOptions,
+      circle::CreateAddOptions(fbb).Union())};
+
+  const std::vector<int32_t> inputs{0};
+  const std::vector<int32_t> outputs{2};
+  std::vector<flatbuffers::Offset<circle::SubGraph>> subgraphs{
+      circle::CreateSubGraphDirect(fbb, &tensors, &inputs, &outputs, &operators, "main")};
+
+  std::vector<flatbuffers::Offset<circle::OperatorCode>> operator_codes{
+      circle::CreateOperatorCode(fbb, circle::BuiltinOperator_ADD)};
+
+  auto model =
+      circle::CreateModelDirect(fbb, 0, &operator_codes, &subgraphs, "external weights", &buffers);
+  circle::FinishModelBuffer(fbb, model);
+
+  return std::vector<uint8_t>(fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+}
+
+// BATCH_MATMUL of two inputs, whose options are given only if with_options
+std::vector<uint8_t> buildBatchMatMulModel(bool with_options, bool adj_x, bool adj_y)
+{
+  flatbuffers::FlatBufferBuilder fbb;
+
+  std::vector<flatbuffers::Offset<circle::Buffer>> buffers{circle::CreateBufferDirect(fbb)};
+
+  const std::vector<int32_t> lhs_shape{1, 2, 3};
+  const std::vector<int32_t> rhs_shape{1, 3, 2};
+  const std::vector<int32_t> output_shape{1, 2, 2};
+  std::vector<flatbuffers::Offset<circle::Tensor>> tensors{
+      circle::CreateTensorDirect(fbb, &lhs_shape, circle::TensorType_FLOAT32, 0, "lhs"),
+      circle::CreateTensorDirect(fbb, &rhs_shape, circle::TensorType_FLOAT32, 0, "rhs"),
+      circle::CreateTensorDirect(fbb, &output_shape, circle::TensorType_FLOAT32, 0, "output")};
+
+  const std::vector<int32_t> op_inputs{0, 1};
+  const std::vector<int32_t> op_outputs{2};
+  std::vector<flatbuffers::Offset<circle::Operator>> operators{
+      with_options ? circle::CreateOperatorDirect(
+                         fbb, 0, &op_inputs, &op_outputs, circle::BuiltinOptions_BatchMatMulOptions,
+                         circle::CreateBatchMatMulOptions(fbb, adj_x, adj_y).Union())
+                   : circle::CreateOperatorDirect(fbb, 0, &op_inputs, &op_outputs)};
+
+  const std::vector<int32_t> inputs{0, 1};
+  const std::vector<int32_t> outputs{2};
+  std::vector<flatbuffers::Offset<circle::SubGraph>> subgraphs{
+      circle::CreateSubGraphDirect(fbb, &tensors, &inputs, &outputs, &operators, "main")};
+
+  std::vector<flatbuffers::Offset<circle::OperatorCode>> operator_codes{
+      circle::CreateOperatorCode(fbb, circle::BuiltinOperator_BATCH_MATMUL)};
+
+  auto model = circle::CreateModelDirect(fbb, 0, &operator_codes, &subgraphs, "batch matmul",
+                                         &buffers);
+  circle::FinishModelBuffer(fbb, model);
+
+  return std::vector<uint8_t>(fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+}
+
+const onert::ir::operation::BatchMatMul::Param &batchMatMulParam(const onert::ir::Graph &graph)
+{
+  const auto &op = graph.operations().at(onert::ir::OperationIndex{0});
+  return dynamic_cast<const onert::ir::operation::BatchMatMul &>(op).param();
+}
+
+const std::vector<float> weights{0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+
+} // namespace
+
+TEST(CircleLoader, external_weights)
+{
+  // Take the constant from the middle of the file, so the offset is actually applied
+  const uint64_t offset = 2 * sizeof(float);
+  const uint64_t size = 4 * sizeof(float);
+  const auto model = buildAddModel(offset, size);
+  TempFile model_file{model.data(), model.size()};
+  TempFile weights_file{weights.data(), weights.size() * sizeof(float)};
+
+  auto subgs = onert::circle_loader::loadModel(model_file.path(), weights_file.path());
+
+  const auto &operand = subgs->primary()->operands().at(onert::ir::OperandIndex{1});
+  ASSERT_TRUE(operand.isConstant());
+  ASSERT_EQ(operand.data()->size(), size);
+  const auto *values = reinterpret_cast<const float *>(operand.data()->base());
+  for (uint32_t i = 0; i < 4; ++i)
+    EXPECT_EQ(values[i], weights[i + 2]);
+}
+
+TEST(CircleLoader, neg_external_weights_out_of_range)
+{
+  const uint64_t file_size = weights.size() * sizeof(float);
+  TempFile weights_file{weights.data(), file_size};
+
+  // Ends past the end of the file
+  {
+    const auto model = buildAddModel(file_size - sizeof(float), 4 * sizeof(float));
+    TempFile model_file{model.data(), model.size()};
+    EXPECT_ANY_THROW(onert::circle_loader::loadModel(model_file.path(), weights_file.path()));
+  }
+
+  // Starts past the end of the file
+  {
+    const auto model = buildAddModel(file_size + sizeof(float), 4 * sizeof(float));
+    TempFile model_file{model.data(), model.size()};
+    EXPECT_ANY_THROW(onert::circle_loader::loadModel(model_file.path(), weights_file.path()));
+  }
+
+  // offset + size wraps around
+  {
+    const auto model = buildAddModel(sizeof(float), UINT64_MAX);
+    TempFile model_file{model.data(), model.size()};
+    EXPECT_ANY_THROW(onert::circle_loader::loadModel(model_file.path(), weights_file.path()));
+  }
+}
+
+TEST(CircleLoader, neg_external_weights_without_file)
+{
+  const auto model = buildAddModel(0, 4 * sizeof(float));
+  TempFile model_file{model.data(), model.size()};
+
+  EXPECT_ANY_THROW(onert::circle_loader::loadModel(model_file.path()));
+}
+
+TEST(CircleLoader, batch_matmul_options)
+{
+  const auto model = buildBatchMatMulModel(true, true, false);
+  TempFile model_file{model.data(), model.size()};
+
+  auto subgs = onert::circle_loader::loadModel(model_file.path());
+
+  const auto &param = batchMatMulParam(*subgs->primary());
+  EXPECT_TRUE(param.adj_x);
+  EXPECT_FALSE(param.adj_y);
+}
+
+TEST(CircleLoader, batch_matmul_without_options)
+{
+  const auto model = buildBatchMatMulModel(false, false, false);
+  TempFile model_file{model.data(), model.size()};
+
+  auto subgs = onert::circle_loader::loadModel(model_file.path());
+
+  const auto &param = batchMatMulParam(*subgs->primary());
+  EXPECT_FALSE(param.adj_x);
+  EXPECT_FALSE(param.adj_y);
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/AdaptivePlanner.h"
+#include "exec/ExecTime.h"
+#include "backend/IConfig.h"
+
+namespace
+{
+
+using namespace onert;
+using Plan = compiler::AdaptivePlanner::Plan;
+
+struct MockConfig : public backend::IConfig
+{
+  explicit MockConfig(const std::string &id) : _id{id} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  ir::Layout supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::UNKNOWN; }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+
+private:
+  std::string _id;
+};
+
+struct MockBackend : public backend::Backend
+{
+  explicit MockBackend(const std::string &id) : _id{id} {}
+  std::shared_ptr<backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>(_id);
+  }
+  std::unique_ptr<backend::BackendContext>
+  newContext(const ir::Graph &, const std::shared_ptr<backend::custom::IKernelBuilder> &,
+             bool) const override
+  {
+    return nullptr;
+  }
+
+private:
+  std::string _id;
+};
+
+const MockBackend slow{"adaptive_slow"};
+const MockBackend fast{"adaptive_fast"};
+
+Plan plan(const backend::Backend *backend)
+{
+  Plan plan;
+  plan.entries.push_back({backend, "op", false, 100});
+  return plan;
+}
+
+// Run the current plan times with op measured as given time on a backend
+void run(compiler::AdaptivePlanner &planner, const backend::Backend *backend, int64_t time,
+         uint32_t times)
+{
+  for (uint32_t i = 0; i < times; ++i)
+  {
+    planner.record(backend, "op", false, 100, time);
+    planner.onExecutionEnd();
+  }
+}
+
+} // namespace
+
+TEST(AdaptivePlanner, switch_to_cheaper_plan)
+{
+  compiler::AdaptivePlanner planner{4, 8, 10};
+  planner.execTime({&slow, &fast});
+
+  planner.propose(plan(&slow));
+  ASSERT_TRUE(planner.acceptProposal());
+
+  run(planner, &slow, 1000, 4);
+  // The plan is estimated as 1us before it is measured
+  ASSERT_TRUE(planner.needsReplan());
+
+  // Not measured backend is explored
+  planner.propose(plan(&fast));
+  ASSERT_TRUE(planner.acceptProposal());
+  ASSERT_EQ(planner.replans(), 1);
+
+  run(planner, &fast, 500, 4);
+  ASSERT_TRUE(planner.needsReplan());
+  // The current one is cheaper
+  planner.propose(plan(&slow));
+  ASSERT_FALSE(planner.acceptProposal());
+  ASSERT_EQ(planner.replans(), 2);
+
+  // Drift is measured from the last decision
+  run(planner, &fast, 500, 4);
+  ASSERT_FALSE(planner.needsReplan());
+}
+
+TEST(AdaptivePlanner, keep_plan_without_enough_gain)
+{
+  compiler::AdaptivePlanner planner{1, 8, 10};
+  planner.execTime({&slow, &fast});
+  planner.record(&slow, "op", false, 100, 1000);
+  planner.record(&fast, "op", false, 100, 950);
+
+  planner.propose(plan(&slow));
+  ASSERT_TRUE(planner.acceptProposal());
+
+  planner.propose(plan(&fast));
+  ASSERT_FALSE(planner.acceptProposal());
+}
+
+TEST(AdaptivePlanner, limit_replans)
+{
+  compiler::AdaptivePlanner planner{1, 1, 10};
+  planner.execTime({&slow, &fast});
+
+  planner.propose(plan(&slow));
+  ASSERT_TRUE(planner.acceptProposal());
+  run(planner, &slow, 1000, 1);
+  ASSERT_TRUE(planner.needsReplan());
+  planner.propose(plan(&fast));
+  ASSERT_TRUE(planner.acceptProposal());
+
+  run(planner, &fast, 2000, 1);
+  ASSERT_FALSE(planner.needsReplan());
+}
+
+TEST(AdaptivePlanner, discard_proposal)
+{
+  compiler::AdaptivePlanner planner{1, 8, 10};
+  planner.execTime({&slow, &fast});
+
+  planner.propose(plan(&slow));
+  planner.discardProposal();
+  ASSERT_FALSE(planner.acceptProposal());
+}
+
+TEST(AdaptivePlanner, pause_recording)
+{
+  compiler::AdaptivePlanner planner{1, 8, 10};
+  planner.execTime({&slow, &fast});
+  planner.record(&slow, "op", false, 100, 1000);
+
+  planner.pauseRecording();
+  planner.record(&slow, "op", false, 100, 5000);
+  ASSERT_EQ(planner.estimate(&slow, "op", false, 100), 1000);
+
+  planner.resumeRecording();
+  planner.record(&slow, "op", false, 100, 5000);
+  ASSERT_GT(planner.estimate(&slow, "op", false, 100), 1000);
+}
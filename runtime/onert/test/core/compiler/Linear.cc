@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/Linear.h"
+#include "compiler/Compiler.h"
+#include "ir/Graph.h"
+#include "ir/LoweredGraph.h"
+#include "ir/operation/FullyConnected.h"
+
+#include <list>
+#include <pthread.h>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+/**
+ * @brief Graph of FullyConnected operations, whose operand sizes are given by their shapes
+ */
+class FullyConnectedGraph
+{
+public:
+  FullyConnectedGraph() : graph{std::make_shared<ir::Graph>()} {}
+
+  ir::OperandIndex addInput(const ir::Shape &shape)
+  {
+    auto index = graph->addOperand(shape, ir::TypeInfo{ir::DataType::FLOAT32});
+    graph->addInput(index);
+    return index;
+  }
+
+  ir::OperandIndex addConstant(const ir::Shape &shape)
+  {
+    auto index = graph->addOperand(shape, ir::TypeInfo{ir::DataType::FLOAT32});
+    _data.emplace_back(shape.num_elements(), 0.0f);
+    graph->operands().at(index).data(std::make_unique<ir::ExternalData>(
+        reinterpret_cast<const uint8_t *>(_data.back().data()), _data.back().size() * 4));
+    return index;
+  }
+
+  // Output of [batch, units] for input of [batch, k] and weights of [units, k]
+  ir::OperandIndex addFullyConnected(const ir::OperandIndex &input,
+                                     const ir::OperandIndex &weights, int32_t units)
+  {
+    const auto batch = graph->operands().at(input).shape().dim(0);
+    auto bias = addConstant(ir::Shape{units});
+    auto output = graph->addOperand(ir::Shape{batch, units}, ir::TypeInfo{ir::DataType::FLOAT32});
+    ir::operation::FullyConnected::Param param;
+    param.activation = ir::Activation::NONE;
+    graph->addOperation(std::make_unique<ir::operation::FullyConnected>(
+        ir::OperandIndexSequence{input, weights, bias}, ir::OperandIndexSequence{output}, param));
+    return output;
+  }
+
+  std::unique_ptr<ir::LoweredGraph> lower()
+  {
+    graph->finishBuilding();
+
+    auto subgs = std::make_shared<ir::Subgraphs>();
+    subgs->push(ir::SubgraphIndex{0}, graph);
+    auto options = compiler::fetchCompilerOptionsFromGlobalConfig(*subgs);
+    options.backend_list = {"cpu"};
+    // Each operation has its own OpSequence, so that they are ordered
+    options.op_seq_max_node = 1;
+    return std::make_unique<ir::LoweredGraph>(*graph, options);
+  }
+
+  std::shared_ptr<ir::Graph> graph;
+
+private:
+  std::list<std::vector<float>> _data;
+};
+
+// Index of the operation of each OpSequence in order
+std::vector<uint32_t> operationOrder(const ir::LoweredGraph &lowered_graph,
+                                     const std::vector<ir::OpSequenceIndex> &order)
+{
+  std::vector<uint32_t> operations;
+  for (const auto &index : order)
+  {
+    const auto &op_seq = lowered_graph.op_seqs().at(index);
+    EXPECT_EQ(op_seq.size(), 1);
+    operations.emplace_back(op_seq.operations().at(0).index.value());
+  }
+  return operations;
+}
+
+} // namespace
+
+TEST(Linear, memory_aware_order)
+{
+  // op0: c1 = FC(x1)       4000 bytes
+  // op1: c2 = FC(c1)        404 bytes
+  // op2: a = FC(x2)        4040 bytes
+  // op3: out = FC(c2, a)     40 bytes, whose weights are a
+  //
+  // Finishing c2 before a keeps either of c1 or a alive at a time, while running op2 before op1
+  // keeps both of them alive. So op0, op1, op2 and op3 is the only order of the least peak.
+  FullyConnectedGraph model;
+  auto x1 = model.addInput(ir::Shape{1, 4});
+  auto x2 = model.addInput(ir::Shape{10, 1});
+  auto c1 = model.addFullyConnected(x1, model.addConstant(ir::Shape{1000, 4}), 1000);
+  auto c2 = model.addFullyConnected(c1, model.addConstant(ir::Shape{101, 1000}), 101);
+  auto a = model.addFullyConnected(x2, model.addConstant(ir::Shape{101, 1}), 101);
+  auto out = model.addFullyConnected(c2, a, 10);
+  model.graph->addOutput(out);
+
+  auto lowered_graph = model.lower();
+  const auto order = compiler::Linear::linearize(*lowered_graph, "MemoryAware");
+
+  ASSERT_EQ(operationOrder(*lowered_graph, order), (std::vector<uint32_t>{0, 1, 2, 3}));
+}
+
+TEST(Linear, deep_chain)
+{
+  // Recursive DFS takes a stack frame per OpSequence, which overflows the stack given below
+  constexpr uint32_t depth = 10000;
+  FullyConnectedGraph model;
+  auto weights = model.addConstant(ir::Shape{4, 4});
+  auto operand = model.addInput(ir::Shape{1, 4});
+  for (uint32_t i = 0; i < depth; ++i)
+    operand = model.addFullyConnected(operand, weights, 4);
+  model.graph->addOutput(operand);
+
+  auto lowered_graph = model.lower();
+
+  struct Result
+  {
+    const ir::LoweredGraph *lowered_graph;
+    std::vector<ir::OpSequenceIndex> dfs;
+    std::vector<ir::OpSequenceIndex> memory_aware;
+  } result{lowered_graph.get(), {}, {}};
+  auto linearize = [](void *arg) -> void * {
+    auto result = static_cast<Result *>(arg);
+    result->dfs = compiler::Linear::linearize(*result->lowered_graph, "DFS");
+    result->memory_aware = compiler::Linear::linearize(*result->lowered_graph, "MemoryAware");
+    return nullptr;
+  };
+
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, 256 * 1024);
+  pthread_t thread;
+  ASSERT_EQ(pthread_create(&thread, &attr, linearize, &result), 0);
+  pthread_join(thread, nullptr);
+  pthread_attr_destroy(&attr);
+
+  std::vector<uint32_t> expected(depth);
+  for (uint32_t i = 0; i < depth; ++i)
+    expected[i] = i;
+  ASSERT_EQ(operationOrder(*lowered_graph, result.dfs), expected);
+  ASSERT_EQ(operationOrder(*lowered_graph, result.memory_aware), expected);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/OperationValidator.h"
+#include "ir/Graph.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/Conv2D.h"
+
+namespace
+{
+
+using namespace onert;
+
+const ir::TypeInfo int8_type{ir::DataType::QUANT8_ASYMM_SIGNED, 0.5f, 0};
+
+// Conv2D of int8 whose kernel of [2, 1, 1, 2] is quantized per channel along the given axis
+std::unique_ptr<ir::Graph> buildConv2D(int32_t kernel_axis)
+{
+  auto graph = std::make_unique<ir::Graph>();
+  auto input = graph->addOperand(ir::Shape{1, 1, 1, 2}, int8_type);
+  ir::TypeInfo kernel_type{ir::DataType::QUANT8_SYMM};
+  kernel_type.channel_scales({0.5f, 0.25f}, kernel_axis);
+  auto kernel = graph->addOperand(ir::Shape{2, 1, 1, 2}, kernel_type);
+  auto bias = graph->addOperand(ir::Shape{2}, ir::TypeInfo{ir::DataType::INT32});
+  auto output = graph->addOperand(ir::Shape{1, 1, 1, 2}, int8_type);
+
+  ir::operation::Conv2D::Param param;
+  param.stride = ir::Stride{1, 1};
+  param.padding = ir::Padding{ir::PaddingType::VALID};
+  param.activation = ir::Activation::NONE;
+  graph->addOperation(std::make_unique<ir::operation::Conv2D>(
+      ir::OperandIndexSequence{input, kernel, bias}, ir::OperandIndexSequence{output}, param));
+  return graph;
+}
+
+} // namespace
+
+TEST(OperationValidator, quant8_signed_conv2d)
+{
+  auto graph = buildConv2D(0);
+  ASSERT_NO_THROW(compiler::OperationValidator{*graph}());
+}
+
+TEST(OperationValidator, neg_quant8_signed_channel_axis)
+{
+  // Kernels of Conv2D have scales along output channels at axis 0
+  auto graph = buildConv2D(3);
+  ASSERT_THROW(compiler::OperationValidator{*graph}(), std::runtime_error);
+}
+
+TEST(OperationValidator, neg_quant8_signed_add)
+{
+  ir::Graph graph;
+  auto lhs = graph.addOperand(ir::Shape{1, 4}, int8_type);
+  auto rhs = graph.addOperand(ir::Shape{1, 4}, int8_type);
+  auto output = graph.addOperand(ir::Shape{1, 4}, int8_type);
+  graph.addOperation(std::make_unique<ir::operation::Add>(
+      ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{output},
+      ir::operation::Add::Param{ir::Activation::NONE}));
+
+  ASSERT_THROW(compiler::OperationValidator{graph}(), std::runtime_error);
+}
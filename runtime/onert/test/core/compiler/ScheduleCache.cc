@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "compiler/ScheduleCache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <utime.h>
+
+namespace
+{
+
+using namespace onert;
+using Schedule = compiler::ScheduleCache::Schedule;
+
+const std::string cache_path = "schedule_cache_test.cache";
+
+Schedule makeSchedule(bool ranked)
+{
+  Schedule schedule;
+  schedule.backends[ir::OperationIndex{0}] = "cpu";
+  schedule.backends[ir::OperationIndex{1}] = "acl_cl";
+  if (ranked)
+  {
+    schedule.ranks = std::make_shared<ir::OperationIndexMap<int64_t>>();
+    schedule.ranks->emplace(ir::OperationIndex{0}, 20);
+    schedule.ranks->emplace(ir::OperationIndex{1}, 10);
+  }
+  return schedule;
+}
+
+} // namespace
+
+TEST(ScheduleCache, save_and_load)
+{
+  {
+    compiler::ScheduleCache cache{cache_path, "model"};
+    cache.load("options");
+    ASSERT_EQ(cache.find(ir::SubgraphIndex{0}), nullptr);
+    cache.insert(ir::SubgraphIndex{0}, makeSchedule(false));
+    cache.insert(ir::SubgraphIndex{1}, makeSchedule(true));
+    cache.save();
+  }
+
+  compiler::ScheduleCache cache{cache_path, "model"};
+  cache.load("options");
+  const auto manual = cache.find(ir::SubgraphIndex{0});
+  ASSERT_NE(manual, nullptr);
+  ASSERT_EQ(manual->backends, makeSchedule(false).backends);
+  ASSERT_EQ(manual->ranks, nullptr);
+  const auto ranked = cache.find(ir::SubgraphIndex{1});
+  ASSERT_NE(ranked, nullptr);
+  ASSERT_EQ(ranked->backends, makeSchedule(true).backends);
+  ASSERT_NE(ranked->ranks, nullptr);
+  ASSERT_EQ(*ranked->ranks, *makeSchedule(true).ranks);
+
+  EXPECT_EQ(remove(cache_path.c_str()), 0);
+}
+
+TEST(ScheduleCache, ignore_other_key)
+{
+  {
+    compiler::ScheduleCache cache{cache_path, "model"};
+    cache.load("options");
+    cache.insert(ir::SubgraphIndex{0}, makeSchedule(false));
+    cache.save();
+  }
+
+  compiler::ScheduleCache other_model{cache_path, "other_model"};
+  other_model.load("options");
+  ASSERT_EQ(other_model.find(ir::SubgraphIndex{0}), nullptr);
+
+  compiler::ScheduleCache other_options{cache_path, "model"};
+  other_options.load("other_options");
+  ASSERT_EQ(other_options.find(ir::SubgraphIndex{0}), nullptr);
+
+  EXPECT_EQ(remove(cache_path.c_str()), 0);
+}
+
+TEST(ScheduleCache, neg_ignore_broken_file)
+{
+  {
+    compiler::ScheduleCache cache{cache_path, "model"};
+    cache.load("options");
+    cache.insert(ir::SubgraphIndex{0}, makeSchedule(true));
+    cache.save();
+  }
+  {
+    std::ofstream stream(cache_path, std::ios::app);
+    stream << "1 2 0\n0 cpu";
+  }
+
+  compiler::ScheduleCache cache{cache_path, "model"};
+  cache.load("options");
+  ASSERT_EQ(cache.find(ir::SubgraphIndex{0}), nullptr);
+  ASSERT_EQ(cache.find(ir::SubgraphIndex{1}), nullptr);
+
+  EXPECT_EQ(remove(cache_path.c_str()), 0);
+}
+
+TEST(ScheduleCache, stamp_file)
+{
+  {
+    std::ofstream stream(cache_path);
+    stream << "model";
+  }
+  struct utimbuf times = {1000, 1000};
+  ASSERT_EQ(utime(cache_path.c_str(), &times), 0);
+  const auto stamp = compiler::ScheduleCache::stampFile(cache_path);
+  ASSERT_EQ(stamp, compiler::ScheduleCache::stampFile(cache_path));
+
+  // Modified time differs
+  times.modtime = 2000;
+  ASSERT_EQ(utime(cache_path.c_str(), &times), 0);
+  ASSERT_NE(stamp, compiler::ScheduleCache::stampFile(cache_path));
+
+  // Size differs
+  {
+    std::ofstream stream(cache_path);
+    stream << "models";
+  }
+  times.modtime = 1000;
+  ASSERT_EQ(utime(cache_path.c_str(), &times), 0);
+  ASSERT_NE(stamp, compiler::ScheduleCache::stampFile(cache_path));
+
+  EXPECT_EQ(remove(cache_path.c_str()), 0);
+  EXPECT_ANY_THROW(compiler::ScheduleCache::stampFile(cache_path));
+}
@@ -307,4 +307,95 @@ TEST(ExecInstance, async)
   delete execution;
 }
 
+class CompiledDiamondModel
+{
+public:
+  CompiledDiamondModel(const std::string &executor)
+  {
+    // Model: two branches of elementwise add operations joined by the last add
+    // model input: lhs
+    // model output: result
+    // constant: rhs1, rhs2
+    // branch1 <= (lhs + rhs1) + rhs1
+    // branch2 <= (lhs + rhs2) + rhs2
+    // result <= branch1 + branch2
+    // all shape: {1, 2, 2, 1}
+    // activation: none (constant)
+    graph = std::make_shared<Graph>();
+    Shape shape{1, 2, 2, 1};
+    TypeInfo type{DataType::FLOAT32};
+    static float rhs1_data[4] = {3, 1, -1, 5};
+    static float rhs2_data[4] = {-2, 4, 0, 1};
+    auto operand_lhs = graph->addOperand(shape, type);
+    auto operand_rhs1 = graph->addOperand(shape, type);
+    auto operand_rhs2 = graph->addOperand(shape, type);
+    graph->operands()
+        .at(operand_rhs1)
+        .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&rhs1_data), 16));
+    graph->operands()
+        .at(operand_rhs2)
+        .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&rhs2_data), 16));
+
+    operation::Add::Param param;
+    param.activation = Activation::NONE;
+    auto add = [&](const OperandIndex &lhs, const OperandIndex &rhs) {
+      auto result = graph->addOperand(shape, type);
+      graph->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{lhs, rhs},
+                                                           OperandIndexSequence{result}, param));
+      return result;
+    };
+    auto branch1 = add(add(operand_lhs, operand_rhs1), operand_rhs1);
+    auto branch2 = add(add(operand_lhs, operand_rhs2), operand_rhs2);
+    auto operand_result = add(branch1, branch2);
+
+    graph->addInput(operand_lhs);
+    graph->addOutput(operand_result);
+    graph->finishBuilding();
+
+    // Compile
+    auto subgs = std::make_shared<onert::ir::Subgraphs>();
+    subgs->push(onert::ir::SubgraphIndex{0}, graph);
+    auto compiler = new onert::compiler::Compiler{subgs};
+    compiler->options().executor = executor;
+    compiler->compile();
+    compiler->release(executors);
+    delete compiler;
+  }
+
+public:
+  std::shared_ptr<Graph> graph;
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+};
+
+// Tensors of concurrent branches must not share memory on Dataflow and Parallel executors
+TEST(ExecInstance, diamond_executors)
+{
+  for (const std::string executor : {"Linear", "Dataflow", "Parallel"})
+  {
+    auto mockup = CompiledDiamondModel(executor);
+    auto executors = mockup.executors;
+
+    const float input_buffer[4] = {1, 0, -1, -2};
+    float output_buffer[4] = {};
+    const float output_expected[4] = {4, 10, -4, 8};
+
+    auto execution = new onert::exec::Execution(executors);
+
+    // Run twice to check that memory planned for the first run is valid for the next one
+    for (int run = 0; run < 2; ++run)
+    {
+      execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(input_buffer), 16);
+      execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+      execution->execute();
+
+      for (auto i = 0; i < 4; i++)
+      {
+        EXPECT_EQ(output_buffer[i], output_expected[i]) << executor;
+      }
+    }
+
+    delete execution;
+  }
+}
+
 } // namespace
@@ -99,4 +99,19 @@ TEST(ExecTime, structure)
   // clean up
   EXPECT_EQ(remove("exec_time.json"), 0);
 }
+
+TEST(ExecTime, blend)
+{
+  const auto *b = new MockBackend();
+  std::vector<const Backend *> bs = {b};
+  ExecTime et(bs);
+  et.blendOperationExecTime(b, "op1", false, 100, 100, 0.25f);
+  ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 100), 100);
+  et.blendOperationExecTime(b, "op1", false, 100, 200, 0.25f);
+  ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 100), 125);
+  // Unsupported one is kept
+  et.updateOperationExecTime(b, "op2", false, 100, ExecTime::getMax());
+  et.blendOperationExecTime(b, "op2", false, 100, 200, 0.25f);
+  ASSERT_EQ(et.getOperationExecTime(b, "op2", false, 100), ExecTime::getMax());
+}
 } // unnamed namespace
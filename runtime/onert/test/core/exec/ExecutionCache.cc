@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "exec/ExecutionCache.h"
+
+namespace
+{
+
+using namespace onert;
+using Signature = exec::ExecutionCache::Signature;
+
+Signature signature(int32_t seq_len) { return Signature{{ir::IOIndex{0}, ir::Shape{1, seq_len}}}; }
+
+} // namespace
+
+TEST(ExecutionCache, hit_and_miss)
+{
+  exec::ExecutionCache cache{2, 0};
+
+  cache.insert(signature(32), nullptr, 100);
+  cache.find(signature(32));
+  cache.find(signature(64));
+
+  ASSERT_EQ(cache.stats().hits, 1);
+  ASSERT_EQ(cache.stats().misses, 1);
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(cache.memory(), 100);
+}
+
+TEST(ExecutionCache, evict_least_recently_used)
+{
+  exec::ExecutionCache cache{2, 0};
+
+  cache.insert(signature(32), nullptr, 100);
+  cache.insert(signature(64), nullptr, 200);
+  // 32 becomes the most recently used one, so 64 is evicted
+  cache.find(signature(32));
+  cache.insert(signature(128), nullptr, 400);
+
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_EQ(cache.memory(), 500);
+  ASSERT_EQ(cache.stats().evictions, 1);
+
+  cache.find(signature(64));
+  ASSERT_EQ(cache.stats().misses, 1);
+}
+
+TEST(ExecutionCache, evict_by_memory)
+{
+  exec::ExecutionCache cache{4, 500};
+
+  cache.insert(signature(32), nullptr, 100);
+  cache.insert(signature(64), nullptr, 200);
+  cache.insert(signature(128), nullptr, 400);
+
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(cache.memory(), 400);
+  ASSERT_EQ(cache.stats().evictions, 2);
+
+  // The most recently used one is kept even if it exceeds the limit
+  cache.insert(signature(256), nullptr, 800);
+
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(cache.memory(), 800);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "exec/OpStats.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/FullyConnected.h"
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::ir;
+
+TEST(OpStats, entry)
+{
+  exec::OpStats stats;
+
+  auto &e1 = stats.entry("Conv2D", "cpu", 0, 3);
+  auto &e2 = stats.entry("Conv2D", "acl_cl", 0, 3);
+  auto &e3 = stats.entry("Conv2D", "cpu", 0, 3);
+  ASSERT_EQ(stats.size(), 2);
+  ASSERT_EQ(&e1, &e3);
+  ASSERT_NE(&e1, &e2);
+
+  e1.count += 2;
+  e1.time_ns += 100;
+  ASSERT_EQ(stats.at(0).count, 2);
+  ASSERT_EQ(stats.at(0).time_ns, 100);
+
+  stats.reset();
+  ASSERT_EQ(stats.size(), 2);
+  ASSERT_EQ(stats.at(0).count, 0);
+  ASSERT_EQ(stats.at(0).time_ns, 0);
+}
+
+TEST(OpStats, estimateFlops)
+{
+  Graph graph;
+  TypeInfo type{DataType::FLOAT32};
+
+  // FullyConnected: [2, 8] x [4, 8]^T
+  auto input = graph.addOperand(Shape{2, 8}, type);
+  auto weight = graph.addOperand(Shape{4, 8}, type);
+  auto bias = graph.addOperand(Shape{4}, type);
+  auto fc_output = graph.addOperand(Shape{2, 4}, type);
+  operation::FullyConnected::Param fc_param;
+  fc_param.activation = Activation::NONE;
+  auto fc_index = graph.addOperation(std::make_unique<operation::FullyConnected>(
+      OperandIndexSequence{input, weight, bias}, OperandIndexSequence{fc_output}, fc_param));
+
+  // Add: one operation per output element
+  auto rhs = graph.addOperand(Shape{2, 4}, type);
+  auto add_output = graph.addOperand(Shape{2, 4}, type);
+  operation::Add::Param add_param;
+  add_param.activation = Activation::NONE;
+  auto add_index = graph.addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{fc_output, rhs}, OperandIndexSequence{add_output}, add_param));
+
+  ASSERT_EQ(exec::OpStats::estimateFlops(graph, graph.operations().at(fc_index)), 2 * 2 * 4 * 8);
+  ASSERT_EQ(exec::OpStats::estimateFlops(graph, graph.operations().at(add_index)), 2 * 4);
+}
+
+TEST(OpStats, neg_estimateFlops_unknown_dim)
+{
+  Graph graph;
+  TypeInfo type{DataType::FLOAT32};
+
+  auto lhs = graph.addOperand(Shape{-1, 4}, type);
+  auto rhs = graph.addOperand(Shape{1, 4}, type);
+  auto output = graph.addOperand(Shape{-1, 4}, type);
+  operation::Add::Param param;
+  param.activation = Activation::NONE;
+  auto index = graph.addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{lhs, rhs}, OperandIndexSequence{output}, param));
+
+  ASSERT_EQ(exec::OpStats::estimateFlops(graph, graph.operations().at(index)), 0);
+}
+
+} // namespace
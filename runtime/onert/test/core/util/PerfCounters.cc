@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/PerfCounters.h"
+
+namespace
+{
+
+using namespace onert::util;
+
+TEST(PerfCounters, read)
+{
+  auto &counters = PerfCounters::thisThread();
+  PerfCounters::Values begin{}, end{};
+
+  // Counters may not be available, e.g. in containers
+  if (!counters.available())
+  {
+    ASSERT_FALSE(counters.read(begin));
+    return;
+  }
+
+  ASSERT_TRUE(counters.read(begin));
+  volatile uint64_t sum = 0;
+  for (uint64_t i = 0; i < 100000; ++i)
+    sum += i;
+  ASSERT_TRUE(counters.read(end));
+  for (uint32_t i = 0; i < PerfCounters::COUNT; ++i)
+    ASSERT_TRUE(end[i] >= begin[i]);
+}
+
+} // namespace
@@ -16,7 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include "ir/Graph.h"
 #include "ir/Layout.h"
+#include "ir/operation/Pad.h"
 #include "util/ShapeInference.h"
 
 using namespace onert::ir;
@@ -279,3 +281,180 @@ TEST(ShapeInference, FullyConnected)
   ASSERT_EQ(infered_out_shape.dim(0), 36);
   ASSERT_EQ(infered_out_shape.dim(1), 3);
 }
+
+TEST(ShapeInference, Transpose)
+{
+  Shape in_shape{2, 3, 4};
+
+  auto infered_out_shape = onert::shape_inference::inferTransposeShape(in_shape, {2, 0, 1});
+
+  ASSERT_EQ(infered_out_shape.rank(), 3);
+  ASSERT_EQ(infered_out_shape.dim(0), 4);
+  ASSERT_EQ(infered_out_shape.dim(1), 2);
+  ASSERT_EQ(infered_out_shape.dim(2), 3);
+}
+
+TEST(ShapeInference, neg_Transpose)
+{
+  Shape in_shape{2, 3, 4};
+
+  ASSERT_THROW(onert::shape_inference::inferTransposeShape(in_shape, {0, 0, 1}),
+               std::runtime_error);
+}
+
+TEST(ShapeInference, Reduce)
+{
+  Shape in_shape{2, 3, 4};
+
+  auto infered_out_shape = onert::shape_inference::inferReduceShape(in_shape, {-1, 0}, false);
+
+  ASSERT_EQ(infered_out_shape.rank(), 1);
+  ASSERT_EQ(infered_out_shape.dim(0), 3);
+
+  infered_out_shape = onert::shape_inference::inferReduceShape(in_shape, {1}, true);
+
+  ASSERT_EQ(infered_out_shape.rank(), 3);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 1);
+  ASSERT_EQ(infered_out_shape.dim(2), 4);
+}
+
+TEST(ShapeInference, Pad)
+{
+  Shape in_shape{1, 3, 3, 2};
+  const int32_t pad[] = {0, 0, 1, 2, 2, 1, 0, 0};
+
+  auto infered_out_shape = onert::shape_inference::inferPadShape(in_shape, pad);
+
+  ASSERT_EQ(infered_out_shape.rank(), 4);
+  ASSERT_EQ(infered_out_shape.dim(0), 1);
+  ASSERT_EQ(infered_out_shape.dim(1), 6);
+  ASSERT_EQ(infered_out_shape.dim(2), 6);
+  ASSERT_EQ(infered_out_shape.dim(3), 2);
+}
+
+TEST(ShapeInference, Reshape)
+{
+  const int32_t shape[] = {4, -1};
+
+  auto infered_out_shape = onert::shape_inference::inferReshapeShape(shape, 2, 24);
+
+  ASSERT_EQ(infered_out_shape.rank(), 2);
+  ASSERT_EQ(infered_out_shape.dim(0), 4);
+  ASSERT_EQ(infered_out_shape.dim(1), 6);
+}
+
+TEST(ShapeInference, neg_Reshape)
+{
+  const int32_t shape[] = {5, -1};
+
+  ASSERT_THROW(onert::shape_inference::inferReshapeShape(shape, 2, 24), std::runtime_error);
+}
+
+TEST(ShapeInference, Squeeze)
+{
+  Shape in_shape{1, 3, 1, 2};
+
+  operation::Squeeze::Param param{};
+  param.ndim = 0;
+  auto infered_out_shape = onert::shape_inference::inferSqueezeShape(in_shape, param);
+
+  ASSERT_EQ(infered_out_shape.rank(), 2);
+  ASSERT_EQ(infered_out_shape.dim(0), 3);
+  ASSERT_EQ(infered_out_shape.dim(1), 2);
+
+  param.ndim = 1;
+  param.dims[0] = -2;
+  infered_out_shape = onert::shape_inference::inferSqueezeShape(in_shape, param);
+
+  ASSERT_EQ(infered_out_shape.rank(), 3);
+  ASSERT_EQ(infered_out_shape.dim(0), 1);
+  ASSERT_EQ(infered_out_shape.dim(1), 3);
+  ASSERT_EQ(infered_out_shape.dim(2), 2);
+}
+
+TEST(ShapeInference, StridedSlice)
+{
+  Shape in_shape{4, 6};
+  const int32_t starts[] = {1, -1};
+  const int32_t ends[] = {3, 0};
+  const int32_t strides[] = {1, -2};
+
+  operation::StridedSlice::Param param{};
+  auto infered_out_shape =
+      onert::shape_inference::inferStridedSliceShape(in_shape, starts, ends, strides, param);
+
+  ASSERT_EQ(infered_out_shape.rank(), 2);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 3);
+
+  // Shrink the first axis
+  param.shrink_axis_mask = 1;
+  infered_out_shape =
+      onert::shape_inference::inferStridedSliceShape(in_shape, starts, ends, strides, param);
+
+  ASSERT_EQ(infered_out_shape.rank(), 1);
+  ASSERT_EQ(infered_out_shape.dim(0), 3);
+}
+
+TEST(ShapeInference, BatchMatMul)
+{
+  Shape lhs_shape{2, 1, 3, 4};
+  Shape rhs_shape{5, 4, 6};
+
+  operation::BatchMatMul::Param param{false, false};
+  auto infered_out_shape =
+      onert::shape_inference::inferBatchMatMulShape(lhs_shape, rhs_shape, param);
+
+  ASSERT_EQ(infered_out_shape.rank(), 4);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 5);
+  ASSERT_EQ(infered_out_shape.dim(2), 3);
+  ASSERT_EQ(infered_out_shape.dim(3), 6);
+
+  // Transposed operands
+  Shape lhs_t_shape{2, 1, 4, 3};
+  Shape rhs_t_shape{5, 6, 4};
+  param = {true, true};
+  infered_out_shape =
+      onert::shape_inference::inferBatchMatMulShape(lhs_t_shape, rhs_t_shape, param);
+
+  ASSERT_EQ(infered_out_shape.rank(), 4);
+  ASSERT_EQ(infered_out_shape.dim(2), 3);
+  ASSERT_EQ(infered_out_shape.dim(3), 6);
+}
+
+TEST(ShapeInference, neg_BatchMatMul)
+{
+  operation::BatchMatMul::Param param{false, false};
+
+  // Inner dimensions do not match
+  ASSERT_THROW(onert::shape_inference::inferBatchMatMulShape(Shape{3, 4}, Shape{5, 6}, param),
+               std::runtime_error);
+  // Batch dimensions are not broadcastable
+  ASSERT_THROW(
+      onert::shape_inference::inferBatchMatMulShape(Shape{2, 3, 4}, Shape{3, 4, 6}, param),
+      std::runtime_error);
+}
+
+TEST(ShapeInference, StaticInferer_ValueDependentOutput)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2}, TypeInfo{DataType::FLOAT32});
+  // Paddings are not constant, so the output shape is taken from the model
+  auto pad = graph.addOperand(Shape{2, 2}, TypeInfo{DataType::INT32});
+  auto output = graph.addOperand(Shape{3, 4}, TypeInfo{DataType::FLOAT32});
+  auto op_index = graph.addOperation(std::make_unique<operation::Pad>(
+      OperandIndexSequence{input, pad}, OperandIndexSequence{output}, operation::Pad::Param{2}));
+  const auto &op = graph.operations().at(op_index);
+
+  onert::shape_inference::StaticInferer inferer(graph.operands());
+  inferer.infer(op);
+  ASSERT_FALSE(graph.operands().at(output).info().isDynamic());
+  ASSERT_EQ(graph.operands().at(output).shape(), (Shape{3, 4}));
+
+  // The declared output shape does not hold for a resized input
+  graph.operands().at(input).info().shape(Shape{2, 2});
+  inferer.infer(op);
+  ASSERT_TRUE(graph.operands().at(output).info().isDynamic());
+}
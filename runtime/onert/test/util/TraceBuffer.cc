@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/TraceBuffer.h"
+
+#include <thread>
+#include <vector>
+
+using namespace onert::util;
+
+namespace
+{
+
+TraceEvent event(uint32_t op_seq)
+{
+  return TraceEvent{TraceBuffer::now(), op_seq, 1, 1, TraceEvent::Phase::BEGIN};
+}
+
+} // namespace
+
+TEST(TraceBuffer, drain_in_order)
+{
+  TraceBuffer buffer{8};
+
+  for (uint32_t i = 0; i < 5; ++i)
+    buffer.record(event(i));
+
+  std::vector<uint32_t> op_seqs;
+  auto dropped = buffer.drain(
+      [&](uint32_t, const TraceEvent &event) { op_seqs.emplace_back(event.op_seq); });
+
+  ASSERT_EQ(dropped, 0);
+  ASSERT_EQ(op_seqs, (std::vector<uint32_t>{0, 1, 2, 3, 4}));
+
+  // Drained events are forgotten
+  op_seqs.clear();
+  buffer.drain([&](uint32_t, const TraceEvent &event) { op_seqs.emplace_back(event.op_seq); });
+  ASSERT_TRUE(op_seqs.empty());
+}
+
+TEST(TraceBuffer, overwrite_oldest)
+{
+  // Capacity is rounded up to 4
+  TraceBuffer buffer{3};
+
+  for (uint32_t i = 0; i < 10; ++i)
+    buffer.record(event(i));
+
+  std::vector<uint32_t> op_seqs;
+  auto dropped = buffer.drain(
+      [&](uint32_t, const TraceEvent &event) { op_seqs.emplace_back(event.op_seq); });
+
+  ASSERT_EQ(dropped, 6);
+  ASSERT_EQ(op_seqs, (std::vector<uint32_t>{6, 7, 8, 9}));
+}
+
+TEST(TraceBuffer, drop_in_pairs)
+{
+  TraceBuffer buffer{4};
+
+  // An execution of two op sequences, whose first 2 events are overwritten
+  auto record = [&](uint32_t op_seq, TraceEvent::Phase phase) {
+    buffer.record(TraceEvent{TraceBuffer::now(), op_seq, 1, 1, phase});
+  };
+  record(100, TraceEvent::Phase::BEGIN);
+  record(0, TraceEvent::Phase::BEGIN);
+  record(0, TraceEvent::Phase::END);
+  record(1, TraceEvent::Phase::BEGIN);
+  record(1, TraceEvent::Phase::END);
+  record(100, TraceEvent::Phase::END);
+
+  std::vector<uint32_t> op_seqs;
+  std::vector<TraceEvent::Phase> phases;
+  auto dropped = buffer.drain([&](uint32_t, const TraceEvent &event) {
+    op_seqs.emplace_back(event.op_seq);
+    phases.emplace_back(event.phase);
+  });
+
+  // END events of the overwritten BEGIN events are dropped with them
+  ASSERT_EQ(dropped, 4);
+  ASSERT_EQ(op_seqs, (std::vector<uint32_t>{1, 1}));
+  ASSERT_EQ(phases,
+            (std::vector<TraceEvent::Phase>{TraceEvent::Phase::BEGIN, TraceEvent::Phase::END}));
+}
+
+TEST(TraceBuffer, ring_per_thread)
+{
+  TraceBuffer buffer{1024};
+  TraceBuffer other{1024};
+
+  auto fn = [&](uint32_t base) {
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+      buffer.record(event(base + i));
+      // Switching buffers must not mix rings
+      other.record(event(base + i));
+    }
+  };
+  std::thread t0{fn, 0};
+  std::thread t1{fn, 1000};
+  t0.join();
+  t1.join();
+
+  std::vector<std::vector<uint32_t>> per_thread(2);
+  buffer.drain([&](uint32_t thread_index, const TraceEvent &event) {
+    ASSERT_LT(thread_index, 2);
+    per_thread[thread_index].emplace_back(event.op_seq);
+  });
+
+  for (const auto &op_seqs : per_thread)
+  {
+    ASSERT_EQ(op_seqs.size(), 100);
+    for (uint32_t i = 1; i < op_seqs.size(); ++i)
+      ASSERT_EQ(op_seqs[i], op_seqs[i - 1] + 1);
+  }
+}
@@ -16,6 +16,7 @@
 
 #include "args.h"
 
+#include <cmath>
 #include <iostream>
 
 namespace nnpkg_run
@@ -51,7 +52,28 @@ void Args::Initialize(void)
     ;
   // clang-format on
 
+  // Load options
+  po::options_description load("Load options", 100);
+
+  // clang-format off
+  load.add_options()
+    ("load_sessions", po::value<int>()->default_value(0),
+         "The number of concurrent sessions, each of them runs on its own thread.\n"
+         "Runs in load mode for load_duration if it is greater than 0.")
+    ("load_nnpackages",
+         po::value<std::vector<std::string>>()->multitoken()->default_value({}, ""),
+         "nnpackages co-located with the given one. Sessions are assigned to them in turn.")
+    ("load_qps", po::value<double>()->default_value(0.0),
+         "Arrival rate of requests per model for open-loop load.\n"
+         "Each session runs requests back to back (closed-loop) if it is 0.")
+    ("load_duration", po::value<double>()->default_value(10.0), "Duration of load in seconds")
+    ("load_report", po::value<std::string>()->default_value(""),
+         "Write load report to {load_report}.csv and {load_report}.json")
+    ;
+  // clang-format on
+
   _options.add(general);
+  _options.add(load);
   _positional.add("nnpackage", 1);
 }
 
@@ -144,6 +166,47 @@ void Args::Parse(const int argc, char **argv)
   {
     _write_report = vm["write_report"].as<bool>();
   }
+
+  if (vm.count("load_sessions"))
+  {
+    _load_sessions = vm["load_sessions"].as<int>();
+  }
+
+  if (vm.count("load_nnpackages"))
+  {
+    _load_nnpackages = vm["load_nnpackages"].as<std::vector<std::string>>();
+  }
+
+  if (vm.count("load_qps"))
+  {
+    _load_qps = vm["load_qps"].as<double>();
+  }
+
+  if (vm.count("load_duration"))
+  {
+    _load_duration = vm["load_duration"].as<double>();
+  }
+
+  if (vm.count("load_report"))
+  {
+    _load_report = vm["load_report"].as<std::string>();
+  }
+
+  if (_load_sessions > 0)
+  {
+    // Open-loop load divides by qps, and load of no duration measures nothing
+    if (!(_load_qps >= 0.0) || std::isinf(_load_qps))
+    {
+      std::cerr << "load_qps must be a finite number of 0 or greater: " << _load_qps << "\n";
+      exit(1);
+    }
+    if (!(_load_duration > 0.0) || std::isinf(_load_duration))
+    {
+      std::cerr << "load_duration must be a finite number greater than 0: " << _load_duration
+                << "\n";
+      exit(1);
+    }
+  }
 }
 
 } // end of namespace nnpkg_run
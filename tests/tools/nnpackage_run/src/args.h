@@ -18,6 +18,7 @@
 #define __NNPACKAGE_RUN_ARGS_H__
 
 #include <string>
+#include <vector>
 #include <boost/program_options.hpp>
 
 namespace po = boost::program_options;
@@ -40,6 +41,11 @@ public:
   const bool getMemoryPoll(void) const { return _mem_poll; }
   const bool getWriteReport(void) const { return _write_report; }
   const bool printVersion(void) const { return _print_version; }
+  const int getLoadSessions(void) const { return _load_sessions; }
+  const std::vector<std::string> &getLoadNnpackages(void) const { return _load_nnpackages; }
+  const double getLoadQps(void) const { return _load_qps; }
+  const double getLoadDuration(void) const { return _load_duration; }
+  const std::string &getLoadReport(void) const { return _load_report; }
 
 private:
   void Initialize();
@@ -58,6 +64,11 @@ private:
   bool _mem_poll;
   bool _write_report;
   bool _print_version = false;
+  int _load_sessions;
+  std::vector<std::string> _load_nnpackages;
+  double _load_qps;
+  double _load_duration;
+  std::string _load_report;
 };
 
 } // end of namespace nnpkg_run
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loadgen.h"
+#include "benchmark.h"
+#include "nnfw_debug.h"
+#include "nnfw_util.h"
+#include "randomgen.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+
+// Sessions start at the same time after all threads are launched
+constexpr std::chrono::milliseconds kStartDelay{10};
+
+double toMillis(uint64_t micros) { return micros / 1e3; }
+
+} // namespace
+
+namespace nnpkg_run
+{
+
+LoadGenerator::LoadGenerator(const Args &args, const Configurator &configure)
+    : _args(args), _configure(configure)
+{
+  _nnpackages.emplace_back(args.getPackageFilename());
+  for (const auto &nnpackage : args.getLoadNnpackages())
+    _nnpackages.emplace_back(nnpackage);
+
+  _arrivals.reset(new std::atomic<uint64_t>[_nnpackages.size()]);
+  for (uint32_t i = 0; i < _nnpackages.size(); ++i)
+    _arrivals[i] = 0;
+}
+
+LoadGenerator::~LoadGenerator()
+{
+  for (auto &session : _sessions)
+  {
+    if (session->session)
+      nnfw_close_session(session->session);
+  }
+}
+
+void LoadGenerator::prepareSession(Session &session, const std::string &nnpackage)
+{
+  NNPR_ENSURE_STATUS(nnfw_create_debug_session(&session.session));
+  _configure(session.session);
+  NNPR_ENSURE_STATUS(nnfw_load_model_from_file(session.session, nnpackage.c_str()));
+  NNPR_ENSURE_STATUS(nnfw_prepare(session.session));
+
+  uint32_t num_inputs = 0;
+  NNPR_ENSURE_STATUS(nnfw_input_size(session.session, &num_inputs));
+  session.inputs = std::vector<Allocation>(num_inputs);
+  generateRandomInputs(session.session, session.inputs);
+
+  uint32_t num_outputs = 0;
+  NNPR_ENSURE_STATUS(nnfw_output_size(session.session, &num_outputs));
+  session.outputs = std::vector<Allocation>(num_outputs);
+  for (uint32_t i = 0; i < num_outputs; i++)
+  {
+    nnfw_tensorinfo ti;
+    NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session.session, i, &ti));
+    auto output_size_in_bytes = bufsize_for(&ti);
+    session.outputs[i].alloc(output_size_in_bytes);
+    NNPR_ENSURE_STATUS(nnfw_set_output(session.session, i, ti.dtype, session.outputs[i].data(),
+                                       output_size_in_bytes));
+    NNPR_ENSURE_STATUS(nnfw_set_output_layout(session.session, i, NNFW_LAYOUT_CHANNELS_LAST));
+  }
+}
+
+void LoadGenerator::runClosedLoop(Session &session, Clock::time_point start, Clock::time_point end)
+{
+  std::this_thread::sleep_until(start);
+  while (true)
+  {
+    const auto begin = Clock::now();
+    if (begin >= end)
+      break;
+
+    const auto status = nnfw_run(session.session);
+    const auto done = Clock::now();
+    if (status != NNFW_STATUS_NO_ERROR)
+    {
+      session.errors += 1;
+      continue;
+    }
+    session.latency.record(
+        std::chrono::duration_cast<std::chrono::microseconds>(done - begin).count());
+  }
+}
+
+void LoadGenerator::runOpenLoop(Session &session, Clock::time_point start, Clock::time_point end)
+{
+  const std::chrono::duration<double, std::nano> interval{1e9 / _args.getLoadQps()};
+  auto &arrivals = _arrivals[session.model];
+  while (true)
+  {
+    // Take the earliest arrival not served yet. If all sessions of the model are busy, arrivals
+    // are delayed, and the delay is counted to their latency.
+    const auto arrival =
+        start + std::chrono::duration_cast<Clock::duration>(interval * arrivals.fetch_add(1));
+    if (arrival >= end)
+      break;
+    std::this_thread::sleep_until(arrival);
+
+    const auto status = nnfw_run(session.session);
+    const auto done = Clock::now();
+    if (status != NNFW_STATUS_NO_ERROR)
+    {
+      session.errors += 1;
+      continue;
+    }
+    session.latency.record(
+        std::chrono::duration_cast<std::chrono::microseconds>(done - arrival).count());
+  }
+}
+
+int LoadGenerator::run()
+{
+  std::unique_ptr<benchmark::MemoryPoller> mp{nullptr};
+  if (_args.getMemoryPoll())
+  {
+    try
+    {
+      mp.reset(new benchmark::MemoryPoller(std::chrono::milliseconds(5), _args.getGpuMemoryPoll()));
+    }
+    catch (const std::runtime_error &error)
+    {
+      std::cerr << error.what() << std::endl;
+      return 1;
+    }
+  }
+
+  // Sessions are prepared one by one, since preparation reads the global config
+  if (mp)
+    mp->start(benchmark::Phase::PREPARE);
+  for (int i = 0; i < _args.getLoadSessions(); ++i)
+  {
+    std::unique_ptr<Session> session{new Session};
+    session->model = i % _nnpackages.size();
+    prepareSession(*session, _nnpackages[session->model]);
+    for (int w = 0; w < _args.getWarmupRuns(); ++w)
+      NNPR_ENSURE_STATUS(nnfw_run(session->session));
+    _sessions.emplace_back(std::move(session));
+  }
+  if (mp)
+    mp->end(benchmark::Phase::PREPARE);
+
+  const bool open_loop = _args.getLoadQps() > 0.0;
+  const auto start = Clock::now() + kStartDelay;
+  const auto end = start + std::chrono::duration_cast<Clock::duration>(
+                               std::chrono::duration<double>(_args.getLoadDuration()));
+
+  if (mp)
+    mp->start(benchmark::Phase::EXECUTE);
+  std::vector<std::thread> threads;
+  for (auto &session : _sessions)
+  {
+    Session *s = session.get();
+    if (open_loop)
+      threads.emplace_back([this, s, start, end]() { runOpenLoop(*s, start, end); });
+    else
+      threads.emplace_back([this, s, start, end]() { runClosedLoop(*s, start, end); });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  const std::chrono::duration<double> elapsed = Clock::now() - start;
+  if (mp)
+    mp->end(benchmark::Phase::EXECUTE);
+
+  // Summaries of each model, and all of them at last
+  std::vector<Summary> summaries(_nnpackages.size() + 1);
+  for (uint32_t i = 0; i < _nnpackages.size(); ++i)
+  {
+    auto path = _nnpackages[i];
+    while (path.size() > 1 && path.back() == '/')
+      path.pop_back();
+    summaries[i].model = path.substr(path.find_last_of('/') + 1);
+  }
+  summaries.back().model = "all";
+  for (const auto &session : _sessions)
+  {
+    for (auto *summary : {&summaries[session->model], &summaries.back()})
+    {
+      summary->sessions += 1;
+      summary->latency.merge(session->latency);
+      summary->errors += session->errors;
+    }
+  }
+  for (auto &summary : summaries)
+    summary.throughput = summary.latency.count() / elapsed.count();
+
+  uint32_t rss = 0, hwm = 0;
+  if (mp)
+  {
+    rss = mp->getRssMap().at(benchmark::Phase::EXECUTE);
+    hwm = mp->getHwmMap().at(benchmark::Phase::EXECUTE);
+  }
+  report(summaries, rss, hwm);
+
+  return 0;
+}
+
+void LoadGenerator::report(const std::vector<Summary> &summaries, uint32_t rss, uint32_t hwm) const
+{
+  const double qps = _args.getLoadQps();
+
+  // to stdout
+  std::cout << "===================================" << std::endl;
+  std::cout << "LOAD " << _args.getLoadSessions() << " sessions, "
+            << (qps > 0.0 ? "open-loop " + std::to_string(qps) + " qps per model"
+                          : std::string{"closed-loop"})
+            << ", " << _args.getLoadDuration() << " s" << std::endl;
+  for (const auto &summary : summaries)
+  {
+    const auto &latency = summary.latency;
+    std::cout << "===================================" << std::endl;
+    std::cout << summary.model << " (" << summary.sessions << " sessions)" << std::endl;
+    std::cout << "- Requests:   " << latency.count() << " (" << summary.errors << " errors)"
+              << std::endl;
+    std::cout << "- Throughput: " << summary.throughput << " req/s" << std::endl;
+    std::cout << "- Min:   " << toMillis(latency.min()) << " ms" << std::endl;
+    std::cout << "- Mean:  " << latency.mean() / 1e3 << " ms" << std::endl;
+    std::cout << "- P50:   " << toMillis(latency.percentile(50.0)) << " ms" << std::endl;
+    std::cout << "- P90:   " << toMillis(latency.percentile(90.0)) << " ms" << std::endl;
+    std::cout << "- P99:   " << toMillis(latency.percentile(99.0)) << " ms" << std::endl;
+    std::cout << "- P99.9: " << toMillis(latency.percentile(99.9)) << " ms" << std::endl;
+    std::cout << "- Max:   " << toMillis(latency.max()) << " ms" << std::endl;
+  }
+  std::cout << "===================================" << std::endl;
+  if (_args.getMemoryPoll())
+  {
+    std::cout << "RSS " << rss << " kb, HWM " << hwm << " kb" << std::endl;
+    std::cout << "===================================" << std::endl;
+  }
+
+  const auto &report = _args.getLoadReport();
+  if (report.empty())
+    return;
+
+  // to csv
+  {
+    benchmark::CsvWriter writer(report + ".csv",
+                                {"Model", "Sessions", "QPS", "Requests", "Errors", "Throughput",
+                                 "Min", "Mean", "P50", "P90", "P99", "P99.9", "Max", "RSS", "HWM"});
+    for (const auto &summary : summaries)
+    {
+      const auto &latency = summary.latency;
+      writer << summary.model << summary.sessions << qps
+             << static_cast<uint32_t>(latency.count()) << static_cast<uint32_t>(summary.errors)
+             << summary.throughput << toMillis(latency.min()) << latency.mean() / 1e3
+             << toMillis(latency.percentile(50.0)) << toMillis(latency.percentile(90.0))
+             << toMillis(latency.percentile(99.0)) << toMillis(latency.percentile(99.9))
+             << toMillis(latency.max()) << rss << hwm;
+    }
+  }
+
+  // to json
+  std::ofstream ofs(report + ".json");
+  if (!ofs.is_open())
+  {
+    std::cerr << "Writing to " << report << ".json is failed" << std::endl;
+    return;
+  }
+  ofs << "{\"sessions\": " << _args.getLoadSessions() << ", \"qps\": " << qps
+      << ", \"duration\": " << _args.getLoadDuration() << ", \"rss\": " << rss
+      << ", \"hwm\": " << hwm << ", \"models\": [";
+  for (uint32_t i = 0; i < summaries.size(); ++i)
+  {
+    const auto &summary = summaries[i];
+    const auto &latency = summary.latency;
+    ofs << (i == 0 ? "" : ", ") << "{\"model\": \"" << summary.model
+        << "\", \"sessions\": " << summary.sessions << ", \"requests\": " << latency.count()
+        << ", \"errors\": " << summary.errors << ", \"throughput\": " << summary.throughput
+        << ", \"latency_ms\": {\"min\": " << toMillis(latency.min())
+        << ", \"mean\": " << latency.mean() / 1e3
+        << ", \"p50\": " << toMillis(latency.percentile(50.0))
+        << ", \"p90\": " << toMillis(latency.percentile(90.0))
+        << ", \"p99\": " << toMillis(latency.percentile(99.0))
+        << ", \"p999\": " << toMillis(latency.percentile(99.9))
+        << ", \"max\": " << toMillis(latency.max()) << "}}";
+  }
+  ofs << "]}" << std::endl;
+}
+
+} // end of namespace nnpkg_run
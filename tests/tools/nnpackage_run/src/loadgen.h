@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNPACKAGE_RUN_LOADGEN_H__
+#define __NNPACKAGE_RUN_LOADGEN_H__
+
+#include "allocation.h"
+#include "args.h"
+#include "benchmark/Histogram.h"
+#include "nnfw.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace nnpkg_run
+{
+
+// Run concurrent sessions of one or more nnpackages and report their latency distribution
+//
+// Each session runs on its own thread. In closed-loop load, a session runs requests back to back.
+// In open-loop load, requests of a model arrive at a fixed rate and are served by any idle session
+// of the model in order of arrival. Latency is measured from the arrival, so it includes queueing.
+class LoadGenerator
+{
+public:
+  using Configurator = std::function<void(nnfw_session *)>;
+
+  // configure is called for each session right after it is created, e.g. to select backends
+  LoadGenerator(const Args &args, const Configurator &configure);
+  ~LoadGenerator();
+
+  // Prepare sessions, run load and write the report. Returns exit code.
+  int run();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Session
+  {
+    nnfw_session *session = nullptr;
+    uint32_t model = 0;
+    std::vector<Allocation> inputs;
+    std::vector<Allocation> outputs;
+    benchmark::Histogram latency; // microseconds
+    uint64_t errors = 0;
+  };
+
+  struct Summary
+  {
+    std::string model;
+    uint32_t sessions = 0;
+    benchmark::Histogram latency;
+    uint64_t errors = 0;
+    double throughput = 0.0; // requests per second
+  };
+
+  void prepareSession(Session &session, const std::string &nnpackage);
+  void runClosedLoop(Session &session, Clock::time_point start, Clock::time_point end);
+  void runOpenLoop(Session &session, Clock::time_point start, Clock::time_point end);
+  void report(const std::vector<Summary> &summaries, uint32_t rss, uint32_t hwm) const;
+
+private:
+  const Args &_args;
+  Configurator _configure;
+  std::vector<std::string> _nnpackages;
+  std::vector<std::unique_ptr<Session>> _sessions;
+  std::unique_ptr<std::atomic<uint64_t>[]> _arrivals; // Next arrival of each model
+};
+
+} // end of namespace nnpkg_run
+
+#endif // __NNPACKAGE_RUN_LOADGEN_H__
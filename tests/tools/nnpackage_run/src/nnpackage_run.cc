@@ -18,9 +18,11 @@
 #include "args.h"
 #include "benchmark.h"
 #include "h5formatter.h"
+#include "loadgen.h"
 #include "tflite/Diff.h"
 #include "nnfw.h"
 #include "nnfw_util.h"
+#include "randomgen.h"
 #include "nnfw_debug.h"
 #ifdef RUY_PROFILER
 #include "ruy/profiler/profiler.h"
@@ -34,16 +36,6 @@
 #include <unordered_map>
 #include <vector>
 
-namespace nnpkg_run
-{
-
-template <class T> void randomData(RandomGenerator &randgen, void *data, uint64_t size)
-{
-  for (uint64_t i = 0; i < size; i++)
-    reinterpret_cast<T *>(data)[i] = randgen.generate<T>();
-}
-}
-
 static const char *default_backend_cand = "acl_cl";
 
 NNFW_STATUS resolve_op_backend(nnfw_session *session)
@@ -86,6 +78,17 @@ int main(const int argc, char **argv)
   ruy::profiler::ScopeProfile ruy_profile;
 #endif
 
+  if (args.getLoadSessions() > 0)
+  {
+    LoadGenerator load_generator(args, [](nnfw_session *session) {
+      char *available_backends = std::getenv("BACKENDS");
+      if (available_backends)
+        NNPR_ENSURE_STATUS(nnfw_set_available_backends(session, available_backends));
+      NNPR_ENSURE_STATUS(resolve_op_backend(session));
+    });
+    return load_generator.run();
+  }
+
   std::unique_ptr<benchmark::MemoryPoller> mp{nullptr};
   if (args.getMemoryPoll())
   {
@@ -128,7 +131,7 @@ int main(const int argc, char **argv)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
-      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_UINT8)
+      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED)
       {
         std::cerr << "E: not supported input type" << std::endl;
         exit(-1);
@@ -144,7 +147,7 @@ int main(const int argc, char **argv)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
-      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_UINT8)
+      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED)
       {
         std::cerr << "E: not supported output type" << std::endl;
         exit(-1);
@@ -169,46 +172,10 @@ int main(const int argc, char **argv)
   // prepare input
   std::vector<Allocation> inputs(num_inputs);
 
-  auto generateInputs = [session, num_inputs, &inputs]() {
-    // generate random data
-    const int seed = 1;
-    RandomGenerator randgen{seed, 0.0f, 2.0f};
-    for (uint32_t i = 0; i < num_inputs; ++i)
-    {
-      nnfw_tensorinfo ti;
-      NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
-      auto input_size_in_bytes = bufsize_for(&ti);
-      inputs[i].alloc(input_size_in_bytes);
-      switch (ti.dtype)
-      {
-        case NNFW_TYPE_TENSOR_FLOAT32:
-          randomData<float>(randgen, inputs[i].data(), num_elems(&ti));
-          break;
-        case NNFW_TYPE_TENSOR_QUANT8_ASYMM:
-          randomData<uint8_t>(randgen, inputs[i].data(), num_elems(&ti));
-          break;
-        case NNFW_TYPE_TENSOR_BOOL:
-          randomData<bool>(randgen, inputs[i].data(), num_elems(&ti));
-          break;
-        case NNFW_TYPE_TENSOR_UINT8:
-          randomData<uint8_t>(randgen, inputs[i].data(), num_elems(&ti));
-          break;
-        case NNFW_TYPE_TENSOR_INT32:
-          randomData<int32_t>(randgen, inputs[i].data(), num_elems(&ti));
-          break;
-        default:
-          std::cerr << "Not supported input type" << std::endl;
-          std::exit(-1);
-      }
-      NNPR_ENSURE_STATUS(
-          nnfw_set_input(session, i, ti.dtype, inputs[i].data(), input_size_in_bytes));
-      NNPR_ENSURE_STATUS(nnfw_set_input_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
-    }
-  };
   if (!args.getLoadFilename().empty())
     H5Formatter(session).loadInputs(args.getLoadFilename(), inputs);
   else
-    generateInputs();
+    generateRandomInputs(session, inputs);
 
   // prepare output
 
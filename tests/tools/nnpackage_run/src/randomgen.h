@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNPACKAGE_RUN_RANDOMGEN_H__
+#define __NNPACKAGE_RUN_RANDOMGEN_H__
+
+#include "allocation.h"
+#include "nnfw.h"
+
+#include <vector>
+
+namespace nnpkg_run
+{
+// Fill inputs with random data and set them to the session
+void generateRandomInputs(nnfw_session *session, std::vector<Allocation> &inputs);
+} // end of namespace nnpkg_run
+
+#endif // __NNPACKAGE_RUN_RANDOMGEN_H__